@@ -1,4 +1,4 @@
-foreach (example jbod open_seek_write)
+foreach (example eviction_policies jbod open_seek_write)
   if(NOT DEFINED _${example}_sources)
     set(_${example}_sources ${CMAKE_HOME_DIRECTORY}/examples/${example}.cpp)
   endif()
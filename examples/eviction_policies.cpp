@@ -0,0 +1,161 @@
+/* Copyright (c) 2024-2026. The FSMOD Team. All rights reserved.          */
+
+/* This program is free software; you can redistribute it and/or modify it
+ * under the terms of the license (GNU LGPL) which comes with this package. */
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include <simgrid/s4u/NetZone.hpp>
+#include <simgrid/s4u/Engine.hpp>
+#include <simgrid/s4u/Actor.hpp>
+
+#include "fsmod.hpp"
+
+XBT_LOG_NEW_DEFAULT_CATEGORY(eviction_policies, "Eviction Policies Benchmark");
+
+namespace sg4 = simgrid::s4u;
+namespace sgfs = simgrid::fsmod;
+
+constexpr int NUM_FILES = 1000;
+constexpr int NUM_REQUESTS = 10000;
+constexpr double ZIPF_EXPONENT = 0.9;
+constexpr int SCAN_PERIOD = 1000;
+constexpr int SCAN_LENGTH = 100;
+
+// A request for a file, which is a hit if the file is cached, and a miss that fetches it in the cache otherwise
+struct Request {
+    std::string file_name;
+    sg_size_t size;
+};
+
+// Files whose popularity follows a Zipf law, and whose sizes span four orders of magnitude (10kB to 100MB)
+std::vector<Request> generate_zipf_workload(std::mt19937& rng, const std::vector<sg_size_t>& sizes) {
+    std::vector<double> cdf(sizes.size());
+    double total = 0;
+    for (size_t rank = 0; rank < sizes.size(); rank++) {
+        total += 1.0 / std::pow(static_cast<double>(rank + 1), ZIPF_EXPONENT);
+        cdf[rank] = total;
+    }
+    std::uniform_real_distribution<double> uniform(0, total);
+    std::vector<Request> workload;
+    for (int i = 0; i < NUM_REQUESTS; i++) {
+        auto rank = static_cast<size_t>(std::lower_bound(cdf.begin(), cdf.end(), uniform(rng)) - cdf.begin());
+        rank = std::min(rank, sizes.size() - 1);
+        workload.push_back({"file_" + std::to_string(rank), sizes[rank]});
+    }
+    return workload;
+}
+
+// The same Zipf workload, interrupted periodically by a scan of files that are used once
+std::vector<Request> generate_scan_mixed_workload(const std::vector<Request>& zipf_workload,
+                                                  const std::vector<sg_size_t>& sizes) {
+    std::vector<Request> workload;
+    int num_scanned_files = 0;
+    for (size_t i = 0; i < zipf_workload.size(); i++) {
+        workload.push_back(zipf_workload[i]);
+        if ((i + 1) % SCAN_PERIOD != 0)
+            continue;
+        for (int j = 0; j < SCAN_LENGTH; j++, num_scanned_files++)
+            workload.push_back({"scan_" + std::to_string(num_scanned_files), sizes[num_scanned_files % sizes.size()]});
+    }
+    return workload;
+}
+
+class WorkloadActor {
+    std::shared_ptr<sgfs::FileSystem> fs_;
+    std::string mount_point_;
+    std::string policy_name_;
+    std::string workload_name_;
+    std::vector<Request> workload_;
+
+public:
+    explicit WorkloadActor(std::shared_ptr<sgfs::FileSystem> fs,
+                           std::string mount_point,
+                           std::string policy_name,
+                           std::string workload_name,
+                           std::vector<Request> workload) :
+            fs_(std::move(fs)),
+            mount_point_(std::move(mount_point)),
+            policy_name_(std::move(policy_name)),
+            workload_name_(std::move(workload_name)),
+            workload_(std::move(workload))
+    {}
+
+    void operator()() {
+        unsigned long num_hits = 0;
+        double num_hit_bytes = 0;
+        double num_bytes = 0;
+        for (const auto& request : workload_) {
+            auto path = mount_point_ + request.file_name;
+            num_bytes += static_cast<double>(request.size);
+            if (fs_->file_exists(path)) {
+                num_hits++;
+                num_hit_bytes += static_cast<double>(request.size);
+                auto file = fs_->open(path, "r");
+                file->read(request.size);
+                file->close();
+            } else {
+                fs_->create_file(path, request.size);
+            }
+        }
+        XBT_INFO("%-10s %-12s hit ratio: %.3f   byte hit ratio: %.3f   time: %.2fs", policy_name_.c_str(),
+                 workload_name_.c_str(), static_cast<double>(num_hits) / static_cast<double>(workload_.size()),
+                 num_hit_bytes / num_bytes, sg4::Engine::get_clock());
+    }
+};
+
+int main(int argc, char **argv) {
+    sg4::Engine engine(&argc, argv);
+
+    XBT_INFO("Generating the workloads...");
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<double> uniform(0, 4);
+    std::vector<sg_size_t> sizes(NUM_FILES);
+    for (auto& size : sizes)
+        size = static_cast<sg_size_t>(10000 * std::pow(10, uniform(rng)));
+    auto zipf_workload = generate_zipf_workload(rng, sizes);
+    std::vector<std::pair<std::string, std::vector<Request>>> workloads = {
+        {"Zipf", zipf_workload},
+        {"Zipf+scans", generate_scan_mixed_workload(zipf_workload, sizes)}};
+
+    std::vector<std::pair<std::string, std::function<std::shared_ptr<sgfs::EvictionPolicy>()>>> policies = {
+        {"FIFO", []() { return std::make_shared<sgfs::FIFOEvictionPolicy>(); }},
+        {"LRU", []() { return std::make_shared<sgfs::LRUEvictionPolicy>(); }},
+        {"ARC", []() { return std::make_shared<sgfs::ARCEvictionPolicy>(); }},
+        {"2Q", []() { return std::make_shared<sgfs::TwoQEvictionPolicy>(); }},
+        {"LFU-DA", []() { return std::make_shared<sgfs::LFUEvictionPolicy>(); }},
+        {"S3-FIFO", []() { return std::make_shared<sgfs::S3FIFOEvictionPolicy>(); }},
+        {"GDSF", []() { return std::make_shared<sgfs::GDSFEvictionPolicy>(); }}};
+
+    XBT_INFO("Creating a platform with one host per run, each having a 1GBps disk...");
+    auto *my_zone = engine.get_netzone_root()->add_netzone_full("zone");
+    std::vector<sg4::Host*> hosts;
+    std::vector<sg4::Disk*> disks;
+    for (size_t i = 0; i < workloads.size() * policies.size(); i++) {
+        auto host = my_zone->add_host("host_" + std::to_string(i), "100Gf");
+        disks.push_back(host->add_disk("disk_" + std::to_string(i), "1GBps", "1GBps"));
+        hosts.push_back(host);
+    }
+    my_zone->seal();
+
+    XBT_INFO("Running each workload with each policy on its own 1GB cache partition...");
+    auto fs = sgfs::FileSystem::create("my_fs");
+    size_t run = 0;
+    for (const auto& [workload_name, workload] : workloads) {
+        for (const auto& [policy_name, make_policy] : policies) {
+            auto storage = sgfs::OneDiskStorage::create("storage_" + std::to_string(run), disks[run]);
+            auto mount_point = "/dev/cache_" + std::to_string(run) + "/";
+            fs->mount_partition(mount_point, storage, "1GB", make_policy());
+            hosts[run]->add_actor("WorkloadActor", WorkloadActor(fs, mount_point, policy_name, workload_name, workload));
+            run++;
+        }
+    }
+
+    XBT_INFO("Launching the simulation...");
+    engine.run();
+}
@@ -6,17 +6,30 @@
 #ifndef FSMOD_FSMOD_HPP
 #define FSMOD_FSMOD_HPP
 
+#include <fsmod/AdmissionPolicy.hpp>
+#include <fsmod/EvictionPolicy.hpp>
 #include <fsmod/FileSystem.hpp>
 #include <fsmod/File.hpp>
 #include <fsmod/FileMetadata.hpp>
 #include <fsmod/FileStat.hpp>
 #include <fsmod/FileSystemException.hpp>
+#include <fsmod/IOScheduler.hpp>
+#include <fsmod/MetadataService.hpp>
 #include <fsmod/Partition.hpp>
 #include <fsmod/PartitionFIFOCaching.hpp>
 #include <fsmod/PartitionLRUCaching.hpp>
+#include <fsmod/PartitionTiered.hpp>
+#include <fsmod/QoSPolicy.hpp>
 #include <fsmod/Storage.hpp>
+#include <fsmod/CachedStorage.hpp>
+#include <fsmod/ClientCache.hpp>
+#include <fsmod/HDDStorage.hpp>
 #include <fsmod/JBODStorage.hpp>
+#include <fsmod/ObjectStorage.hpp>
 #include <fsmod/OneDiskStorage.hpp>
 #include <fsmod/OneRemoteDiskStorage.hpp>
+#include <fsmod/ReplicatedStorage.hpp>
+#include <fsmod/SSDStorage.hpp>
+#include <fsmod/StripedStorage.hpp>
 
 #endif //FSMOD_FSMOD_HPP
@@ -0,0 +1,125 @@
+/* Copyright (c) 2024-2026. The FSMOD Team. All rights reserved.          */
+
+/* This program is free software; you can redistribute it and/or modify it
+ * under the terms of the license (GNU LGPL) which comes with this package. */
+
+#ifndef FSMOD_ADMISSIONPOLICY_HPP
+#define FSMOD_ADMISSIONPOLICY_HPP
+
+#include <simgrid/forward.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "EvictionPolicy.hpp"
+#include "FileMetadata.hpp"
+
+namespace simgrid::fsmod {
+
+    /**
+     * @brief An abstract class that decides which files a read-through partition caches. The partition notifies its
+     *        policy of each access to a file of its origin, and asks it whether a file it does not hold should be
+     *        fetched, given the files that would be evicted to make room for it. A file that is not admitted is
+     *        served directly by the origin, and thus displaces no cached file
+     */
+    class XBT_PUBLIC AdmissionPolicy {
+        friend class Partition;
+
+        sg_size_t partition_size_ = 0;
+
+    public:
+        virtual ~AdmissionPolicy() = default;
+
+        /**
+         * @brief Retrieve the size of the partition the policy was set on, which some policies use to size
+         *        their history
+         * @return A number of bytes (0 if the policy has not been set on a partition yet)
+         */
+        [[nodiscard]] sg_size_t get_partition_size() const { return partition_size_; }
+
+        /**
+         * @brief Notify the policy that a file has been accessed, whether the partition holds it or not
+         * @param path: the path of the file on the partition (e.g., "/dir/foo.txt")
+         */
+        virtual void on_access(const std::string &path) {}
+        /**
+         * @brief Decide whether a file that the partition does not hold should be cached
+         * @param path: the path of the file on the partition
+         * @param size: the size of the file
+         * @param victims: the files that would be evicted to make room for the file, in eviction order (empty if
+         *        the partition has enough free space)
+         * @return true if the file should be fetched and cached, false if it should be served by the origin
+         */
+        [[nodiscard]] virtual bool admit(const std::string &path, sg_size_t size,
+                                         const std::vector<const FileMetadata*> &victims) = 0;
+    };
+
+    /**
+     * @brief A policy that only admits files up to a maximum size, so that a few huge files cannot flush the
+     *        partition
+     */
+    class XBT_PUBLIC MaxSizeAdmissionPolicy : public AdmissionPolicy {
+    public:
+        explicit MaxSizeAdmissionPolicy(sg_size_t max_size);
+
+        /**
+         * @brief Retrieve the size of the largest files the policy admits
+         * @return A number of bytes
+         */
+        [[nodiscard]] sg_size_t get_max_size() const { return max_size_; }
+        bool admit(const std::string &path, sg_size_t size, const std::vector<const FileMetadata*> &victims) override {
+            return size <= max_size_;
+        }
+
+    private:
+        sg_size_t max_size_;
+    };
+
+    /**
+     * @brief A policy that only admits a file on its second miss. The files that missed once are remembered in a
+     *        ghost list holding as many bytes as the partition, so that files used only once, as in a scan, are
+     *        never cached
+     */
+    class XBT_PUBLIC SecondHitAdmissionPolicy : public AdmissionPolicy {
+    public:
+        bool admit(const std::string &path, sg_size_t size, const std::vector<const FileMetadata*> &victims) override;
+
+    private:
+        GhostList ghosts_;
+    };
+
+    /**
+     * @brief A policy that implements TinyLFU admission. The frequency of accesses to files is estimated by a
+     *        count-min sketch of 4-bit counters, which are halved once every ten accesses per counter so that old
+     *        accesses fade out. A file is admitted if it is accessed more often than each of the files it would
+     *        evict, and always when it fits in the free space
+     */
+    class XBT_PUBLIC TinyLFUAdmissionPolicy : public AdmissionPolicy {
+    public:
+        explicit TinyLFUAdmissionPolicy(size_t num_counters = 4096);
+
+        /**
+         * @brief Estimate the number of recent accesses to a file
+         * @param path: the path of the file on the partition
+         * @return A number of accesses, which may exceed the actual one, and is at most 15
+         */
+        [[nodiscard]] unsigned int get_estimated_frequency(const std::string &path) const;
+        void on_access(const std::string &path) override;
+        bool admit(const std::string &path, sg_size_t size, const std::vector<const FileMetadata*> &victims) override;
+
+    private:
+        static constexpr int NUM_ROWS = 4;
+        static constexpr std::uint8_t MAX_COUNT = 15;
+
+        size_t num_counters_;
+        std::vector<std::uint8_t> counters_;
+        unsigned long num_accesses_ = 0;
+        unsigned long sample_size_;
+
+        [[nodiscard]] size_t get_index(const std::string &path, int row) const;
+    };
+
+} // namespace simgrid::fsmod
+
+#endif //FSMOD_ADMISSIONPOLICY_HPP
@@ -0,0 +1,112 @@
+/* Copyright (c) 2024-2026. The FSMOD Team. All rights reserved.          */
+
+/* This program is free software; you can redistribute it and/or modify it
+ * under the terms of the license (GNU LGPL) which comes with this package. */
+
+#ifndef FSMOD_CACHEDSTORAGE_HPP
+#define FSMOD_CACHEDSTORAGE_HPP
+
+#include <list>
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "Storage.hpp"
+
+namespace simgrid::fsmod {
+
+    /**
+     * @brief A class that implements a storage whose blocks are cached on a (fast) cache disk, in front of another
+     *        (slow) storage. Read hits are served by the cache disk, while read misses are served by the backing
+     *        storage and then inserted in the cache. Blocks are evicted in Least-Recently-Used order. Requests larger
+     *        than the cache bypass it
+     */
+    class XBT_PUBLIC CachedStorage : public Storage, public std::enable_shared_from_this<CachedStorage> {
+    public:
+        /**
+         * @brief An enum that defines how writes are handled by the cache
+         */
+        enum class WritePolicy {
+            /** @brief Writes go to both the cache disk and the backing storage, and complete when both are done */
+            WRITE_THROUGH,
+            /** @brief Writes go to the cache disk only. Dirty blocks are written to the backing storage when they are
+             * evicted or flushed */
+            WRITE_BACK
+        };
+
+        CachedStorage(const std::string &name, std::shared_ptr<Storage> backing_storage, s4u::Disk *cache_disk,
+                      sg_size_t cache_size, sg_size_t block_size, WritePolicy write_policy);
+        ~CachedStorage() override = default;
+        static std::shared_ptr<CachedStorage> create(const std::string &name, std::shared_ptr<Storage> backing_storage,
+                                                     s4u::Disk *cache_disk, sg_size_t cache_size,
+                                                     sg_size_t block_size = 65536,
+                                                     WritePolicy write_policy = WritePolicy::WRITE_THROUGH);
+
+        [[nodiscard]] std::shared_ptr<Storage> get_backing_storage() const { return backing_storage_; }
+        [[nodiscard]] s4u::Disk* get_cache_disk() const { return cache_disk_; }
+        [[nodiscard]] sg_size_t get_cache_size() const { return num_cache_blocks_ * block_size_; }
+        [[nodiscard]] sg_size_t get_block_size() const { return block_size_; }
+        [[nodiscard]] WritePolicy get_write_policy() const { return write_policy_; }
+
+        [[nodiscard]] unsigned long get_num_cached_blocks() const { return blocks_.size(); }
+        [[nodiscard]] unsigned long get_num_dirty_blocks() const { return num_dirty_blocks_; }
+        [[nodiscard]] unsigned long get_num_read_hits() const { return num_read_hits_; }
+        [[nodiscard]] unsigned long get_num_read_misses() const { return num_read_misses_; }
+        [[nodiscard]] double get_read_hit_rate() const;
+        [[nodiscard]] unsigned long get_num_write_hits() const { return num_write_hits_; }
+        [[nodiscard]] unsigned long get_num_evicted_blocks() const { return num_evicted_blocks_; }
+        [[nodiscard]] unsigned long get_num_flushed_blocks() const { return num_flushed_blocks_; }
+
+        void flush();
+        void set_flush_interval(double interval);
+        [[nodiscard]] double get_flush_interval() const { return flush_interval_; }
+
+    protected:
+        s4u::IoPtr read_async(const IOContext& context, sg_offset_t offset, sg_size_t size) override;
+        void read(const IOContext& context, sg_offset_t offset, sg_size_t size) override;
+        s4u::IoPtr write_async(const IOContext& context, sg_offset_t offset, sg_size_t size,
+                               bool detached = false) override;
+        void write(const IOContext& context, sg_offset_t offset, sg_size_t size) override;
+        void on_file_deletion(unsigned long file_id) override;
+
+    private:
+        // A block is identified by a file and its index in that file
+        using BlockId = std::pair<unsigned long, sg_size_t>;
+        struct Block {
+            std::list<BlockId>::iterator lru_position;
+            bool dirty = false;
+        };
+
+        std::shared_ptr<Storage> backing_storage_;
+        s4u::Disk* cache_disk_;
+        sg_size_t block_size_;
+        unsigned long num_cache_blocks_;
+        WritePolicy write_policy_;
+
+        std::map<BlockId, Block> blocks_;
+        std::list<BlockId> lru_list_; // Most recently used first
+        unsigned long num_dirty_blocks_ = 0;
+
+        unsigned long num_read_hits_ = 0;
+        unsigned long num_read_misses_ = 0;
+        unsigned long num_write_hits_ = 0;
+        unsigned long num_evicted_blocks_ = 0;
+        unsigned long num_flushed_blocks_ = 0;
+
+        double flush_interval_ = 0;
+        s4u::ActorPtr flusher_ = nullptr;
+
+        [[nodiscard]] std::vector<std::pair<sg_size_t, sg_size_t>> split_in_blocks(sg_offset_t offset,
+                                                                                   sg_size_t size) const;
+        // For each file, the offset of the first dirty block to write back and the number of bytes to write
+        using WriteBacks = std::map<unsigned long, std::pair<sg_offset_t, sg_size_t>>;
+        void insert_block(const BlockId& block_id, bool dirty, WriteBacks& write_backs);
+        void touch_block(Block& block);
+        void add_write_back(const BlockId& block_id, WriteBacks& write_backs);
+        s4u::IoPtr create_cache_disk_io(sg_size_t size, s4u::Io::OpType op_type, s4u::Host* client_host) const;
+        std::vector<s4u::IoPtr> start_write_backs(const WriteBacks& write_backs, bool detached);
+    };
+} // namespace simgrid::fsmod
+
+#endif //FSMOD_CACHEDSTORAGE_HPP
@@ -0,0 +1,92 @@
+/* Copyright (c) 2024-2026. The FSMOD Team. All rights reserved.          */
+
+/* This program is free software; you can redistribute it and/or modify it
+ * under the terms of the license (GNU LGPL) which comes with this package. */
+
+#ifndef FSMOD_CLIENTCACHE_HPP
+#define FSMOD_CLIENTCACHE_HPP
+
+#include <simgrid/forward.h>
+#include <simgrid/s4u/Disk.hpp>
+#include <simgrid/s4u/Host.hpp>
+#include <simgrid/s4u/Io.hpp>
+
+#include <list>
+#include <map>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+
+namespace simgrid::fsmod {
+
+    class FileMetadata;
+    class Storage;
+
+    /**
+     * @brief A class that implements an NFS-like client cache, which caches on a client host the blocks of the files
+     *        that actors on that host read from (or write to) storages attached to other hosts. Cached blocks are
+     *        served by the client's memory, or by a local cache disk. The cache follows close-to-open consistency:
+     *        opening a file revalidates its attributes with the server, and its cached blocks are invalidated if
+     *        another client has modified it. While a file is open, its attributes are trusted for a configurable
+     *        timeout, after which a read revalidates them again. Blocks are evicted in Least-Recently-Used order
+     */
+    class XBT_PUBLIC ClientCache {
+    public:
+        ClientCache(s4u::Host *host, sg_size_t cache_size, sg_size_t block_size, s4u::Disk *cache_disk);
+        static std::shared_ptr<ClientCache> create(s4u::Host *host, sg_size_t cache_size,
+                                                   sg_size_t block_size = 65536, s4u::Disk *cache_disk = nullptr);
+
+        [[nodiscard]] s4u::Host* get_host() const { return host_; }
+        [[nodiscard]] s4u::Disk* get_cache_disk() const { return cache_disk_; }
+        [[nodiscard]] sg_size_t get_cache_size() const { return num_cache_blocks_ * block_size_; }
+        [[nodiscard]] sg_size_t get_block_size() const { return block_size_; }
+
+        void set_attribute_cache_timeout(double timeout);
+        [[nodiscard]] double get_attribute_cache_timeout() const { return attribute_cache_timeout_; }
+
+        [[nodiscard]] unsigned long get_num_cached_blocks() const { return blocks_.size(); }
+        [[nodiscard]] unsigned long get_num_read_hits() const { return num_read_hits_; }
+        [[nodiscard]] unsigned long get_num_read_misses() const { return num_read_misses_; }
+        [[nodiscard]] unsigned long get_num_revalidations() const { return num_revalidations_; }
+        [[nodiscard]] unsigned long get_num_invalidations() const { return num_invalidations_; }
+
+    private:
+        friend class File;
+        friend class FileSystem;
+
+        // A block is identified by a file and its index in that file
+        using BlockId = std::pair<unsigned long, sg_size_t>;
+        // What the client knows about a file: the modification date its cached blocks correspond to, and the date
+        // until which this knowledge is trusted without asking the server
+        struct FileAttributes {
+            double modification_date;
+            double expiration_date;
+        };
+
+        s4u::Host* host_;
+        sg_size_t block_size_;
+        unsigned long num_cache_blocks_;
+        s4u::Disk* cache_disk_;
+        double attribute_cache_timeout_ = 3.0;
+
+        std::map<BlockId, std::list<BlockId>::iterator> blocks_;
+        std::list<BlockId> lru_list_; // Most recently used first
+        std::unordered_map<unsigned long, FileAttributes> attributes_;
+
+        unsigned long num_read_hits_ = 0;
+        unsigned long num_read_misses_ = 0;
+        unsigned long num_revalidations_ = 0;
+        unsigned long num_invalidations_ = 0;
+
+        [[nodiscard]] bool caches(const std::shared_ptr<Storage>& storage) const;
+        void revalidate(const FileMetadata* metadata, const std::shared_ptr<Storage>& storage);
+        void invalidate(unsigned long file_id);
+        void insert_block(const BlockId& block_id);
+        s4u::IoPtr read_async(const FileMetadata* metadata, const std::shared_ptr<Storage>& storage,
+                              sg_offset_t offset, sg_size_t size);
+        void notify_write(const FileMetadata* metadata, double previous_modification_date, sg_offset_t offset,
+                          sg_size_t size);
+    };
+} // namespace simgrid::fsmod
+
+#endif //FSMOD_CLIENTCACHE_HPP
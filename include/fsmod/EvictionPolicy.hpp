@@ -0,0 +1,360 @@
+/* Copyright (c) 2024-2026. The FSMOD Team. All rights reserved.          */
+
+/* This program is free software; you can redistribute it and/or modify it
+ * under the terms of the license (GNU LGPL) which comes with this package. */
+
+#ifndef FSMOD_EVICTIONPOLICY_HPP
+#define FSMOD_EVICTIONPOLICY_HPP
+
+#include <simgrid/forward.h>
+
+#include <list>
+#include <map>
+#include <set>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "FileMetadata.hpp"
+
+namespace simgrid::fsmod {
+
+    /**
+     * @brief An abstract class that decides which files a partition evicts when it runs out of space. The partition
+     *        notifies its policy of what happens to its files, and asks it for victims when it needs space. A file
+     *        is pinned, and can never be evicted, while it is open or not evictable
+     */
+    class XBT_PUBLIC EvictionPolicy {
+        friend class Partition;
+
+        sg_size_t partition_size_ = 0;
+
+    public:
+        virtual ~EvictionPolicy() = default;
+
+        /**
+         * @brief Retrieve the size of the partition the policy was mounted with, which some policies use to size
+         *        their queues
+         * @return A number of bytes (0 if the policy has not been mounted yet)
+         */
+        [[nodiscard]] sg_size_t get_partition_size() const { return partition_size_; }
+
+        /**
+         * @brief Notify the policy that a file has been created on, or moved to, the partition
+         * @param file_metadata: the file's metadata
+         */
+        virtual void on_create(const FileMetadata *file_metadata) = 0;
+        /**
+         * @brief Notify the policy that a file has been accessed (created, opened, read, or written)
+         * @param file_metadata: the file's metadata
+         */
+        virtual void on_access(const FileMetadata *file_metadata) = 0;
+        /**
+         * @brief Notify the policy that a file has been deleted from, or moved out of, the partition
+         * @param file_metadata: the file's metadata
+         */
+        virtual void on_delete(const FileMetadata *file_metadata) = 0;
+        /**
+         * @brief Notify the policy that a file has become pinned or unpinned, as given by its is_pinned() method
+         * @param file_metadata: the file's metadata
+         */
+        virtual void on_pin_change(const FileMetadata *file_metadata) {}
+        /**
+         * @brief Select the files to evict to free some space
+         * @param num_bytes: the number of bytes to free
+         * @return Unpinned files, in eviction order, whose reclaimable space adds up to at least num_bytes if
+         *         possible. The partition evicts them in order until enough space is freed, and evicts nothing if
+         *         they cannot free enough space
+         */
+        [[nodiscard]] virtual std::vector<const FileMetadata*> select_victims(sg_size_t num_bytes) = 0;
+        /**
+         * @brief Retrieve the files that select_victims() would select, without changing the policy's state, so that
+         *        the partition can tell how much space it could free without evicting anything. Policies whose
+         *        select_victims() changes their state must override it
+         * @param num_bytes: the number of bytes to free
+         * @return Unpinned files, in eviction order, as select_victims() would return them (default: the result of
+         *         select_victims())
+         */
+        [[nodiscard]] virtual std::vector<const FileMetadata*> peek_victims(sg_size_t num_bytes) {
+            return select_victims(num_bytes);
+        }
+    };
+
+    /** \cond EXCLUDE_FROM_DOCUMENTATION */
+    // An intrusive doubly linked list of files, whose links are embedded in the files' metadata. A file can be in
+    // one list per hook at a time
+    class XBT_PUBLIC EvictionList {
+    public:
+        explicit EvictionList(size_t hook) : hook_(hook) {}
+        EvictionList(const EvictionList &) = delete;
+        EvictionList &operator=(const EvictionList &) = delete;
+
+        void push_back(const FileMetadata *file_metadata);
+        void insert_after(const FileMetadata *position, const FileMetadata *file_metadata);
+        void remove(const FileMetadata *file_metadata);
+        [[nodiscard]] bool contains(const FileMetadata *file_metadata) const {
+            return get_hook(file_metadata).list == this;
+        }
+        [[nodiscard]] const FileMetadata* front() const { return front_; }
+        [[nodiscard]] const FileMetadata* next(const FileMetadata *file_metadata) const {
+            return get_hook(file_metadata).next;
+        }
+        [[nodiscard]] const FileMetadata* prev(const FileMetadata *file_metadata) const {
+            return get_hook(file_metadata).prev;
+        }
+        [[nodiscard]] size_t size() const { return size_; }
+
+    private:
+        size_t hook_;
+        const FileMetadata *front_ = nullptr;
+        const FileMetadata *back_ = nullptr;
+        size_t size_ = 0;
+
+        [[nodiscard]] EvictionListHook &get_hook(const FileMetadata *file_metadata) const {
+            return file_metadata->eviction_list_hooks_[hook_];
+        }
+    };
+    /** \endcond */
+
+    /**
+     * @brief A policy that evicts files in First-In-First-Out order, based on their creation dates. Pinned files are
+     *        kept out of the list of candidate victims, so that selecting victims never visits them and costs
+     *        O(1) per victim. Creating, deleting, or pinning a file costs O(1), while unpinning a file costs O(p),
+     *        where p is the number of pinned files that precede it in eviction order
+     */
+    class XBT_PUBLIC FIFOEvictionPolicy : public EvictionPolicy {
+    public:
+        void on_create(const FileMetadata *file_metadata) override;
+        void on_access(const FileMetadata *file_metadata) override {}
+        void on_delete(const FileMetadata *file_metadata) override;
+        void on_pin_change(const FileMetadata *file_metadata) override;
+        [[nodiscard]] std::vector<const FileMetadata*> select_victims(sg_size_t num_bytes) override;
+
+    protected:
+        void move_to_back(const FileMetadata *file_metadata);
+
+    private:
+        // All files in eviction order, and the unpinned ones in the same order
+        EvictionList files_{0};
+        EvictionList unpinned_files_{1};
+    };
+
+    /**
+     * @brief A policy that evicts files in Least-Recently-Used order, based on their latest creation, read, or write
+     *        dates. Each access costs O(1), and pin changes cost the same as with FIFO
+     */
+    class XBT_PUBLIC LRUEvictionPolicy : public FIFOEvictionPolicy {
+    public:
+        void on_access(const FileMetadata *file_metadata) override { move_to_back(file_metadata); }
+    };
+
+    /** \cond EXCLUDE_FROM_DOCUMENTATION */
+    // The paths and sizes of recently evicted files, oldest first, which policies use to recognize files that come
+    // back soon after their eviction
+    class XBT_PUBLIC GhostList {
+    public:
+        void push(const std::string &path, sg_size_t size);
+        bool remove(const std::string &path);
+        void trim(sg_size_t max_num_bytes);
+        [[nodiscard]] bool contains(const std::string &path) const { return positions_.find(path) != positions_.end(); }
+        [[nodiscard]] bool empty() const { return entries_.empty(); }
+        [[nodiscard]] sg_size_t get_num_bytes() const { return num_bytes_; }
+
+    private:
+        std::list<std::pair<std::string, sg_size_t>> entries_;
+        std::unordered_map<std::string, std::list<std::pair<std::string, sg_size_t>>::iterator> positions_;
+        sg_size_t num_bytes_ = 0;
+    };
+    /** \endcond */
+
+    /**
+     * @brief A policy that implements Adaptive Replacement Caching (ARC). Files seen once are kept in a recency
+     *        list and files seen again in a frequency list, and the recently evicted files of both lists are
+     *        remembered. Creating a file that was recently evicted from one list grows the share of the partition
+     *        targeted by that list, so that the policy adapts to the workload and resists scans. Sizes are
+     *        accounted in bytes rather than in files
+     */
+    class XBT_PUBLIC ARCEvictionPolicy : public EvictionPolicy {
+    public:
+        void on_create(const FileMetadata *file_metadata) override;
+        void on_access(const FileMetadata *file_metadata) override;
+        void on_delete(const FileMetadata *file_metadata) override;
+        [[nodiscard]] std::vector<const FileMetadata*> select_victims(sg_size_t num_bytes) override;
+        [[nodiscard]] std::vector<const FileMetadata*> peek_victims(sg_size_t num_bytes) override;
+
+        /**
+         * @brief Retrieve the number of bytes the policy currently targets for files seen only once
+         * @return A number of bytes
+         */
+        [[nodiscard]] sg_size_t get_recency_target() const { return recency_target_; }
+
+    private:
+        struct Entry {
+            bool frequent;
+            std::list<const FileMetadata*>::iterator position;
+            sg_size_t size;
+            bool created; // The partition reports each creation as an access too, which is not a second access
+        };
+
+        std::list<const FileMetadata*> recent_;
+        std::list<const FileMetadata*> frequent_;
+        sg_size_t recent_num_bytes_ = 0;
+        sg_size_t frequent_num_bytes_ = 0;
+        GhostList recent_ghosts_;
+        GhostList frequent_ghosts_;
+        sg_size_t recency_target_ = 0;
+        std::unordered_map<const FileMetadata*, Entry> entries_;
+        std::unordered_set<const FileMetadata*> victims_;
+
+        void insert(const FileMetadata *file_metadata, bool frequent);
+        void trim_ghosts();
+    };
+
+    /**
+     * @brief A policy that implements the full 2Q algorithm. New files enter a FIFO queue, and only files created
+     *        again soon after their eviction from that queue, as remembered by a ghost queue, enter the main LRU
+     *        queue. Files that are used only once, such as those of a scan, thus never displace the main queue
+     */
+    class XBT_PUBLIC TwoQEvictionPolicy : public EvictionPolicy {
+    public:
+        explicit TwoQEvictionPolicy(double in_fraction = 0.25, double out_fraction = 0.5);
+
+        void on_create(const FileMetadata *file_metadata) override;
+        void on_access(const FileMetadata *file_metadata) override;
+        void on_delete(const FileMetadata *file_metadata) override;
+        [[nodiscard]] std::vector<const FileMetadata*> select_victims(sg_size_t num_bytes) override;
+        [[nodiscard]] std::vector<const FileMetadata*> peek_victims(sg_size_t num_bytes) override;
+
+        [[nodiscard]] double get_in_fraction() const { return in_fraction_; }
+        [[nodiscard]] double get_out_fraction() const { return out_fraction_; }
+
+    private:
+        struct Entry {
+            bool in_main;
+            std::list<const FileMetadata*>::iterator position;
+            sg_size_t size;
+        };
+
+        double in_fraction_;
+        double out_fraction_;
+        std::list<const FileMetadata*> in_queue_;
+        std::list<const FileMetadata*> main_queue_;
+        sg_size_t in_queue_num_bytes_ = 0;
+        GhostList out_queue_;
+        std::unordered_map<const FileMetadata*, Entry> entries_;
+        std::unordered_set<const FileMetadata*> victims_;
+    };
+
+    /**
+     * @brief A policy that evicts the Least-Frequently-Used files, with dynamic aging (LFU-DA). The priority of a
+     *        file is its number of accesses plus the age of the cache, which is the priority of the latest evicted
+     *        file, so that files that were popular long ago eventually get evicted
+     */
+    class XBT_PUBLIC LFUEvictionPolicy : public EvictionPolicy {
+    public:
+        void on_create(const FileMetadata *file_metadata) override;
+        void on_access(const FileMetadata *file_metadata) override;
+        void on_delete(const FileMetadata *file_metadata) override;
+        [[nodiscard]] std::vector<const FileMetadata*> select_victims(sg_size_t num_bytes) override;
+        [[nodiscard]] std::vector<const FileMetadata*> peek_victims(sg_size_t num_bytes) override;
+
+        /**
+         * @brief Retrieve the age of the cache
+         * @return The priority of the latest evicted file
+         */
+        [[nodiscard]] double get_age() const { return age_; }
+
+    protected:
+        /**
+         * @brief Compute the part of the priority of a file that does not come from the age of the cache
+         * @param file_metadata: the file's metadata
+         * @param frequency: the file's number of accesses
+         * @return A priority, the files with the lowest priorities being evicted first
+         */
+        [[nodiscard]] virtual double get_value(const FileMetadata *file_metadata, unsigned long frequency) const {
+            return static_cast<double>(frequency);
+        }
+
+    private:
+        struct Entry {
+            unsigned long frequency;
+            double priority;
+            unsigned long sequence_number;
+        };
+
+        double age_ = 0;
+        unsigned long sequence_number_ = 0;
+        // Lowest priority first and, among equal priorities, least recently accessed first
+        std::set<std::tuple<double, unsigned long, const FileMetadata*>> queue_;
+        std::unordered_map<const FileMetadata*, Entry> entries_;
+        std::unordered_set<const FileMetadata*> victims_;
+
+        void update(const FileMetadata *file_metadata, Entry &entry);
+    };
+
+    /**
+     * @brief A policy that implements Greedy-Dual-Size-Frequency (GDSF), i.e., LFU-DA in which the value of a file
+     *        is its number of accesses divided by its size, so that many small popular files are kept rather than
+     *        a few large ones
+     */
+    class XBT_PUBLIC GDSFEvictionPolicy : public LFUEvictionPolicy {
+    protected:
+        [[nodiscard]] double get_value(const FileMetadata *file_metadata, unsigned long frequency) const override;
+    };
+
+    /**
+     * @brief A policy that implements S3-FIFO. New files enter a small FIFO queue. When evicted from that queue, the
+     *        files that were accessed since their creation move to a main FIFO queue, and the others are evicted and
+     *        remembered by a ghost queue, so that creating them again sends them directly to the main queue. Files
+     *        of the main queue that were accessed since they were last considered for eviction are given another
+     *        chance (lazy promotion). One-hit wonders are thus evicted quickly, and hits cost no reordering
+     */
+    class XBT_PUBLIC S3FIFOEvictionPolicy : public EvictionPolicy {
+    public:
+        explicit S3FIFOEvictionPolicy(double small_fraction = 0.1);
+
+        void on_create(const FileMetadata *file_metadata) override;
+        void on_access(const FileMetadata *file_metadata) override;
+        void on_delete(const FileMetadata *file_metadata) override;
+        [[nodiscard]] std::vector<const FileMetadata*> select_victims(sg_size_t num_bytes) override;
+        [[nodiscard]] std::vector<const FileMetadata*> peek_victims(sg_size_t num_bytes) override;
+
+        [[nodiscard]] double get_small_fraction() const { return small_fraction_; }
+
+    private:
+        struct Entry {
+            bool in_main;
+            std::list<const FileMetadata*>::iterator position;
+            sg_size_t size;
+            unsigned int frequency; // Saturates at 3
+            bool created; // The partition reports each creation as an access too, which is not counted
+        };
+
+        double small_fraction_;
+        std::list<const FileMetadata*> small_queue_;
+        std::list<const FileMetadata*> main_queue_;
+        sg_size_t small_queue_num_bytes_ = 0;
+        GhostList ghost_queue_;
+        std::unordered_map<const FileMetadata*, Entry> entries_;
+        std::unordered_set<const FileMetadata*> victims_;
+
+        // Selecting victims reorganizes the queues, hence the queues and entries to work on
+        using Entries = std::unordered_map<const FileMetadata*, Entry>;
+        static const FileMetadata* next_small_queue_victim(std::list<const FileMetadata*> &small_queue,
+                                                           std::list<const FileMetadata*> &main_queue,
+                                                           sg_size_t &small_queue_num_bytes, Entries &entries,
+                                                           std::list<const FileMetadata*>::iterator &it);
+        static const FileMetadata* next_main_queue_victim(std::list<const FileMetadata*> &main_queue,
+                                                          Entries &entries,
+                                                          std::list<const FileMetadata*>::iterator &it);
+        [[nodiscard]] std::vector<const FileMetadata*> select_victims_in(std::list<const FileMetadata*> &small_queue,
+                                                                         std::list<const FileMetadata*> &main_queue,
+                                                                         sg_size_t &small_queue_num_bytes,
+                                                                         Entries &entries, sg_size_t num_bytes) const;
+    };
+
+} // namespace simgrid::fsmod
+
+#endif //FSMOD_EVICTIONPOLICY_HPP
@@ -8,6 +8,8 @@
 
 #include <simgrid/forward.h>
 #include <simgrid/s4u/Io.hpp>
+#include <functional>
+#include <memory>
 #include <utility>
 #include <xbt/parse_units.hpp>
 
@@ -29,9 +31,27 @@ namespace simgrid::fsmod {
         int desc_id     = 0;
         FileMetadata* metadata_;
         Partition* partition_;
+        std::string qos_tag_;
 
         void update_current_position(sg_offset_t pos);
-        int write_init_checks(sg_size_t num_bytes);
+        int write_init_checks(sg_size_t num_bytes, sg_size_t& num_bytes_to_store);
+        void abort_write(int write_id);
+
+        [[nodiscard]] std::function<s4u::IoPtr(bool)> make_read_starter(const std::shared_ptr<Storage>& storage,
+                                                                        sg_offset_t offset, sg_size_t num_bytes) const;
+        [[nodiscard]] std::pair<double, double> admit_request(sg_size_t num_bytes) const;
+        s4u::IoPtr start_with_qos(s4u::Io::OpType op_type, sg_size_t num_bytes, const std::shared_ptr<Storage>& storage,
+                                  const std::function<s4u::IoPtr(bool)>& start, bool detached = false) const;
+
+        [[nodiscard]] std::pair<sg_offset_t, sg_size_t> get_physical_extent(sg_offset_t offset,
+                                                                            sg_size_t num_bytes) const;
+        [[nodiscard]] double get_compression_flops(s4u::Io::OpType op_type, sg_size_t num_bytes) const;
+        [[nodiscard]] double get_hashing_flops(sg_size_t num_bytes) const;
+        [[nodiscard]] s4u::Host* get_processing_host(const std::shared_ptr<Storage>& storage) const;
+        [[nodiscard]] std::function<s4u::IoPtr(bool)> with_processing(s4u::Io::OpType op_type, double flops,
+                                                                      const std::shared_ptr<Storage>& storage,
+                                                                      std::function<s4u::IoPtr(bool)> start) const;
+        static void compute(s4u::Host* host, double flops);
 
     public:
         File(std::string full_path, std::string access_mode, FileMetadata *metadata,
@@ -63,6 +83,9 @@ namespace simgrid::fsmod {
 
         [[nodiscard]] FileSystem *get_file_system() const;
 
+        void set_qos_tag(const std::string& tag) { qos_tag_ = tag; }
+        [[nodiscard]] const std::string& get_qos_tag() const { return qos_tag_; }
+
         void seek(sg_offset_t pos, int origin = SEEK_SET);
         [[nodiscard]] sg_size_t tell() const { return current_position_; }
 
@@ -6,7 +6,10 @@
 #ifndef SIMGRID_MODULE_FS_FILEMETADATA_H_
 #define SIMGRID_MODULE_FS_FILEMETADATA_H_
 
+#include <array>
+#include <string>
 #include <unordered_map>
+#include <vector>
 #include <simgrid/forward.h>
 #include <iostream>
 
@@ -14,14 +17,24 @@ namespace simgrid::fsmod {
 
     /** \cond EXCLUDE_FROM_DOCUMENTATION    */
 
+    class EvictionList;
+    class FileMetadata;
     class Partition;
 
+    // The links of a file in an intrusive list, so that updating the list costs neither an allocation nor a lookup
+    struct EvictionListHook {
+        const FileMetadata *prev = nullptr;
+        const FileMetadata *next = nullptr;
+        const EvictionList *list = nullptr;
+    };
+
     class XBT_PUBLIC FileMetadata {
+        friend class EvictionList;
         friend class Partition;
-        friend class PartitionFIFOCaching;
-        friend class PartitionLRUCaching;
+        friend class PartitionTiered;
 
         Partition *partition_;
+        unsigned long id_;
         std::string dir_path_;
         std::string file_name_;
 
@@ -33,26 +46,55 @@ namespace simgrid::fsmod {
         std::unordered_map<int, sg_size_t> ongoing_writes_;
         unsigned file_refcount_ = 0;
 
-        unsigned long sequence_number_= 0; // Used for caching algorithms
         bool evictable_ = true; // Used for caching algorithms
+        mutable std::array<EvictionListHook, 2> eviction_list_hooks_; // Used for caching algorithms
+
+        unsigned int tier_ = 0; // Used for storage tiering
+        bool tier_assigned_ = false; // Used for storage tiering
+        double heat_ = 0.0; // Used for storage tiering
+        double heat_date_ = 0.0; // Used for storage tiering
+
+        double compression_ratio_ = 1.0; // Used for compression
+
+        std::string fingerprint_; // Used for deduplication
+        std::vector<std::string> chunk_fingerprints_; // Used for deduplication
+        std::vector<std::string> stored_chunks_; // Used for deduplication
+
+        sg_size_t stored_size_ = 0; // Used for free space accounting
+
+        bool dirty_ = false; // Used for write-back
 
     public:
         FileMetadata(sg_size_t initial_size, Partition *partition, std::string dir_path, std::string file_name);
 
+        [[nodiscard]] unsigned long get_id() const { return id_; }
+        [[nodiscard]] const std::string& get_dir_path() const { return dir_path_; }
+        [[nodiscard]] const std::string& get_file_name() const { return file_name_; }
+
         [[nodiscard]] sg_size_t get_current_size() const { return current_size_; }
         void set_current_size(sg_size_t num_bytes) { current_size_ = num_bytes; }
         [[nodiscard]] sg_size_t get_future_size() const { return future_size_; }
         void set_future_size(sg_size_t num_bytes) { future_size_ = num_bytes; }
 
+        [[nodiscard]] double get_creation_date() const { return creation_date_; }
+
         [[nodiscard]] double get_modification_date() const { return modification_date_; }
         void set_modification_date(double date) { modification_date_ = date; }
 
         [[nodiscard]] double get_access_date() const { return access_date_; }
         void set_access_date(double date);
 
+        [[nodiscard]] double get_compression_ratio() const { return compression_ratio_; }
+
         [[nodiscard]] unsigned get_file_refcount() const { return file_refcount_; }
-        void increase_file_refcount() { file_refcount_++; }
-        void decrease_file_refcount() { file_refcount_--; }
+        void increase_file_refcount();
+        void decrease_file_refcount();
+
+        [[nodiscard]] bool is_evictable() const { return evictable_; }
+        [[nodiscard]] bool is_pinned() const { return file_refcount_ > 0 || not evictable_; }
+        [[nodiscard]] sg_size_t get_reclaimable_space() const;
+        // A file being written holds data that was not written back (yet)
+        [[nodiscard]] bool is_dirty() const { return dirty_ || not ongoing_writes_.empty(); }
 
         void notify_write_start(int write_id, sg_size_t new_size) {
             ongoing_writes_[write_id] = new_size;
@@ -65,6 +107,16 @@ namespace simgrid::fsmod {
                 return; // already ended (e.g., callback fired twice due to cancel + erase)
             current_size_ = it->second;
             ongoing_writes_.erase(it);
+            dirty_ = true;
+        }
+
+        // Forget a write that failed, which neither changes the size of the file nor makes it dirty
+        void notify_write_abort(int write_id) {
+            if (ongoing_writes_.erase(write_id) == 0)
+                return;
+            future_size_ = current_size_;
+            for (const auto& [id, new_size] : ongoing_writes_)
+                future_size_ = std::max(new_size, future_size_);
         }
     };
 
@@ -12,10 +12,15 @@
 #include <xbt/parse_units.hpp>
 
 #include <memory>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
+#include "ClientCache.hpp"
+#include "MetadataService.hpp"
+#include "QoSPolicy.hpp"
 #include "Partition.hpp"
+#include "PartitionTiered.hpp"
 #include "File.hpp"
 
 namespace simgrid::fsmod {
@@ -61,13 +66,48 @@ namespace simgrid::fsmod {
                              Partition::CachingScheme caching_scheme  = Partition::CachingScheme::NONE);
         void mount_partition(const std::string &mount_point, std::shared_ptr<Storage> storage, const std::string& size,
                              Partition::CachingScheme caching_scheme  = Partition::CachingScheme::NONE);
+        void mount_partition(const std::string &mount_point, std::shared_ptr<Storage> storage, sg_size_t size,
+                             std::shared_ptr<EvictionPolicy> eviction_policy);
+        void mount_partition(const std::string &mount_point, std::shared_ptr<Storage> storage, const std::string& size,
+                             std::shared_ptr<EvictionPolicy> eviction_policy);
+        std::shared_ptr<PartitionTiered> mount_tiered_partition(const std::string &mount_point,
+                                                                std::shared_ptr<Storage> fast_storage,
+                                                                sg_size_t fast_tier_size,
+                                                                std::shared_ptr<Storage> capacity_storage,
+                                                                sg_size_t capacity_tier_size);
+        std::shared_ptr<PartitionTiered> mount_tiered_partition(const std::string &mount_point,
+                                                                std::shared_ptr<Storage> fast_storage,
+                                                                const std::string &fast_tier_size,
+                                                                std::shared_ptr<Storage> capacity_storage,
+                                                                const std::string &capacity_tier_size);
+
+        void set_metadata_service(std::shared_ptr<MetadataService> metadata_service);
+        [[nodiscard]] std::shared_ptr<MetadataService> get_metadata_service() const { return metadata_service_; }
+
+        void add_client_cache(std::shared_ptr<ClientCache> client_cache);
+        [[nodiscard]] std::shared_ptr<ClientCache> get_client_cache(const s4u::Host* host) const;
+
+        void set_qos_policy(std::shared_ptr<QoSPolicy> qos_policy);
+        [[nodiscard]] std::shared_ptr<QoSPolicy> get_qos_policy() const { return qos_policy_; }
+        void set_actor_qos_policy(const s4u::Actor* actor, std::shared_ptr<QoSPolicy> qos_policy);
+        [[nodiscard]] std::shared_ptr<QoSPolicy> get_actor_qos_policy(const s4u::Actor* actor) const;
+        void set_tag_qos_policy(const std::string& tag, std::shared_ptr<QoSPolicy> qos_policy);
+        [[nodiscard]] std::shared_ptr<QoSPolicy> get_tag_qos_policy(const std::string& tag) const;
 
         void create_file(const std::string& full_path, sg_size_t size) const;
         void create_file(const std::string& full_path, const std::string& size) const;
+        void create_file(const std::string& full_path, sg_size_t size, unsigned long stripe_count,
+                         sg_size_t stripe_size) const;
+        void create_file(const std::string& full_path, const std::string& size, unsigned long stripe_count,
+                         const std::string& stripe_size) const;
 
         void truncate_file(const std::string& full_path, sg_size_t size) const;
 
         void make_file_evictable(const std::string& full_path, bool evictable) const;
+        void set_file_compression_ratio(const std::string& full_path, double ratio) const;
+        void set_file_fingerprint(const std::string& full_path, const std::string& fingerprint) const;
+        void set_file_chunk_fingerprints(const std::string& full_path,
+                                         const std::vector<std::string>& chunk_fingerprints) const;
 
         [[nodiscard]] bool file_exists(const std::string& full_path) const;
 
@@ -91,12 +131,25 @@ namespace simgrid::fsmod {
 
         [[nodiscard]] sg_size_t get_free_space_at_path(const std::string &full_path) const;
 
+        [[nodiscard]] Partition::DirectoryLockStatistics
+            get_directory_lock_statistics(const std::string &full_dir_path) const;
+
     private:
         friend class File;
 
         [[nodiscard]] std::pair<std::shared_ptr<Partition>, std::string> find_path_at_mount_point(const std::string &full_path) const;
+        [[nodiscard]] std::string check_new_mount_point(const std::string &mount_point) const;
+        void perform_metadata_operation(const std::shared_ptr<Partition> &partition,
+                                        MetadataService::Operation operation) const;
+        [[nodiscard]] std::shared_ptr<ClientCache> get_client_cache_for(const std::shared_ptr<Storage> &storage) const;
+        [[nodiscard]] std::vector<std::shared_ptr<QoSPolicy>> get_qos_policies(const std::string &tag) const;
 
         std::map<std::string, std::shared_ptr<Partition>, std::less<>> partitions_;
+        std::shared_ptr<MetadataService> metadata_service_ = nullptr;
+        std::unordered_map<const s4u::Host*, std::shared_ptr<ClientCache>> client_caches_;
+        std::shared_ptr<QoSPolicy> qos_policy_ = nullptr;
+        std::unordered_map<aid_t, std::shared_ptr<QoSPolicy>> actor_qos_policies_;
+        std::map<std::string, std::shared_ptr<QoSPolicy>, std::less<>> tag_qos_policies_;
 
         int num_open_files_ = 0;
     };
@@ -0,0 +1,91 @@
+/* Copyright (c) 2024-2026. The FSMOD Team. All rights reserved.          */
+
+/* This program is free software; you can redistribute it and/or modify it
+ * under the terms of the license (GNU LGPL) which comes with this package. */
+
+#ifndef FSMOD_HDDSTORAGE_HPP
+#define FSMOD_HDDSTORAGE_HPP
+
+#include <deque>
+#include <memory>
+#include <unordered_map>
+
+#include "Storage.hpp"
+
+namespace simgrid::fsmod {
+
+    /**
+     * @brief A class that implements a one-disk storage that models a spinning hard disk drive. Each file is placed
+     *        at a base address on the drive, and the drive's single head serves operations one at a time. An
+     *        operation that does not start where the previous one ended pays a seek, which grows with the distance
+     *        the head travels, and half a rotation on average. Queued operations are served in arrival order, or
+     *        reordered in elevator (C-LOOK) order to shorten seeks
+     */
+    class XBT_PUBLIC HDDStorage : public Storage, public std::enable_shared_from_this<HDDStorage> {
+    public:
+        HDDStorage(const std::string &name, s4u::Disk *disk, sg_size_t capacity);
+        ~HDDStorage() override = default;
+        static std::shared_ptr<HDDStorage> create(const std::string &name, s4u::Disk *disk, sg_size_t capacity);
+
+        [[nodiscard]] sg_size_t get_capacity() const { return capacity_; }
+
+        void set_rotation_speed(double rpm);
+        [[nodiscard]] double get_rotation_speed() const { return rpm_; }
+        void set_seek_times(double track_to_track_seek_time, double full_stroke_seek_time);
+        [[nodiscard]] double get_track_to_track_seek_time() const { return track_to_track_seek_time_; }
+        [[nodiscard]] double get_full_stroke_seek_time() const { return full_stroke_seek_time_; }
+        [[nodiscard]] double get_positioning_time(sg_size_t distance) const;
+
+        void set_file_extent_size(sg_size_t extent_size);
+        [[nodiscard]] sg_size_t get_file_extent_size() const { return file_extent_size_; }
+
+        void set_request_reordering(bool reordering) { request_reordering_ = reordering; }
+        [[nodiscard]] bool get_request_reordering() const { return request_reordering_; }
+
+        [[nodiscard]] sg_offset_t get_head_position() const { return head_position_; }
+        [[nodiscard]] unsigned long get_num_operations() const { return num_operations_; }
+        [[nodiscard]] unsigned long get_num_seeks() const { return num_seeks_; }
+        [[nodiscard]] double get_total_positioning_time() const { return total_positioning_time_; }
+
+    protected:
+        s4u::IoPtr read_async(const IOContext& context, sg_offset_t offset, sg_size_t size) override;
+        void read(const IOContext& context, sg_offset_t offset, sg_size_t size) override;
+        s4u::IoPtr write_async(const IOContext& context, sg_offset_t offset, sg_size_t size,
+                               bool detached = false) override;
+        void write(const IOContext& context, sg_offset_t offset, sg_size_t size) override;
+
+    private:
+        struct Operation {
+            s4u::Io::OpType op_type;
+            sg_offset_t address;
+            sg_size_t size;
+            s4u::IoPtr completion;
+            s4u::IoPtr gate;
+        };
+
+        sg_size_t capacity_;
+        double rpm_ = 7200;
+        double track_to_track_seek_time_ = 0.001;
+        double full_stroke_seek_time_ = 0.015;
+        sg_size_t file_extent_size_;
+        bool request_reordering_ = false;
+
+        std::unordered_map<unsigned long, sg_offset_t> file_base_addresses_;
+        std::deque<std::shared_ptr<Operation>> pending_operations_;
+        std::shared_ptr<Operation> current_operation_;
+        bool head_busy_ = false;
+        sg_offset_t head_position_ = 0;
+
+        unsigned long num_operations_ = 0;
+        unsigned long num_seeks_ = 0;
+        double total_positioning_time_ = 0;
+
+        sg_offset_t get_file_base_address(unsigned long file_id);
+        s4u::IoPtr submit(s4u::Io::OpType op_type, sg_offset_t address, sg_size_t size);
+        std::shared_ptr<Operation> pop_next_operation();
+        void serve_operations();
+        void fail_operations();
+    };
+} // namespace simgrid::fsmod
+
+#endif //FSMOD_HDDSTORAGE_HPP
@@ -0,0 +1,137 @@
+/* Copyright (c) 2024-2026. The FSMOD Team. All rights reserved.          */
+
+/* This program is free software; you can redistribute it and/or modify it
+ * under the terms of the license (GNU LGPL) which comes with this package. */
+
+#ifndef FSMOD_IOSCHEDULER_HPP
+#define FSMOD_IOSCHEDULER_HPP
+
+#include <simgrid/forward.h>
+#include <simgrid/s4u/Io.hpp>
+
+#include <deque>
+#include <map>
+#include <memory>
+
+namespace simgrid::fsmod {
+
+    /**
+     * @brief An I/O request waiting in the queue of a storage's controller
+     */
+    struct XBT_PUBLIC IORequest {
+        /** @brief Whether the request is a read or a write */
+        s4u::Io::OpType op_type;
+        /** @brief The identifier of the accessed file, or 0 if the request does not come from a file */
+        unsigned long file_id;
+        /** @brief The offset of the first byte to access */
+        sg_offset_t offset;
+        /** @brief The number of bytes to access */
+        sg_size_t size;
+        /** @brief The PID of the actor that issued the request */
+        aid_t client;
+        /** @brief The host on which the actor that issued the request runs */
+        s4u::Host* client_host;
+        /** @brief The date at which the request was issued */
+        double arrival_date;
+        /** @brief The activity returned to the client, which completes with the request */
+        s4u::IoPtr completion;
+        /** @brief An activity that holds the completion activity back until the request is dispatched */
+        s4u::IoPtr dispatch_gate;
+    };
+
+    /**
+     * @brief An abstract class that decides in which order the controller of a storage dispatches queued requests
+     */
+    class XBT_PUBLIC IOScheduler {
+    public:
+        virtual ~IOScheduler() = default;
+
+        /**
+         * @brief Add a request to the queue
+         * @param request: a request
+         */
+        virtual void push(const std::shared_ptr<IORequest>& request) = 0;
+        /**
+         * @brief Remove the next request to dispatch from the queue
+         * @return A request
+         */
+        virtual std::shared_ptr<IORequest> pop() = 0;
+        /**
+         * @brief Retrieve the number of queued requests
+         * @return A number of requests
+         */
+        [[nodiscard]] virtual size_t size() const = 0;
+        [[nodiscard]] bool empty() const { return size() == 0; }
+    };
+
+    /**
+     * @brief A scheduler that dispatches requests in arrival order
+     */
+    class XBT_PUBLIC FIFOIOScheduler : public IOScheduler {
+    public:
+        void push(const std::shared_ptr<IORequest>& request) override { queue_.push_back(request); }
+        std::shared_ptr<IORequest> pop() override;
+        [[nodiscard]] size_t size() const override { return queue_.size(); }
+
+    private:
+        std::deque<std::shared_ptr<IORequest>> queue_;
+    };
+
+    /**
+     * @brief A scheduler that gives each request a deadline (its arrival date plus an expiry delay that depends on
+     *        whether it is a read or a write) and dispatches the request with the earliest deadline first
+     */
+    class XBT_PUBLIC DeadlineIOScheduler : public IOScheduler {
+    public:
+        explicit DeadlineIOScheduler(double read_expiry = 0.5, double write_expiry = 5.0);
+
+        void push(const std::shared_ptr<IORequest>& request) override;
+        std::shared_ptr<IORequest> pop() override;
+        [[nodiscard]] size_t size() const override { return queue_.size(); }
+
+        [[nodiscard]] double get_read_expiry() const { return read_expiry_; }
+        [[nodiscard]] double get_write_expiry() const { return write_expiry_; }
+
+    private:
+        double read_expiry_;
+        double write_expiry_;
+        // Requests with the same deadline remain in arrival order
+        std::multimap<double, std::shared_ptr<IORequest>> queue_;
+    };
+
+    /**
+     * @brief A scheduler that shares the storage among clients: the next request is taken from the client that has
+     *        been served the fewest bytes so far. A client that becomes active again starts from the least-served
+     *        active client, so that being idle does not earn it credit
+     */
+    class XBT_PUBLIC FairShareIOScheduler : public IOScheduler {
+    public:
+        void push(const std::shared_ptr<IORequest>& request) override;
+        std::shared_ptr<IORequest> pop() override;
+        [[nodiscard]] size_t size() const override { return num_requests_; }
+
+        [[nodiscard]] sg_size_t get_served_bytes(aid_t client) const;
+
+    private:
+        std::map<aid_t, std::deque<std::shared_ptr<IORequest>>> queues_;
+        std::map<aid_t, sg_size_t> served_bytes_;
+        size_t num_requests_ = 0;
+    };
+
+    /**
+     * @brief A scheduler that dispatches the smallest request first (shortest job first), and requests of the same
+     *        size in arrival order
+     */
+    class XBT_PUBLIC ShortestJobFirstIOScheduler : public IOScheduler {
+    public:
+        void push(const std::shared_ptr<IORequest>& request) override { queue_.emplace(request->size, request); }
+        std::shared_ptr<IORequest> pop() override;
+        [[nodiscard]] size_t size() const override { return queue_.size(); }
+
+    private:
+        std::multimap<sg_size_t, std::shared_ptr<IORequest>> queue_;
+    };
+
+} // namespace simgrid::fsmod
+
+#endif //FSMOD_IOSCHEDULER_HPP
@@ -8,12 +8,17 @@
 
 #include "Storage.hpp"
 
+#include <memory>
+#include <set>
+#include <unordered_map>
+#include <utility>
+
 namespace simgrid::fsmod {
 
     /**
      * @brief A class that implements an abstraction of a "Just a Bunch Of Disks" storage
      */
-    class XBT_PUBLIC JBODStorage : public Storage {
+    class XBT_PUBLIC JBODStorage : public Storage, public std::enable_shared_from_this<JBODStorage> {
     public:
         /**
          * @brief An enum that defines the possible RAID levels that can be used by a JBODStorage
@@ -32,35 +37,132 @@ namespace simgrid::fsmod {
                 /** @brief RAID level 5 */
                 RAID5 = 5,
                 /** @brief RAID level 6 */
-                RAID6 = 6};
+                RAID6 = 6,
+                /** @brief RAID level 10 (data striped over mirrored pairs of disks) */
+                RAID10 = 10,
+                /** @brief k+m Reed-Solomon erasure coding (k data and m parity fragments per stripe) */
+                ERASURE_CODING = 100};
+
+        /**
+         * @brief An enum that defines how RAID1 and RAID10 reads choose among the mirrors that hold the data
+         */
+        enum class MirrorReadPolicy {
+                /** @brief Use each mirror in turn */
+                ROUND_ROBIN,
+                /** @brief Use the mirror with the fewest bytes left to read or write */
+                LEAST_OUTSTANDING_BYTES,
+                /** @brief Use the mirror expected to complete the read first, given its outstanding bytes and its
+                 *         read bandwidth */
+                EARLIEST_COMPLETION};
 
         JBODStorage(const std::string& name, const std::vector<simgrid::s4u::Disk*>& disks);
         static std::shared_ptr<JBODStorage> create(const std::string& name,
                                                    const std::vector<simgrid::s4u::Disk*>& disks,
-                                                   JBODStorage::RAID raid_level = RAID::RAID0);
+                                                   JBODStorage::RAID raid_level = RAID::RAID0,
+                                                   sg_size_t stripe_unit_size = 0);
+        static std::shared_ptr<JBODStorage> create_erasure_coded(const std::string& name,
+                                                                 const std::vector<simgrid::s4u::Disk*>& disks,
+                                                                 unsigned long num_data_fragments,
+                                                                 unsigned long num_parity_fragments,
+                                                                 sg_size_t stripe_unit_size = 0);
         ~JBODStorage() override = default;
 
         [[nodiscard]] RAID get_raid_level() const;
 
         void set_raid_level(RAID raid_level);
+        void set_erasure_coding(unsigned long num_data_fragments, unsigned long num_parity_fragments);
+
+        [[nodiscard]] unsigned long get_num_data_disks() const;
+        [[nodiscard]] unsigned long get_num_parity_disks() const;
+
+        [[nodiscard]] sg_size_t get_stripe_unit_size() const;
+
+        void set_stripe_unit_size(sg_size_t stripe_unit_size);
+
+        [[nodiscard]] MirrorReadPolicy get_mirror_read_policy() const { return mirror_read_policy_; }
+        void set_mirror_read_policy(MirrorReadPolicy policy) { mirror_read_policy_ = policy; }
+        [[nodiscard]] double get_hedged_read_threshold() const { return hedged_read_threshold_; }
+        void set_hedged_read_threshold(double threshold);
+        [[nodiscard]] unsigned long get_num_hedged_reads() const { return num_hedged_reads_; }
+        [[nodiscard]] sg_size_t get_outstanding_bytes(unsigned long disk_idx) const;
+
+        [[nodiscard]] unsigned long get_num_failed_disks() const;
+        [[nodiscard]] unsigned long get_max_num_failed_disks() const;
 
+        void add_spare_disk(s4u::Disk* disk);
+        [[nodiscard]] const std::vector<s4u::Disk*>& get_spare_disks() const { return spare_disks_; }
+        [[nodiscard]] double get_rebuild_rate() const { return rebuild_rate_; }
+        void set_rebuild_rate(double rate);
+        [[nodiscard]] sg_size_t get_rebuild_size() const;
+        void set_rebuild_size(sg_size_t num_bytes) { rebuild_size_ = num_bytes; }
+        [[nodiscard]] bool is_rebuilding() const { return not disks_being_rebuilt_.empty(); }
+        s4u::ActorPtr start_rebuild(const s4u::Disk* failed_disk);
 
     protected:
-        s4u::IoPtr read_async(sg_size_t size) override;
-        void read(sg_size_t size) override;
-        s4u::IoPtr write_async(sg_size_t size, bool detached = false) override;
-        void write(sg_size_t size) override;
+        /**
+         * @brief The number of bytes each disk has to read and/or write to serve a request, as well as the
+         *        amount of computation needed to update the parity blocks (if any)
+         */
+        struct DiskAccessPlan {
+            /** @brief Bytes to read on each disk (for a write, the old data and parity of a read-modify-write) */
+            std::vector<sg_size_t> read_bytes;
+            /** @brief Bytes to write on each disk (data and parity) */
+            std::vector<sg_size_t> write_bytes;
+            /** @brief Number of flops to compute the parity blocks, or to reconstruct the data of failed disks */
+            double parity_flops = 0.0;
+        };
+
+        s4u::IoPtr read_async(const IOContext& context, sg_offset_t offset, sg_size_t size) override;
+        void read(const IOContext& context, sg_offset_t offset, sg_size_t size) override;
+        s4u::IoPtr write_async(const IOContext& context, sg_offset_t offset, sg_size_t size,
+                               bool detached = false) override;
+        void write(const IOContext& context, sg_offset_t offset, sg_size_t size) override;
 
-        void update_parity_disk_idx() { parity_disk_idx_ = (parity_disk_idx_- 1) % num_disks_; }
+        [[nodiscard]] DiskAccessPlan plan_read(sg_offset_t offset, sg_size_t size);
+        [[nodiscard]] DiskAccessPlan plan_write(sg_offset_t offset, sg_size_t size);
+
+        void update_parity_disk_idx() { parity_disk_idx_ = (parity_disk_idx_ + num_disks_ - 1) % num_disks_; }
 
         long get_next_read_disk_idx() { return (++read_disk_idx_) % num_disks_; }
-        [[nodiscard]] unsigned long get_parity_disk_idx() const { return parity_disk_idx_; }
+        [[nodiscard]] unsigned long select_mirror(const std::vector<unsigned long>& mirrors, sg_size_t size);
+        [[nodiscard]] unsigned long get_parity_disk_idx(sg_size_t stripe) const;
+        [[nodiscard]] unsigned long get_data_disk_idx(unsigned long parity_disk_idx, unsigned long chunk) const;
+        [[nodiscard]] bool has_rotating_parity() const;
+        [[nodiscard]] bool is_failed(unsigned long disk_idx) const { return not get_disk_at(disk_idx)->is_on(); }
 
     private:
         unsigned long num_disks_;
-        RAID raid_level_;
+        RAID raid_level_ = RAID::RAID0;
+        sg_size_t stripe_unit_size_ = 0;
+        unsigned long num_parity_fragments_ = 0;
         unsigned long parity_disk_idx_;
         long read_disk_idx_ = -1;
+
+        std::vector<s4u::Disk*> spare_disks_;
+        double rebuild_rate_ = 0.0;
+        sg_size_t rebuild_size_ = 0;
+        std::set<unsigned long> disks_being_rebuilt_;
+        bool watching_disks_ = false;
+
+        MirrorReadPolicy mirror_read_policy_ = MirrorReadPolicy::ROUND_ROBIN;
+        double hedged_read_threshold_ = 0.0;
+        unsigned long num_hedged_reads_ = 0;
+        std::vector<sg_size_t> outstanding_bytes_;
+        std::unordered_map<const s4u::Activity*, std::pair<unsigned long, sg_size_t>> outstanding_ios_;
+
+        s4u::IoPtr create_io(unsigned long disk_idx, sg_size_t size, s4u::Io::OpType op_type);
+        void release_io(const s4u::Activity* io);
+        void cancel_io(const s4u::IoPtr& io);
+        s4u::IoPtr hedged_read_async(unsigned long disk_idx, sg_size_t size, s4u::Host* destination_host);
+        void hedged_read(unsigned long disk_idx, sg_size_t size);
+
+        void watch_disk(s4u::Disk* disk);
+        void rebuild(unsigned long disk_idx, s4u::Disk* spare_disk);
+
+        void add_stripe(DiskAccessPlan& plan, sg_size_t stripe, sg_size_t unit, sg_size_t begin, sg_size_t end,
+                        bool for_write, bool force_full_stripe = false) const;
+        void add_full_stripes(DiskAccessPlan& plan, sg_size_t first_stripe, sg_size_t num_stripes, bool for_write) const;
+        [[nodiscard]] DiskAccessPlan plan_striped_access(sg_offset_t offset, sg_size_t size, bool for_write) const;
     };
 }
 
@@ -0,0 +1,76 @@
+/* Copyright (c) 2024-2026. The FSMOD Team. All rights reserved.          */
+
+/* This program is free software; you can redistribute it and/or modify it
+ * under the terms of the license (GNU LGPL) which comes with this package. */
+
+#ifndef FSMOD_METADATASERVICE_HPP
+#define FSMOD_METADATASERVICE_HPP
+
+#include <simgrid/forward.h>
+#include <simgrid/s4u/Host.hpp>
+#include <simgrid/s4u/Semaphore.hpp>
+
+#include <array>
+#include <memory>
+
+namespace simgrid::fsmod {
+
+    /**
+     * @brief A class that implements a metadata server model (e.g., a Lustre MDS). When a metadata service is set on a
+     *        file system or a partition, each metadata operation made by an actor costs a request/reply round trip
+     *        between the actor's host and the server host, plus a per-operation latency during which the operation
+     *        holds one of the server's service slots. Operations queue when all slots are busy
+     */
+    class XBT_PUBLIC MetadataService {
+    public:
+        /**
+         * @brief An enum that defines the metadata operations served by a metadata service
+         */
+        enum class Operation {
+            /** @brief FileSystem::create_file(), or FileSystem::open() on a file that does not exist */
+            CREATE = 0,
+            /** @brief FileSystem::open() on a file that exists */
+            OPEN = 1,
+            /** @brief FileSystem::unlink_file() */
+            UNLINK = 2,
+            /** @brief FileSystem::move_file() */
+            MOVE = 3,
+            /** @brief FileSystem::list_files_in_directory() */
+            LIST = 4
+        };
+
+        MetadataService(s4u::Host *host, unsigned long max_concurrent_operations);
+        static std::shared_ptr<MetadataService> create(s4u::Host *host, unsigned long max_concurrent_operations = 1);
+
+        [[nodiscard]] s4u::Host* get_host() const { return host_; }
+        [[nodiscard]] unsigned long get_max_concurrent_operations() const { return max_concurrent_operations_; }
+
+        void set_latency(double latency);
+        void set_latency(Operation operation, double latency);
+        [[nodiscard]] double get_latency(Operation operation) const;
+
+        [[nodiscard]] unsigned long get_num_operations(Operation operation) const;
+        [[nodiscard]] unsigned long get_num_operations() const;
+        [[nodiscard]] unsigned long get_num_running_operations() const { return num_running_operations_; }
+        [[nodiscard]] unsigned long get_num_waiting_operations() const { return num_waiting_operations_; }
+        [[nodiscard]] double get_total_waiting_time() const { return total_waiting_time_; }
+
+    private:
+        friend class FileSystem;
+
+        static constexpr size_t NUM_OPERATIONS = 5;
+
+        s4u::Host* host_;
+        unsigned long max_concurrent_operations_;
+        s4u::SemaphorePtr slots_;
+        std::array<double, NUM_OPERATIONS> latencies_ = {};
+        std::array<unsigned long, NUM_OPERATIONS> num_operations_ = {};
+        unsigned long num_running_operations_ = 0;
+        unsigned long num_waiting_operations_ = 0;
+        double total_waiting_time_ = 0.0;
+
+        void perform(Operation operation);
+    };
+} // namespace simgrid::fsmod
+
+#endif //FSMOD_METADATASERVICE_HPP
@@ -0,0 +1,77 @@
+/* Copyright (c) 2024-2026. The FSMOD Team. All rights reserved.          */
+
+/* This program is free software; you can redistribute it and/or modify it
+ * under the terms of the license (GNU LGPL) which comes with this package. */
+
+#ifndef FSMOD_OBJECTSTORAGE_HPP
+#define FSMOD_OBJECTSTORAGE_HPP
+
+#include <memory>
+#include <vector>
+
+#include "Storage.hpp"
+
+namespace simgrid::fsmod {
+
+    /**
+     * @brief A class that implements a remote object store (e.g., S3), accessed through requests that each pay a
+     *        fixed latency before their data is transferred, and that cannot be larger than a maximum request size.
+     *        Large writes go through a multipart upload whose parts are sent over parallel connections, and large
+     *        reads are split into ranged GETs that are also served over parallel connections
+     */
+    class XBT_PUBLIC ObjectStorage : public Storage, public std::enable_shared_from_this<ObjectStorage> {
+    public:
+        ObjectStorage(const std::string &name, s4u::Disk *disk, double request_latency, sg_size_t max_request_size);
+        ~ObjectStorage() override = default;
+        static std::shared_ptr<ObjectStorage> create(const std::string &name, s4u::Disk *disk,
+                                                     double request_latency,
+                                                     sg_size_t max_request_size = 5368709120);
+
+        [[nodiscard]] double get_request_latency() const { return request_latency_; }
+        [[nodiscard]] sg_size_t get_max_request_size() const { return max_request_size_; }
+
+        void set_multipart_upload(sg_size_t part_size, unsigned long parallelism);
+        [[nodiscard]] sg_size_t get_part_size() const { return part_size_; }
+        [[nodiscard]] unsigned long get_multipart_parallelism() const { return multipart_parallelism_; }
+
+        void set_ranged_get(sg_size_t range_size, unsigned long parallelism);
+        [[nodiscard]] sg_size_t get_range_size() const { return range_size_; }
+        [[nodiscard]] unsigned long get_ranged_get_parallelism() const { return ranged_get_parallelism_; }
+
+        [[nodiscard]] unsigned long get_num_requests() const { return num_requests_; }
+        [[nodiscard]] unsigned long get_num_get_requests() const { return num_get_requests_; }
+        [[nodiscard]] unsigned long get_num_put_requests() const { return num_put_requests_; }
+        [[nodiscard]] unsigned long get_num_multipart_uploads() const { return num_multipart_uploads_; }
+
+    protected:
+        s4u::IoPtr read_async(const IOContext& context, sg_offset_t offset, sg_size_t size) override;
+        void read(const IOContext& context, sg_offset_t offset, sg_size_t size) override;
+        s4u::IoPtr write_async(const IOContext& context, sg_offset_t offset, sg_size_t size,
+                               bool detached = false) override;
+        void write(const IOContext& context, sg_offset_t offset, sg_size_t size) override;
+
+    private:
+        double request_latency_;
+        sg_size_t max_request_size_;
+        sg_size_t part_size_ = 8388608;
+        unsigned long multipart_parallelism_ = 10;
+        sg_size_t range_size_ = 8388608;
+        unsigned long ranged_get_parallelism_ = 10;
+
+        unsigned long num_requests_ = 0;
+        unsigned long num_get_requests_ = 0;
+        unsigned long num_put_requests_ = 0;
+        unsigned long num_multipart_uploads_ = 0;
+
+        [[nodiscard]] s4u::Host* get_server_host() const;
+        void check_request_size(sg_size_t size, const std::string& what) const;
+        void send_request(s4u::Io::OpType op_type, sg_size_t size, s4u::Host* client_host);
+        void send_parallel_requests(s4u::Io::OpType op_type, sg_size_t size, sg_size_t request_size,
+                                    unsigned long parallelism, s4u::Host* client_host);
+        void get(sg_size_t size, s4u::Host* client_host);
+        void put(sg_size_t size, s4u::Host* client_host);
+        s4u::IoPtr start_request(s4u::Io::OpType op_type, sg_size_t size, s4u::Host* client_host, bool detached);
+    };
+} // namespace simgrid::fsmod
+
+#endif //FSMOD_OBJECTSTORAGE_HPP
@@ -20,10 +20,11 @@ namespace simgrid::fsmod {
         static std::shared_ptr<OneDiskStorage> create(const std::string &name, simgrid::s4u::Disk *disk);
 
     protected:
-        s4u::IoPtr read_async(sg_size_t size) override;
-        void read(sg_size_t size) override;
-        s4u::IoPtr write_async(sg_size_t size, bool detached = false) override;
-        void write(sg_size_t size) override;
+        s4u::IoPtr read_async(const IOContext& context, sg_offset_t offset, sg_size_t size) override;
+        void read(const IOContext& context, sg_offset_t offset, sg_size_t size) override;
+        s4u::IoPtr write_async(const IOContext& context, sg_offset_t offset, sg_size_t size,
+                               bool detached = false) override;
+        void write(const IOContext& context, sg_offset_t offset, sg_size_t size) override;
     };
 } // namespace simgrid::fsmod
 
@@ -12,15 +12,22 @@
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
+#include <simgrid/s4u/Actor.hpp>
+#include <simgrid/s4u/Mutex.hpp>
+
+#include "fsmod/AdmissionPolicy.hpp"
+#include "fsmod/EvictionPolicy.hpp"
 #include "fsmod/FileMetadata.hpp"
 
 namespace simgrid::fsmod {
 
     class Storage;
     class FileSystem;
+    class MetadataService;
 
-    class XBT_PUBLIC Partition {
+    class XBT_PUBLIC Partition : public std::enable_shared_from_this<Partition> {
     public:
         /**
          * @brief An enum that defines the possible caching schemes that can
@@ -41,9 +48,25 @@ namespace simgrid::fsmod {
             LRU = 2
         };
 
+        /**
+         * @brief Statistics about the lock of a directory, which serializes the metadata mutations (file creations,
+         *        deletions, and moves) in that directory
+         */
+        struct DirectoryLockStatistics {
+            /** @brief The number of mutations that held the lock */
+            unsigned long num_mutations = 0;
+            /** @brief The number of mutations that found the lock held by another mutation */
+            unsigned long num_waits = 0;
+            /** @brief The total time mutations waited for the lock */
+            double total_wait_time = 0.0;
+            /** @brief The longest time a mutation waited for the lock */
+            double max_wait_time = 0.0;
+        };
+
         /** \cond EXCLUDE_FROM_DOCUMENTATION */
-        Partition(std::string name, FileSystem *file_system, std::shared_ptr<Storage> storage, sg_size_t size);
-        virtual ~Partition() = default;
+        Partition(std::string name, FileSystem *file_system, std::shared_ptr<Storage> storage, sg_size_t size,
+                  std::shared_ptr<EvictionPolicy> eviction_policy = nullptr);
+        virtual ~Partition();
         /** \endcond */
 
 
@@ -52,46 +75,158 @@ namespace simgrid::fsmod {
         [[nodiscard]] sg_size_t get_size() const;
         [[nodiscard]] sg_size_t get_free_space() const;
         [[nodiscard]] sg_size_t get_num_files() const;
+        [[nodiscard]] std::shared_ptr<EvictionPolicy> get_eviction_policy() const { return eviction_policy_; }
+
+        void set_metadata_service(std::shared_ptr<MetadataService> metadata_service);
+        [[nodiscard]] std::shared_ptr<MetadataService> get_metadata_service() const { return metadata_service_; }
+
+        void set_directory_lock_hold_time(double hold_time);
+        [[nodiscard]] double get_directory_lock_hold_time() const { return directory_lock_hold_time_; }
+
+        void set_compression(double ratio, double compression_flops_per_byte = 0,
+                             double decompression_flops_per_byte = 0);
+        [[nodiscard]] double get_compression_ratio() const { return compression_ratio_; }
+        [[nodiscard]] double get_compression_flops_per_byte() const { return compression_flops_per_byte_; }
+        [[nodiscard]] double get_decompression_flops_per_byte() const { return decompression_flops_per_byte_; }
+
+        void set_deduplication(sg_size_t chunk_size, double hashing_flops_per_byte = 0);
+        [[nodiscard]] sg_size_t get_deduplication_chunk_size() const { return deduplication_chunk_size_; }
+        [[nodiscard]] double get_hashing_flops_per_byte() const { return hashing_flops_per_byte_; }
+        [[nodiscard]] sg_size_t get_num_unique_chunks() const { return chunks_.size(); }
+        [[nodiscard]] double get_deduplication_ratio() const;
+
+        void set_eviction_watermarks(double high_watermark, double low_watermark);
+        [[nodiscard]] double get_high_watermark() const { return high_watermark_; }
+        [[nodiscard]] double get_low_watermark() const { return low_watermark_; }
+        [[nodiscard]] unsigned long get_num_foreground_evictions() const { return num_foreground_evictions_; }
+        [[nodiscard]] unsigned long get_num_background_evictions() const { return num_background_evictions_; }
+
+        void set_write_back(std::shared_ptr<FileSystem> backing_file_system, const std::string& backing_path,
+                            bool asynchronous = false);
+        [[nodiscard]] std::shared_ptr<FileSystem> get_backing_file_system() const { return backing_file_system_; }
+        [[nodiscard]] const std::string& get_backing_path() const { return backing_path_; }
+        [[nodiscard]] bool is_write_back_asynchronous() const { return asynchronous_write_back_; }
+        [[nodiscard]] unsigned long get_num_write_backs() const { return num_write_backs_; }
+        [[nodiscard]] sg_size_t get_num_written_back_bytes() const { return num_written_back_bytes_; }
+
+        void set_read_through(std::shared_ptr<FileSystem> origin_file_system, const std::string& origin_path);
+        [[nodiscard]] std::shared_ptr<FileSystem> get_origin_file_system() const { return origin_file_system_; }
+        [[nodiscard]] const std::string& get_origin_path() const { return origin_path_; }
+        [[nodiscard]] unsigned long get_num_cache_hits() const { return num_cache_hits_; }
+        [[nodiscard]] unsigned long get_num_cache_misses() const { return num_cache_misses_; }
+        [[nodiscard]] unsigned long get_num_fetches() const { return num_fetches_; }
+        [[nodiscard]] sg_size_t get_num_fetched_bytes() const { return num_fetched_bytes_; }
+        void set_admission_policy(std::shared_ptr<AdmissionPolicy> admission_policy);
+        [[nodiscard]] std::shared_ptr<AdmissionPolicy> get_admission_policy() const { return admission_policy_; }
+        [[nodiscard]] unsigned long get_num_rejections() const { return num_rejections_; }
 
     protected:
         friend class FileSystem;
         // Methods to perform caching
-        void make_file_evictable(const std::string &dir_path, const std::string &file_name, bool evictable) const;
+        void make_file_evictable(const std::string &dir_path, const std::string &file_name, bool evictable);
         virtual void create_space(sg_size_t num_bytes);
         virtual void new_file_creation_event(FileMetadata *file_metadata);
         virtual void new_file_access_event(FileMetadata *file_metadata);
         virtual void new_file_deletion_event(FileMetadata *file_metadata);
+        virtual void new_file_pin_change_event(FileMetadata *file_metadata);
+        // Called once the stored content of a file has been resized from old_size to its stored size
+        virtual void new_file_resize_event(FileMetadata *file_metadata, sg_size_t old_size);
+        // Method to place files on different storages
+        [[nodiscard]] virtual std::shared_ptr<Storage> get_storage_for_file(const FileMetadata *file_metadata) const {
+            return storage_;
+        }
+
+        [[nodiscard]] std::shared_ptr<Storage> get_storage() const { return storage_; }
+        [[nodiscard]] FileMetadata* get_file_metadata(const std::string& dir_path, const std::string& file_name) const;
+        // Methods to account for the space files actually occupy
+        [[nodiscard]] static sg_size_t get_physical_size(const FileMetadata *file_metadata, sg_size_t num_bytes);
+        [[nodiscard]] sg_size_t get_reclaimable_space(const FileMetadata *file_metadata) const;
 
     private:
         friend class File;
         friend class FileMetadata;
         friend class FileSystem;
 
+        struct Chunk {
+            sg_size_t size;
+            sg_size_t physical_size;
+            unsigned long refcount;
+        };
 
         std::string name_;
         FileSystem *file_system_;
         std::shared_ptr<Storage> storage_;
+        std::shared_ptr<EvictionPolicy> eviction_policy_;
+        std::shared_ptr<MetadataService> metadata_service_ = nullptr;
+        double directory_lock_hold_time_ = 0.0;
+        double compression_ratio_ = 1.0;
+        double compression_flops_per_byte_ = 0.0;
+        double decompression_flops_per_byte_ = 0.0;
+        sg_size_t deduplication_chunk_size_ = 0;
+        double hashing_flops_per_byte_ = 0.0;
+        std::unordered_map<std::string, Chunk> chunks_;
+        std::unordered_map<std::string, s4u::MutexPtr> directory_locks_;
+        std::unordered_map<std::string, DirectoryLockStatistics> directory_lock_statistics_;
+        double high_watermark_ = 1.0;
+        double low_watermark_ = 1.0;
+        s4u::ActorPtr eviction_actor_ = nullptr;
+        unsigned long num_foreground_evictions_ = 0;
+        unsigned long num_background_evictions_ = 0;
+        std::shared_ptr<FileSystem> backing_file_system_ = nullptr;
+        std::string backing_path_;
+        bool asynchronous_write_back_ = false;
+        unsigned long num_write_backs_ = 0;
+        sg_size_t num_written_back_bytes_ = 0;
+        std::shared_ptr<FileSystem> origin_file_system_ = nullptr;
+        std::string origin_path_;
+        std::unordered_map<std::string, s4u::MutexPtr> ongoing_fetches_;
+        unsigned long num_cache_hits_ = 0;
+        unsigned long num_cache_misses_ = 0;
+        unsigned long num_fetches_ = 0;
+        sg_size_t num_fetched_bytes_ = 0;
+        std::shared_ptr<AdmissionPolicy> admission_policy_ = nullptr;
+        unsigned long num_rejections_ = 0;
         sg_size_t size_ = 0;
         sg_size_t free_space_ = 0;
         std::unordered_map<std::string, std::unordered_map<std::string, std::unique_ptr<FileMetadata>>> content_;
 
-        void decrease_free_space(sg_size_t num_bytes) { free_space_ -= num_bytes; }
-        void increase_free_space(sg_size_t num_bytes) { free_space_ += num_bytes; }
-
-        [[nodiscard]] std::shared_ptr<Storage> get_storage() const { return storage_; }
-
         void create_new_directory(const std::string& dir_path);
         [[nodiscard]] bool directory_exists(const std::string& dir_path) const { return content_.find(dir_path) != content_.end(); }
         [[nodiscard]] std::set<std::string, std::less<>> list_files_in_directory(const std::string &dir_path) const;
         void delete_directory(const std::string &dir_path);
 
-        [[nodiscard]] FileMetadata* get_file_metadata(const std::string& dir_path, const std::string& file_name) const;
+        void hold_directory_locks(std::vector<std::string> dir_paths);
+        [[nodiscard]] DirectoryLockStatistics get_directory_lock_statistics(const std::string &dir_path) const;
+
         void create_new_file(const std::string& dir_path, const std::string& file_name, sg_size_t size);
         void move_file(const std::string& src_dir_path, const std::string& src_file_name,
                        const std::string& dst_dir_path, const std::string& dst_file_name);
         void truncate_file(const std::string &dir_path, const std::string &file_name, sg_size_t num_bytes);
-
-
+        void set_file_compression_ratio(const std::string &dir_path, const std::string &file_name, double ratio);
+        void set_file_fingerprints(const std::string &dir_path, const std::string &file_name, std::string fingerprint,
+                                   std::vector<std::string> chunk_fingerprints);
+
+        [[nodiscard]] std::string get_chunk_key(const FileMetadata *file_metadata, sg_size_t index,
+                                                sg_size_t file_size) const;
+        [[nodiscard]] sg_size_t get_space_needed(const FileMetadata *file_metadata, sg_size_t new_size) const;
+        [[nodiscard]] sg_size_t get_num_duplicate_bytes(const FileMetadata *file_metadata, sg_size_t offset,
+                                                        sg_size_t num_bytes, sg_size_t new_size) const;
+        void reserve_space(FileMetadata *file_metadata, sg_size_t new_size);
+        [[nodiscard]] s4u::Host* get_background_actor_host() const;
+        void start_background_eviction_if_needed();
+        bool evict_files_in_background();
+        [[nodiscard]] bool needs_write_back(const FileMetadata *file_metadata) const;
+        void write_back(FileMetadata *file_metadata);
+        bool write_back_and_evict(FileMetadata *file_metadata);
+        s4u::ActorPtr start_write_back_and_evict(FileMetadata *file_metadata,
+                                                 const std::shared_ptr<unsigned long>& num_evictions);
+        bool read_through(const std::string& dir_path, const std::string& file_name, FileMetadata*& pinned_file);
+        bool admit(const std::string& path, sg_size_t size);
+        sg_size_t select_files_to_evict(sg_size_t num_bytes, std::vector<FileMetadata*>& files_to_evict,
+                                        bool peek = false);
+        FileMetadata* fetch_from_origin(const std::string& dir_path, const std::string& file_name,
+                                        const std::string& origin_path);
+        void resize_stored_content(FileMetadata *file_metadata, sg_size_t new_size);
 
     protected:
         void delete_file(const std::string& dir_path, const std::string& file_name);
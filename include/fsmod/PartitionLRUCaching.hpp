@@ -6,15 +6,12 @@
 #ifndef SIMGRID_MODULE_FS_PARTITION_LRU_CACHING_H_
 #define SIMGRID_MODULE_FS_PARTITION_LRU_CACHING_H_
 
-#include <map>
-#include <set>
-#include <unordered_map>
 #include <memory>
 #include <string>
 #include <utility>
 
-#include "fsmod/PartitionFIFOCaching.hpp"
-#include "fsmod/FileMetadata.hpp"
+#include "fsmod/EvictionPolicy.hpp"
+#include "fsmod/Partition.hpp"
 
 namespace simgrid::fsmod {
 
@@ -22,17 +19,17 @@ namespace simgrid::fsmod {
 
     class Storage;
 
-    class XBT_PUBLIC PartitionLRUCaching : public PartitionFIFOCaching {
+    // Kept for one release: a partition with a LRUEvictionPolicy, which mount_partition() now creates
+    class [[deprecated("Use a Partition with a LRUEvictionPolicy instead")]] XBT_PUBLIC PartitionLRUCaching
+            : public Partition {
     public:
-        PartitionLRUCaching(std::string name, FileSystem *file_system, std::shared_ptr<Storage> storage, sg_size_t size) :
-                PartitionFIFOCaching(std::move(name), file_system, std::move(storage), size) {}
-
-    protected:
-        // Methods to perform caching
-        void new_file_access_event(FileMetadata *file_metadata) override;
+        PartitionLRUCaching(std::string name, FileSystem *file_system, std::shared_ptr<Storage> storage,
+                           sg_size_t size) :
+                Partition(std::move(name), file_system, std::move(storage), size,
+                          std::make_shared<LRUEvictionPolicy>()) {}
     };
 
-    /** \endcond     */
+    /** \endcond    */
 
 } // namespace simgrid::fsmod
 
@@ -0,0 +1,108 @@
+/* Copyright (c) 2024-2026. The FSMOD Team. All rights reserved.          */
+
+/* This program is free software; you can redistribute it and/or modify it
+ * under the terms of the license (GNU LGPL) which comes with this package. */
+
+#ifndef SIMGRID_MODULE_FS_PARTITION_TIERED_H_
+#define SIMGRID_MODULE_FS_PARTITION_TIERED_H_
+
+#include <simgrid/forward.h>
+#include <simgrid/s4u/Actor.hpp>
+
+#include <array>
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include <utility>
+
+#include "fsmod/Partition.hpp"
+#include "fsmod/FileMetadata.hpp"
+
+namespace simgrid::fsmod {
+
+    /**
+     * @brief A partition whose files are stored either on a fast tier (e.g., SSDs) or on a capacity tier (e.g., HDDs).
+     *        New files are placed on the fast tier when they fit. Each file has a heat, which increases by one at each
+     *        access and halves after each heat half-life without access. A background actor periodically demotes
+     *        files whose heat falls below a demotion threshold to the capacity tier, and promotes files whose heat
+     *        reaches a promotion threshold to the fast tier, reading and writing their content on both storages
+     */
+    class XBT_PUBLIC PartitionTiered : public Partition {
+    public:
+        /**
+         * @brief An enum that defines the tiers of a tiered partition
+         */
+        enum class Tier {
+            /** @brief The tier on which new and hot files are stored */
+            FAST = 0,
+            /** @brief The tier on which cold files are stored */
+            CAPACITY = 1
+        };
+
+        /** \cond EXCLUDE_FROM_DOCUMENTATION */
+        PartitionTiered(std::string name, FileSystem *file_system,
+                        std::shared_ptr<Storage> fast_storage, sg_size_t fast_tier_size,
+                        std::shared_ptr<Storage> capacity_storage, sg_size_t capacity_tier_size);
+        /** \endcond */
+
+        [[nodiscard]] std::shared_ptr<Storage> get_tier_storage(Tier tier) const;
+        [[nodiscard]] sg_size_t get_tier_size(Tier tier) const;
+        [[nodiscard]] sg_size_t get_tier_used_space(Tier tier) const;
+
+        [[nodiscard]] Tier get_file_tier(const std::string& full_path) const;
+        [[nodiscard]] double get_file_heat(const std::string& full_path) const;
+
+        void set_heat_half_life(double half_life);
+        [[nodiscard]] double get_heat_half_life() const { return heat_half_life_; }
+        void set_heat_thresholds(double promotion_threshold, double demotion_threshold);
+        [[nodiscard]] double get_promotion_threshold() const { return promotion_threshold_; }
+        [[nodiscard]] double get_demotion_threshold() const { return demotion_threshold_; }
+        void set_migration_interval(double interval);
+        [[nodiscard]] double get_migration_interval() const { return migration_interval_; }
+        void set_migration_rate(double rate);
+        [[nodiscard]] double get_migration_rate() const { return migration_rate_; }
+
+        s4u::ActorPtr start_migrations();
+        void migrate_file(const std::string& full_path, Tier tier);
+
+        [[nodiscard]] unsigned long get_num_promotions() const { return num_promotions_; }
+        [[nodiscard]] unsigned long get_num_demotions() const { return num_demotions_; }
+        [[nodiscard]] sg_size_t get_num_migrated_bytes() const { return num_migrated_bytes_; }
+
+    protected:
+        void new_file_creation_event(FileMetadata *file_metadata) override;
+        void new_file_access_event(FileMetadata *file_metadata) override;
+        void new_file_deletion_event(FileMetadata *file_metadata) override;
+        void new_file_resize_event(FileMetadata *file_metadata, sg_size_t old_size) override;
+        [[nodiscard]] std::shared_ptr<Storage> get_storage_for_file(const FileMetadata *file_metadata) const override;
+
+    private:
+        std::shared_ptr<Storage> capacity_storage_;
+        sg_size_t fast_tier_size_;
+        sg_size_t capacity_tier_size_;
+
+        double heat_half_life_ = 60.0;
+        double promotion_threshold_ = 4.0;
+        double demotion_threshold_ = 0.5;
+        double migration_interval_ = 10.0;
+        double migration_rate_ = 0;
+
+        unsigned long num_promotions_ = 0;
+        unsigned long num_demotions_ = 0;
+        sg_size_t num_migrated_bytes_ = 0;
+
+        s4u::ActorPtr migration_actor_ = nullptr;
+        std::unordered_set<FileMetadata*> files_;
+        // The stored size of the files of each tier, indexed by tier
+        std::array<sg_size_t, 2> tier_used_space_ = {0, 0};
+        std::unordered_set<FileMetadata*> migrating_files_;
+
+        [[nodiscard]] double get_heat(const FileMetadata *file_metadata) const;
+        [[nodiscard]] FileMetadata* get_file_metadata_at_path(const std::string& full_path) const;
+        void migrate(FileMetadata *file_metadata, Tier tier);
+        void run_migrations();
+    };
+
+} // namespace simgrid::fsmod
+
+#endif
@@ -0,0 +1,82 @@
+/* Copyright (c) 2024-2026. The FSMOD Team. All rights reserved.          */
+
+/* This program is free software; you can redistribute it and/or modify it
+ * under the terms of the license (GNU LGPL) which comes with this package. */
+
+#ifndef FSMOD_QOSPOLICY_HPP
+#define FSMOD_QOSPOLICY_HPP
+
+#include <simgrid/forward.h>
+
+#include <memory>
+
+namespace simgrid::fsmod {
+
+    /**
+     * @brief A class that implements an I/O quality-of-service policy, which throttles the reads and writes made
+     *        through files with token buckets that cap their bandwidth and their number of operations per second,
+     *        and gives their I/O activities a priority class. A policy applies to a whole file system, to an actor,
+     *        or to the files tagged with a user-defined tag, and all the requests it applies to share its buckets
+     */
+    class XBT_PUBLIC QoSPolicy {
+    public:
+        /**
+         * @brief An enum that defines priority classes, which are mapped onto the sharing weights of I/O activities
+         */
+        enum class PriorityClass {
+            /** @brief I/O activities get half the share of a normal activity */
+            LOW,
+            /** @brief I/O activities get the default share */
+            NORMAL,
+            /** @brief I/O activities get twice the share of a normal activity */
+            HIGH
+        };
+
+        QoSPolicy() = default;
+        static std::shared_ptr<QoSPolicy> create();
+
+        void set_bandwidth_limit(double bandwidth, sg_size_t burst_size);
+        [[nodiscard]] double get_bandwidth_limit() const { return bandwidth_bucket_.rate; }
+        [[nodiscard]] sg_size_t get_burst_size() const { return static_cast<sg_size_t>(bandwidth_bucket_.capacity); }
+
+        void set_iops_limit(double iops, unsigned long burst_operations = 1);
+        [[nodiscard]] double get_iops_limit() const { return iops_bucket_.rate; }
+        [[nodiscard]] unsigned long get_burst_operations() const {
+            return static_cast<unsigned long>(iops_bucket_.capacity);
+        }
+
+        void set_priority_class(PriorityClass priority_class) { priority_class_ = priority_class; }
+        [[nodiscard]] PriorityClass get_priority_class() const { return priority_class_; }
+        [[nodiscard]] static double get_priority_weight(PriorityClass priority_class);
+
+        [[nodiscard]] unsigned long get_num_requests() const { return num_requests_; }
+        [[nodiscard]] unsigned long get_num_throttled_requests() const { return num_throttled_requests_; }
+        [[nodiscard]] double get_total_throttling_delay() const { return total_throttling_delay_; }
+
+    private:
+        friend class File;
+
+        // A bucket that fills at a given rate up to its capacity. Requests take tokens even when there are not
+        // enough of them, and must then wait until the debt is paid back, which caps the long-term rate
+        struct TokenBucket {
+            double rate = 0; // 0 means unlimited
+            double capacity = 0;
+            double tokens = 0;
+            double last_update_date = 0;
+
+            double take(double amount);
+        };
+
+        TokenBucket bandwidth_bucket_;
+        TokenBucket iops_bucket_;
+        PriorityClass priority_class_ = PriorityClass::NORMAL;
+
+        unsigned long num_requests_ = 0;
+        unsigned long num_throttled_requests_ = 0;
+        double total_throttling_delay_ = 0;
+
+        double admit(sg_size_t num_bytes);
+    };
+} // namespace simgrid::fsmod
+
+#endif //FSMOD_QOSPOLICY_HPP
@@ -0,0 +1,75 @@
+/* Copyright (c) 2024-2026. The FSMOD Team. All rights reserved.          */
+
+/* This program is free software; you can redistribute it and/or modify it
+ * under the terms of the license (GNU LGPL) which comes with this package. */
+
+#ifndef FSMOD_REPLICATEDSTORAGE_HPP
+#define FSMOD_REPLICATEDSTORAGE_HPP
+
+#include <unordered_map>
+#include <vector>
+
+#include "Storage.hpp"
+
+namespace simgrid::fsmod {
+
+    /**
+     * @brief A class that implements a replicated storage (e.g., HDFS), in which each file is stored on a number of
+     *        disks attached to different hosts. Writes go to all the replicas of a file, and reads go to the replica
+     *        with the lowest estimated cost from the host of the reader
+     */
+    class XBT_PUBLIC ReplicatedStorage : public Storage {
+    public:
+        /**
+         * @brief An enum that defines how writes reach the replicas of a file
+         */
+        enum class ReplicationMode {
+            /** @brief The client sends data to the first replica, which forwards it to the second one, and so on.
+             * All hops of the chain transfer data concurrently */
+            PIPELINE,
+            /** @brief The client sends data to all replicas concurrently */
+            FAN_OUT
+        };
+
+        ReplicatedStorage(const std::string &name, const std::vector<s4u::Disk*> &disks,
+                          unsigned long replication_factor, ReplicationMode replication_mode);
+        ~ReplicatedStorage() override = default;
+        static std::shared_ptr<ReplicatedStorage> create(const std::string &name, const std::vector<s4u::Disk*> &disks,
+                                                         unsigned long replication_factor,
+                                                         ReplicationMode replication_mode = ReplicationMode::PIPELINE);
+
+        [[nodiscard]] unsigned long get_replication_factor() const { return replication_factor_; }
+        [[nodiscard]] ReplicationMode get_replication_mode() const { return replication_mode_; }
+
+        [[nodiscard]] sg_size_t get_num_bytes_written() const { return num_bytes_written_; }
+        [[nodiscard]] sg_size_t get_num_replica_bytes_written() const { return num_replica_bytes_written_; }
+        [[nodiscard]] double get_write_amplification() const;
+        [[nodiscard]] sg_size_t get_disk_num_bytes_read(unsigned long disk_index) const;
+        [[nodiscard]] unsigned long get_num_placed_files() const { return replicas_.size(); }
+
+        [[nodiscard]] double estimate_read_cost(s4u::Disk *disk, s4u::Host *client_host, sg_size_t size) const;
+
+    protected:
+        s4u::IoPtr read_async(const IOContext& context, sg_offset_t offset, sg_size_t size) override;
+        void read(const IOContext& context, sg_offset_t offset, sg_size_t size) override;
+        s4u::IoPtr write_async(const IOContext& context, sg_offset_t offset, sg_size_t size,
+                               bool detached = false) override;
+        void write(const IOContext& context, sg_offset_t offset, sg_size_t size) override;
+        void on_file_deletion(unsigned long file_id) override { replicas_.erase(file_id); }
+
+    private:
+        unsigned long replication_factor_;
+        ReplicationMode replication_mode_;
+        // The indices of the disks that hold the replicas of each file, in replication chain order
+        std::unordered_map<unsigned long, std::vector<unsigned long>> replicas_;
+        unsigned long next_first_replica_ = 0;
+
+        sg_size_t num_bytes_written_ = 0;
+        sg_size_t num_replica_bytes_written_ = 0;
+        std::vector<sg_size_t> disk_num_bytes_read_;
+
+        std::vector<unsigned long> get_file_replicas(unsigned long file_id, s4u::Host *client_host);
+    };
+} // namespace simgrid::fsmod
+
+#endif //FSMOD_REPLICATEDSTORAGE_HPP
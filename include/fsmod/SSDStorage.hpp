@@ -0,0 +1,78 @@
+/* Copyright (c) 2024-2026. The FSMOD Team. All rights reserved.          */
+
+/* This program is free software; you can redistribute it and/or modify it
+ * under the terms of the license (GNU LGPL) which comes with this package. */
+
+#ifndef FSMOD_SSDSTORAGE_HPP
+#define FSMOD_SSDSTORAGE_HPP
+
+#include <memory>
+
+#include "Storage.hpp"
+
+namespace simgrid::fsmod {
+
+    /**
+     * @brief A class that implements a one-disk storage that models a solid-state drive. Each operation pays a
+     *        fixed latency, and the drive serves a bounded number of operations per second, so that small I/Os are
+     *        limited by IOPS rather than by bandwidth. Writes are amplified by the drive's garbage collection, the
+     *        more so as the partitions mounted on the storage fill up, and the drive periodically stalls to collect
+     *        garbage when its free space runs low
+     */
+    class XBT_PUBLIC SSDStorage : public Storage, public std::enable_shared_from_this<SSDStorage> {
+    public:
+        SSDStorage(const std::string &name, s4u::Disk *disk, double max_iops, double operation_latency);
+        ~SSDStorage() override = default;
+        static std::shared_ptr<SSDStorage> create(const std::string &name, s4u::Disk *disk, double max_iops,
+                                                  double operation_latency = 0);
+
+        [[nodiscard]] double get_max_iops() const { return max_iops_; }
+        [[nodiscard]] double get_operation_latency() const { return operation_latency_; }
+
+        void set_over_provisioning(double over_provisioning);
+        [[nodiscard]] double get_over_provisioning() const { return over_provisioning_; }
+        [[nodiscard]] double get_write_amplification() const;
+
+        void set_garbage_collection(double free_space_threshold, sg_size_t period, double stall_duration);
+        [[nodiscard]] double get_gc_free_space_threshold() const { return gc_free_space_threshold_; }
+        [[nodiscard]] sg_size_t get_gc_period() const { return gc_period_; }
+        [[nodiscard]] double get_gc_stall_duration() const { return gc_stall_duration_; }
+
+        [[nodiscard]] sg_size_t get_num_bytes_written() const { return num_bytes_written_; }
+        [[nodiscard]] sg_size_t get_num_physical_bytes_written() const { return num_physical_bytes_written_; }
+        [[nodiscard]] unsigned long get_num_gc_stalls() const { return num_gc_stalls_; }
+        [[nodiscard]] double get_total_stall_time() const { return total_stall_time_; }
+
+    protected:
+        s4u::IoPtr read_async(const IOContext& context, sg_offset_t offset, sg_size_t size) override;
+        void read(const IOContext& context, sg_offset_t offset, sg_size_t size) override;
+        s4u::IoPtr write_async(const IOContext& context, sg_offset_t offset, sg_size_t size,
+                               bool detached = false) override;
+        void write(const IOContext& context, sg_offset_t offset, sg_size_t size) override;
+
+    private:
+        double max_iops_;
+        double operation_latency_;
+        double over_provisioning_ = 0.07;
+
+        double gc_free_space_threshold_ = 0;
+        sg_size_t gc_period_ = 0;
+        double gc_stall_duration_ = 0;
+        sg_size_t num_bytes_since_gc_ = 0;
+        double stall_end_date_ = 0;
+
+        sg_size_t num_bytes_written_ = 0;
+        sg_size_t num_physical_bytes_written_ = 0;
+        unsigned long num_gc_stalls_ = 0;
+        double total_stall_time_ = 0;
+
+        [[nodiscard]] sg_size_t get_physical_size(s4u::Io::OpType op_type, sg_size_t size) const;
+        s4u::IoPtr create_io(s4u::Io::OpType op_type, sg_size_t physical_size);
+        void account_for_write(sg_size_t size, sg_size_t physical_size);
+        void wait_for_garbage_collection() const;
+        void perform(s4u::Io::OpType op_type, sg_size_t size);
+        s4u::IoPtr start(s4u::Io::OpType op_type, sg_size_t size, bool detached);
+    };
+} // namespace simgrid::fsmod
+
+#endif //FSMOD_SSDSTORAGE_HPP
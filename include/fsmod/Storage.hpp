@@ -10,15 +10,36 @@
 #include <simgrid/s4u/Host.hpp>
 #include <simgrid/s4u/Actor.hpp>
 #include <simgrid/s4u/MessageQueue.hpp>
+#include <simgrid/s4u/Semaphore.hpp>
 
 #include <atomic>
 #include <boost/intrusive_ptr.hpp>
 #include <utility>
 
+#include "IOScheduler.hpp"
 #include "Partition.hpp"
 
 namespace simgrid::fsmod {
 
+    /**
+     * @brief The context of an I/O, which storages receive with each request and pass on to the storages they
+     *        are built on
+     */
+    struct XBT_PUBLIC IOContext {
+        /** @brief The identifier of the accessed file, or 0 if the I/O does not come from a file */
+        unsigned long file_id = 0;
+        /** @brief The host to/from which data is transferred, or nullptr for the host of the calling actor */
+        s4u::Host* client_host = nullptr;
+
+        /**
+         * @brief Retrieve the host to/from which data is transferred
+         * @return A host
+         */
+        [[nodiscard]] s4u::Host* get_client_host() const {
+            return client_host ? client_host : s4u::Host::current();
+        }
+    };
+
     /**
      * @brief A class that implements a storage abstraction
      */
@@ -33,6 +54,14 @@ namespace simgrid::fsmod {
         [[nodiscard]] s4u::Disk* get_first_disk() const;
         [[nodiscard]] s4u::Disk* get_disk_at(unsigned long position) const;
         [[nodiscard]] virtual s4u::ActorPtr start_controller(s4u::Host* host, const std::function<void()> &func);
+        s4u::ActorPtr start_controller(s4u::Host* host, std::shared_ptr<IOScheduler> scheduler,
+                                       unsigned long max_concurrent_requests = 1);
+
+        [[nodiscard]] std::shared_ptr<IOScheduler> get_io_scheduler() const { return io_scheduler_; }
+        [[nodiscard]] unsigned long get_max_concurrent_requests() const { return max_concurrent_requests_; }
+        [[nodiscard]] unsigned long get_num_running_requests() const { return num_running_requests_; }
+
+        static void wait_for_completion(const s4u::IoPtr& completion);
 
         virtual ~Storage() = default;
         
@@ -42,18 +71,56 @@ namespace simgrid::fsmod {
         void set_disk(s4u::Disk* disk) { disks_.push_back(disk); }
         void set_disks(const std::vector<s4u::Disk*>& disks) { disks_ = disks; }
 
+        [[nodiscard]] sg_size_t get_used_space() const;
+        [[nodiscard]] double get_fill_level() const;
+
+        [[nodiscard]] std::pair<s4u::IoPtr, s4u::IoPtr> init_completion(s4u::Io::OpType op_type,
+                                                                        const std::string& name) const;
+        static void fail_completion(const s4u::IoPtr& completion);
+        s4u::IoPtr start_in_background(s4u::Host* host, s4u::Io::OpType op_type, const std::string& name,
+                                       const std::function<void()>& work, bool detached = false) const;
+
         friend class File;
-        virtual s4u::IoPtr read_async(sg_size_t size) = 0;
-        virtual void read(sg_size_t size) = 0;
+        friend class ClientCache;
+        friend class Partition;
+        friend class PartitionTiered;
+        friend class CachedStorage;
+        friend class StripedStorage;
+        s4u::IoPtr submit_read_async(const IOContext& context, sg_offset_t offset, sg_size_t size);
+        void submit_read(const IOContext& context, sg_offset_t offset, sg_size_t size);
+        s4u::IoPtr submit_write_async(const IOContext& context, sg_offset_t offset, sg_size_t size,
+                                      bool detached = false);
+        void submit_write(const IOContext& context, sg_offset_t offset, sg_size_t size);
+
+        virtual s4u::IoPtr read_async(const IOContext& context, sg_offset_t offset, sg_size_t size) = 0;
+        virtual void read(const IOContext& context, sg_offset_t offset, sg_size_t size) = 0;
 
-        virtual s4u::IoPtr write_async(sg_size_t size, bool detached = false) = 0;
-        virtual void write(sg_size_t size) = 0;
+        virtual s4u::IoPtr write_async(const IOContext& context, sg_offset_t offset, sg_size_t size,
+                                       bool detached = false) = 0;
+        virtual void write(const IOContext& context, sg_offset_t offset, sg_size_t size) = 0;
+
+        /**
+         * @brief Notify the storage that a file it holds has been deleted, or has left it, so that it forgets what
+         *        it knows about that file
+         * @param file_id: the file's identifier
+         */
+        virtual void on_file_deletion(unsigned long /*file_id*/) {}
 
     private:
         std::string name_;
         std::vector<s4u::Disk*> disks_;
         s4u::Host* controller_host_ = nullptr;
         s4u::ActorPtr controller_ = nullptr;
+
+        std::shared_ptr<IOScheduler> io_scheduler_ = nullptr;
+        unsigned long max_concurrent_requests_ = 1;
+        unsigned long num_running_requests_ = 0;
+        s4u::SemaphorePtr request_arrivals_ = nullptr;
+        std::vector<const Partition*> partitions_;
+
+        s4u::IoPtr enqueue_request(s4u::Io::OpType op_type, const IOContext& context, sg_offset_t offset,
+                                   sg_size_t size);
+        void dispatch_requests();
     };
 
 } // namespace simgrid::fsmod
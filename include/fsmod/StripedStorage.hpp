@@ -0,0 +1,75 @@
+/* Copyright (c) 2024-2026. The FSMOD Team. All rights reserved.          */
+
+/* This program is free software; you can redistribute it and/or modify it
+ * under the terms of the license (GNU LGPL) which comes with this package. */
+
+#ifndef FSMOD_STRIPEDSTORAGE_HPP
+#define FSMOD_STRIPEDSTORAGE_HPP
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "Storage.hpp"
+
+namespace simgrid::fsmod {
+
+    /**
+     * @brief A class that implements a parallel file system storage (e.g., Lustre), in which the content of each
+     *        file is striped over several storage targets, typically remote storages on different server hosts.
+     *        A file is cut in stripes of a given size that are assigned to a given number of targets in round-robin
+     *        fashion. A request is split over the targets that hold its stripes, which all serve it concurrently
+     */
+    class XBT_PUBLIC StripedStorage : public Storage {
+    public:
+        StripedStorage(const std::string &name, const std::vector<std::shared_ptr<Storage>> &targets,
+                       unsigned long stripe_count, sg_size_t stripe_size);
+        ~StripedStorage() override = default;
+        static std::shared_ptr<StripedStorage> create(const std::string &name,
+                                                      const std::vector<std::shared_ptr<Storage>> &targets,
+                                                      unsigned long stripe_count = 1,
+                                                      sg_size_t stripe_size = 1048576);
+
+        [[nodiscard]] const std::vector<std::shared_ptr<Storage>>& get_targets() const { return targets_; }
+        [[nodiscard]] unsigned long get_num_targets() const { return targets_.size(); }
+        [[nodiscard]] unsigned long get_stripe_count() const { return stripe_count_; }
+        [[nodiscard]] sg_size_t get_stripe_size() const { return stripe_size_; }
+        void set_default_layout(unsigned long stripe_count, sg_size_t stripe_size);
+
+        [[nodiscard]] sg_size_t get_target_num_bytes(unsigned long target_index) const;
+        [[nodiscard]] unsigned long get_num_file_layouts() const { return layouts_.size(); }
+
+    protected:
+        s4u::IoPtr read_async(const IOContext& context, sg_offset_t offset, sg_size_t size) override;
+        void read(const IOContext& context, sg_offset_t offset, sg_size_t size) override;
+        s4u::IoPtr write_async(const IOContext& context, sg_offset_t offset, sg_size_t size,
+                               bool detached = false) override;
+        void write(const IOContext& context, sg_offset_t offset, sg_size_t size) override;
+        void on_file_deletion(unsigned long file_id) override;
+
+    private:
+        friend class FileSystem;
+
+        // The stripe count, stripe size, and first target of a file
+        struct Layout {
+            unsigned long stripe_count;
+            sg_size_t stripe_size;
+            unsigned long first_target;
+        };
+
+        std::vector<std::shared_ptr<Storage>> targets_;
+        unsigned long stripe_count_;
+        sg_size_t stripe_size_;
+        std::unordered_map<unsigned long, Layout> layouts_;
+        unsigned long next_first_target_ = 0;
+        std::vector<sg_size_t> target_num_bytes_;
+
+        void check_layout(unsigned long stripe_count, sg_size_t stripe_size) const;
+        void set_file_layout(unsigned long file_id, unsigned long stripe_count, sg_size_t stripe_size);
+        Layout get_file_layout(unsigned long file_id);
+        s4u::IoPtr submit_to_targets(s4u::Io::OpType op_type, const IOContext& context, sg_offset_t offset,
+                                     sg_size_t size);
+    };
+} // namespace simgrid::fsmod
+
+#endif //FSMOD_STRIPEDSTORAGE_HPP
@@ -0,0 +1,85 @@
+/* Copyright (c) 2024-2026. The FSMOD Team. All rights reserved.          */
+
+/* This program is free software; you can redistribute it and/or modify it
+ * under the terms of the license (GNU LGPL) which comes with this package. */
+
+#include "fsmod/AdmissionPolicy.hpp"
+#include "fsmod/PathUtil.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <stdexcept>
+
+namespace simgrid::fsmod {
+
+    /**
+     * @brief Constructor
+     * @param max_size: the size of the largest files to admit
+     */
+    MaxSizeAdmissionPolicy::MaxSizeAdmissionPolicy(sg_size_t max_size) : max_size_(max_size) {
+        if (max_size == 0)
+            throw std::invalid_argument("The maximum size of the files admitted in a partition must be positive");
+    }
+
+    bool SecondHitAdmissionPolicy::admit(const std::string &path, sg_size_t size,
+                                         const std::vector<const FileMetadata*> &victims) {
+        if (ghosts_.remove(path))
+            return true;
+        ghosts_.push(path, size);
+        ghosts_.trim(get_partition_size());
+        return false;
+    }
+
+    /**
+     * @brief Constructor
+     * @param num_counters: the number of counters in each of the four rows of the sketch, which should be about
+     *        the number of files that the partition can hold
+     */
+    TinyLFUAdmissionPolicy::TinyLFUAdmissionPolicy(size_t num_counters)
+        : num_counters_(num_counters), counters_(NUM_ROWS * num_counters, 0), sample_size_(10 * num_counters) {
+        if (num_counters == 0)
+            throw std::invalid_argument("The number of counters of a TinyLFU sketch must be positive");
+    }
+
+    size_t TinyLFUAdmissionPolicy::get_index(const std::string &path, int row) const {
+        // Derive the hash of each row from two hashes of the path (double hashing)
+        std::uint64_t hash = std::hash<std::string>{}(path);
+        std::uint64_t second_hash = hash * 0x9E3779B97F4A7C15ULL;
+        second_hash = (second_hash ^ (second_hash >> 31)) | 1;
+        auto column = static_cast<size_t>((hash + static_cast<std::uint64_t>(row) * second_hash) % num_counters_);
+        return static_cast<size_t>(row) * num_counters_ + column;
+    }
+
+    unsigned int TinyLFUAdmissionPolicy::get_estimated_frequency(const std::string &path) const {
+        std::uint8_t frequency = MAX_COUNT;
+        for (int row = 0; row < NUM_ROWS; row++)
+            frequency = std::min(frequency, counters_[get_index(path, row)]);
+        return frequency;
+    }
+
+    void TinyLFUAdmissionPolicy::on_access(const std::string &path) {
+        // Only increment the smallest counters (conservative update), which makes estimates more accurate
+        auto frequency = get_estimated_frequency(path);
+        for (int row = 0; row < NUM_ROWS; row++) {
+            auto &counter = counters_[get_index(path, row)];
+            if (counter == frequency && counter < MAX_COUNT)
+                counter++;
+        }
+        // Age all counters once the sample is complete
+        if (++num_accesses_ >= sample_size_) {
+            for (auto &counter : counters_)
+                counter /= 2;
+            num_accesses_ /= 2;
+        }
+    }
+
+    bool TinyLFUAdmissionPolicy::admit(const std::string &path, sg_size_t size,
+                                       const std::vector<const FileMetadata*> &victims) {
+        auto frequency = get_estimated_frequency(path);
+        return std::all_of(victims.begin(), victims.end(), [this, frequency](const FileMetadata *victim) {
+            auto victim_path = PathUtil::simplify_path_string(victim->get_dir_path() + "/" + victim->get_file_name());
+            return frequency > get_estimated_frequency(victim_path);
+        });
+    }
+
+} // namespace simgrid::fsmod
@@ -0,0 +1,327 @@
+/* Copyright (c) 2024-2026. The FSMOD Team. All rights reserved.          */
+
+/* This program is free software; you can redistribute it and/or modify it
+ * under the terms of the license (GNU LGPL) which comes with this package. */
+
+#include "fsmod/CachedStorage.hpp"
+#include <simgrid/s4u/ActivitySet.hpp>
+#include <simgrid/s4u/Actor.hpp>
+
+#include <algorithm>
+
+XBT_LOG_NEW_DEFAULT_CATEGORY(fsmod_cached_storage, "File System module: Cached storage related logs");
+
+namespace simgrid::fsmod {
+
+    /**
+     * @brief Create an instance of a cached storage
+     * @param name: the storage's name
+     * @param backing_storage: the storage whose blocks are cached
+     * @param cache_disk: the disk that stores cached blocks
+     * @param cache_size: the number of bytes of the cache disk used by the cache
+     * @param block_size: the caching granularity in bytes (default: 64KiB)
+     * @param write_policy: how writes are handled (default: CachedStorage::WritePolicy::WRITE_THROUGH)
+     * @return a cached storage instance
+     */
+    std::shared_ptr<CachedStorage> CachedStorage::create(const std::string& name,
+                                                         std::shared_ptr<Storage> backing_storage,
+                                                         s4u::Disk* cache_disk, sg_size_t cache_size,
+                                                         sg_size_t block_size, WritePolicy write_policy) {
+        return std::make_shared<CachedStorage>(name, std::move(backing_storage), cache_disk, cache_size, block_size,
+                                               write_policy);
+    }
+
+    CachedStorage::CachedStorage(const std::string& name, std::shared_ptr<Storage> backing_storage,
+                                 s4u::Disk* cache_disk, sg_size_t cache_size, sg_size_t block_size,
+                                 WritePolicy write_policy)
+        : Storage(name), backing_storage_(std::move(backing_storage)), cache_disk_(cache_disk),
+          block_size_(block_size), write_policy_(write_policy) {
+        if (not backing_storage_)
+            throw std::invalid_argument("A cached storage requires a backing storage");
+        if (block_size == 0)
+            throw std::invalid_argument("The block size of a cached storage must be positive");
+        if (cache_size < block_size)
+            throw std::invalid_argument("The cache of a cached storage must hold at least one block");
+        num_cache_blocks_ = cache_size / block_size;
+        // The backing storage's disks come first, so that its first disk remains the first disk of the storage
+        set_disks(backing_storage_->get_disks());
+        set_disk(cache_disk);
+    }
+
+    /**
+     * @brief Retrieve the fraction of the blocks accessed by reads that were found in the cache
+     * @return A hit rate between 0 and 1
+     */
+    double CachedStorage::get_read_hit_rate() const {
+        auto num_reads = num_read_hits_ + num_read_misses_;
+        return (num_reads == 0) ? 0.0 : static_cast<double>(num_read_hits_) / static_cast<double>(num_reads);
+    }
+
+    /**
+     * @brief Write all dirty blocks to the backing storage. This method must be called from an actor and returns
+     *        once all blocks have been written
+     */
+    void CachedStorage::flush() {
+        WriteBacks write_backs;
+        for (auto& [block_id, block] : blocks_) {
+            if (not block.dirty)
+                continue;
+            add_write_back(block_id, write_backs);
+            block.dirty = false;
+        }
+        num_dirty_blocks_ = 0;
+        s4u::ActivitySet pending_ios;
+        for (const auto& io : start_write_backs(write_backs, false))
+            pending_ios.push(io);
+        pending_ios.wait_all();
+    }
+
+    /**
+     * @brief Set the delay between two flushes of the dirty blocks by a background actor, which runs on the host
+     *        of the cache disk
+     * @param interval: a delay in seconds (0 means that dirty blocks are only written back when evicted or when
+     *                  flush() is called)
+     */
+    void CachedStorage::set_flush_interval(double interval) {
+        if (interval < 0)
+            throw std::invalid_argument("The flush interval of a cached storage cannot be negative");
+        flush_interval_ = interval;
+        if (flush_interval_ == 0 || flusher_)
+            return;
+
+        // Do not keep the storage alive because its flusher still runs
+        std::weak_ptr<CachedStorage> weak_storage = weak_from_this();
+        flusher_ = cache_disk_->get_host()->add_actor(get_name() + "_flusher", [weak_storage]() {
+            while (true) {
+                double interval;
+                if (auto storage = weak_storage.lock())
+                    interval = storage->flush_interval_;
+                else
+                    return;
+                if (interval == 0)
+                    break;
+                s4u::this_actor::sleep_for(interval);
+                if (auto storage = weak_storage.lock())
+                    storage->flush();
+                else
+                    return;
+            }
+            if (auto storage = weak_storage.lock())
+                storage->flusher_ = nullptr;
+        });
+        flusher_->daemonize();
+    }
+
+    std::vector<std::pair<sg_size_t, sg_size_t>> CachedStorage::split_in_blocks(sg_offset_t offset,
+                                                                                sg_size_t size) const {
+        std::vector<std::pair<sg_size_t, sg_size_t>> blocks;
+        auto start = static_cast<sg_size_t>(offset);
+        auto end = start + size;
+        for (sg_size_t block_idx = start / block_size_; block_idx * block_size_ < end; block_idx++) {
+            auto block_start = std::max(start, block_idx * block_size_);
+            auto block_end = std::min(end, (block_idx + 1) * block_size_);
+            blocks.emplace_back(block_idx, block_end - block_start);
+        }
+        return blocks;
+    }
+
+    void CachedStorage::insert_block(const BlockId& block_id, bool dirty, WriteBacks& write_backs) {
+        if (blocks_.size() == num_cache_blocks_) {
+            auto victim_id = lru_list_.back();
+            XBT_DEBUG("Evicting block %llu of file %lu", victim_id.second, victim_id.first);
+            if (blocks_[victim_id].dirty) {
+                add_write_back(victim_id, write_backs);
+                num_dirty_blocks_--;
+            }
+            lru_list_.pop_back();
+            blocks_.erase(victim_id);
+            num_evicted_blocks_++;
+        }
+        lru_list_.push_front(block_id);
+        blocks_[block_id] = {lru_list_.begin(), dirty};
+        if (dirty)
+            num_dirty_blocks_++;
+    }
+
+    void CachedStorage::touch_block(Block& block) {
+        lru_list_.splice(lru_list_.begin(), lru_list_, block.lru_position);
+    }
+
+    void CachedStorage::add_write_back(const BlockId& block_id, WriteBacks& write_backs) {
+        auto block_offset = static_cast<sg_offset_t>(block_id.second * block_size_);
+        auto [it, inserted] = write_backs.try_emplace(block_id.first, block_offset, 0);
+        it->second.first = std::min(it->second.first, block_offset);
+        it->second.second += block_size_;
+        num_flushed_blocks_++;
+    }
+
+    s4u::IoPtr CachedStorage::create_cache_disk_io(sg_size_t size, s4u::Io::OpType op_type,
+                                                   s4u::Host* client_host) const {
+        auto* cache_host = cache_disk_->get_host();
+        if (client_host == cache_host)
+            return cache_disk_->io_init(size, op_type);
+        // Data is transferred between the client and the host of the cache disk
+        if (op_type == s4u::Io::OpType::READ)
+            return s4u::Io::streamto_init(cache_host, cache_disk_, client_host, nullptr)->set_size(size);
+        return s4u::Io::streamto_init(client_host, nullptr, cache_host, cache_disk_)->set_size(size);
+    }
+
+    std::vector<s4u::IoPtr> CachedStorage::start_write_backs(const WriteBacks& write_backs, bool detached) {
+        std::vector<s4u::IoPtr> ios;
+        for (const auto& [file_id, write_back] : write_backs) {
+            auto [offset, num_bytes] = write_back;
+            XBT_DEBUG("Writing back %llu bytes of file %lu", num_bytes, file_id);
+            // Read the dirty blocks from the cache disk while writing them to the backing storage
+            auto cache_io = cache_disk_->io_init(num_bytes, s4u::Io::OpType::READ);
+            cache_io->set_name("Cache Write Back");
+            // The data is sent from the host of the cache disk
+            auto backing_io = backing_storage_->submit_write_async({file_id, cache_disk_->get_host()}, offset,
+                                                                   num_bytes, detached);
+            if (detached) {
+                cache_io->detach();
+            } else {
+                cache_io->start();
+                ios.push_back(cache_io);
+                ios.push_back(backing_io);
+            }
+        }
+        return ios;
+    }
+
+    s4u::IoPtr CachedStorage::read_async(const IOContext& context, sg_offset_t offset, sg_size_t size) {
+        auto file_id = context.file_id;
+        auto* client_host = context.get_client_host();
+        auto blocks = split_in_blocks(offset, size);
+
+        s4u::IoPtr completion_activity = s4u::Io::init()->set_op_type(s4u::Io::OpType::READ)->set_size(0);
+        completion_activity->set_name("Cached Storage Read Completion");
+
+        // Requests larger than the cache bypass it, so as not to flush it
+        if (blocks.size() > num_cache_blocks_) {
+            num_read_misses_ += blocks.size();
+            auto backing_io = backing_storage_->submit_read_async({file_id, client_host}, offset, size);
+            backing_io->add_successor(completion_activity);
+            completion_activity->set_disk(cache_disk_);
+            return completion_activity;
+        }
+
+        sg_size_t hit_bytes = 0;
+        sg_size_t miss_bytes = 0;
+        sg_offset_t miss_offset = offset;
+        WriteBacks write_backs;
+        for (const auto& [block_idx, num_bytes] : blocks) {
+            BlockId block_id(file_id, block_idx);
+            if (auto it = blocks_.find(block_id); it != blocks_.end()) {
+                num_read_hits_++;
+                hit_bytes += num_bytes;
+                touch_block(it->second);
+                continue;
+            }
+            num_read_misses_++;
+            if (miss_bytes == 0)
+                miss_offset = std::max(offset, static_cast<sg_offset_t>(block_idx * block_size_));
+            miss_bytes += num_bytes;
+            insert_block(block_id, false, write_backs);
+        }
+        // Dirty blocks evicted to make room are written back in the background
+        start_write_backs(write_backs, true);
+
+        // Hits are served by the cache disk
+        if (hit_bytes > 0) {
+            auto cache_io = create_cache_disk_io(hit_bytes, s4u::Io::OpType::READ, client_host);
+            cache_io->set_name("Cache Hit");
+            cache_io->add_successor(completion_activity);
+            cache_io->detach();
+        }
+        // Misses are served by the backing storage, and then inserted in the cache without delaying the client
+        if (miss_bytes > 0) {
+            auto backing_io = backing_storage_->submit_read_async({file_id, client_host}, miss_offset, miss_bytes);
+            backing_io->add_successor(completion_activity);
+            auto fill_io = cache_disk_->io_init(miss_bytes, s4u::Io::OpType::WRITE);
+            fill_io->set_name("Cache Fill");
+            backing_io->add_successor(fill_io);
+            fill_io->detach();
+        }
+
+        completion_activity->set_disk(cache_disk_);
+        return completion_activity;
+    }
+
+    void CachedStorage::read(const IOContext& context, sg_offset_t offset, sg_size_t size) {
+        wait_for_completion(read_async(context, offset, size));
+    }
+
+    s4u::IoPtr CachedStorage::write_async(const IOContext& context, sg_offset_t offset, sg_size_t size,
+                                          bool detached) {
+        auto file_id = context.file_id;
+        auto* client_host = context.get_client_host();
+        auto blocks = split_in_blocks(offset, size);
+
+        auto completion_activity = s4u::Io::init()->set_op_type(s4u::Io::OpType::WRITE)->set_size(0);
+        completion_activity->set_name("Cached Storage Write Completion");
+
+        if (blocks.size() > num_cache_blocks_) {
+            // Requests larger than the cache bypass it. Cached copies of the written blocks become stale
+            for (const auto& [block_idx, num_bytes] : blocks) {
+                auto it = blocks_.find(BlockId(file_id, block_idx));
+                if (it == blocks_.end())
+                    continue;
+                if (it->second.dirty)
+                    num_dirty_blocks_--;
+                lru_list_.erase(it->second.lru_position);
+                blocks_.erase(it);
+            }
+            auto backing_io = backing_storage_->submit_write_async({file_id, client_host}, offset, size);
+            backing_io->add_successor(completion_activity);
+        } else {
+            bool write_back = (write_policy_ == WritePolicy::WRITE_BACK);
+            WriteBacks write_backs;
+            for (const auto& [block_idx, num_bytes] : blocks) {
+                BlockId block_id(file_id, block_idx);
+                auto it = blocks_.find(block_id);
+                if (it == blocks_.end()) {
+                    insert_block(block_id, write_back, write_backs);
+                    continue;
+                }
+                num_write_hits_++;
+                touch_block(it->second);
+                if (write_back && not it->second.dirty) {
+                    it->second.dirty = true;
+                    num_dirty_blocks_++;
+                }
+            }
+            start_write_backs(write_backs, true);
+
+            auto cache_io = create_cache_disk_io(size, s4u::Io::OpType::WRITE, client_host);
+            cache_io->set_name("Cache Write");
+            cache_io->add_successor(completion_activity);
+            cache_io->detach();
+            if (not write_back) {
+                auto backing_io = backing_storage_->submit_write_async({file_id, client_host}, offset, size);
+                backing_io->add_successor(completion_activity);
+            }
+        }
+
+        completion_activity->set_disk(cache_disk_);
+        if (detached)
+            completion_activity->detach();
+        return completion_activity;
+    }
+
+    void CachedStorage::write(const IOContext& context, sg_offset_t offset, sg_size_t size) {
+        wait_for_completion(write_async(context, offset, size));
+    }
+
+    void CachedStorage::on_file_deletion(unsigned long file_id) {
+        // The blocks of a deleted file are dropped, and its dirty blocks are never written back
+        auto first = blocks_.lower_bound({file_id, 0});
+        auto last = blocks_.lower_bound({file_id + 1, 0});
+        for (auto it = first; it != last; ++it) {
+            if (it->second.dirty)
+                num_dirty_blocks_--;
+            lru_list_.erase(it->second.lru_position);
+        }
+        blocks_.erase(first, last);
+        backing_storage_->on_file_deletion(file_id);
+    }
+}
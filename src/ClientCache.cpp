@@ -0,0 +1,184 @@
+/* Copyright (c) 2024-2026. The FSMOD Team. All rights reserved.          */
+
+/* This program is free software; you can redistribute it and/or modify it
+ * under the terms of the license (GNU LGPL) which comes with this package. */
+
+#include "fsmod/ClientCache.hpp"
+#include "fsmod/FileMetadata.hpp"
+#include "fsmod/Storage.hpp"
+#include <simgrid/s4u/Actor.hpp>
+#include <simgrid/s4u/Comm.hpp>
+#include <simgrid/s4u/Engine.hpp>
+
+#include <algorithm>
+
+XBT_LOG_NEW_DEFAULT_CATEGORY(fsmod_client_cache, "File System module: Client cache related logs");
+
+namespace simgrid::fsmod {
+
+    /**
+     * @brief Create an instance of a client cache
+     * @param host: the client host whose actors use the cache
+     * @param cache_size: the number of bytes the cache can hold
+     * @param block_size: the granularity at which data is cached, in bytes (default: 64KiB)
+     * @param cache_disk: a disk of the client host on which cached blocks are kept, or nullptr to keep them in
+     *        memory, which serves them in zero time (default: nullptr)
+     * @return a client cache instance
+     */
+    std::shared_ptr<ClientCache> ClientCache::create(s4u::Host* host, sg_size_t cache_size, sg_size_t block_size,
+                                                     s4u::Disk* cache_disk) {
+        return std::make_shared<ClientCache>(host, cache_size, block_size, cache_disk);
+    }
+
+    ClientCache::ClientCache(s4u::Host* host, sg_size_t cache_size, sg_size_t block_size, s4u::Disk* cache_disk)
+        : host_(host), block_size_(block_size), cache_disk_(cache_disk) {
+        if (host == nullptr)
+            throw std::invalid_argument("The host of a client cache cannot be null");
+        if (block_size == 0)
+            throw std::invalid_argument("The block size of a client cache must be positive");
+        if (cache_size < block_size)
+            throw std::invalid_argument("The size of a client cache must be at least one block");
+        if (cache_disk != nullptr && cache_disk->get_host() != host)
+            throw std::invalid_argument("The cache disk of a client cache must be attached to its host");
+        num_cache_blocks_ = cache_size / block_size;
+    }
+
+    /**
+     * @brief Set the time during which the attributes of an open file are trusted without asking the server
+     *        whether the file has been modified
+     * @param timeout: a duration in seconds (0 to revalidate on every read)
+     */
+    void ClientCache::set_attribute_cache_timeout(double timeout) {
+        if (timeout < 0)
+            throw std::invalid_argument("The attribute cache timeout of a client cache cannot be negative");
+        attribute_cache_timeout_ = timeout;
+    }
+
+    static s4u::Host* get_server_host(const std::shared_ptr<Storage>& storage) {
+        auto* server_host = storage->get_controller_host();
+        if (server_host == nullptr)
+            server_host = storage->get_first_disk()->get_host();
+        return server_host;
+    }
+
+    bool ClientCache::caches(const std::shared_ptr<Storage>& storage) const {
+        // Data stored on the client host itself is not worth caching
+        return get_server_host(storage) != host_;
+    }
+
+    void ClientCache::revalidate(const FileMetadata* metadata, const std::shared_ptr<Storage>& storage) {
+        // Revalidations made outside of actors (e.g., to set up the initial content of a file system) are free
+        if (not s4u::Actor::is_maestro()) {
+            auto* server_host = get_server_host(storage);
+            s4u::Comm::sendto(host_, server_host, 0);
+            s4u::Comm::sendto(server_host, host_, 0);
+        }
+        num_revalidations_++;
+
+        auto file_id = metadata->get_id();
+        auto modification_date = metadata->get_modification_date();
+        auto it = attributes_.find(file_id);
+        if (it != attributes_.end() && it->second.modification_date != modification_date) {
+            XBT_DEBUG("File %lu was modified by another client, invalidating its cached blocks", file_id);
+            invalidate(file_id);
+        }
+        attributes_[file_id] = {modification_date, s4u::Engine::get_clock() + attribute_cache_timeout_};
+    }
+
+    void ClientCache::invalidate(unsigned long file_id) {
+        num_invalidations_++;
+        auto first = blocks_.lower_bound({file_id, 0});
+        auto last = blocks_.lower_bound({file_id + 1, 0});
+        for (auto it = first; it != last; ++it)
+            lru_list_.erase(it->second);
+        blocks_.erase(first, last);
+    }
+
+    void ClientCache::insert_block(const BlockId& block_id) {
+        if (auto it = blocks_.find(block_id); it != blocks_.end()) {
+            lru_list_.splice(lru_list_.begin(), lru_list_, it->second);
+            return;
+        }
+        if (blocks_.size() >= num_cache_blocks_) {
+            blocks_.erase(lru_list_.back());
+            lru_list_.pop_back();
+        }
+        lru_list_.push_front(block_id);
+        blocks_[block_id] = lru_list_.begin();
+    }
+
+    s4u::IoPtr ClientCache::read_async(const FileMetadata* metadata, const std::shared_ptr<Storage>& storage,
+                                       sg_offset_t offset, sg_size_t size) {
+        auto file_id = metadata->get_id();
+        auto it = attributes_.find(file_id);
+        if (it == attributes_.end() || s4u::Engine::get_clock() >= it->second.expiration_date)
+            revalidate(metadata, storage);
+
+        // Hit blocks are served by the client, and missed blocks are requested from the server in one request
+        sg_size_t hit_bytes = 0;
+        sg_size_t miss_bytes = 0;
+        sg_offset_t miss_offset = offset;
+        auto start = static_cast<sg_size_t>(offset);
+        auto end = start + size;
+        for (auto block = start / block_size_; block * block_size_ < end; block++) {
+            auto num_bytes = std::min(end, (block + 1) * block_size_) - std::max(start, block * block_size_);
+            if (blocks_.find({file_id, block}) != blocks_.end()) {
+                hit_bytes += num_bytes;
+                num_read_hits_++;
+            } else {
+                if (miss_bytes == 0)
+                    miss_offset = static_cast<sg_offset_t>(std::max(start, block * block_size_));
+                miss_bytes += num_bytes;
+                num_read_misses_++;
+            }
+            insert_block({file_id, block});
+        }
+        XBT_DEBUG("Read of %llu bytes of file %lu: %llu bytes hit, %llu bytes miss", size, file_id, hit_bytes,
+                  miss_bytes);
+
+        s4u::IoPtr completion_activity = s4u::Io::init()->set_op_type(s4u::Io::OpType::READ)->set_size(0);
+        completion_activity->set_name("Client Cache Completion");
+        if (hit_bytes > 0 && cache_disk_ != nullptr) {
+            auto cache_io = cache_disk_->io_init(hit_bytes, s4u::Io::OpType::READ);
+            cache_io->set_name("Client Cache Hit");
+            cache_io->add_successor(completion_activity);
+            cache_io->detach();
+        }
+        if (miss_bytes > 0) {
+            auto server_io = storage->submit_read_async({file_id, host_}, miss_offset, miss_bytes);
+            server_io->add_successor(completion_activity);
+            // Missed blocks are written to the cache disk without delaying the client
+            if (cache_disk_ != nullptr) {
+                auto fill_io = cache_disk_->io_init(miss_bytes, s4u::Io::OpType::WRITE);
+                fill_io->set_name("Client Cache Fill");
+                server_io->add_successor(fill_io);
+                fill_io->detach();
+            }
+        }
+        completion_activity->set_disk(cache_disk_ != nullptr ? cache_disk_ : storage->get_first_disk());
+        return completion_activity;
+    }
+
+    void ClientCache::notify_write(const FileMetadata* metadata, double previous_modification_date,
+                                   sg_offset_t offset, sg_size_t size) {
+        // A write does not revalidate the attributes, but if the file was modified by another client before it, the
+        // blocks cached before that modification are stale
+        auto file_id = metadata->get_id();
+        auto it = attributes_.find(file_id);
+        if (it != attributes_.end() && it->second.modification_date != previous_modification_date)
+            invalidate(file_id);
+
+        // Written blocks are cached, so that the client's own writes do not invalidate them
+        auto start = static_cast<sg_size_t>(offset);
+        auto end = start + size;
+        for (auto block = start / block_size_; block * block_size_ < end; block++)
+            insert_block({file_id, block});
+        if (cache_disk_ != nullptr && size > 0) {
+            auto cache_io = cache_disk_->io_init(size, s4u::Io::OpType::WRITE);
+            cache_io->set_name("Client Cache Write");
+            cache_io->detach();
+        }
+        attributes_[file_id] = {metadata->get_modification_date(),
+                                s4u::Engine::get_clock() + attribute_cache_timeout_};
+    }
+}
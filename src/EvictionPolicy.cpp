@@ -0,0 +1,537 @@
+/* Copyright (c) 2024-2026. The FSMOD Team. All rights reserved.          */
+
+/* This program is free software; you can redistribute it and/or modify it
+ * under the terms of the license (GNU LGPL) which comes with this package. */
+
+#include "fsmod/EvictionPolicy.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace simgrid::fsmod {
+
+    namespace {
+        // Files are remembered by path after their eviction, as their metadata is gone
+        std::string get_path(const FileMetadata *file_metadata) {
+            return file_metadata->get_dir_path() + "/" + file_metadata->get_file_name();
+        }
+
+        sg_size_t get_fraction(sg_size_t num_bytes, double fraction) {
+            return static_cast<sg_size_t>(static_cast<double>(num_bytes) * fraction);
+        }
+
+        // Skip the files that cannot be evicted
+        void skip_pinned_files(std::list<const FileMetadata*>::iterator &it,
+                               const std::list<const FileMetadata*> &list) {
+            while (it != list.end() && (*it)->is_pinned())
+                ++it;
+        }
+    }
+
+    void EvictionList::push_back(const FileMetadata *file_metadata) {
+        insert_after(back_, file_metadata);
+    }
+
+    /**
+     * @brief Insert a file in the list, or move it if it already is in the list
+     * @param position: the file after which to insert it (nullptr: at the front)
+     * @param file_metadata: the file's metadata
+     */
+    void EvictionList::insert_after(const FileMetadata *position, const FileMetadata *file_metadata) {
+        if (position == file_metadata)
+            return;
+        remove(file_metadata);
+        auto &hook = get_hook(file_metadata);
+        hook.list = this;
+        hook.prev = position;
+        hook.next = position ? get_hook(position).next : front_;
+        (hook.prev ? get_hook(hook.prev).next : front_) = file_metadata;
+        (hook.next ? get_hook(hook.next).prev : back_) = file_metadata;
+        size_++;
+    }
+
+    void EvictionList::remove(const FileMetadata *file_metadata) {
+        if (not contains(file_metadata))
+            return;
+        auto &hook = get_hook(file_metadata);
+        (hook.prev ? get_hook(hook.prev).next : front_) = hook.next;
+        (hook.next ? get_hook(hook.next).prev : back_) = hook.prev;
+        hook = EvictionListHook();
+        size_--;
+    }
+
+    void FIFOEvictionPolicy::on_create(const FileMetadata *file_metadata) {
+        files_.push_back(file_metadata);
+        if (not file_metadata->is_pinned())
+            unpinned_files_.push_back(file_metadata);
+    }
+
+    void FIFOEvictionPolicy::on_delete(const FileMetadata *file_metadata) {
+        files_.remove(file_metadata);
+        unpinned_files_.remove(file_metadata);
+    }
+
+    void FIFOEvictionPolicy::on_pin_change(const FileMetadata *file_metadata) {
+        if (file_metadata->is_pinned()) {
+            unpinned_files_.remove(file_metadata);
+            return;
+        }
+        if (not files_.contains(file_metadata) || unpinned_files_.contains(file_metadata))
+            return;
+        // Put the file back at its place, after the closest unpinned file that precedes it in eviction order. This
+        // walks back over the pinned files in between, which are few as long as few files are open at once
+        const auto *previous = files_.prev(file_metadata);
+        while (previous && not unpinned_files_.contains(previous))
+            previous = files_.prev(previous);
+        unpinned_files_.insert_after(previous, file_metadata);
+    }
+
+    std::vector<const FileMetadata*> FIFOEvictionPolicy::select_victims(sg_size_t num_bytes) {
+        std::vector<const FileMetadata*> victims;
+        sg_size_t space_that_can_be_created = 0;
+        for (const auto *victim = unpinned_files_.front(); victim && space_that_can_be_created < num_bytes;
+             victim = unpinned_files_.next(victim)) {
+            victims.push_back(victim);
+            space_that_can_be_created += victim->get_reclaimable_space();
+        }
+        return victims;
+    }
+
+    void FIFOEvictionPolicy::move_to_back(const FileMetadata *file_metadata) {
+        if (not files_.contains(file_metadata))
+            return;
+        files_.push_back(file_metadata);
+        if (unpinned_files_.contains(file_metadata))
+            unpinned_files_.push_back(file_metadata);
+    }
+
+    void GhostList::push(const std::string &path, sg_size_t size) {
+        remove(path);
+        entries_.emplace_back(path, size);
+        positions_[path] = std::prev(entries_.end());
+        num_bytes_ += size;
+    }
+
+    bool GhostList::remove(const std::string &path) {
+        auto it = positions_.find(path);
+        if (it == positions_.end())
+            return false;
+        num_bytes_ -= it->second->second;
+        entries_.erase(it->second);
+        positions_.erase(it);
+        return true;
+    }
+
+    void GhostList::trim(sg_size_t max_num_bytes) {
+        while (num_bytes_ > max_num_bytes && not entries_.empty()) {
+            num_bytes_ -= entries_.front().second;
+            positions_.erase(entries_.front().first);
+            entries_.pop_front();
+        }
+    }
+
+    void ARCEvictionPolicy::insert(const FileMetadata *file_metadata, bool frequent) {
+        auto size = file_metadata->get_current_size();
+        auto &list = frequent ? frequent_ : recent_;
+        list.push_back(file_metadata);
+        (frequent ? frequent_num_bytes_ : recent_num_bytes_) += size;
+        entries_[file_metadata] = {frequent, std::prev(list.end()), size, true};
+    }
+
+    void ARCEvictionPolicy::on_create(const FileMetadata *file_metadata) {
+        auto path = get_path(file_metadata);
+        auto size = static_cast<double>(file_metadata->get_current_size());
+        auto recent_ghost_bytes = static_cast<double>(recent_ghosts_.get_num_bytes());
+        auto frequent_ghost_bytes = static_cast<double>(frequent_ghosts_.get_num_bytes());
+        if (recent_ghosts_.contains(path)) {
+            // The recency list was too small: grow its target (ghosts of empty files weigh nothing)
+            auto ratio = recent_ghost_bytes > 0 ? frequent_ghost_bytes / recent_ghost_bytes : 1.0;
+            auto delta = size * std::max(1.0, ratio);
+            recency_target_ = std::min(get_partition_size(),
+                                       recency_target_ + static_cast<sg_size_t>(delta));
+            recent_ghosts_.remove(path);
+            insert(file_metadata, true);
+        } else if (frequent_ghosts_.contains(path)) {
+            // The frequency list was too small: shrink the target of the recency list
+            auto ratio = frequent_ghost_bytes > 0 ? recent_ghost_bytes / frequent_ghost_bytes : 1.0;
+            auto delta = size * std::max(1.0, ratio);
+            recency_target_ -= std::min(recency_target_, static_cast<sg_size_t>(delta));
+            frequent_ghosts_.remove(path);
+            insert(file_metadata, true);
+        } else {
+            insert(file_metadata, false);
+        }
+        trim_ghosts();
+    }
+
+    void ARCEvictionPolicy::on_access(const FileMetadata *file_metadata) {
+        auto it = entries_.find(file_metadata);
+        if (it == entries_.end())
+            return;
+        auto &entry = it->second;
+        auto &old_list = entry.frequent ? frequent_ : recent_;
+        (entry.frequent ? frequent_num_bytes_ : recent_num_bytes_) -= entry.size;
+        entry.size = file_metadata->get_current_size();
+        // A second access moves the file to the frequency list, and any access makes it the most recently used
+        if (not entry.created)
+            entry.frequent = true;
+        entry.created = false;
+        auto &new_list = entry.frequent ? frequent_ : recent_;
+        new_list.splice(new_list.end(), old_list, entry.position);
+        (entry.frequent ? frequent_num_bytes_ : recent_num_bytes_) += entry.size;
+    }
+
+    void ARCEvictionPolicy::on_delete(const FileMetadata *file_metadata) {
+        auto it = entries_.find(file_metadata);
+        if (it == entries_.end())
+            return;
+        auto &entry = it->second;
+        (entry.frequent ? frequent_ : recent_).erase(entry.position);
+        (entry.frequent ? frequent_num_bytes_ : recent_num_bytes_) -= entry.size;
+        // Only remember evicted files, not deleted ones
+        if (victims_.erase(file_metadata))
+            (entry.frequent ? frequent_ghosts_ : recent_ghosts_).push(get_path(file_metadata), entry.size);
+        entries_.erase(it);
+        trim_ghosts();
+    }
+
+    void ARCEvictionPolicy::trim_ghosts() {
+        auto size = get_partition_size();
+        recent_ghosts_.trim(size - std::min(size, recent_num_bytes_));
+        auto num_bytes = recent_num_bytes_ + frequent_num_bytes_ + recent_ghosts_.get_num_bytes();
+        frequent_ghosts_.trim(2 * size - std::min(2 * size, num_bytes));
+    }
+
+    std::vector<const FileMetadata*> ARCEvictionPolicy::peek_victims(sg_size_t num_bytes) {
+        std::vector<const FileMetadata*> victims;
+        sg_size_t space_that_can_be_created = 0;
+        sg_size_t recent_num_bytes = recent_num_bytes_;
+        auto recent_it = recent_.begin();
+        auto frequent_it = frequent_.begin();
+        while (space_that_can_be_created < num_bytes) {
+            skip_pinned_files(recent_it, recent_);
+            skip_pinned_files(frequent_it, frequent_);
+            // Evict from the recency list while it exceeds its target, or when the frequency list has no victim left
+            bool from_recent = recent_it != recent_.end() &&
+                               (recent_num_bytes > recency_target_ || frequent_it == frequent_.end());
+            if (not from_recent && frequent_it == frequent_.end())
+                break;
+            const auto *victim = from_recent ? *recent_it++ : *frequent_it++;
+            if (from_recent)
+                recent_num_bytes -= entries_.at(victim).size;
+            victims.push_back(victim);
+            space_that_can_be_created += victim->get_reclaimable_space();
+        }
+        return victims;
+    }
+
+    std::vector<const FileMetadata*> ARCEvictionPolicy::select_victims(sg_size_t num_bytes) {
+        // Remember the victims, so that their deletion is known to be an eviction
+        auto victims = peek_victims(num_bytes);
+        victims_ = {victims.begin(), victims.end()};
+        return victims;
+    }
+
+    /**
+     * @brief Constructor
+     * @param in_fraction: the fraction of the partition targeted by the queue of new files (default: 0.25)
+     * @param out_fraction: the fraction of the partition's size that the ghost queue remembers (default: 0.5)
+     */
+    TwoQEvictionPolicy::TwoQEvictionPolicy(double in_fraction, double out_fraction)
+        : in_fraction_(in_fraction), out_fraction_(out_fraction) {
+        if (in_fraction <= 0 || in_fraction >= 1)
+            throw std::invalid_argument("The fraction of the partition targeted by the queue of new files must be "
+                                        "between 0 and 1");
+        if (out_fraction <= 0)
+            throw std::invalid_argument("The fraction of the partition remembered by the ghost queue must be positive");
+    }
+
+    void TwoQEvictionPolicy::on_create(const FileMetadata *file_metadata) {
+        auto size = file_metadata->get_current_size();
+        // A file that comes back soon after its eviction from the queue of new files is worth keeping
+        if (out_queue_.remove(get_path(file_metadata))) {
+            main_queue_.push_back(file_metadata);
+            entries_[file_metadata] = {true, std::prev(main_queue_.end()), size};
+        } else {
+            in_queue_.push_back(file_metadata);
+            in_queue_num_bytes_ += size;
+            entries_[file_metadata] = {false, std::prev(in_queue_.end()), size};
+        }
+    }
+
+    void TwoQEvictionPolicy::on_access(const FileMetadata *file_metadata) {
+        auto it = entries_.find(file_metadata);
+        if (it == entries_.end())
+            return;
+        auto &entry = it->second;
+        auto size = file_metadata->get_current_size();
+        // Accesses to new files are deemed correlated, and do not reorder the queue of new files
+        if (entry.in_main) {
+            main_queue_.splice(main_queue_.end(), main_queue_, entry.position);
+        } else {
+            in_queue_num_bytes_ = in_queue_num_bytes_ - entry.size + size;
+        }
+        entry.size = size;
+    }
+
+    void TwoQEvictionPolicy::on_delete(const FileMetadata *file_metadata) {
+        auto it = entries_.find(file_metadata);
+        if (it == entries_.end())
+            return;
+        auto &entry = it->second;
+        if (entry.in_main) {
+            main_queue_.erase(entry.position);
+            victims_.erase(file_metadata);
+        } else {
+            in_queue_.erase(entry.position);
+            in_queue_num_bytes_ -= entry.size;
+            // Only remember files evicted from the queue of new files
+            if (victims_.erase(file_metadata)) {
+                out_queue_.push(get_path(file_metadata), entry.size);
+                out_queue_.trim(get_fraction(get_partition_size(), out_fraction_));
+            }
+        }
+        entries_.erase(it);
+    }
+
+    std::vector<const FileMetadata*> TwoQEvictionPolicy::peek_victims(sg_size_t num_bytes) {
+        std::vector<const FileMetadata*> victims;
+        sg_size_t space_that_can_be_created = 0;
+        sg_size_t in_queue_num_bytes = in_queue_num_bytes_;
+        auto in_queue_target = get_fraction(get_partition_size(), in_fraction_);
+        auto in_it = in_queue_.begin();
+        auto main_it = main_queue_.begin();
+        while (space_that_can_be_created < num_bytes) {
+            skip_pinned_files(in_it, in_queue_);
+            skip_pinned_files(main_it, main_queue_);
+            // Evict new files while their queue exceeds its target, or when the main queue has no victim left
+            bool from_in_queue = in_it != in_queue_.end() &&
+                                 (in_queue_num_bytes > in_queue_target || main_it == main_queue_.end());
+            if (not from_in_queue && main_it == main_queue_.end())
+                break;
+            const auto *victim = from_in_queue ? *in_it++ : *main_it++;
+            if (from_in_queue)
+                in_queue_num_bytes -= entries_.at(victim).size;
+            victims.push_back(victim);
+            space_that_can_be_created += victim->get_reclaimable_space();
+        }
+        return victims;
+    }
+
+    std::vector<const FileMetadata*> TwoQEvictionPolicy::select_victims(sg_size_t num_bytes) {
+        // Remember the victims, so that their deletion is known to be an eviction
+        auto victims = peek_victims(num_bytes);
+        victims_ = {victims.begin(), victims.end()};
+        return victims;
+    }
+
+    void LFUEvictionPolicy::update(const FileMetadata *file_metadata, Entry &entry) {
+        queue_.erase({entry.priority, entry.sequence_number, file_metadata});
+        entry.priority = age_ + get_value(file_metadata, entry.frequency);
+        entry.sequence_number = sequence_number_++;
+        queue_.insert({entry.priority, entry.sequence_number, file_metadata});
+    }
+
+    void LFUEvictionPolicy::on_create(const FileMetadata *file_metadata) {
+        // The access that comes with the creation is the first one
+        auto &entry = entries_[file_metadata] = {0, 0, 0};
+        update(file_metadata, entry);
+    }
+
+    void LFUEvictionPolicy::on_access(const FileMetadata *file_metadata) {
+        auto it = entries_.find(file_metadata);
+        if (it == entries_.end())
+            return;
+        it->second.frequency++;
+        update(file_metadata, it->second);
+    }
+
+    void LFUEvictionPolicy::on_delete(const FileMetadata *file_metadata) {
+        auto it = entries_.find(file_metadata);
+        if (it == entries_.end())
+            return;
+        queue_.erase({it->second.priority, it->second.sequence_number, file_metadata});
+        // The cache ages with each eviction
+        if (victims_.erase(file_metadata))
+            age_ = std::max(age_, it->second.priority);
+        entries_.erase(it);
+    }
+
+    std::vector<const FileMetadata*> LFUEvictionPolicy::peek_victims(sg_size_t num_bytes) {
+        std::vector<const FileMetadata*> victims;
+        sg_size_t space_that_can_be_created = 0;
+        for (auto const& [priority, sequence_number, victim] : queue_) {
+            if (space_that_can_be_created >= num_bytes)
+                break;
+            // Never evict a pinned file
+            if (victim->is_pinned())
+                continue;
+            victims.push_back(victim);
+            space_that_can_be_created += victim->get_reclaimable_space();
+        }
+        return victims;
+    }
+
+    std::vector<const FileMetadata*> LFUEvictionPolicy::select_victims(sg_size_t num_bytes) {
+        // Remember the victims, so that their deletion is known to be an eviction
+        auto victims = peek_victims(num_bytes);
+        victims_ = {victims.begin(), victims.end()};
+        return victims;
+    }
+
+    double GDSFEvictionPolicy::get_value(const FileMetadata *file_metadata, unsigned long frequency) const {
+        return static_cast<double>(frequency) /
+               static_cast<double>(std::max<sg_size_t>(1, file_metadata->get_current_size()));
+    }
+
+    /**
+     * @brief Constructor
+     * @param small_fraction: the fraction of the partition targeted by the small queue of new files (default: 0.1)
+     */
+    S3FIFOEvictionPolicy::S3FIFOEvictionPolicy(double small_fraction) : small_fraction_(small_fraction) {
+        if (small_fraction <= 0 || small_fraction >= 1)
+            throw std::invalid_argument("The fraction of the partition targeted by the small queue must be between "
+                                        "0 and 1");
+    }
+
+    void S3FIFOEvictionPolicy::on_create(const FileMetadata *file_metadata) {
+        auto size = file_metadata->get_current_size();
+        // A file that comes back soon after its eviction from the small queue goes directly to the main queue
+        if (ghost_queue_.remove(get_path(file_metadata))) {
+            main_queue_.push_back(file_metadata);
+            entries_[file_metadata] = {true, std::prev(main_queue_.end()), size, 0, true};
+        } else {
+            small_queue_.push_back(file_metadata);
+            small_queue_num_bytes_ += size;
+            entries_[file_metadata] = {false, std::prev(small_queue_.end()), size, 0, true};
+        }
+    }
+
+    void S3FIFOEvictionPolicy::on_access(const FileMetadata *file_metadata) {
+        auto it = entries_.find(file_metadata);
+        if (it == entries_.end())
+            return;
+        auto &entry = it->second;
+        auto size = file_metadata->get_current_size();
+        if (not entry.in_main)
+            small_queue_num_bytes_ = small_queue_num_bytes_ - entry.size + size;
+        entry.size = size;
+        // Hits only bump a counter, and never reorder the queues
+        if (not entry.created)
+            entry.frequency = std::min(entry.frequency + 1, 3U);
+        entry.created = false;
+    }
+
+    void S3FIFOEvictionPolicy::on_delete(const FileMetadata *file_metadata) {
+        auto it = entries_.find(file_metadata);
+        if (it == entries_.end())
+            return;
+        auto &entry = it->second;
+        if (entry.in_main) {
+            main_queue_.erase(entry.position);
+            victims_.erase(file_metadata);
+        } else {
+            small_queue_.erase(entry.position);
+            small_queue_num_bytes_ -= entry.size;
+            // Only remember files evicted from the small queue
+            if (victims_.erase(file_metadata)) {
+                ghost_queue_.push(get_path(file_metadata), entry.size);
+                ghost_queue_.trim(get_partition_size() - get_fraction(get_partition_size(), small_fraction_));
+            }
+        }
+        entries_.erase(it);
+    }
+
+    const FileMetadata* S3FIFOEvictionPolicy::next_small_queue_victim(std::list<const FileMetadata*> &small_queue,
+                                                                     std::list<const FileMetadata*> &main_queue,
+                                                                     sg_size_t &small_queue_num_bytes,
+                                                                     Entries &entries,
+                                                                     std::list<const FileMetadata*>::iterator &it) {
+        while (it != small_queue.end()) {
+            const auto *file_metadata = *it;
+            auto &entry = entries.at(file_metadata);
+            if (file_metadata->is_pinned()) {
+                ++it;
+            } else if (entry.frequency > 0) {
+                // Files accessed since their creation move to the main queue
+                auto next = std::next(it);
+                main_queue.splice(main_queue.end(), small_queue, it);
+                small_queue_num_bytes -= entry.size;
+                entry.in_main = true;
+                entry.frequency = 0;
+                it = next;
+            } else {
+                return *it++;
+            }
+        }
+        return nullptr;
+    }
+
+    const FileMetadata* S3FIFOEvictionPolicy::next_main_queue_victim(std::list<const FileMetadata*> &main_queue,
+                                                                    Entries &entries,
+                                                                    std::list<const FileMetadata*>::iterator &it) {
+        while (it != main_queue.end()) {
+            const auto *file_metadata = *it;
+            auto &entry = entries.at(file_metadata);
+            if (file_metadata->is_pinned()) {
+                ++it;
+            } else if (entry.frequency > 0) {
+                // Files accessed since they were last considered get another chance
+                entry.frequency--;
+                auto next = std::next(it);
+                if (next != main_queue.end()) {
+                    main_queue.splice(main_queue.end(), main_queue, it);
+                    it = next;
+                }
+            } else {
+                return *it++;
+            }
+        }
+        return nullptr;
+    }
+
+    std::vector<const FileMetadata*> S3FIFOEvictionPolicy::select_victims_in(
+            std::list<const FileMetadata*> &small_queue, std::list<const FileMetadata*> &main_queue,
+            sg_size_t &small_queue_num_bytes, Entries &entries, sg_size_t num_bytes) const {
+        std::vector<const FileMetadata*> victims;
+        sg_size_t space_that_can_be_created = 0;
+        sg_size_t small_queue_victim_num_bytes = 0;
+        auto small_queue_target = get_fraction(get_partition_size(), small_fraction_);
+        auto small_it = small_queue.begin();
+        auto main_it = main_queue.begin();
+        while (space_that_can_be_created < num_bytes) {
+            const FileMetadata *victim = nullptr;
+            // Evict from the small queue while it reaches its target, or when the main queue has no victim left
+            if (small_queue_num_bytes - small_queue_victim_num_bytes >= small_queue_target)
+                victim = next_small_queue_victim(small_queue, main_queue, small_queue_num_bytes, entries, small_it);
+            if (not victim)
+                victim = next_main_queue_victim(main_queue, entries, main_it);
+            if (not victim)
+                victim = next_small_queue_victim(small_queue, main_queue, small_queue_num_bytes, entries, small_it);
+            if (not victim)
+                break;
+            if (not entries.at(victim).in_main)
+                small_queue_victim_num_bytes += entries.at(victim).size;
+            victims.push_back(victim);
+            space_that_can_be_created += victim->get_reclaimable_space();
+        }
+        return victims;
+    }
+
+    std::vector<const FileMetadata*> S3FIFOEvictionPolicy::select_victims(sg_size_t num_bytes) {
+        auto victims = select_victims_in(small_queue_, main_queue_, small_queue_num_bytes_, entries_, num_bytes);
+        // Remember the victims, so that their deletion is known to be an eviction
+        victims_ = {victims.begin(), victims.end()};
+        return victims;
+    }
+
+    std::vector<const FileMetadata*> S3FIFOEvictionPolicy::peek_victims(sg_size_t num_bytes) {
+        // Selecting victims promotes files and gives them second chances, so work on copies of the queues, at a
+        // cost linear in the number of files
+        auto small_queue = small_queue_;
+        auto main_queue = main_queue_;
+        auto small_queue_num_bytes = small_queue_num_bytes_;
+        auto entries = entries_;
+        return select_victims_in(small_queue, main_queue, small_queue_num_bytes, entries, num_bytes);
+    }
+}
@@ -3,9 +3,12 @@
 /* This program is free software; you can redistribute it and/or modify it
  * under the terms of the license (GNU LGPL) which comes with this package. */
 
+#include <cmath>
 #include <iostream>
 
+#include <simgrid/s4u/Actor.hpp>
 #include <simgrid/s4u/Engine.hpp>
+#include <simgrid/s4u/Exec.hpp>
 #include <simgrid/Exception.hpp>
 
 #include "fsmod/File.hpp"
@@ -13,6 +16,7 @@
 #include "fsmod/FileSystem.hpp"
 #include "fsmod/FileSystemException.hpp"
 #include "fsmod/FileStat.hpp"
+#include "fsmod/QoSPolicy.hpp"
 
 XBT_LOG_NEW_DEFAULT_CATEGORY(fsmod_file, "File System module: File management related logs");
 
@@ -37,10 +41,17 @@ namespace simgrid::fsmod {
             throw std::invalid_argument("Invalid access mode '" + access_mode_ + "'. Cannot read in 'w' or 'a' mode'");
         // if the current position is close to the end of the file, we may not be able to read the requested size
         sg_size_t num_bytes_to_read = std::min(num_bytes, metadata_->get_current_size() - current_position_);
+        auto offset = static_cast<sg_offset_t>(current_position_);
+        // Start the I/O first, so that the position is left unchanged if the storage cannot serve it
+        auto storage = partition_->get_storage_for_file(metadata_);
+        auto io = start_with_qos(s4u::Io::OpType::READ, num_bytes_to_read, storage,
+                                 with_processing(s4u::Io::OpType::READ,
+                                                 get_compression_flops(s4u::Io::OpType::READ, num_bytes_to_read),
+                                                 storage, make_read_starter(storage, offset, num_bytes_to_read)));
         // Update
         current_position_ += num_bytes_to_read;
         metadata_->set_access_date(s4u::Engine::get_clock());
-        return boost::dynamic_pointer_cast<s4u::Io>(partition_->get_storage()->read_async(num_bytes_to_read));
+        return io;
     }
 
    /**
@@ -66,6 +77,7 @@ namespace simgrid::fsmod {
             return 0;
         // if the current position is close to the end of the file, we may not be able to read the requested size
         sg_size_t num_bytes_to_read = std::min(num_bytes, metadata_->get_current_size() - current_position_);
+        auto offset = static_cast<sg_offset_t>(current_position_);
         // Update
         current_position_ += num_bytes_to_read;
         metadata_->set_access_date(s4u::Engine::get_clock());
@@ -73,15 +85,30 @@ namespace simgrid::fsmod {
         // Do the I/O simulation if need be
         if (simulate_it) {
             try {
-                partition_->get_storage()->read(num_bytes_to_read);
+                auto storage = partition_->get_storage_for_file(metadata_);
+                auto [delay, weight] = admit_request(num_bytes_to_read);
+                if (delay > 0)
+                    s4u::this_actor::sleep_for(delay);
+                if (weight != 1.0 || partition_->file_system_->get_client_cache_for(storage)) {
+                    auto io = make_read_starter(storage, offset, num_bytes_to_read)(false);
+                    io->update_priority(weight);
+                    Storage::wait_for_completion(io);
+                } else {
+                    auto [physical_offset, physical_size] = get_physical_extent(offset, num_bytes_to_read);
+                    storage->submit_read({metadata_->get_id()}, physical_offset, physical_size);
+                }
+                compute(get_processing_host(storage),
+                        get_compression_flops(s4u::Io::OpType::READ, num_bytes_to_read));
             } catch (StorageFailureException&) {
-                throw xbt::UnimplementedError("Handling of hardware resource failures not implemented");
+                // Nothing was read, let the caller decide whether to retry
+                current_position_ = static_cast<sg_size_t>(offset);
+                throw;
             }
         }
         return num_bytes_to_read;
     }
 
-    int File::write_init_checks(sg_size_t num_bytes) {
+    int File::write_init_checks(sg_size_t num_bytes, sg_size_t& num_bytes_to_store) {
         static int sequence_number = -1;
         int my_sequence_number;
 
@@ -99,14 +126,14 @@ namespace simgrid::fsmod {
         if (current_position_ + num_bytes > metadata_->get_future_size())
             added_bytes = current_position_ + num_bytes - metadata_->get_future_size();
 
-        if (added_bytes > partition_->get_free_space()) {
-            partition_->create_space(added_bytes - partition_->get_free_space());
-        }
-
         // Compute the new tentative file size
         sg_size_t new_file_size_if_i_succeed = metadata_->get_future_size() + added_bytes;
-        // Decrease the available space on partition of what is going to be added by that write
-        partition_->decrease_free_space(added_bytes);
+        // Data that the partition already stores does not need to be written again
+        num_bytes_to_store = num_bytes - partition_->get_num_duplicate_bytes(metadata_, current_position_, num_bytes,
+                                                                             new_file_size_if_i_succeed);
+
+        // Reserve the space on the partition for what is going to be added by that write
+        partition_->reserve_space(metadata_, new_file_size_if_i_succeed);
 
         // Update metadata
         my_sequence_number = ++sequence_number;
@@ -115,6 +142,12 @@ namespace simgrid::fsmod {
         return my_sequence_number;
     }
 
+    void File::abort_write(int write_id) {
+        // Give back the space reserved for the write, unless other ongoing writes still need it
+        metadata_->notify_write_abort(write_id);
+        partition_->resize_stored_content(metadata_, metadata_->get_future_size());
+    }
+
     /**
      * @brief Asynchronously write data from the file
      * @param num_bytes: the number of bytes to read as a string with units
@@ -130,13 +163,48 @@ namespace simgrid::fsmod {
      * @return An I/O activity
      */
     s4u::IoPtr File::write_async(sg_size_t num_bytes, bool detached) {
-        int my_sequence_number = write_init_checks(num_bytes);
-        s4u::IoPtr io = boost::dynamic_pointer_cast<s4u::Io>(partition_->get_storage()->write_async(num_bytes, detached));
-        io->on_this_completion_cb([this, my_sequence_number](s4u::Io const&) {
+        sg_size_t num_bytes_to_store;
+        int my_sequence_number = write_init_checks(num_bytes, num_bytes_to_store);
+        auto offset = static_cast<sg_offset_t>(current_position_);
+        auto storage = partition_->get_storage_for_file(metadata_);
+        auto client_cache = partition_->file_system_->get_client_cache_for(storage);
+        auto previous_modification_date = metadata_->get_modification_date();
+        auto [physical_offset, physical_size] = get_physical_extent(offset, num_bytes_to_store);
+        double flops = get_hashing_flops(num_bytes) + get_compression_flops(s4u::Io::OpType::WRITE, num_bytes_to_store);
+        auto start = [storage, file_id = metadata_->get_id(), physical_offset = physical_offset,
+                      physical_size = physical_size](bool detached_io) {
+            if (physical_size == 0) {
+                // Data that the partition already stores only updates its metadata
+                s4u::IoPtr metadata_update = s4u::Io::init()->set_op_type(s4u::Io::OpType::WRITE)->set_size(0);
+                if (detached_io)
+                    metadata_update->detach();
+                metadata_update->set_disk(storage->get_first_disk());
+                return metadata_update;
+            }
+            return boost::dynamic_pointer_cast<s4u::Io>(
+                storage->submit_write_async({file_id}, physical_offset, physical_size, detached_io));
+        };
+        s4u::IoPtr io;
+        try {
+            io = start_with_qos(s4u::Io::OpType::WRITE, num_bytes, storage,
+                                with_processing(s4u::Io::OpType::WRITE, flops, storage, start), detached);
+        } catch (StorageFailureException&) {
+            abort_write(my_sequence_number);
+            throw;
+        }
+        io->on_this_completion_cb([this, my_sequence_number, client_cache, previous_modification_date,
+                                   physical_offset = physical_offset, physical_size = physical_size](s4u::Io const& io) {
+            // A write that did not reach the storage leaves the file as it was
+            if (io.get_state() != s4u::Activity::State::FINISHED) {
+                abort_write(my_sequence_number);
+                return;
+            }
             // Update
             metadata_->set_access_date(s4u::Engine::get_clock());
             metadata_->set_modification_date(s4u::Engine::get_clock());
             metadata_->notify_write_end(my_sequence_number);
+            if (client_cache)
+                client_cache->notify_write(metadata_, previous_modification_date, physical_offset, physical_size);
         });
         return io;
     }
@@ -160,14 +228,37 @@ namespace simgrid::fsmod {
     sg_size_t File::write(sg_size_t num_bytes, bool simulate_it) {
         if (num_bytes == 0) /* Nothing to write, return */
             return 0;
-        int my_sequence_number = write_init_checks(num_bytes);
+        sg_size_t num_bytes_to_store;
+        int my_sequence_number = write_init_checks(num_bytes, num_bytes_to_store);
+        auto offset = static_cast<sg_offset_t>(current_position_);
+        auto storage = partition_->get_storage_for_file(metadata_);
+        auto previous_modification_date = metadata_->get_modification_date();
+        auto [physical_offset, physical_size] = get_physical_extent(offset, num_bytes_to_store);
 
         // Do the I/O simulation if need be
         if (simulate_it) {
             try {
-                partition_->get_storage()->write(num_bytes);
+                auto [delay, weight] = admit_request(num_bytes);
+                if (delay > 0)
+                    s4u::this_actor::sleep_for(delay);
+                compute(get_processing_host(storage),
+                        get_hashing_flops(num_bytes) +
+                        get_compression_flops(s4u::Io::OpType::WRITE, num_bytes_to_store));
+                // Data that the partition already stores only updates its metadata
+                if (physical_size > 0) {
+                    if (weight != 1.0) {
+                        auto io = boost::dynamic_pointer_cast<s4u::Io>(
+                            storage->submit_write_async({metadata_->get_id()}, physical_offset, physical_size));
+                        io->update_priority(weight);
+                        Storage::wait_for_completion(io);
+                    } else {
+                        storage->submit_write({metadata_->get_id()}, physical_offset, physical_size);
+                    }
+                }
             } catch (StorageFailureException&) {
-                throw xbt::UnimplementedError("Handling of hardware resource failures not implemented");
+                // As for a failed asynchronous write, undo the write before letting the caller handle the failure
+                abort_write(my_sequence_number);
+                throw;
             }
         }
 
@@ -175,10 +266,112 @@ namespace simgrid::fsmod {
         metadata_->set_access_date(s4u::Engine::get_clock());
         metadata_->set_modification_date(s4u::Engine::get_clock());
         metadata_->notify_write_end(my_sequence_number);
+        if (auto client_cache = partition_->file_system_->get_client_cache_for(storage))
+            client_cache->notify_write(metadata_, previous_modification_date, physical_offset, physical_size);
 
         return num_bytes;
     }
 
+    std::function<s4u::IoPtr(bool)> File::make_read_starter(const std::shared_ptr<Storage>& storage, sg_offset_t offset,
+                                                        sg_size_t num_bytes) const {
+        auto* metadata = metadata_;
+        auto* file_system = partition_->file_system_;
+        auto [physical_offset, physical_size] = get_physical_extent(offset, num_bytes);
+        return [storage, metadata, file_system, physical_offset = physical_offset,
+                physical_size = physical_size](bool /*detached*/) {
+            if (auto client_cache = file_system->get_client_cache_for(storage))
+                return client_cache->read_async(metadata, storage, physical_offset, physical_size);
+            return boost::dynamic_pointer_cast<s4u::Io>(
+                storage->submit_read_async({metadata->get_id()}, physical_offset, physical_size));
+        };
+    }
+
+    std::pair<double, double> File::admit_request(sg_size_t num_bytes) const {
+        // Every policy that applies to the request must let it through, and the most specific one gives its priority
+        auto policies = partition_->file_system_->get_qos_policies(qos_tag_);
+        if (policies.empty())
+            return {0, 1.0};
+        double delay = 0;
+        for (const auto& policy : policies)
+            delay = std::max(delay, policy->admit(num_bytes));
+        return {delay, QoSPolicy::get_priority_weight(policies.front()->get_priority_class())};
+    }
+
+    s4u::IoPtr File::start_with_qos(s4u::Io::OpType op_type, sg_size_t num_bytes,
+                                    const std::shared_ptr<Storage>& storage,
+                                    const std::function<s4u::IoPtr(bool)>& start, bool detached) const {
+        auto [delay, weight] = admit_request(num_bytes);
+        if (delay == 0) {
+            auto io = start(detached);
+            if (weight != 1.0)
+                io->update_priority(weight);
+            return io;
+        }
+
+        // A throttled request is started later, which requires an actor
+        return storage->start_in_background(s4u::Host::current(), op_type, path_ + "_throttled_io",
+                                            [delay = delay, weight = weight, start]() {
+            s4u::this_actor::sleep_for(delay);
+            auto io = start(false);
+            if (weight != 1.0)
+                io->update_priority(weight);
+            Storage::wait_for_completion(io);
+        }, detached);
+    }
+
+    std::pair<sg_offset_t, sg_size_t> File::get_physical_extent(sg_offset_t offset, sg_size_t num_bytes) const {
+        double ratio = metadata_->get_compression_ratio();
+        if (ratio == 1.0)
+            return {offset, num_bytes};
+        auto physical_offset = static_cast<sg_offset_t>(std::floor(static_cast<double>(offset) / ratio));
+        auto physical_end = Partition::get_physical_size(metadata_, static_cast<sg_size_t>(offset) + num_bytes);
+        return {physical_offset, physical_end - static_cast<sg_size_t>(physical_offset)};
+    }
+
+    double File::get_compression_flops(s4u::Io::OpType op_type, sg_size_t num_bytes) const {
+        if (metadata_->get_compression_ratio() == 1.0)
+            return 0;
+        double flops_per_byte = (op_type == s4u::Io::OpType::READ) ? partition_->get_decompression_flops_per_byte()
+                                                                  : partition_->get_compression_flops_per_byte();
+        return flops_per_byte * static_cast<double>(num_bytes);
+    }
+
+    double File::get_hashing_flops(sg_size_t num_bytes) const {
+        if (partition_->get_deduplication_chunk_size() == 0)
+            return 0;
+        return partition_->get_hashing_flops_per_byte() * static_cast<double>(num_bytes);
+    }
+
+    s4u::Host* File::get_processing_host(const std::shared_ptr<Storage>& storage) const {
+        if (auto* controller_host = storage->get_controller_host())
+            return controller_host;
+        return s4u::Host::current();
+    }
+
+    std::function<s4u::IoPtr(bool)> File::with_processing(s4u::Io::OpType op_type, double flops,
+                                                          const std::shared_ptr<Storage>& storage,
+                                                          std::function<s4u::IoPtr(bool)> start) const {
+        if (flops <= 0)
+            return start;
+        // Data is hashed and compressed before it is written, and decompressed after it is read, which requires
+        // an actor
+        auto* host = get_processing_host(storage);
+        return [op_type, storage, host, flops, name = path_ + "_processed_io", start](bool detached) {
+            return storage->start_in_background(s4u::Host::current(), op_type, name, [op_type, host, flops, start]() {
+                if (op_type == s4u::Io::OpType::WRITE)
+                    compute(host, flops);
+                Storage::wait_for_completion(start(false));
+                if (op_type == s4u::Io::OpType::READ)
+                    compute(host, flops);
+            }, detached);
+        };
+    }
+
+    void File::compute(s4u::Host* host, double flops) {
+        if (flops > 0)
+            s4u::Exec::init()->set_flops_amount(flops)->set_host(host)->wait();
+    }
+
     /**
      * @brief Change the file pointer position
      * @param pos: the position as an offset from the first byte of the file
@@ -11,8 +11,12 @@
 
 namespace simgrid::fsmod {
 
+   // Identifiers are never reused, so that storages can tell files apart even after some are deleted
+   static unsigned long next_file_id = 1;
+
    FileMetadata::FileMetadata(sg_size_t initial_size, Partition *partition, std::string dir_path, std::string file_name)
         : partition_(partition),
+          id_(next_file_id++),
           dir_path_(std::move(dir_path)),
           file_name_(std::move(file_name)),
           current_size_(initial_size),
@@ -30,4 +34,25 @@ namespace simgrid::fsmod {
       access_date_ = date;
       partition_->new_file_access_event(this);
    }
+
+   void FileMetadata::increase_file_refcount() {
+      file_refcount_++;
+      // Opening a file pins it
+      if (file_refcount_ == 1 && evictable_)
+         partition_->new_file_pin_change_event(this);
+   }
+
+   void FileMetadata::decrease_file_refcount() {
+      file_refcount_--;
+      if (file_refcount_ == 0 && evictable_)
+         partition_->new_file_pin_change_event(this);
+   }
+
+   /**
+    * @brief Retrieve the space that deleting the file would free on its partition
+    * @return A number of bytes, which accounts for compression and for the chunks shared with other files
+    */
+   sg_size_t FileMetadata::get_reclaimable_space() const {
+      return partition_->get_reclaimable_space(this);
+   }
 } // namespace simgrid::fsmod
\ No newline at end of file
@@ -15,8 +15,8 @@
 #include "fsmod/File.hpp"
 #include "fsmod/PathUtil.hpp"
 #include "fsmod/Partition.hpp"
-#include "fsmod/PartitionFIFOCaching.hpp"
-#include "fsmod/PartitionLRUCaching.hpp"
+#include "fsmod/PartitionTiered.hpp"
+#include "fsmod/StripedStorage.hpp"
 #include "fsmod/FileSystemException.hpp"
 
 XBT_LOG_NEW_DEFAULT_CATEGORY(fsmod_filesystem, "File System module: File system management related logs");
@@ -51,6 +51,29 @@ namespace simgrid::fsmod {
         return std::make_pair(partition, path_at_mount_point);
     }
 
+    /**
+     * @brief Private method to check that a mount point can be used by a new partition
+     * @param mount_point: the partition's mount point
+     * @return The mount point without trailing slashes
+     */
+    std::string FileSystem::check_new_mount_point(const std::string &mount_point) const {
+        auto cleanup_mount_point = mount_point;
+        PathUtil::remove_trailing_slashes(cleanup_mount_point);
+        if (PathUtil::simplify_path_string(mount_point)  != cleanup_mount_point) {
+            throw std::invalid_argument("Invalid partition path");
+        }
+        // Adding a terminal "/" to not trigger spurious prefix errors
+        cleanup_mount_point += "/";
+        for (auto const &[mp, p]: this->partitions_) {
+            if (((mp + "/").rfind(cleanup_mount_point, 0) == 0) || (cleanup_mount_point.rfind(mp + "/", 0) == 0)) {
+                throw std::invalid_argument("Mount point already exists or is prefix of existing mount point");
+            }
+        }
+        // Remove the terminal
+        PathUtil::remove_trailing_slashes(cleanup_mount_point);
+        return cleanup_mount_point;
+    }
+
     /*********************** PUBLIC INTERFACE *****************************/
 
     /**
@@ -84,36 +107,90 @@ namespace simgrid::fsmod {
      */
     void FileSystem::mount_partition(const std::string &mount_point, std::shared_ptr<Storage> storage, sg_size_t size,
                                      Partition::CachingScheme caching_scheme) {
-        auto cleanup_mount_point = mount_point;
-        PathUtil::remove_trailing_slashes(cleanup_mount_point);
-        if (PathUtil::simplify_path_string(mount_point)  != cleanup_mount_point) {
-            throw std::invalid_argument("Invalid partition path");
-        }
-        // Adding a terminal "/" to not trigger spurious prefix errors
-        cleanup_mount_point += "/";
-        for (auto const &[mp, p]: this->partitions_) {
-            if (((mp + "/").rfind(cleanup_mount_point, 0) == 0) || (cleanup_mount_point.rfind(mp + "/", 0) == 0)) {
-                throw std::invalid_argument("Mount point already exists or is prefix of existing mount point");
-            }
-        }
-        // Remove the terminal
-        PathUtil::remove_trailing_slashes(cleanup_mount_point);
-
-
+        std::shared_ptr<EvictionPolicy> eviction_policy;
         switch (caching_scheme) {
             case Partition::CachingScheme::FIFO:
-                this->partitions_[cleanup_mount_point] =
-                        std::make_shared<PartitionFIFOCaching>(cleanup_mount_point, this, std::move(storage), size);
+                eviction_policy = std::make_shared<FIFOEvictionPolicy>();
                 break;
             case Partition::CachingScheme::LRU:
-                this->partitions_[cleanup_mount_point] =
-                        std::make_shared<PartitionLRUCaching>(cleanup_mount_point, this, std::move(storage), size);
+                eviction_policy = std::make_shared<LRUEvictionPolicy>();
                 break;
             default: // actually Partition::CachingScheme::NONE
-                this->partitions_[cleanup_mount_point] =
-                        std::make_shared<Partition>(cleanup_mount_point, this, std::move(storage), size);
                 break;
         }
+        mount_partition(mount_point, std::move(storage), size, std::move(eviction_policy));
+    }
+
+    /**
+     * @brief A method to add a partition that evicts files with a given policy to the file system
+     * @param mount_point: the partition's mount point (e.g., "/dev/a/")
+     * @param storage: the storage
+     * @param size: the partition size as a unit string (e.g., "100GB")
+     * @param eviction_policy: the policy that selects the files to evict when space is needed (nullptr: no caching)
+     */
+    void FileSystem::mount_partition(const std::string &mount_point, std::shared_ptr<Storage> storage,
+                                     const std::string &size, std::shared_ptr<EvictionPolicy> eviction_policy) {
+        mount_partition(mount_point, std::move(storage), static_cast<sg_size_t>(xbt_parse_get_size("", 0, size, "")),
+                        std::move(eviction_policy));
+    }
+
+    /**
+     * @brief A method to add a partition that evicts files with a given policy to the file system
+     * @param mount_point: the partition's mount point (e.g., "/dev/a/")
+     * @param storage: the storage
+     * @param size: the partition size in bytes
+     * @param eviction_policy: the policy that selects the files to evict when space is needed (nullptr: no caching)
+     */
+    void FileSystem::mount_partition(const std::string &mount_point, std::shared_ptr<Storage> storage, sg_size_t size,
+                                     std::shared_ptr<EvictionPolicy> eviction_policy) {
+        auto cleanup_mount_point = this->check_new_mount_point(mount_point);
+        this->partitions_[cleanup_mount_point] = std::make_shared<Partition>(cleanup_mount_point, this,
+                                                                             std::move(storage), size,
+                                                                             std::move(eviction_policy));
+    }
+
+    /**
+     * @brief A method to add a tiered partition to the file system
+     * @param mount_point: the partition's mount point
+     * @param fast_storage: the storage of the fast tier
+     * @param fast_tier_size: the size of the fast tier as a unit string (e.g., "10GB")
+     * @param capacity_storage: the storage of the capacity tier
+     * @param capacity_tier_size: the size of the capacity tier as a unit string (e.g., "1TB")
+     * @return The tiered partition
+     */
+    std::shared_ptr<PartitionTiered> FileSystem::mount_tiered_partition(const std::string &mount_point,
+                                                                        std::shared_ptr<Storage> fast_storage,
+                                                                        const std::string &fast_tier_size,
+                                                                        std::shared_ptr<Storage> capacity_storage,
+                                                                        const std::string &capacity_tier_size) {
+        return mount_tiered_partition(mount_point, std::move(fast_storage),
+                                      static_cast<sg_size_t>(xbt_parse_get_size("", 0, fast_tier_size, "")),
+                                      std::move(capacity_storage),
+                                      static_cast<sg_size_t>(xbt_parse_get_size("", 0, capacity_tier_size, "")));
+    }
+
+    /**
+     * @brief A method to add a tiered partition to the file system. New files are placed on the fast tier when
+     *        they fit, and a background actor migrates files between tiers based on their heat
+     * @param mount_point: the partition's mount point
+     * @param fast_storage: the storage of the fast tier
+     * @param fast_tier_size: the size of the fast tier in bytes
+     * @param capacity_storage: the storage of the capacity tier
+     * @param capacity_tier_size: the size of the capacity tier in bytes
+     * @return The tiered partition
+     */
+    std::shared_ptr<PartitionTiered> FileSystem::mount_tiered_partition(const std::string &mount_point,
+                                                                        std::shared_ptr<Storage> fast_storage,
+                                                                        sg_size_t fast_tier_size,
+                                                                        std::shared_ptr<Storage> capacity_storage,
+                                                                        sg_size_t capacity_tier_size) {
+        auto cleanup_mount_point = this->check_new_mount_point(mount_point);
+        auto partition = std::make_shared<PartitionTiered>(cleanup_mount_point, this, std::move(fast_storage),
+                                                           fast_tier_size, std::move(capacity_storage),
+                                                           capacity_tier_size);
+        this->partitions_[cleanup_mount_point] = partition;
+        partition->start_migrations();
+        return partition;
     }
 
    /**
@@ -234,7 +311,133 @@ namespace simgrid::fsmod {
 
 
     /**
-     * @brief Create a new file on the file system in zero time
+     * @brief Set the metadata service that serves the metadata operations on this file system, unless the
+     *        partition on which an operation is made has its own metadata service. Without metadata service,
+     *        metadata operations take zero time
+     * @param metadata_service: a metadata service (or nullptr)
+     */
+    void FileSystem::set_metadata_service(std::shared_ptr<MetadataService> metadata_service) {
+        metadata_service_ = std::move(metadata_service);
+    }
+
+    /**
+     * @brief Add a client cache, which caches the data that the actors on its host access on the partitions of
+     *        this file system whose storage is attached to another host. There is at most one client cache per host
+     * @param client_cache: a client cache
+     */
+    void FileSystem::add_client_cache(std::shared_ptr<ClientCache> client_cache) {
+        if (not client_cache)
+            throw std::invalid_argument("FileSystem::add_client_cache(): the client cache cannot be null");
+        const auto* host = client_cache->get_host();
+        if (client_caches_.find(host) != client_caches_.end())
+            throw std::invalid_argument("FileSystem::add_client_cache(): host " + host->get_name() +
+                                        " already has a client cache");
+        client_caches_[host] = std::move(client_cache);
+    }
+
+    /**
+     * @brief Retrieve the client cache of a host
+     * @param host: a host
+     * @return A client cache, or nullptr if the host has none
+     */
+    std::shared_ptr<ClientCache> FileSystem::get_client_cache(const s4u::Host* host) const {
+        auto it = client_caches_.find(host);
+        return it == client_caches_.end() ? nullptr : it->second;
+    }
+
+    std::shared_ptr<ClientCache> FileSystem::get_client_cache_for(const std::shared_ptr<Storage> &storage) const {
+        // Accesses made outside of actors (e.g., to set up the initial content of a file system) are not cached
+        if (client_caches_.empty() || s4u::Actor::is_maestro())
+            return nullptr;
+        auto client_cache = get_client_cache(s4u::Host::current());
+        if (client_cache && client_cache->caches(storage))
+            return client_cache;
+        return nullptr;
+    }
+
+    /**
+     * @brief Set the QoS policy that applies to all the reads and writes made on this file system
+     * @param qos_policy: a QoS policy (or nullptr)
+     */
+    void FileSystem::set_qos_policy(std::shared_ptr<QoSPolicy> qos_policy) {
+        qos_policy_ = std::move(qos_policy);
+    }
+
+    /**
+     * @brief Set the QoS policy that applies to the reads and writes made by an actor on this file system
+     * @param actor: an actor
+     * @param qos_policy: a QoS policy (or nullptr)
+     */
+    void FileSystem::set_actor_qos_policy(const s4u::Actor* actor, std::shared_ptr<QoSPolicy> qos_policy) {
+        if (actor == nullptr)
+            throw std::invalid_argument("FileSystem::set_actor_qos_policy(): the actor cannot be null");
+        if (qos_policy)
+            actor_qos_policies_[actor->get_pid()] = std::move(qos_policy);
+        else
+            actor_qos_policies_.erase(actor->get_pid());
+    }
+
+    /**
+     * @brief Retrieve the QoS policy of an actor
+     * @param actor: an actor
+     * @return A QoS policy, or nullptr if the actor has none
+     */
+    std::shared_ptr<QoSPolicy> FileSystem::get_actor_qos_policy(const s4u::Actor* actor) const {
+        if (actor == nullptr)
+            return nullptr;
+        auto it = actor_qos_policies_.find(actor->get_pid());
+        return it == actor_qos_policies_.end() ? nullptr : it->second;
+    }
+
+    /**
+     * @brief Set the QoS policy that applies to the reads and writes made on this file system through the files
+     *        tagged with a given tag (see File::set_qos_tag())
+     * @param tag: a user-defined tag
+     * @param qos_policy: a QoS policy (or nullptr)
+     */
+    void FileSystem::set_tag_qos_policy(const std::string& tag, std::shared_ptr<QoSPolicy> qos_policy) {
+        if (tag.empty())
+            throw std::invalid_argument("FileSystem::set_tag_qos_policy(): the tag cannot be empty");
+        if (qos_policy)
+            tag_qos_policies_[tag] = std::move(qos_policy);
+        else
+            tag_qos_policies_.erase(tag);
+    }
+
+    /**
+     * @brief Retrieve the QoS policy of a tag
+     * @param tag: a user-defined tag
+     * @return A QoS policy, or nullptr if the tag has none
+     */
+    std::shared_ptr<QoSPolicy> FileSystem::get_tag_qos_policy(const std::string& tag) const {
+        auto it = tag_qos_policies_.find(tag);
+        return it == tag_qos_policies_.end() ? nullptr : it->second;
+    }
+
+    std::vector<std::shared_ptr<QoSPolicy>> FileSystem::get_qos_policies(const std::string &tag) const {
+        // From the most specific policy to the least specific one
+        std::vector<std::shared_ptr<QoSPolicy>> policies;
+        if (auto tag_policy = tag.empty() ? nullptr : get_tag_qos_policy(tag))
+            policies.push_back(tag_policy);
+        if (not actor_qos_policies_.empty() && not s4u::Actor::is_maestro())
+            if (auto actor_policy = get_actor_qos_policy(s4u::Actor::self()))
+                policies.push_back(actor_policy);
+        if (qos_policy_)
+            policies.push_back(qos_policy_);
+        return policies;
+    }
+
+    void FileSystem::perform_metadata_operation(const std::shared_ptr<Partition> &partition,
+                                                MetadataService::Operation operation) const {
+        auto metadata_service = partition->get_metadata_service();
+        if (not metadata_service)
+            metadata_service = metadata_service_;
+        if (metadata_service)
+            metadata_service->perform(operation);
+    }
+
+    /**
+     * @brief Create a new file on the file system, in zero time unless a metadata service is used
      * @param full_path: the file's absolute path
      * @param size: the file size
      */
@@ -246,6 +449,7 @@ namespace simgrid::fsmod {
         // Get the partition and path
         std::string simplified_path = PathUtil::simplify_path_string(full_path);
         auto [partition, path_at_mount_point] = this->find_path_at_mount_point(simplified_path);
+        perform_metadata_operation(partition, MetadataService::Operation::CREATE);
 
         // Check that the path doesn't match an existing directory
         // TODO: This is weak, since if directory "a/b/c/d" exists, director "a/b" does not!
@@ -258,9 +462,45 @@ namespace simgrid::fsmod {
         auto [dir, file_name] = PathUtil::split_path(path_at_mount_point);
 
         // Add the file to the content
+        partition->hold_directory_locks({dir});
         partition->create_new_file(dir, file_name, size);
     }
 
+    /**
+     * @brief Create a new file in zero time on a partition whose storage is a striped storage, with a given layout
+     *        instead of the storage's default one
+     * @param full_path: the file's absolute path
+     * @param size: the file size
+     * @param stripe_count: the number of storage targets over which the file is striped
+     * @param stripe_size: the stripe size
+     */
+    void FileSystem::create_file(const std::string &full_path, const std::string &size, unsigned long stripe_count,
+                                 const std::string &stripe_size) const {
+        create_file(full_path, static_cast<sg_size_t>(xbt_parse_get_size("", 0, size, "")), stripe_count,
+                    static_cast<sg_size_t>(xbt_parse_get_size("", 0, stripe_size, "")));
+    }
+
+    void FileSystem::create_file(const std::string &full_path, sg_size_t size, unsigned long stripe_count,
+                                 sg_size_t stripe_size) const {
+        create_file(full_path, size);
+
+        std::string simplified_path = PathUtil::simplify_path_string(full_path);
+        auto [partition, path_at_mount_point] = this->find_path_at_mount_point(simplified_path);
+        auto [dir, file_name] = PathUtil::split_path(path_at_mount_point);
+        auto* metadata = partition->get_file_metadata(dir, file_name);
+        // The file does not exist if its layout cannot be set
+        try {
+            auto storage = std::dynamic_pointer_cast<StripedStorage>(partition->get_storage_for_file(metadata));
+            if (not storage)
+                throw std::invalid_argument("Cannot set the layout of " + full_path + ", which is not stored "
+                                            "on a striped storage");
+            storage->set_file_layout(metadata->get_id(), stripe_count, stripe_size);
+        } catch (const std::invalid_argument&) {
+            partition->delete_file(dir, file_name);
+            throw;
+        }
+    }
+
     /**
      * @brief Truncate a file
      * @param full_path: the file's absolute path
@@ -293,6 +533,60 @@ namespace simgrid::fsmod {
         partition->make_file_evictable(dir, file_name, evictable);
     }
 
+    /**
+     * @brief Set the compression ratio of a closed file, which overrides the one of its partition. The file's
+     *        content is re-stored with the new ratio in zero time: neither reading nor recompressing it is simulated,
+     *        so that this is meant to describe how a file is stored rather than to model a recompression job
+     * @param full_path: the file's absolute path
+     * @param ratio: the ratio between the size of the file and its compressed size (1 to store it uncompressed)
+     */
+    void FileSystem::set_file_compression_ratio(const std::string& full_path, double ratio) const {
+        // Get the partition and path
+        std::string simplified_path = PathUtil::simplify_path_string(full_path);
+        auto [partition, path_at_mount_point] = this->find_path_at_mount_point(simplified_path);
+
+        // Split the path
+        auto [dir, file_name] = PathUtil::split_path(path_at_mount_point);
+
+        partition->set_file_compression_ratio(dir, file_name, ratio);
+    }
+
+    /**
+     * @brief Set the content fingerprint of a closed file on a deduplicated partition. Files with the same
+     *        fingerprint have the same content, and thus share all their chunks
+     * @param full_path: the file's absolute path
+     * @param fingerprint: an identifier of the file's content (empty for a content shared with no other file)
+     */
+    void FileSystem::set_file_fingerprint(const std::string& full_path, const std::string& fingerprint) const {
+        // Get the partition and path
+        std::string simplified_path = PathUtil::simplify_path_string(full_path);
+        auto [partition, path_at_mount_point] = this->find_path_at_mount_point(simplified_path);
+
+        // Split the path
+        auto [dir, file_name] = PathUtil::split_path(path_at_mount_point);
+
+        partition->set_file_fingerprints(dir, file_name, fingerprint, {});
+    }
+
+    /**
+     * @brief Set the fingerprints of the chunks of a closed file on a deduplicated partition. Chunks with the same
+     *        fingerprint have the same content, in this file or in any other one, and are thus stored only once
+     * @param full_path: the file's absolute path
+     * @param chunk_fingerprints: the fingerprints of the file's first chunks, in order (the chunks past the last
+     *        fingerprint hold content shared with no other file)
+     */
+    void FileSystem::set_file_chunk_fingerprints(const std::string& full_path,
+                                                 const std::vector<std::string>& chunk_fingerprints) const {
+        // Get the partition and path
+        std::string simplified_path = PathUtil::simplify_path_string(full_path);
+        auto [partition, path_at_mount_point] = this->find_path_at_mount_point(simplified_path);
+
+        // Split the path
+        auto [dir, file_name] = PathUtil::split_path(path_at_mount_point);
+
+        partition->set_file_fingerprints(dir, file_name, "", chunk_fingerprints);
+    }
+
 
     /**
       * @brief Open a file. If no file corresponds to the given full path, a new file of size 0 is created.
@@ -316,8 +610,27 @@ namespace simgrid::fsmod {
         // Split the path
         auto [dir, file_name] = PathUtil::split_path(path_at_mount_point);
 
-        // Get the file metadata
+        // A read-through partition fetches the files it does not hold from its origin, unless they are overwritten.
+        // The files it does not admit are opened on the origin instead
+        FileMetadata* pinned_file = nullptr;
+        if (access_mode != "w" && not partition->read_through(dir, file_name, pinned_file)) {
+            auto origin_path = PathUtil::simplify_path_string(partition->origin_path_ + "/" + dir + "/" + file_name);
+            return partition->origin_file_system_->open(origin_path, access_mode);
+        }
+
+        // Get the file metadata. Opening a file that does not exist creates it, which is a single metadata operation.
+        // A file held by a read-through partition stays pinned meanwhile, so that it cannot be evicted
         auto metadata = partition->get_file_metadata(dir, file_name);
+        if (metadata || access_mode == "r" || access_mode == "r+") {
+            try {
+                perform_metadata_operation(partition, MetadataService::Operation::OPEN);
+            } catch (...) {
+                if (pinned_file)
+                    pinned_file->decrease_file_refcount();
+                throw;
+            }
+            metadata = partition->get_file_metadata(dir, file_name);
+        }
         if (not metadata) {
             if (access_mode == "r" or access_mode == "r+")
                 throw FileNotFoundException(XBT_THROW_POINT, full_path);
@@ -326,7 +639,7 @@ namespace simgrid::fsmod {
         } else {
             if (access_mode == "w") {
                 // Opening a file in "w" mode resets its size to 0. Update metadata and partition free space accordingly
-                partition->increase_free_space(metadata->get_current_size());
+                partition->resize_stored_content(metadata, 0);
                 metadata->set_current_size(0);
                 metadata->set_future_size(0);
             }
@@ -334,6 +647,13 @@ namespace simgrid::fsmod {
 
         // Increase the refcount
         metadata->increase_file_refcount();
+        if (pinned_file)
+            pinned_file->decrease_file_refcount();
+
+        // Close-to-open consistency: opening a file tells the client whether its cached data is still valid
+        auto storage = partition->get_storage_for_file(metadata);
+        if (auto client_cache = get_client_cache_for(storage))
+            client_cache->revalidate(metadata, storage);
 
         // Create the file object
         auto file = std::make_shared<File>(simplified_path, access_mode, metadata, partition.get());
@@ -376,6 +696,8 @@ namespace simgrid::fsmod {
         auto [partition, path_at_mount_point] = this->find_path_at_mount_point(simplified_path);
         auto [dir, file_name] = PathUtil::split_path(path_at_mount_point);
 
+        perform_metadata_operation(partition, MetadataService::Operation::UNLINK);
+        partition->hold_directory_locks({dir});
         partition->delete_file(dir, file_name);
     }
 
@@ -400,6 +722,8 @@ namespace simgrid::fsmod {
         auto [dst_dir, dst_file_name] = PathUtil::split_path(dst_path_at_mount_point);
 
         auto partition = src_partition;
+        perform_metadata_operation(partition, MetadataService::Operation::MOVE);
+        partition->hold_directory_locks({src_dir, dst_dir});
         partition->move_file(src_dir, src_file_name, dst_dir, dst_file_name);
     }
 
@@ -457,6 +781,7 @@ namespace simgrid::fsmod {
     std::set<std::string, std::less<>> FileSystem::list_files_in_directory(const std::string &full_dir_path) const {
         std::string simplified_path = PathUtil::simplify_path_string(full_dir_path);
         auto [partition, path_at_mount_point] = this->find_path_at_mount_point(simplified_path);
+        perform_metadata_operation(partition, MetadataService::Operation::LIST);
         return partition->list_files_in_directory(path_at_mount_point);
     }
 
@@ -481,6 +806,21 @@ namespace simgrid::fsmod {
         return partition->get_free_space();
     }
 
+    /**
+     * @brief Retrieve statistics about the lock of a directory, which show how much file creations, deletions, and
+     *        moves in that directory contended
+     * @param full_dir_path: the directory's absolute path
+     * @return Lock statistics (all zero if no mutation was made in the directory by an actor)
+     */
+    Partition::DirectoryLockStatistics FileSystem::get_directory_lock_statistics(const std::string &full_dir_path) const {
+        std::string simplified_path = PathUtil::simplify_path_string(full_dir_path);
+        auto [partition, path_at_mount_point] = this->find_path_at_mount_point(simplified_path);
+        // Files at the root of a partition are in directory "/"
+        if (path_at_mount_point.empty())
+            path_at_mount_point = "/";
+        return partition->get_directory_lock_statistics(path_at_mount_point);
+    }
+
     /**
      * @brief Retrieve the file system's name
      * @return a name
@@ -0,0 +1,213 @@
+/* Copyright (c) 2024-2026. The FSMOD Team. All rights reserved.          */
+
+/* This program is free software; you can redistribute it and/or modify it
+ * under the terms of the license (GNU LGPL) which comes with this package. */
+
+#include "fsmod/HDDStorage.hpp"
+#include <simgrid/Exception.hpp>
+#include <simgrid/s4u/Actor.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <tuple>
+
+XBT_LOG_NEW_DEFAULT_CATEGORY(fsmod_hdd_storage, "File System module: HDD storage related logs");
+
+namespace simgrid::fsmod {
+
+    /**
+     * @brief Create an instance of an HDD storage
+     * @param name: the storage's name
+     * @param disk: the storage's disk
+     * @param capacity: the number of bytes the drive can hold, which is the distance of a full-stroke seek
+     * @return an HDD storage instance
+     */
+    std::shared_ptr<HDDStorage> HDDStorage::create(const std::string& name, s4u::Disk* disk, sg_size_t capacity) {
+        return std::make_shared<HDDStorage>(name, disk, capacity);
+    }
+
+    HDDStorage::HDDStorage(const std::string& name, s4u::Disk* disk, sg_size_t capacity)
+        : Storage(name), capacity_(capacity) {
+        if (disk == nullptr)
+            throw std::invalid_argument("The disk of an HDD storage cannot be null");
+        if (capacity == 0)
+            throw std::invalid_argument("The capacity of an HDD storage must be positive");
+        file_extent_size_ = std::min<sg_size_t>(1000000000, capacity);
+        set_disk(disk);
+    }
+
+    /**
+     * @brief Set the rotation speed of the drive, which determines the rotational latency of the operations that
+     *        require a seek (half a rotation on average)
+     * @param rpm: a number of rotations per minute (default: 7200)
+     */
+    void HDDStorage::set_rotation_speed(double rpm) {
+        if (rpm <= 0)
+            throw std::invalid_argument("The rotation speed of an HDD storage must be positive");
+        rpm_ = rpm;
+    }
+
+    /**
+     * @brief Set the seek times of the drive. The seek time grows with the square root of the distance traveled by
+     *        the head, from the track-to-track seek time for the shortest distances to the full-stroke seek time for
+     *        a distance equal to the drive's capacity
+     * @param track_to_track_seek_time: the shortest seek time in seconds (default: 0.001)
+     * @param full_stroke_seek_time: the longest seek time in seconds (default: 0.015)
+     */
+    void HDDStorage::set_seek_times(double track_to_track_seek_time, double full_stroke_seek_time) {
+        if (track_to_track_seek_time < 0 || full_stroke_seek_time < track_to_track_seek_time)
+            throw std::invalid_argument("The seek times of an HDD storage cannot be negative, and the full-stroke "
+                                        "seek time cannot be shorter than the track-to-track seek time");
+        track_to_track_seek_time_ = track_to_track_seek_time;
+        full_stroke_seek_time_ = full_stroke_seek_time;
+    }
+
+    /**
+     * @brief Compute the time the head needs to reach an address, i.e., its seek time plus the average rotational
+     *        latency, which is 0 if the head is already there
+     * @param distance: the number of bytes between the head and the address
+     * @return A time in seconds
+     */
+    double HDDStorage::get_positioning_time(sg_size_t distance) const {
+        if (distance == 0)
+            return 0;
+        double stroke = std::min(1.0, static_cast<double>(distance) / static_cast<double>(capacity_));
+        double seek_time = track_to_track_seek_time_ + (full_stroke_seek_time_ - track_to_track_seek_time_) *
+                                                       std::sqrt(stroke);
+        return seek_time + 30.0 / rpm_;
+    }
+
+    /**
+     * @brief Set the size of the contiguous extent reserved for each file. Files are placed one after the other,
+     *        in the order in which they are first accessed, each at the beginning of its own extent. Once all the
+     *        extents that fit in the drive's capacity are used, the next files wrap around to the first extent, and
+     *        thus share the addresses of other files. Since the drive only uses addresses to compute seek
+     *        distances, such files only seem closer than they would be
+     * @param extent_size: a number of bytes, at most the drive's capacity (default: 1GB)
+     */
+    void HDDStorage::set_file_extent_size(sg_size_t extent_size) {
+        if (extent_size == 0 || extent_size > capacity_)
+            throw std::invalid_argument("The file extent size of an HDD storage must be between 1 and its capacity");
+        file_extent_size_ = extent_size;
+    }
+
+    sg_offset_t HDDStorage::get_file_base_address(unsigned long file_id) {
+        // Requests that do not come from a file access the beginning of the drive
+        if (file_id == 0)
+            return 0;
+        auto it = file_base_addresses_.find(file_id);
+        if (it != file_base_addresses_.end())
+            return it->second;
+        sg_size_t num_extents = capacity_ / file_extent_size_;
+        // Files beyond the drive's capacity share extents, see set_file_extent_size()
+        auto base_address = static_cast<sg_offset_t>((file_base_addresses_.size() % num_extents) * file_extent_size_);
+        file_base_addresses_[file_id] = base_address;
+        return base_address;
+    }
+
+    s4u::IoPtr HDDStorage::submit(s4u::Io::OpType op_type, sg_offset_t address, sg_size_t size) {
+        auto operation = std::make_shared<Operation>();
+        operation->op_type = op_type;
+        operation->address = address;
+        operation->size = size;
+        // The completion activity is blocked by the gate, which is only started once the operation is served
+        std::tie(operation->completion, operation->gate) = init_completion(op_type,
+                                                                           get_name() + " Operation Completion");
+
+        // The head is driven by an actor that serves operations until none are pending
+        if (not head_busy_) {
+            auto storage = shared_from_this();
+            get_first_disk()->get_host()->add_actor(get_name() + "_head", [storage]() {
+                // If the host fails, so does every operation the head had yet to complete
+                s4u::this_actor::on_exit([storage](bool failed) {
+                    if (failed)
+                        storage->fail_operations();
+                });
+                storage->serve_operations();
+            });
+            head_busy_ = true;
+        }
+        pending_operations_.push_back(operation);
+        return operation->completion;
+    }
+
+    std::shared_ptr<HDDStorage::Operation> HDDStorage::pop_next_operation() {
+        auto next = pending_operations_.begin();
+        if (request_reordering_) {
+            // C-LOOK: the closest operation ahead of the head, or else the one with the lowest address
+            auto ahead = pending_operations_.end();
+            for (auto it = pending_operations_.begin(); it != pending_operations_.end(); ++it) {
+                if ((*it)->address < (*next)->address)
+                    next = it;
+                if ((*it)->address >= head_position_ && (ahead == pending_operations_.end() ||
+                                                         (*it)->address < (*ahead)->address))
+                    ahead = it;
+            }
+            if (ahead != pending_operations_.end())
+                next = ahead;
+        }
+        auto operation = *next;
+        pending_operations_.erase(next);
+        return operation;
+    }
+
+    void HDDStorage::serve_operations() {
+        while (not pending_operations_.empty()) {
+            auto operation = pop_next_operation();
+            current_operation_ = operation;
+            auto distance = static_cast<sg_size_t>(std::abs(operation->address - head_position_));
+            double positioning_time = get_positioning_time(distance);
+            num_operations_++;
+            XBT_DEBUG("Moving the head of %s by %llu bytes in %g seconds", get_cname(), distance, positioning_time);
+            try {
+                if (positioning_time > 0) {
+                    num_seeks_++;
+                    total_positioning_time_ += positioning_time;
+                    s4u::this_actor::sleep_for(positioning_time);
+                }
+                if (operation->size > 0)
+                    s4u::IoPtr(get_first_disk()->io_init(operation->size, operation->op_type))->start()->wait();
+            } catch (const simgrid::Exception&) {
+                current_operation_ = nullptr;
+                fail_completion(operation->completion);
+                continue;
+            }
+            current_operation_ = nullptr;
+            head_position_ = operation->address + static_cast<sg_offset_t>(operation->size);
+            operation->gate->set_disk(get_first_disk());
+        }
+        head_busy_ = false;
+    }
+
+    void HDDStorage::fail_operations() {
+        if (current_operation_)
+            fail_completion(current_operation_->completion);
+        current_operation_ = nullptr;
+        for (const auto& operation : pending_operations_)
+            fail_completion(operation->completion);
+        pending_operations_.clear();
+        // The next operation starts a new head actor
+        head_busy_ = false;
+    }
+
+    s4u::IoPtr HDDStorage::read_async(const IOContext& context, sg_offset_t offset, sg_size_t size) {
+        return submit(s4u::Io::OpType::READ, get_file_base_address(context.file_id) + offset, size);
+    }
+
+    void HDDStorage::read(const IOContext& context, sg_offset_t offset, sg_size_t size) {
+        wait_for_completion(read_async(context, offset, size));
+    }
+
+    s4u::IoPtr HDDStorage::write_async(const IOContext& context, sg_offset_t offset, sg_size_t size, bool detached) {
+        auto completion_activity = submit(s4u::Io::OpType::WRITE, get_file_base_address(context.file_id) + offset,
+                                          size);
+        if (detached)
+            completion_activity->detach();
+        return completion_activity;
+    }
+
+    void HDDStorage::write(const IOContext& context, sg_offset_t offset, sg_size_t size) {
+        wait_for_completion(write_async(context, offset, size));
+    }
+}
@@ -0,0 +1,104 @@
+/* Copyright (c) 2024-2026. The FSMOD Team. All rights reserved.          */
+
+/* This program is free software; you can redistribute it and/or modify it
+ * under the terms of the license (GNU LGPL) which comes with this package. */
+
+#include "fsmod/IOScheduler.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace simgrid::fsmod {
+
+    std::shared_ptr<IORequest> FIFOIOScheduler::pop() {
+        if (queue_.empty())
+            throw std::out_of_range("No queued I/O request");
+        auto request = queue_.front();
+        queue_.pop_front();
+        return request;
+    }
+
+    /**
+     * @brief Constructor
+     * @param read_expiry: the delay after which a read request should have been dispatched, in seconds
+     * @param write_expiry: the delay after which a write request should have been dispatched, in seconds
+     */
+    DeadlineIOScheduler::DeadlineIOScheduler(double read_expiry, double write_expiry)
+        : read_expiry_(read_expiry), write_expiry_(write_expiry) {
+        if (read_expiry < 0 || write_expiry < 0)
+            throw std::invalid_argument("Request expiry delays cannot be negative");
+    }
+
+    void DeadlineIOScheduler::push(const std::shared_ptr<IORequest>& request) {
+        double expiry = (request->op_type == s4u::Io::OpType::READ) ? read_expiry_ : write_expiry_;
+        queue_.emplace(request->arrival_date + expiry, request);
+    }
+
+    std::shared_ptr<IORequest> DeadlineIOScheduler::pop() {
+        if (queue_.empty())
+            throw std::out_of_range("No queued I/O request");
+        auto request = queue_.begin()->second;
+        queue_.erase(queue_.begin());
+        return request;
+    }
+
+    void FairShareIOScheduler::push(const std::shared_ptr<IORequest>& request) {
+        auto& queue = queues_[request->client];
+        if (queue.empty()) {
+            // Catch up with the least-served active client
+            sg_size_t min_served_bytes = 0;
+            bool has_active_clients = false;
+            for (const auto& [client, client_queue] : queues_) {
+                if (client_queue.empty())
+                    continue;
+                if (not has_active_clients || served_bytes_[client] < min_served_bytes)
+                    min_served_bytes = served_bytes_[client];
+                has_active_clients = true;
+            }
+            if (has_active_clients)
+                served_bytes_[request->client] = std::max(served_bytes_[request->client], min_served_bytes);
+        }
+        queue.push_back(request);
+        num_requests_++;
+    }
+
+    std::shared_ptr<IORequest> FairShareIOScheduler::pop() {
+        std::deque<std::shared_ptr<IORequest>>* selected_queue = nullptr;
+        sg_size_t min_served_bytes = 0;
+        for (auto& [client, client_queue] : queues_) {
+            if (client_queue.empty())
+                continue;
+            if (selected_queue == nullptr || served_bytes_[client] < min_served_bytes) {
+                selected_queue = &client_queue;
+                min_served_bytes = served_bytes_[client];
+            }
+        }
+        if (selected_queue == nullptr)
+            throw std::out_of_range("No queued I/O request");
+
+        auto request = selected_queue->front();
+        selected_queue->pop_front();
+        num_requests_--;
+        served_bytes_[request->client] += request->size;
+        return request;
+    }
+
+    /**
+     * @brief Retrieve the number of bytes of the requests of a client that have been dispatched
+     * @param client: the PID of an actor
+     * @return A number of bytes
+     */
+    sg_size_t FairShareIOScheduler::get_served_bytes(aid_t client) const {
+        auto it = served_bytes_.find(client);
+        return (it == served_bytes_.end()) ? 0 : it->second;
+    }
+
+    std::shared_ptr<IORequest> ShortestJobFirstIOScheduler::pop() {
+        if (queue_.empty())
+            throw std::out_of_range("No queued I/O request");
+        auto request = queue_.begin()->second;
+        queue_.erase(queue_.begin());
+        return request;
+    }
+
+} // namespace simgrid::fsmod
@@ -4,9 +4,15 @@
  * under the terms of the license (GNU LGPL) which comes with this package. */
 
 #include "fsmod/JBODStorage.hpp"
+#include <simgrid/Exception.hpp>
+#include <simgrid/s4u/ActivitySet.hpp>
 #include <simgrid/s4u/Comm.hpp>
+#include <simgrid/s4u/Engine.hpp>
 #include <simgrid/s4u/Exec.hpp>
+#include <algorithm>
+#include <numeric>
 #include <sstream>
+#include <utility>
 
 XBT_LOG_NEW_DEFAULT_CATEGORY(fsmod_jbod, "File System module: JBOD Storage related logs");
 
@@ -17,18 +23,44 @@ namespace simgrid::fsmod {
      * @param name: the storage's name
      * @param disks: the storage's disks
      * @param raid_level: the RAID level
+     * @param stripe_unit_size: the number of contiguous bytes stored on a disk before moving to the next disk of a
+     *        stripe (0 means that each request is spread evenly over the disks as a single stripe)
      * @return a JBOD instance
      */
-    std::shared_ptr<JBODStorage> JBODStorage::create(const std::string& name, const std::vector<s4u::Disk*>& disks, RAID raid_level) {
+    std::shared_ptr<JBODStorage> JBODStorage::create(const std::string& name, const std::vector<s4u::Disk*>& disks,
+                                                     RAID raid_level, sg_size_t stripe_unit_size) {
         auto storage = std::make_shared<JBODStorage>(name, disks);
         // Set the RAID level
         storage->set_raid_level(raid_level);
+        storage->set_stripe_unit_size(stripe_unit_size);
+        return storage;
+    }
+
+    /**
+     * @brief Create an instance of a JBOD (Just a Bunch of Disks) storage that uses k+m Reed-Solomon erasure coding
+     * @param name: the storage's name
+     * @param disks: the storage's disks (there must be exactly num_data_fragments + num_parity_fragments of them)
+     * @param num_data_fragments: the number of data fragments per stripe (k)
+     * @param num_parity_fragments: the number of parity fragments per stripe (m)
+     * @param stripe_unit_size: the size of a fragment in bytes (0 means that each request is spread evenly over the
+     *        disks as a single stripe)
+     * @return a JBOD instance
+     */
+    std::shared_ptr<JBODStorage> JBODStorage::create_erasure_coded(const std::string& name,
+                                                                   const std::vector<s4u::Disk*>& disks,
+                                                                   unsigned long num_data_fragments,
+                                                                   unsigned long num_parity_fragments,
+                                                                   sg_size_t stripe_unit_size) {
+        auto storage = std::make_shared<JBODStorage>(name, disks);
+        storage->set_erasure_coding(num_data_fragments, num_parity_fragments);
+        storage->set_stripe_unit_size(stripe_unit_size);
         return storage;
     }
 
     JBODStorage::JBODStorage(const std::string& name, const std::vector<s4u::Disk*>& disks)
         : Storage(name),
-          num_disks_(disks.size()) {
+          num_disks_(disks.size()),
+          outstanding_bytes_(disks.size(), 0) {
         set_disks(disks);
         parity_disk_idx_ = num_disks_ - 1;
     }
@@ -52,55 +84,689 @@ namespace simgrid::fsmod {
         if (raid_level == RAID::RAID6 && get_num_disks() < 4) {
             throw std::invalid_argument("RAID" + std::to_string((int)raid_level) +"  requires at least 4 disks");
         }
+        if (raid_level == RAID::RAID10 && (get_num_disks() < 4 || get_num_disks() % 2 != 0)) {
+            throw std::invalid_argument("RAID" + std::to_string((int)raid_level) +"  requires an even number of disks, "
+                                        "and at least 4 disks");
+        }
+        if (raid_level == RAID::ERASURE_CODING && num_parity_fragments_ == 0) {
+            throw std::invalid_argument("Erasure coding requires a number of data and parity fragments, "
+                                        "use set_erasure_coding()");
+        }
         raid_level_ = raid_level;
     }
 
-    s4u::IoPtr JBODStorage::read_async(sg_size_t size) {
-        // Determine what to read from each disk
-        sg_size_t read_size;
-        std::vector<s4u::Disk*> targets;
-        std::stringstream debug_msg;
+    /**
+     * @brief Use k+m Reed-Solomon erasure coding: each stripe consists of k data fragments and m parity
+     *        fragments, whose locations rotate from one stripe to the next. Reads are served from the k data
+     *        fragments and the cost of encoding the parity scales with m.
+     * @param num_data_fragments: the number of data fragments per stripe (k)
+     * @param num_parity_fragments: the number of parity fragments per stripe (m)
+     */
+    void JBODStorage::set_erasure_coding(unsigned long num_data_fragments, unsigned long num_parity_fragments) {
+        if (num_data_fragments == 0 || num_parity_fragments == 0) {
+            throw std::invalid_argument("Erasure coding requires at least one data and one parity fragment");
+        }
+        if (num_data_fragments + num_parity_fragments != get_num_disks()) {
+            throw std::invalid_argument("Erasure coding " + std::to_string(num_data_fragments) + "+" +
+                                        std::to_string(num_parity_fragments) + " requires " +
+                                        std::to_string(num_data_fragments + num_parity_fragments) + " disks");
+        }
+        num_parity_fragments_ = num_parity_fragments;
+        raid_level_ = RAID::ERASURE_CODING;
+    }
+
+    /**
+     * @brief Retrieve the storage's stripe unit size
+     * @return A number of bytes (0 if requests are not split into fixed-size stripe units)
+     */
+    sg_size_t JBODStorage::get_stripe_unit_size() const {
+        return stripe_unit_size_;
+    }
+
+    /**
+     * @brief Set the storage's stripe unit size, i.e., the number of contiguous bytes stored on a disk before
+     *        moving to the next disk of a stripe. With a non-zero stripe unit, request offsets are mapped onto
+     *        stripes, parity rotates from one stripe to the next (RAID5 and RAID6), and writes that cover only
+     *        part of a stripe are performed as read-modify-write operations.
+     * @param stripe_unit_size: a number of bytes (0 means that each request is spread evenly over the disks as a
+     *        single stripe)
+     */
+    void JBODStorage::set_stripe_unit_size(sg_size_t stripe_unit_size) {
+        stripe_unit_size_ = stripe_unit_size;
+    }
+
+    /**
+     * @brief Retrieve the number of disks that hold data in each stripe (i.e., the number of data fragments). Mirror
+     *        copies are not counted, so that this number is 1 for RAID1 and half the number of disks for RAID10
+     * @return A number of disks
+     */
+    unsigned long JBODStorage::get_num_data_disks() const {
+        switch (raid_level_) {
+            case RAID::RAID1:
+                return 1;
+            case RAID::RAID10:
+                return num_disks_ / 2;
+            default:
+                return num_disks_ - get_num_parity_disks();
+        }
+    }
+
+    /**
+     * @brief Retrieve the number of disks that hold parity in each stripe (i.e., the number of parity fragments)
+     * @return A number of disks
+     */
+    unsigned long JBODStorage::get_num_parity_disks() const {
+        switch (raid_level_) {
+            case RAID::RAID4:
+            case RAID::RAID5:
+                return 1;
+            case RAID::RAID6:
+                return 2;
+            case RAID::ERASURE_CODING:
+                return num_parity_fragments_;
+            default:
+                return 0;
+        }
+    }
+
+    /**
+     * @brief Issue RAID1 reads to a second mirror when the first one has not completed them after some time, and
+     *        keep whichever copy arrives first. This bounds the latency of reads that hit a slow or overloaded disk,
+     *        at the cost of extra disk traffic
+     * @param threshold: a delay in seconds (0 disables hedged reads)
+     */
+    void JBODStorage::set_hedged_read_threshold(double threshold) {
+        if (threshold < 0)
+            throw std::invalid_argument("The hedged read threshold of a JBOD cannot be negative");
+        hedged_read_threshold_ = threshold;
+    }
+
+    /**
+     * @brief Retrieve the number of bytes that the storage has asked a disk to read or write and that have not
+     *        been processed yet
+     * @param disk_idx: a disk index
+     * @return A number of bytes
+     */
+    sg_size_t JBODStorage::get_outstanding_bytes(unsigned long disk_idx) const {
+        return outstanding_bytes_.at(disk_idx);
+    }
+
+    /**
+     * @brief Choose the mirror from which to read according to the mirror read policy
+     * @param mirrors: the indices of the disks that hold the data
+     * @param size: the number of bytes to read
+     * @return A disk index, or the number of disks if all the mirrors have failed
+     */
+    unsigned long JBODStorage::select_mirror(const std::vector<unsigned long>& mirrors, sg_size_t size) {
+        auto is_candidate = [this, &mirrors](unsigned long disk_idx) {
+            return not is_failed(disk_idx) && std::find(mirrors.begin(), mirrors.end(), disk_idx) != mirrors.end();
+        };
+
+        if (mirror_read_policy_ == MirrorReadPolicy::ROUND_ROBIN) {
+            for (unsigned long i = 0; i < num_disks_; i++) {
+                auto disk_idx = static_cast<unsigned long>(get_next_read_disk_idx());
+                if (is_candidate(disk_idx))
+                    return disk_idx;
+            }
+            return num_disks_;
+        }
+
+        unsigned long selected_disk_idx = num_disks_;
+        double best_cost = 0;
+        for (auto disk_idx : mirrors) {
+            if (not is_candidate(disk_idx))
+                continue;
+            auto cost = static_cast<double>(outstanding_bytes_[disk_idx]);
+            if (mirror_read_policy_ == MirrorReadPolicy::EARLIEST_COMPLETION)
+                cost = (cost + static_cast<double>(size)) / get_disk_at(disk_idx)->get_read_bandwidth();
+            if (selected_disk_idx == num_disks_ || cost < best_cost) {
+                selected_disk_idx = disk_idx;
+                best_cost = cost;
+            }
+        }
+        return selected_disk_idx;
+    }
+
+    s4u::IoPtr JBODStorage::create_io(unsigned long disk_idx, sg_size_t size, s4u::Io::OpType op_type) {
+        const auto* disk = get_disk_at(disk_idx);
+        auto io = s4u::IoPtr(disk->io_init(size, op_type));
+        io->set_name(disk->get_name());
+        // Keep track of the load of each disk for the mirror read policies
+        outstanding_bytes_[disk_idx] += size;
+        outstanding_ios_[io.get()] = {disk_idx, size};
+        io->on_this_completion_cb([this](s4u::Io const& io) { release_io(&io); });
+        return io;
+    }
+
+    void JBODStorage::release_io(const s4u::Activity* io) {
+        auto it = outstanding_ios_.find(io);
+        if (it == outstanding_ios_.end())
+            return;
+        outstanding_bytes_[it->second.first] -= it->second.second;
+        outstanding_ios_.erase(it);
+    }
+
+    void JBODStorage::cancel_io(const s4u::IoPtr& io) {
+        io->cancel();
+        // A canceled I/O no longer loads its disk, whether or not its completion callbacks are invoked
+        release_io(io.get());
+    }
+
+    /**
+     * @brief Retrieve the number of disks of the storage that have failed (i.e., that are turned off)
+     * @return A number of disks
+     */
+    unsigned long JBODStorage::get_num_failed_disks() const {
+        unsigned long num_failed_disks = 0;
+        for (unsigned long i = 0; i < num_disks_; i++)
+            if (is_failed(i))
+                num_failed_disks++;
+        return num_failed_disks;
+    }
+
+    /**
+     * @brief Retrieve the number of disk failures the storage tolerates, regardless of which disks fail. Beyond
+     *        that number, accessing data stored on the failed disks throws a StorageFailureException
+     * @return A number of disks
+     */
+    unsigned long JBODStorage::get_max_num_failed_disks() const {
+        switch (raid_level_) {
+            case RAID::RAID1:
+                return num_disks_ - 1;
+            case RAID::RAID10:
+                // Losing both disks of a pair loses data
+                return 1;
+            default:
+                return get_num_parity_disks();
+        }
+    }
+
+    /**
+     * @brief Add a spare disk to the storage. When a disk of the storage fails and a spare disk is available, a
+     *        background actor rebuilds the content of the failed disk on the spare, which then replaces it
+     * @param disk: a disk that is not used by the storage
+     */
+    void JBODStorage::add_spare_disk(s4u::Disk* disk) {
+        spare_disks_.push_back(disk);
+        if (not watching_disks_) {
+            for (auto* storage_disk : get_disks())
+                watch_disk(storage_disk);
+            watching_disks_ = true;
+        }
+    }
+
+    /**
+     * @brief Set the rate at which a failed disk is rebuilt on a spare disk. Rebuild traffic competes with
+     *        foreground I/O on the surviving disks, so a lower rate trades a longer degraded period for less
+     *        interference
+     * @param rate: a number of bytes per second (0 means as fast as the disks allow)
+     */
+    void JBODStorage::set_rebuild_rate(double rate) {
+        if (rate < 0)
+            throw std::invalid_argument("The rebuild rate of a JBOD cannot be negative");
+        rebuild_rate_ = rate;
+    }
+
+    /**
+     * @brief Retrieve the number of bytes rebuilt per failed disk. Unless set with set_rebuild_size(), this is the
+     *        number of bytes each disk stores, i.e., the space used by the partitions of the storage divided by
+     *        the number of data disks
+     * @return A number of bytes
+     */
+    sg_size_t JBODStorage::get_rebuild_size() const {
+        if (rebuild_size_ > 0)
+            return rebuild_size_;
+        auto num_data_disks = get_num_data_disks();
+        return (get_used_space() + num_data_disks - 1) / num_data_disks;
+    }
+
+    void JBODStorage::watch_disk(s4u::Disk* disk) {
+        // Do not keep the storage alive because one of its disks still exists
+        std::weak_ptr<JBODStorage> weak_storage = weak_from_this();
+        disk->on_this_onoff_cb([weak_storage](s4u::Disk const& failed_disk) {
+            auto storage = weak_storage.lock();
+            if (not storage || failed_disk.is_on() || storage->spare_disks_.empty() ||
+                storage->get_max_num_failed_disks() == 0)
+                return;
+            // The disk may have already been replaced by a spare
+            auto disks = storage->get_disks();
+            if (std::find(disks.begin(), disks.end(), &failed_disk) != disks.end())
+                storage->start_rebuild(&failed_disk);
+        });
+    }
+
+    /**
+     * @brief Start rebuilding a failed disk of the storage on the next spare disk. This happens automatically when
+     *        a disk of a storage that has spare disks fails, but can also be requested explicitly
+     * @param failed_disk: a disk of the storage
+     * @return The actor that rebuilds the disk, or nullptr if the disk is already being rebuilt
+     */
+    s4u::ActorPtr JBODStorage::start_rebuild(const s4u::Disk* failed_disk) {
+        auto disks = get_disks();
+        auto it = std::find(disks.begin(), disks.end(), failed_disk);
+        if (it == disks.end())
+            throw std::invalid_argument("Disk " + failed_disk->get_name() + " is not a disk of " + get_name());
+        if (get_max_num_failed_disks() == 0)
+            throw std::invalid_argument("Disks of a RAID0 JBOD cannot be rebuilt");
+        if (spare_disks_.empty())
+            throw std::invalid_argument("No spare disk available to rebuild " + failed_disk->get_name());
+
+        auto disk_idx = static_cast<unsigned long>(it - disks.begin());
+        if (disks_being_rebuilt_.find(disk_idx) != disks_being_rebuilt_.end())
+            return nullptr;
+        disks_being_rebuilt_.insert(disk_idx);
+        auto* spare_disk = spare_disks_.front();
+        spare_disks_.erase(spare_disks_.begin());
+
+        auto host = get_controller_host();
+        if (host == nullptr)
+            host = get_first_disk()->get_host();
+        auto storage = shared_from_this();
+        return host->add_actor(get_name() + "_rebuild_" + failed_disk->get_name(),
+                               [storage, disk_idx, spare_disk]() { storage->rebuild(disk_idx, spare_disk); });
+    }
+
+    void JBODStorage::rebuild(unsigned long disk_idx, s4u::Disk* spare_disk) {
+        XBT_DEBUG("Rebuilding %s on %s", get_disk_at(disk_idx)->get_cname(), spare_disk->get_cname());
+        double start_date = s4u::Engine::get_clock();
+        // Without rate limit, rebuild everything at once. Otherwise, rebuild one second worth of data at a time
+        auto rebuild_size = get_rebuild_size();
+        sg_size_t io_size = rebuild_size;
+        if (rebuild_rate_ > 0)
+            io_size = std::max<sg_size_t>(1, static_cast<sg_size_t>(rebuild_rate_));
+
+        sg_size_t num_rebuilt_bytes = 0;
+        try {
+            while (num_rebuilt_bytes < rebuild_size) {
+                auto num_bytes = std::min(io_size, rebuild_size - num_rebuilt_bytes);
+                // Read the same amount from enough surviving disks to recover the content of the failed one: a
+                // mirror, or as many disks as there are data units in a stripe
+                bool mirrored = (raid_level_ == RAID::RAID1 || raid_level_ == RAID::RAID10);
+                unsigned long num_sources = mirrored ? 1 : get_num_data_disks();
+                std::vector<unsigned long> sources;
+                for (unsigned long i = 0; i < num_disks_ && sources.size() < num_sources; i++) {
+                    // With RAID10, only the other disk of the pair holds the same data
+                    if (i == disk_idx || is_failed(i) || (raid_level_ == RAID::RAID10 && i != (disk_idx ^ 1)))
+                        continue;
+                    sources.push_back(i);
+                }
+                if (sources.size() < num_sources)
+                    throw StorageFailureException(XBT_THROW_POINT, "Not enough surviving disks");
+
+                s4u::ActivitySet reads;
+                for (auto source_idx : sources)
+                    reads.push(get_disk_at(source_idx)->read_async(num_bytes));
+                reads.wait_all();
+                if (get_num_parity_disks() > 0)
+                    s4u::this_actor::execute(static_cast<double>(num_bytes));
+                spare_disk->write(num_bytes);
+
+                num_rebuilt_bytes += num_bytes;
+                if (rebuild_rate_ > 0 && num_rebuilt_bytes < rebuild_size)
+                    s4u::this_actor::sleep_until(start_date + static_cast<double>(num_rebuilt_bytes) / rebuild_rate_);
+            }
+        } catch (const simgrid::Exception& e) {
+            XBT_WARN("Cannot rebuild %s on %s: %s", get_disk_at(disk_idx)->get_cname(), spare_disk->get_cname(),
+                     e.what());
+            if (spare_disk->is_on())
+                spare_disks_.push_back(spare_disk);
+            disks_being_rebuilt_.erase(disk_idx);
+            return;
+        }
+
+        // The spare disk now replaces the failed one
+        XBT_DEBUG("%s has been rebuilt on %s", get_disk_at(disk_idx)->get_cname(), spare_disk->get_cname());
+        auto disks = get_disks();
+        disks[disk_idx] = spare_disk;
+        set_disks(disks);
+        disks_being_rebuilt_.erase(disk_idx);
+        watch_disk(spare_disk);
+    }
+
+    bool JBODStorage::has_rotating_parity() const {
+        return raid_level_ == RAID::RAID5 || raid_level_ == RAID::RAID6 || raid_level_ == RAID::ERASURE_CODING;
+    }
+
+    /**
+     * @brief Retrieve the index of the (first) parity disk of a stripe
+     * @param stripe: a stripe index
+     * @return A disk index
+     */
+    unsigned long JBODStorage::get_parity_disk_idx(sg_size_t stripe) const {
+        switch (raid_level_) {
+            case RAID::RAID4:
+                return num_disks_ - 1;
+            case RAID::RAID5:
+            case RAID::RAID6:
+            case RAID::ERASURE_CODING:
+                // Without stripe units, parity rotates once per write request
+                if (stripe_unit_size_ == 0)
+                    return parity_disk_idx_;
+                // Left-symmetric layout: parity moves one disk to the left at each stripe
+                return num_disks_ - 1 - (stripe % num_disks_);
+            default:
+                return 0;
+        }
+    }
+
+    /**
+     * @brief Retrieve the index of the disk that stores a given data chunk of a stripe
+     * @param parity_disk_idx: the index of the (first) parity disk of the stripe
+     * @param chunk: the index of the data chunk in the stripe
+     * @return A disk index
+     */
+    unsigned long JBODStorage::get_data_disk_idx(unsigned long parity_disk_idx, unsigned long chunk) const {
+        if (has_rotating_parity())
+            return (parity_disk_idx + get_num_parity_disks() + chunk) % num_disks_;
+        // RAID10 stores each chunk on a pair of adjacent disks
+        if (raid_level_ == RAID::RAID10)
+            return 2 * chunk;
+        return chunk;
+    }
 
-        // Get Parity disk index;
-        unsigned long parity_disk_idx = get_parity_disk_idx();
+    /**
+     * @brief Add the disk accesses needed to read or write the bytes in [begin, end) of a stripe to a plan. Failed
+     *        disks are skipped: the data they hold is reconstructed from the surviving units of the stripe on reads,
+     *        and only lives in the parity of the stripe after a write.
+     * @param plan: the plan to update
+     * @param stripe: the stripe index
+     * @param unit: the stripe unit size
+     * @param begin: the first byte to access, relative to the start of the stripe
+     * @param end: the byte after the last byte to access, relative to the start of the stripe
+     * @param for_write: whether the access is a write
+     * @param force_full_stripe: whether to consider the stripe as fully written (i.e., no read-modify-write)
+     */
+    void JBODStorage::add_stripe(DiskAccessPlan& plan, sg_size_t stripe, sg_size_t unit, sg_size_t begin,
+                                 sg_size_t end, bool for_write, bool force_full_stripe) const {
+        auto parity_disk_idx = get_parity_disk_idx(stripe);
+        auto num_data_disks = get_num_data_disks();
+        auto num_parity_disks = get_num_parity_disks();
+        // Without parity, partial-stripe writes do not need to read anything
+        bool full_stripe = force_full_stripe || num_parity_disks == 0 || (begin == 0 && end == unit * num_data_disks);
+        // Only the parity bytes that cover the accessed data are involved, unless the whole stripe is
+        sg_size_t region = full_stripe ? unit : std::min(unit, end - begin);
+
+        if (raid_level_ == RAID::RAID10) {
+            // Each chunk remains available as long as one disk of its mirrored pair is
+            for (sg_size_t chunk = begin / unit; chunk <= (end - 1) / unit; chunk++) {
+                sg_size_t num_bytes = std::min(end, (chunk + 1) * unit) - std::max(begin, chunk * unit);
+                auto disk_idx = get_data_disk_idx(parity_disk_idx, chunk);
+                if (is_failed(disk_idx) && is_failed(disk_idx + 1))
+                    throw StorageFailureException(XBT_THROW_POINT, "Both disks of a mirrored pair of " + get_name() +
+                                                                   " have failed");
+                if (not for_write) {
+                    plan.read_bytes[disk_idx] += num_bytes;
+                    continue;
+                }
+                for (auto mirror_idx : {disk_idx, disk_idx + 1})
+                    if (not is_failed(mirror_idx))
+                        plan.write_bytes[mirror_idx] += num_bytes;
+            }
+            return;
+        }
+
+        unsigned long num_failed_disks = 0;
+        for (unsigned long i = 0; i < num_data_disks + num_parity_disks; i++)
+            if (is_failed((parity_disk_idx + i) % num_disks_))
+                num_failed_disks++;
+        bool degraded = (num_failed_disks > 0);
+
+        std::vector<sg_size_t> chunk_bytes(num_data_disks, 0);
+        sg_size_t lost_bytes = 0;
+        for (sg_size_t chunk = begin / unit; chunk <= (end - 1) / unit; chunk++) {
+            sg_size_t num_bytes = std::min(end, (chunk + 1) * unit) - std::max(begin, chunk * unit);
+            auto disk_idx = get_data_disk_idx(parity_disk_idx, chunk);
+            chunk_bytes[chunk] = num_bytes;
+            if (is_failed(disk_idx)) {
+                lost_bytes += num_bytes;
+                continue;
+            }
+            if (not for_write) {
+                plan.read_bytes[disk_idx] += num_bytes;
+                continue;
+            }
+            plan.write_bytes[disk_idx] += num_bytes;
+            // A partial-stripe write has to read the old data to compute the new parity
+            if (not full_stripe && not degraded)
+                plan.read_bytes[disk_idx] += num_bytes;
+        }
+        if (lost_bytes > 0 && num_failed_disks > num_parity_disks)
+            throw StorageFailureException(XBT_THROW_POINT, "Too many failed disks in " + get_name() + " (" +
+                                                           std::to_string(num_failed_disks) + " in a stripe that " +
+                                                           "tolerates " + std::to_string(num_parity_disks) + ")");
+
+        if (not for_write) {
+            if (lost_bytes == 0)
+                return;
+            // Degraded read: read the same region from as many surviving units (data first, then parity) as
+            // there are data units in the stripe, and decode the missing data (1 flop per lost byte)
+            unsigned long num_sources = 0;
+            for (unsigned long i = 0; i < num_data_disks + num_parity_disks; i++) {
+                if (num_sources == num_data_disks)
+                    break;
+                auto disk_idx = i < num_data_disks ? get_data_disk_idx(parity_disk_idx, i)
+                                                   : (parity_disk_idx + i - num_data_disks) % num_disks_;
+                if (is_failed(disk_idx))
+                    continue;
+                sg_size_t already_read = i < num_data_disks ? chunk_bytes[i] : 0;
+                plan.read_bytes[disk_idx] += std::max(region, already_read) - already_read;
+                num_sources++;
+            }
+            plan.parity_flops += static_cast<double>(lost_bytes);
+            return;
+        }
 
+        unsigned long num_surviving_parity_disks = 0;
+        for (unsigned long i = 0; i < num_parity_disks; i++) {
+            auto disk_idx = (parity_disk_idx + i) % num_disks_;
+            if (is_failed(disk_idx))
+                continue;
+            num_surviving_parity_disks++;
+            plan.write_bytes[disk_idx] += region;
+            if (not full_stripe && not degraded)
+                plan.read_bytes[disk_idx] += region;
+            // Assume 1 flop per byte to write per parity block, so that the encoding cost scales with the number
+            // of parity blocks
+            plan.parity_flops += static_cast<double>(region);
+        }
+
+        // The old data and parity of the failed disks cannot be read back, so a degraded partial-stripe write
+        // recomputes the parity from the rest of the region on the surviving data disks (reconstruct-write)
+        if (not full_stripe && degraded && num_surviving_parity_disks > 0) {
+            for (unsigned long chunk = 0; chunk < num_data_disks; chunk++) {
+                auto disk_idx = get_data_disk_idx(parity_disk_idx, chunk);
+                if (not is_failed(disk_idx) && chunk_bytes[chunk] < region)
+                    plan.read_bytes[disk_idx] += region - chunk_bytes[chunk];
+            }
+        }
+    }
+
+    /**
+     * @brief Add the disk accesses needed to read or write a sequence of full stripes to a plan
+     * @param plan: the plan to update
+     * @param first_stripe: the index of the first stripe
+     * @param num_stripes: the number of stripes
+     * @param for_write: whether the access is a write
+     */
+    void JBODStorage::add_full_stripes(DiskAccessPlan& plan, sg_size_t first_stripe, sg_size_t num_stripes,
+                                       bool for_write) const {
+        auto unit = stripe_unit_size_;
+        auto stripe_size = unit * get_num_data_disks();
+
+        // The layout repeats itself every num_disks_ stripes with rotating parity, and at every stripe otherwise.
+        // Account for one such cycle and scale it, so that only the remaining stripes need to be walked
+        sg_size_t cycle_length = has_rotating_parity() ? num_disks_ : 1;
+        sg_size_t num_cycles = num_stripes / cycle_length;
+        if (num_cycles > 0) {
+            DiskAccessPlan one_cycle{std::vector<sg_size_t>(num_disks_, 0), std::vector<sg_size_t>(num_disks_, 0)};
+            for (sg_size_t stripe = first_stripe; stripe < first_stripe + cycle_length; stripe++)
+                add_stripe(one_cycle, stripe, unit, 0, stripe_size, for_write);
+            for (unsigned long i = 0; i < num_disks_; i++) {
+                plan.read_bytes[i] += num_cycles * one_cycle.read_bytes[i];
+                plan.write_bytes[i] += num_cycles * one_cycle.write_bytes[i];
+            }
+            plan.parity_flops += static_cast<double>(num_cycles) * one_cycle.parity_flops;
+        }
+
+        for (sg_size_t stripe = first_stripe + num_cycles * cycle_length; stripe < first_stripe + num_stripes; stripe++)
+            add_stripe(plan, stripe, unit, 0, stripe_size, for_write);
+    }
+
+    /**
+     * @brief Compute the disk accesses needed to read or write a range of bytes on a striped layout
+     * @param offset: the offset of the first byte
+     * @param size: the number of bytes
+     * @param for_write: whether the access is a write
+     * @return A plan
+     */
+    JBODStorage::DiskAccessPlan JBODStorage::plan_striped_access(sg_offset_t offset, sg_size_t size,
+                                                                 bool for_write) const {
+        DiskAccessPlan plan{std::vector<sg_size_t>(num_disks_, 0), std::vector<sg_size_t>(num_disks_, 0)};
+        if (size == 0)
+            return plan;
+
+        if (stripe_unit_size_ == 0) {
+            // The whole request is one full stripe, spread evenly (remainder included) over the data disks
+            auto unit = (size + get_num_data_disks() - 1) / get_num_data_disks();
+            add_stripe(plan, 0, unit, 0, size, for_write, true);
+            return plan;
+        }
+
+        auto stripe_size = stripe_unit_size_ * get_num_data_disks();
+        auto begin = static_cast<sg_size_t>(offset);
+        auto end = begin + size;
+        sg_size_t first_stripe = begin / stripe_size;
+        sg_size_t last_stripe = (end - 1) / stripe_size;
+
+        // Leading partial stripe (which may also be the only stripe)
+        sg_size_t stripe = first_stripe;
+        if (begin % stripe_size != 0 || end < (first_stripe + 1) * stripe_size) {
+            add_stripe(plan, first_stripe, stripe_unit_size_, begin - first_stripe * stripe_size,
+                       std::min(end, (first_stripe + 1) * stripe_size) - first_stripe * stripe_size, for_write);
+            stripe++;
+        }
+        if (stripe > last_stripe)
+            return plan;
+
+        // Full stripes, then trailing partial stripe (if any)
+        bool trailing_partial_stripe = (end % stripe_size != 0);
+        add_full_stripes(plan, stripe, (trailing_partial_stripe ? last_stripe : last_stripe + 1) - stripe, for_write);
+        if (trailing_partial_stripe)
+            add_stripe(plan, last_stripe, stripe_unit_size_, 0, end - last_stripe * stripe_size, for_write);
+
+        return plan;
+    }
+
+    /**
+     * @brief Compute the number of bytes to read on each disk to serve a read request
+     * @param offset: the offset of the first byte to read
+     * @param size: the number of bytes to read
+     * @return A plan
+     */
+    JBODStorage::DiskAccessPlan JBODStorage::plan_read(sg_offset_t offset, sg_size_t size) {
         switch(raid_level_) {
             case RAID::RAID0:
-                read_size = size / num_disks_;
-                targets = get_disks();
-                break;
-            case RAID::RAID1:
-                read_size = size;
-                targets.push_back(get_disk_at(get_next_read_disk_idx()));
-                break;
             case RAID::RAID4:
-                read_size = size / (num_disks_ - 1);
-                targets = get_disks();
-                targets.pop_back();
-                break;
             case RAID::RAID5:
-                read_size = size / (num_disks_ - 1);
-                targets = get_disks();
-                targets.erase(targets.begin() + ((parity_disk_idx + 1) % num_disks_));
-                break;
             case RAID::RAID6:
-                read_size = size / (num_disks_ - 2);
-                targets = get_disks();
-                if (parity_disk_idx + 1 == static_cast<int>(num_disks_)) { // First and last disks in the JBOD
-                    targets.pop_back();
-                    targets.erase(targets.begin());
-                } else {
-                    targets.erase(targets.begin() + parity_disk_idx,
-                                  targets.begin() + parity_disk_idx + 2);
+            case RAID::ERASURE_CODING:
+                return plan_striped_access(offset, size, false);
+            case RAID::RAID1: {
+                // Read from one of the surviving mirrors
+                DiskAccessPlan plan{std::vector<sg_size_t>(num_disks_, 0), std::vector<sg_size_t>(num_disks_, 0)};
+                std::vector<unsigned long> mirrors(num_disks_);
+                std::iota(mirrors.begin(), mirrors.end(), 0);
+                auto disk_idx = select_mirror(mirrors, size);
+                if (disk_idx == num_disks_)
+                    throw StorageFailureException(XBT_THROW_POINT, "All disks of " + get_name() + " have failed");
+                plan.read_bytes[disk_idx] = size;
+                return plan;
+            }
+            case RAID::RAID10: {
+                auto plan = plan_striped_access(offset, size, false);
+                if (mirror_read_policy_ != MirrorReadPolicy::ROUND_ROBIN) {
+                    // Choose a disk for each mirrored pair independently
+                    for (unsigned long i = 0; i < num_disks_; i += 2) {
+                        if (plan.read_bytes[i] == 0)
+                            continue;
+                        auto disk_idx = select_mirror({i, i + 1}, plan.read_bytes[i]);
+                        std::swap(plan.read_bytes[i], plan.read_bytes[disk_idx]);
+                    }
+                    return plan;
+                }
+                // Read all chunks from either the first or the second disk of each mirrored pair
+                if (get_next_read_disk_idx() % 2 == 1) {
+                    for (unsigned long i = 0; i < num_disks_; i += 2)
+                        std::swap(plan.read_bytes[i], plan.read_bytes[i + 1]);
                 }
-                debug_msg << "Parity disks are #" << parity_disk_idx << " and #";
-                debug_msg << (parity_disk_idx + 1) % num_disks_ << ". Reading From: ";
-                for (auto t: targets)
-                    debug_msg << t->get_name() << " ";
-                XBT_DEBUG("%s", debug_msg.str().c_str());
-                break;
+                // Fall back to the other disk of the pair if the chosen one has failed
+                for (unsigned long i = 0; i < num_disks_; i++) {
+                    if (plan.read_bytes[i] > 0 && is_failed(i)) {
+                        plan.read_bytes[i ^ 1] += plan.read_bytes[i];
+                        plan.read_bytes[i] = 0;
+                    }
+                }
+                return plan;
+            }
+            default:
+                throw std::invalid_argument("Unsupported RAID level. Supported level are: 0, 1, 4, 5, 6, 10, and "
+                                            "erasure coding");
+        }
+    }
+
+    /**
+     * @brief Compute the number of bytes to read and write on each disk to serve a write request
+     * @param offset: the offset of the first byte to write
+     * @param size: the number of bytes to write
+     * @return A plan
+     */
+    JBODStorage::DiskAccessPlan JBODStorage::plan_write(sg_offset_t offset, sg_size_t size) {
+        switch(raid_level_) {
+            case RAID::RAID0:
+            case RAID::RAID4:
+            case RAID::RAID10:
+                return plan_striped_access(offset, size, true);
+            case RAID::RAID5:
+            case RAID::RAID6:
+            case RAID::ERASURE_CODING:
+                if (stripe_unit_size_ == 0)
+                    update_parity_disk_idx();
+                return plan_striped_access(offset, size, true);
+            case RAID::RAID1: {
+                // Write to all surviving mirrors
+                DiskAccessPlan plan{std::vector<sg_size_t>(num_disks_, 0), std::vector<sg_size_t>(num_disks_, 0)};
+                for (unsigned long i = 0; i < num_disks_; i++)
+                    if (not is_failed(i))
+                        plan.write_bytes[i] = size;
+                if (get_num_failed_disks() == num_disks_)
+                    throw StorageFailureException(XBT_THROW_POINT, "All disks of " + get_name() + " have failed");
+                return plan;
+            }
             default:
-                throw std::invalid_argument("Unsupported RAID level. Supported level are: 0, 1, 4, 5, and 6");
+                throw std::invalid_argument("Unsupported RAID level. Supported level are: 0, 1, 4, 5, 6, 10, and "
+                                            "erasure coding");
+        }
+    }
+
+    s4u::IoPtr JBODStorage::read_async(const IOContext& context, sg_offset_t offset, sg_size_t size) {
+        // Determine what to read from each disk
+        auto plan = plan_read(offset, size);
+
+        if (raid_level_ == RAID::RAID6 && stripe_unit_size_ == 0) {
+            std::stringstream debug_msg;
+            unsigned long parity_disk_idx = get_parity_disk_idx(0);
+            debug_msg << "Parity disks are #" << parity_disk_idx << " and #";
+            debug_msg << (parity_disk_idx + 1) % num_disks_ << ". Reading From: ";
+            for (unsigned long i = 0; i < num_disks_; i++)
+                if (plan.read_bytes[i] > 0)
+                    debug_msg << get_disk_at(i)->get_name() << " ";
+            XBT_DEBUG("%s", debug_msg.str().c_str());
+        }
+
+        if (raid_level_ == RAID::RAID1 && hedged_read_threshold_ > 0 && size > 0) {
+            auto disk_idx = std::find_if(plan.read_bytes.begin(), plan.read_bytes.end(),
+                                         [](sg_size_t num_bytes) { return num_bytes > 0; }) - plan.read_bytes.begin();
+            return hedged_read_async(disk_idx, size, context.get_client_host());
         }
 
         // Create a Comm to transfer data to the host that requested a read to the controller host of the JBOD
@@ -112,16 +778,31 @@ namespace simgrid::fsmod {
         auto comm = s4u::Comm::sendto_init()->set_source(source_host)->set_payload_size(size);
         comm->set_name("Transfer from JBod");
 
+        // In degraded mode, the data of the failed disks has to be reconstructed on the controller before the
+        // transfer can start
+        s4u::ExecPtr reconstruction = nullptr;
+        if (plan.parity_flops > 0) {
+            reconstruction = s4u::Exec::init()->set_flops_amount(plan.parity_flops);
+            reconstruction->set_name("Data Reconstruction");
+            reconstruction->add_successor(comm);
+        }
+
         // Create the I/O activities on individual disks
-        std::vector<s4u::IoPtr> ios;
-        for (const auto* disk : targets) {
-            auto io = s4u::IoPtr(disk->io_init(read_size, s4u::Io::OpType::READ));
-            io->set_name(disk->get_name());
-            ios.push_back(io);
+        for (unsigned long i = 0; i < num_disks_; i++) {
+            if (plan.read_bytes[i] == 0)
+                continue;
+            auto io = create_io(i, plan.read_bytes[i], s4u::Io::OpType::READ);
             // Have the completion activity depend on every I/O
-            io->add_successor(comm);
+            if (reconstruction)
+                io->add_successor(reconstruction);
+            else
+                io->add_successor(comm);
             io->detach();
         }
+        if (reconstruction) {
+            reconstruction->detach();
+            reconstruction->set_host(source_host);
+        }
 
         // Create a no-op Activity that depends on the completion of the Comm. This is the one ActivityPtr returned
         // to the caller
@@ -130,7 +811,7 @@ namespace simgrid::fsmod {
         comm->add_successor(completion_activity);
 
         // Start the comm by setting its destination
-        comm->set_destination(s4u::Host::current());
+        comm->set_destination(context.get_client_host());
 
         // Completion activity is now blocked by the Comm, start it by assigning it to the controller host first disk
         completion_activity->set_disk(get_first_disk());
@@ -138,54 +819,105 @@ namespace simgrid::fsmod {
         return completion_activity;
     }
 
-    void JBODStorage::read(sg_size_t size) {
-        read_async(size)->wait();
+    s4u::IoPtr JBODStorage::hedged_read_async(unsigned long disk_idx, sg_size_t size, s4u::Host* destination_host) {
+        auto source_host = get_controller_host();
+        if (source_host == nullptr)
+            source_host = this->get_first_disk()->get_host();
+
+        // The decision to hedge is taken over time, which requires an actor. It starts the transfer once one of
+        // the copies has been read
+        auto storage = shared_from_this();
+        return start_in_background(source_host, s4u::Io::OpType::READ, get_name() + "_hedged_read",
+                                   [storage, disk_idx, size, source_host, destination_host]() {
+            storage->hedged_read(disk_idx, size);
+            auto comm = s4u::Comm::sendto_init()->set_source(source_host)->set_payload_size(size);
+            comm->set_name("Transfer from JBod");
+            comm->set_destination(destination_host);
+            comm->wait();
+        });
     }
 
-    s4u::IoPtr JBODStorage::write_async(sg_size_t size, bool detached) {
-        // Transfer data from the host that requested a write to the controller host of the JBOD
-        auto comm = s4u::Comm::sendto_init()->set_payload_size(size)->set_source(s4u::Host::current());
-        comm->set_name("Transfer to JBod");
+    void JBODStorage::hedged_read(unsigned long disk_idx, sg_size_t size) {
+        auto primary_io = create_io(disk_idx, size, s4u::Io::OpType::READ);
+        primary_io->start();
+        try {
+            primary_io->wait_for(hedged_read_threshold_);
+            return;
+        } catch (const TimeoutException&) {
+            XBT_DEBUG("Read on %s is too slow", get_disk_at(disk_idx)->get_cname());
+        } catch (const simgrid::Exception& e) {
+            // The copy is read from another mirror right away
+            XBT_DEBUG("Read on %s failed: %s", get_disk_at(disk_idx)->get_cname(), e.what());
+            primary_io = nullptr;
+        }
 
-        // Determine what to write on each individual disk according to RAID level and which disk will store the
-        // parity block
-        sg_size_t write_size;
-        double parity_block_comp_cost = 0.0;
+        // Read the same data from another mirror, and keep whichever copy arrives first
+        std::vector<unsigned long> other_mirrors;
+        for (unsigned long i = 0; i < num_disks_; i++)
+            if (i != disk_idx)
+                other_mirrors.push_back(i);
+        auto hedge_disk_idx = select_mirror(other_mirrors, size);
+        if (hedge_disk_idx == num_disks_) {
+            if (not primary_io)
+                throw StorageFailureException(XBT_THROW_POINT, "All disks of " + get_name() + " have failed");
+            primary_io->wait();
+            return;
+        }
+        XBT_DEBUG("Hedging the read on %s", get_disk_at(hedge_disk_idx)->get_cname());
+        num_hedged_reads_++;
+        auto hedge_io = create_io(hedge_disk_idx, size, s4u::Io::OpType::READ);
+        hedge_io->set_name(get_disk_at(hedge_disk_idx)->get_name() + " (hedged read)");
+        hedge_io->start();
+        if (not primary_io) {
+            hedge_io->wait();
+            return;
+        }
 
-        switch(raid_level_) {
-            case RAID::RAID0:
-                write_size = size / num_disks_;
-                break;
-            case RAID::RAID1:
-                write_size = size;
-                break;
-            case RAID::RAID4:
-                write_size = size / (num_disks_ - 1);
-                // Assume 1 flop per byte to write per parity block.
-                parity_block_comp_cost = static_cast<double>(write_size);
-                break;
-            case RAID::RAID5:
-                update_parity_disk_idx();
-                write_size = size / (num_disks_ - 1);
-                // Assume 1 flop per byte to write per parity block.
-                parity_block_comp_cost = static_cast<double>(write_size);
-                break;
-            case RAID::RAID6:
-                update_parity_disk_idx();
-                write_size = size / (num_disks_ - 2);
-                // Assume 2 flops per byte to write per parity block.
-                parity_block_comp_cost = static_cast<double>(2 * write_size);
-                break;
-            default:
-                throw std::invalid_argument("Unsupported RAID level. Supported level are: 0, 1, 4, 5, and 6");
+        s4u::ActivitySet pending_ios;
+        pending_ios.push(primary_io);
+        pending_ios.push(hedge_io);
+        try {
+            auto first_io = pending_ios.wait_any();
+            cancel_io(first_io.get() == primary_io.get() ? hedge_io : primary_io);
+        } catch (const simgrid::Exception& e) {
+            // The read fails only if the other copy cannot be read either
+            auto failed_io = pending_ios.get_failed_activity();
+            XBT_DEBUG("One of the copies of a hedged read failed: %s", e.what());
+            (failed_io.get() == primary_io.get() ? hedge_io : primary_io)->wait();
         }
+    }
+
+    void JBODStorage::read(const IOContext& context, sg_offset_t offset, sg_size_t size) {
+        wait_for_completion(read_async(context, offset, size));
+    }
+
+    s4u::IoPtr JBODStorage::write_async(const IOContext& context, sg_offset_t offset, sg_size_t size, bool detached) {
+        // Determine what to write on each individual disk according to RAID level and which disks store the
+        // parity blocks, and what has to be read first for partial-stripe writes
+        auto plan = plan_write(offset, size);
+
+        // Transfer data from the host that requested a write to the controller host of the JBOD
+        auto comm = s4u::Comm::sendto_init()->set_payload_size(size)->set_source(context.get_client_host());
+        comm->set_name("Transfer to JBod");
 
         // Compute the parity block (if any)
-        s4u::ExecPtr parity_block_comp = s4u::Exec::init()->set_flops_amount(parity_block_comp_cost);
+        s4u::ExecPtr parity_block_comp = s4u::Exec::init()->set_flops_amount(plan.parity_flops);
         parity_block_comp->set_name("Parity Block Computation");
 
         // Do not start computing the parity block before the completion of the comm to the controller
         comm->add_successor(parity_block_comp);
+
+        // Read-modify-write: the old data and parity must also be read before computing the new parity. These reads
+        // do not depend on the transfer and start right away
+        for (unsigned long i = 0; i < num_disks_; i++) {
+            if (plan.read_bytes[i] == 0)
+                continue;
+            auto io = create_io(i, plan.read_bytes[i], s4u::Io::OpType::READ);
+            io->set_name(get_disk_at(i)->get_name() + " (read-modify-write)");
+            io->add_successor(parity_block_comp);
+            io->detach();
+        }
+
         // Start the comm by setting its destination
         auto destination_host = get_controller_host();
         if (destination_host == nullptr)
@@ -202,17 +934,21 @@ namespace simgrid::fsmod {
         completion_activity->set_name("JBOD Write Completion");
 
         // Create the I/O activities on individual disks
-        std::vector<s4u::IoPtr> ios;
-        for (const auto* disk : get_disks()) {
-            auto io = s4u::IoPtr(disk->io_init(write_size, s4u::Io::OpType::WRITE));
-            io->set_name(disk->get_name());
-            ios.push_back(io);
+        bool has_ios = false;
+        for (unsigned long i = 0; i < num_disks_; i++) {
+            if (plan.write_bytes[i] == 0)
+                continue;
+            auto io = create_io(i, plan.write_bytes[i], s4u::Io::OpType::WRITE);
             // Do not start the I/Os before the completion of the computation of the parity block
             parity_block_comp->add_successor(io);
             // Have the completion activity depend on every I/O
             io->add_successor(completion_activity);
             io->detach();
+            has_ios = true;
         }
+        // Nothing to write, only wait for the transfer (and computation)
+        if (not has_ios)
+            parity_block_comp->add_successor(completion_activity);
 
         // Completion activity is now blocked by I/Os, start it by assigning it to the controller host first disk
         completion_activity->set_disk(get_first_disk());
@@ -223,7 +959,7 @@ namespace simgrid::fsmod {
         return completion_activity;
     }
 
-    void JBODStorage::write(sg_size_t size) {
-        write_async(size)->wait();
+    void JBODStorage::write(const IOContext& context, sg_offset_t offset, sg_size_t size) {
+        wait_for_completion(write_async(context, offset, size));
     }
 }
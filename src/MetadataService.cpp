@@ -0,0 +1,114 @@
+/* Copyright (c) 2024-2026. The FSMOD Team. All rights reserved.          */
+
+/* This program is free software; you can redistribute it and/or modify it
+ * under the terms of the license (GNU LGPL) which comes with this package. */
+
+#include "fsmod/MetadataService.hpp"
+#include <simgrid/s4u/Actor.hpp>
+#include <simgrid/s4u/Comm.hpp>
+#include <simgrid/s4u/Engine.hpp>
+
+#include <numeric>
+
+XBT_LOG_NEW_DEFAULT_CATEGORY(fsmod_metadata_service, "File System module: Metadata service related logs");
+
+namespace simgrid::fsmod {
+
+    /**
+     * @brief Create an instance of a metadata service
+     * @param host: the host of the metadata server
+     * @param max_concurrent_operations: the maximum number of operations the server serves at the same time
+     *        (default: 1)
+     * @return a metadata service instance
+     */
+    std::shared_ptr<MetadataService> MetadataService::create(s4u::Host* host, unsigned long max_concurrent_operations) {
+        return std::make_shared<MetadataService>(host, max_concurrent_operations);
+    }
+
+    MetadataService::MetadataService(s4u::Host* host, unsigned long max_concurrent_operations)
+        : host_(host), max_concurrent_operations_(max_concurrent_operations) {
+        if (host == nullptr)
+            throw std::invalid_argument("A metadata service requires a server host");
+        if (max_concurrent_operations == 0)
+            throw std::invalid_argument("A metadata service must serve at least one operation at a time");
+        slots_ = s4u::Semaphore::create(static_cast<unsigned int>(max_concurrent_operations));
+    }
+
+    /**
+     * @brief Set the time the server spends on every metadata operation
+     * @param latency: a delay in seconds
+     */
+    void MetadataService::set_latency(double latency) {
+        for (size_t i = 0; i < NUM_OPERATIONS; i++)
+            set_latency(static_cast<Operation>(i), latency);
+    }
+
+    /**
+     * @brief Set the time the server spends on a metadata operation
+     * @param operation: an operation
+     * @param latency: a delay in seconds
+     */
+    void MetadataService::set_latency(Operation operation, double latency) {
+        if (latency < 0)
+            throw std::invalid_argument("The latency of a metadata operation cannot be negative");
+        latencies_.at(static_cast<size_t>(operation)) = latency;
+    }
+
+    /**
+     * @brief Retrieve the time the server spends on a metadata operation
+     * @param operation: an operation
+     * @return A delay in seconds
+     */
+    double MetadataService::get_latency(Operation operation) const {
+        return latencies_.at(static_cast<size_t>(operation));
+    }
+
+    /**
+     * @brief Retrieve the number of operations of a given kind served so far
+     * @param operation: an operation
+     * @return A number of operations
+     */
+    unsigned long MetadataService::get_num_operations(Operation operation) const {
+        return num_operations_.at(static_cast<size_t>(operation));
+    }
+
+    /**
+     * @brief Retrieve the number of operations served so far
+     * @return A number of operations
+     */
+    unsigned long MetadataService::get_num_operations() const {
+        return std::accumulate(num_operations_.begin(), num_operations_.end(), 0UL);
+    }
+
+    void MetadataService::perform(Operation operation) {
+        // Operations made outside of actors (e.g., to set up the initial content of a file system) are free
+        if (s4u::Actor::is_maestro())
+            return;
+
+        auto* client_host = s4u::Host::current();
+        if (client_host != host_)
+            s4u::Comm::sendto(client_host, host_, 0);
+
+        // Wait for a service slot
+        num_waiting_operations_++;
+        double arrival_date = s4u::Engine::get_clock();
+        slots_->acquire();
+        num_waiting_operations_--;
+        total_waiting_time_ += s4u::Engine::get_clock() - arrival_date;
+
+        num_running_operations_++;
+        try {
+            s4u::this_actor::sleep_for(get_latency(operation));
+        } catch (...) {
+            num_running_operations_--;
+            slots_->release();
+            throw;
+        }
+        num_running_operations_--;
+        slots_->release();
+        num_operations_.at(static_cast<size_t>(operation))++;
+
+        if (client_host != host_)
+            s4u::Comm::sendto(host_, client_host, 0);
+    }
+}
@@ -0,0 +1,178 @@
+/* Copyright (c) 2024-2026. The FSMOD Team. All rights reserved.          */
+
+/* This program is free software; you can redistribute it and/or modify it
+ * under the terms of the license (GNU LGPL) which comes with this package. */
+
+#include "fsmod/ObjectStorage.hpp"
+#include <simgrid/Exception.hpp>
+#include <simgrid/s4u/Actor.hpp>
+
+#include <algorithm>
+
+XBT_LOG_NEW_DEFAULT_CATEGORY(fsmod_object_storage, "File System module: Object storage related logs");
+
+namespace simgrid::fsmod {
+
+    /**
+     * @brief Create an instance of an object storage
+     * @param name: the storage's name
+     * @param disk: the disk that holds the objects, attached to the object store's server host
+     * @param request_latency: the time in seconds each request waits before its data is transferred
+     * @param max_request_size: the maximum number of bytes a request can transfer (default: 5GiB)
+     * @return an object storage instance
+     */
+    std::shared_ptr<ObjectStorage> ObjectStorage::create(const std::string& name, s4u::Disk* disk,
+                                                         double request_latency, sg_size_t max_request_size) {
+        return std::make_shared<ObjectStorage>(name, disk, request_latency, max_request_size);
+    }
+
+    ObjectStorage::ObjectStorage(const std::string& name, s4u::Disk* disk, double request_latency,
+                                 sg_size_t max_request_size)
+        : Storage(name), request_latency_(request_latency), max_request_size_(max_request_size) {
+        if (disk == nullptr)
+            throw std::invalid_argument("The disk of an object storage cannot be null");
+        if (request_latency < 0)
+            throw std::invalid_argument("The request latency of an object storage cannot be negative");
+        if (max_request_size == 0)
+            throw std::invalid_argument("The maximum request size of an object storage must be positive");
+        part_size_ = std::min(part_size_, max_request_size_);
+        range_size_ = std::min(range_size_, max_request_size_);
+        set_disk(disk);
+    }
+
+    void ObjectStorage::check_request_size(sg_size_t size, const std::string& what) const {
+        if (size == 0 || size > max_request_size_)
+            throw std::invalid_argument("The " + what + " of an object storage must be between 1 and its maximum "
+                                        "request size (" + std::to_string(max_request_size_) + ")");
+    }
+
+    /**
+     * @brief Configure multipart uploads. Writes larger than a part are cut in parts that are uploaded over
+     *        parallel connections, between a request that initiates the upload and a request that completes it
+     * @param part_size: the number of bytes of a part, at most the maximum request size
+     * @param parallelism: the number of parts uploaded at the same time
+     */
+    void ObjectStorage::set_multipart_upload(sg_size_t part_size, unsigned long parallelism) {
+        check_request_size(part_size, "part size");
+        if (parallelism == 0)
+            throw std::invalid_argument("The multipart upload parallelism of an object storage must be positive");
+        part_size_ = part_size;
+        multipart_parallelism_ = parallelism;
+    }
+
+    /**
+     * @brief Configure ranged GETs. Reads larger than a range are cut in ranges that are downloaded over
+     *        parallel connections
+     * @param range_size: the number of bytes of a range, at most the maximum request size
+     * @param parallelism: the number of ranges downloaded at the same time
+     */
+    void ObjectStorage::set_ranged_get(sg_size_t range_size, unsigned long parallelism) {
+        check_request_size(range_size, "range size");
+        if (parallelism == 0)
+            throw std::invalid_argument("The ranged GET parallelism of an object storage must be positive");
+        range_size_ = range_size;
+        ranged_get_parallelism_ = parallelism;
+    }
+
+    s4u::Host* ObjectStorage::get_server_host() const {
+        auto* server_host = get_controller_host();
+        if (server_host == nullptr)
+            server_host = get_first_disk()->get_host();
+        return server_host;
+    }
+
+    void ObjectStorage::send_request(s4u::Io::OpType op_type, sg_size_t size, s4u::Host* client_host) {
+        num_requests_++;
+        if (op_type == s4u::Io::OpType::READ)
+            num_get_requests_++;
+        else
+            num_put_requests_++;
+        s4u::this_actor::sleep_for(request_latency_);
+        if (size == 0)
+            return;
+        if (op_type == s4u::Io::OpType::READ)
+            s4u::Io::streamto_async(get_server_host(), get_first_disk(), client_host, nullptr, size)->wait();
+        else
+            s4u::Io::streamto_async(client_host, nullptr, get_server_host(), get_first_disk(), size)->wait();
+    }
+
+    void ObjectStorage::send_parallel_requests(s4u::Io::OpType op_type, sg_size_t size, sg_size_t request_size,
+                                               unsigned long parallelism, s4u::Host* client_host) {
+        std::vector<sg_size_t> request_sizes;
+        for (sg_size_t position = 0; position < size; position += request_size)
+            request_sizes.push_back(std::min(request_size, size - position));
+        if (request_sizes.size() == 1) {
+            send_request(op_type, request_sizes.front(), client_host);
+            return;
+        }
+
+        // Each connection sends its requests one after the other, and the connections run concurrently
+        auto storage = shared_from_this();
+        auto num_connections = std::min<unsigned long>(parallelism, request_sizes.size());
+        auto failed = std::make_shared<bool>(false);
+        std::vector<s4u::ActorPtr> connections;
+        for (unsigned long c = 0; c < num_connections; c++) {
+            connections.push_back(client_host->add_actor(
+                get_name() + "_connection_" + std::to_string(c),
+                [storage, op_type, request_sizes, c, num_connections, client_host, failed]() {
+                    try {
+                        for (auto i = c; i < request_sizes.size(); i += num_connections)
+                            storage->send_request(op_type, request_sizes.at(i), client_host);
+                    } catch (const simgrid::Exception&) {
+                        *failed = true;
+                    }
+                }));
+        }
+        for (const auto& connection : connections)
+            connection->join();
+        if (*failed)
+            throw StorageFailureException(XBT_THROW_POINT, "A request to " + get_name() + " failed");
+    }
+
+    void ObjectStorage::get(sg_size_t size, s4u::Host* client_host) {
+        XBT_DEBUG("GET of %llu bytes in ranges of %llu bytes", size, range_size_);
+        send_parallel_requests(s4u::Io::OpType::READ, size, range_size_, ranged_get_parallelism_, client_host);
+    }
+
+    void ObjectStorage::put(sg_size_t size, s4u::Host* client_host) {
+        if (size <= part_size_) {
+            send_request(s4u::Io::OpType::WRITE, size, client_host);
+            return;
+        }
+        XBT_DEBUG("Multipart upload of %llu bytes in parts of %llu bytes", size, part_size_);
+        num_multipart_uploads_++;
+        send_request(s4u::Io::OpType::WRITE, 0, client_host);
+        send_parallel_requests(s4u::Io::OpType::WRITE, size, part_size_, multipart_parallelism_, client_host);
+        send_request(s4u::Io::OpType::WRITE, 0, client_host);
+    }
+
+    s4u::IoPtr ObjectStorage::start_request(s4u::Io::OpType op_type, sg_size_t size, s4u::Host* client_host,
+                                            bool detached) {
+        auto storage = shared_from_this();
+        // Request latencies are waited for over time, which requires an actor
+        return start_in_background(client_host, op_type, get_name() + "_request", [storage, op_type, size,
+                                                                                  client_host]() {
+            if (op_type == s4u::Io::OpType::READ)
+                storage->get(size, client_host);
+            else
+                storage->put(size, client_host);
+        }, detached);
+    }
+
+    s4u::IoPtr ObjectStorage::read_async(const IOContext& context, sg_offset_t /*offset*/, sg_size_t size) {
+        return start_request(s4u::Io::OpType::READ, size, context.get_client_host(), false);
+    }
+
+    void ObjectStorage::read(const IOContext& context, sg_offset_t /*offset*/, sg_size_t size) {
+        get(size, context.get_client_host());
+    }
+
+    s4u::IoPtr ObjectStorage::write_async(const IOContext& context, sg_offset_t /*offset*/, sg_size_t size,
+                                          bool detached) {
+        return start_request(s4u::Io::OpType::WRITE, size, context.get_client_host(), detached);
+    }
+
+    void ObjectStorage::write(const IOContext& context, sg_offset_t /*offset*/, sg_size_t size) {
+        put(size, context.get_client_host());
+    }
+}
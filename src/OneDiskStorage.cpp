@@ -22,15 +22,16 @@ namespace simgrid::fsmod {
         set_disk(disk);
     }
 
-    s4u::IoPtr OneDiskStorage::read_async(sg_size_t size) {
+    s4u::IoPtr OneDiskStorage::read_async(const IOContext& /*context*/, sg_offset_t /*offset*/, sg_size_t size) {
         return get_first_disk()->read_async(size);
     }
 
-    void OneDiskStorage::read(sg_size_t size) {
+    void OneDiskStorage::read(const IOContext& /*context*/, sg_offset_t /*offset*/, sg_size_t size) {
         get_first_disk()->read(size);
     }
 
-    s4u::IoPtr OneDiskStorage::write_async(sg_size_t size, bool detached) {
+    s4u::IoPtr OneDiskStorage::write_async(const IOContext& /*context*/, sg_offset_t /*offset*/, sg_size_t size,
+                                           bool detached) {
       auto io = s4u::IoPtr(get_first_disk()->io_init(size, s4u::Io::OpType::WRITE));
       if (detached)
         io->detach();
@@ -40,7 +41,7 @@ namespace simgrid::fsmod {
       return io;
     }
 
-    void OneDiskStorage::write(sg_size_t size) {
+    void OneDiskStorage::write(const IOContext& /*context*/, sg_offset_t /*offset*/, sg_size_t size) {
         get_first_disk()->write(size);
     }
 
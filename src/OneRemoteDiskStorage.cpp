@@ -22,22 +22,24 @@ namespace simgrid::fsmod {
         set_disk(disk);
     }
 
-    s4u::IoPtr OneRemoteDiskStorage::read_async(sg_size_t size) {
+    s4u::IoPtr OneRemoteDiskStorage::read_async(const IOContext& context, sg_offset_t /*offset*/, sg_size_t size) {
         auto source_host = get_controller_host();
         if (source_host == nullptr)
             source_host = this->get_first_disk()->get_host();
-        return s4u::Io::streamto_async(source_host, get_first_disk(), s4u::Host::current(), nullptr, size);
+        return s4u::Io::streamto_async(source_host, get_first_disk(), context.get_client_host(), nullptr, size);
     }
 
-    void OneRemoteDiskStorage::read(sg_size_t size) {
-        this->read_async(size)->wait();
+    void OneRemoteDiskStorage::read(const IOContext& context, sg_offset_t offset, sg_size_t size) {
+        this->read_async(context, offset, size)->wait();
     }
 
-    s4u::IoPtr OneRemoteDiskStorage::write_async(sg_size_t size, bool detached) {
+    s4u::IoPtr OneRemoteDiskStorage::write_async(const IOContext& context, sg_offset_t /*offset*/, sg_size_t size,
+                                                 bool detached) {
        auto destination_host = get_controller_host();
        if (destination_host == nullptr)
            destination_host= this->get_first_disk()->get_host();
-       auto io = s4u::Io::streamto_init(s4u::Host::current(), nullptr, destination_host, get_first_disk())->set_size(size);
+       auto io = s4u::Io::streamto_init(context.get_client_host(), nullptr, destination_host, get_first_disk())
+                     ->set_size(size);
        if (detached)
          io->detach();
        else
@@ -46,8 +48,8 @@ namespace simgrid::fsmod {
        return io;
     }
 
-    void OneRemoteDiskStorage::write(sg_size_t size) {
-        this->write_async(size)->wait();
+    void OneRemoteDiskStorage::write(const IOContext& context, sg_offset_t offset, sg_size_t size) {
+        this->write_async(context, offset, size)->wait();
     }
 
 }
@@ -3,25 +3,69 @@
 /* This program is free software; you can redistribute it and/or modify it
  * under the terms of the license (GNU LGPL) which comes with this package. */
 
+#include <algorithm>
+#include <cmath>
 #include <memory>
+#include <tuple>
+#include <unordered_set>
 
+#include <simgrid/Exception.hpp>
+#include <simgrid/s4u/Actor.hpp>
 #include <simgrid/s4u/Engine.hpp>
 
+#include "fsmod/File.hpp"
+#include "fsmod/FileSystem.hpp"
+#include "fsmod/MetadataService.hpp"
 #include "fsmod/Partition.hpp"
 #include "fsmod/FileMetadata.hpp"
 #include "fsmod/FileSystemException.hpp"
+#include "fsmod/PathUtil.hpp"
+#include "fsmod/Storage.hpp"
+
+XBT_LOG_NEW_DEFAULT_CATEGORY(fsmod_partition, "File System module: Partition related logs");
 
 namespace simgrid::fsmod {
 
+    namespace {
+        sg_size_t to_physical_size(sg_size_t num_bytes, double compression_ratio) {
+            if (compression_ratio == 1.0)
+                return num_bytes;
+            return static_cast<sg_size_t>(std::ceil(static_cast<double>(num_bytes) / compression_ratio));
+        }
+
+        sg_size_t get_chunk_length(sg_size_t index, sg_size_t file_size, sg_size_t chunk_size) {
+            return std::min(chunk_size, file_size - index * chunk_size);
+        }
+
+        sg_size_t get_num_chunks(sg_size_t file_size, sg_size_t chunk_size) {
+            return (file_size + chunk_size - 1) / chunk_size;
+        }
+    }
+
     /**
      * @brief Constructor
      * @param name: partition name
      * @param file_system: file system that hosts this partition
      * @param storage: storage
      * @param size: size in bytes
+     * @param eviction_policy: the policy that selects the files to evict when space is needed (nullptr: no caching)
      */
-    Partition::Partition(std::string name, FileSystem *file_system, std::shared_ptr<Storage> storage, sg_size_t size)
-            : name_(std::move(name)), file_system_(file_system), storage_(std::move(storage)), size_(size), free_space_(size) {
+    Partition::Partition(std::string name, FileSystem *file_system, std::shared_ptr<Storage> storage, sg_size_t size,
+                         std::shared_ptr<EvictionPolicy> eviction_policy)
+            : name_(std::move(name)), file_system_(file_system), storage_(std::move(storage)),
+              eviction_policy_(std::move(eviction_policy)), size_(size), free_space_(size) {
+        // Storages whose behavior depends on how full they are need to know the partitions mounted on them
+        if (storage_)
+            storage_->partitions_.push_back(this);
+        if (eviction_policy_)
+            eviction_policy_->partition_size_ = size;
+    }
+
+    Partition::~Partition() {
+        if (storage_) {
+            auto& partitions = storage_->partitions_;
+            partitions.erase(std::remove(partitions.begin(), partitions.end(), this), partitions.end());
+        }
     }
 
 
@@ -69,6 +113,575 @@ namespace simgrid::fsmod {
         return to_return;
     }
 
+    /**
+     * @brief Set the metadata service that serves the metadata operations on this partition, instead of the
+     *        file system's one
+     * @param metadata_service: a metadata service (or nullptr to use the file system's one)
+     */
+    void Partition::set_metadata_service(std::shared_ptr<MetadataService> metadata_service) {
+        metadata_service_ = std::move(metadata_service);
+    }
+
+    /**
+     * @brief Set the time during which a metadata mutation (file creation, deletion, or move) made by an actor holds
+     *        the lock of the directories it modifies. Mutations in the same directory are serialized, while mutations
+     *        in different directories proceed in parallel
+     * @param hold_time: a delay in seconds (0 means that mutations take zero time)
+     */
+    void Partition::set_directory_lock_hold_time(double hold_time) {
+        if (hold_time < 0)
+            throw std::invalid_argument("The directory lock hold time of a partition cannot be negative");
+        directory_lock_hold_time_ = hold_time;
+    }
+
+    /**
+     * @brief Enable transparent compression on the partition. The files created from now on are stored compressed
+     *        with the given ratio, which can be changed for each file, and the free space of the partition accounts
+     *        for their compressed size. Writes compress data before it reaches the storage, and reads decompress it
+     *        afterward, on the host of the storage's controller if any or on the host of the calling actor
+     * @param ratio: the ratio between the size of the data and its compressed size (1 disables compression)
+     * @param compression_flops_per_byte: the number of flops needed to compress a byte of data (default: 0)
+     * @param decompression_flops_per_byte: the number of flops needed to decompress a byte of data (default: 0)
+     */
+    void Partition::set_compression(double ratio, double compression_flops_per_byte,
+                                    double decompression_flops_per_byte) {
+        if (ratio < 1.0)
+            throw std::invalid_argument("The compression ratio of a partition cannot be less than 1");
+        if (compression_flops_per_byte < 0 || decompression_flops_per_byte < 0)
+            throw std::invalid_argument("The compression and decompression costs of a partition cannot be negative");
+        compression_ratio_ = ratio;
+        compression_flops_per_byte_ = compression_flops_per_byte;
+        decompression_flops_per_byte_ = decompression_flops_per_byte;
+    }
+
+    /**
+     * @brief Set the watermarks that drive the background eviction of files on a caching partition. When the space
+     *        used on the partition rises above the high watermark, a background actor evicts files, in the order
+     *        chosen by the eviction policy, until the used space falls to the low watermark. Foreground writers thus
+     *        rarely have to evict files themselves, and the cost of evictions (e.g., directory lock hold times) is
+     *        paid off their critical path. The actor runs on the controller host of the partition's storage, or on
+     *        the host of its first disk if it has no controller
+     * @param high_watermark: the fraction of the partition's size above which background eviction starts
+     *        (1 disables background eviction, which is the default)
+     * @param low_watermark: the fraction of the partition's size at which background eviction stops
+     */
+    void Partition::set_eviction_watermarks(double high_watermark, double low_watermark) {
+        if (not eviction_policy_)
+            throw std::invalid_argument("Eviction watermarks can only be set on a partition with an eviction policy");
+        if (low_watermark < 0 || high_watermark > 1 || low_watermark > high_watermark)
+            throw std::invalid_argument("The eviction watermarks of a partition must satisfy "
+                                        "0 <= low watermark <= high watermark <= 1");
+        high_watermark_ = high_watermark;
+        low_watermark_ = low_watermark;
+        this->start_background_eviction_if_needed();
+    }
+
+    /**
+     * @brief Retrieve the number of bytes some data of a file occupies on the storage
+     * @param file_metadata: the file's metadata
+     * @param num_bytes: a number of bytes of the file
+     * @return A number of bytes, which is smaller than num_bytes if the file is compressed
+     */
+    sg_size_t Partition::get_physical_size(const FileMetadata *file_metadata, sg_size_t num_bytes) {
+        return to_physical_size(num_bytes, file_metadata->compression_ratio_);
+    }
+
+    void Partition::set_file_compression_ratio(const std::string &dir_path, const std::string &file_name,
+                                               double ratio) {
+        auto metadata = this->get_file_metadata(dir_path, file_name);
+        if (not metadata) {
+            throw FileNotFoundException(XBT_THROW_POINT, dir_path + "/" + file_name);
+        }
+        if (ratio < 1.0) {
+            throw std::invalid_argument("The compression ratio of a file cannot be less than 1");
+        }
+        if (metadata->get_file_refcount() > 0) {
+            throw FileIsOpenException(XBT_THROW_POINT, "compress: " + dir_path + "/" + file_name);
+        }
+
+        // The file's content is stored again with the new ratio, in zero time: no I/O or computation is simulated
+        auto size = metadata->stored_size_;
+        auto old_ratio = metadata->compression_ratio_;
+        this->resize_stored_content(metadata, 0);
+        metadata->compression_ratio_ = ratio;
+        try {
+            this->reserve_space(metadata, size);
+        } catch (...) {
+            metadata->compression_ratio_ = old_ratio;
+            this->resize_stored_content(metadata, size);
+            throw;
+        }
+    }
+
+    /**
+     * @brief Enable block-level deduplication on the partition, which must not hold any file. The content of each
+     *        file is split into chunks, and chunks with the same fingerprint are stored only once, so that the free
+     *        space of the partition accounts for unique chunks only. Writes hash all their data, on the host of the
+     *        storage's controller if any or on the host of the calling actor, but only store the chunks that the
+     *        partition does not already hold
+     * @param chunk_size: the size of a chunk in bytes
+     * @param hashing_flops_per_byte: the number of flops needed to fingerprint a byte of written data (default: 0)
+     */
+    void Partition::set_deduplication(sg_size_t chunk_size, double hashing_flops_per_byte) {
+        if (chunk_size == 0)
+            throw std::invalid_argument("The deduplication chunk size of a partition must be positive");
+        if (hashing_flops_per_byte < 0)
+            throw std::invalid_argument("The hashing cost of a partition cannot be negative");
+        if (this->get_num_files() > 0)
+            throw std::invalid_argument("Deduplication can only be configured on a partition that holds no file");
+        deduplication_chunk_size_ = chunk_size;
+        hashing_flops_per_byte_ = hashing_flops_per_byte;
+    }
+
+    /**
+     * @brief Retrieve the deduplication ratio of the partition
+     * @return The ratio between the number of bytes of the chunks referenced by files and the number of bytes of
+     *         the unique chunks actually stored (1 if nothing is deduplicated)
+     */
+    double Partition::get_deduplication_ratio() const {
+        double referenced_bytes = 0;
+        double unique_bytes = 0;
+        for (const auto& [key, chunk] : chunks_) {
+            referenced_bytes += static_cast<double>(chunk.size) * static_cast<double>(chunk.refcount);
+            unique_bytes += static_cast<double>(chunk.size);
+        }
+        return (unique_bytes > 0) ? referenced_bytes / unique_bytes : 1.0;
+    }
+
+    void Partition::set_file_fingerprints(const std::string &dir_path, const std::string &file_name,
+                                          std::string fingerprint, std::vector<std::string> chunk_fingerprints) {
+        auto metadata = this->get_file_metadata(dir_path, file_name);
+        if (not metadata) {
+            throw FileNotFoundException(XBT_THROW_POINT, dir_path + "/" + file_name);
+        }
+        if (metadata->get_file_refcount() > 0) {
+            throw FileIsOpenException(XBT_THROW_POINT, "fingerprint: " + dir_path + "/" + file_name);
+        }
+
+        // The file's content is stored again with the new fingerprints
+        auto size = metadata->stored_size_;
+        this->resize_stored_content(metadata, 0);
+        std::swap(metadata->fingerprint_, fingerprint);
+        std::swap(metadata->chunk_fingerprints_, chunk_fingerprints);
+        try {
+            this->reserve_space(metadata, size);
+        } catch (...) {
+            std::swap(metadata->fingerprint_, fingerprint);
+            std::swap(metadata->chunk_fingerprints_, chunk_fingerprints);
+            this->resize_stored_content(metadata, size);
+            throw;
+        }
+    }
+
+    /**
+     * @brief Compute the key that identifies a chunk of a file in the chunk store of a deduplicated partition
+     * @param file_metadata: the file's metadata
+     * @param index: the index of the chunk in the file
+     * @param file_size: the size of the file
+     * @return A key, which is the same for two chunks with the same content
+     */
+    std::string Partition::get_chunk_key(const FileMetadata *file_metadata, sg_size_t index,
+                                         sg_size_t file_size) const {
+        std::string key;
+        if (index < file_metadata->chunk_fingerprints_.size())
+            key = file_metadata->chunk_fingerprints_.at(index);
+        else if (not file_metadata->fingerprint_.empty())
+            key = file_metadata->fingerprint_ + "/" + std::to_string(index);
+        else // The chunks of a file without fingerprints are never shared
+            key = "#" + std::to_string(file_metadata->get_id()) + "/" + std::to_string(index);
+        // A partial chunk can only be shared with partial chunks of the same length
+        auto length = get_chunk_length(index, file_size, deduplication_chunk_size_);
+        if (length < deduplication_chunk_size_)
+            key += "[" + std::to_string(length) + "]";
+        return key;
+    }
+
+    /**
+     * @brief Compute how much free space a file needs to have its stored content grow or shrink to a new size
+     * @param file_metadata: the file's metadata
+     * @param new_size: the new size of the file
+     * @return A number of bytes, which is 0 if the file does not need more space
+     */
+    sg_size_t Partition::get_space_needed(const FileMetadata *file_metadata, sg_size_t new_size) const {
+        if (deduplication_chunk_size_ == 0) {
+            auto old_physical_size = get_physical_size(file_metadata, file_metadata->stored_size_);
+            auto new_physical_size = get_physical_size(file_metadata, new_size);
+            return (new_physical_size > old_physical_size) ? new_physical_size - old_physical_size : 0;
+        }
+
+        // Replay the reference count changes that resizing the content would make
+        std::unordered_map<std::string, std::pair<long, sg_size_t>> changes;
+        auto first_index = std::min(file_metadata->stored_size_, new_size) / deduplication_chunk_size_;
+        for (auto index = first_index; index < file_metadata->stored_chunks_.size(); index++)
+            changes[file_metadata->stored_chunks_.at(index)].first--;
+        for (auto index = first_index; index < get_num_chunks(new_size, deduplication_chunk_size_); index++) {
+            auto& [refcount_change, physical_size] = changes[get_chunk_key(file_metadata, index, new_size)];
+            refcount_change++;
+            physical_size = to_physical_size(get_chunk_length(index, new_size, deduplication_chunk_size_),
+                                             file_metadata->compression_ratio_);
+        }
+        sg_size_t allocated_space = 0;
+        sg_size_t freed_space = 0;
+        for (const auto& [key, change] : changes) {
+            auto it = chunks_.find(key);
+            if (it == chunks_.end()) {
+                if (change.first > 0)
+                    allocated_space += change.second;
+            } else if (static_cast<long>(it->second.refcount) + change.first == 0) {
+                freed_space += it->second.physical_size;
+            }
+        }
+        return (allocated_space > freed_space) ? allocated_space - freed_space : 0;
+    }
+
+    /**
+     * @brief Compute how many bytes of a write to a file are already stored on the partition, which is the case for
+     *        the parts of the chunks that the partition already holds
+     * @param file_metadata: the file's metadata
+     * @param offset: the offset of the write in the file
+     * @param num_bytes: the number of bytes written
+     * @param new_size: the size of the file after the write
+     * @return A number of bytes
+     */
+    sg_size_t Partition::get_num_duplicate_bytes(const FileMetadata *file_metadata, sg_size_t offset,
+                                                 sg_size_t num_bytes, sg_size_t new_size) const {
+        if (deduplication_chunk_size_ == 0)
+            return 0;
+        std::unordered_set<std::string> written_chunks;
+        sg_size_t num_duplicate_bytes = 0;
+        for (auto index = offset / deduplication_chunk_size_; index * deduplication_chunk_size_ < offset + num_bytes;
+             index++) {
+            // Chunks without fingerprints hold new data
+            if (index >= file_metadata->chunk_fingerprints_.size() && file_metadata->fingerprint_.empty())
+                continue;
+            auto key = get_chunk_key(file_metadata, index, new_size);
+            bool already_stored = chunks_.find(key) != chunks_.end();
+            if (not written_chunks.insert(key).second || already_stored) {
+                num_duplicate_bytes += std::min(offset + num_bytes, (index + 1) * deduplication_chunk_size_) -
+                                       std::max(offset, index * deduplication_chunk_size_);
+            }
+        }
+        return num_duplicate_bytes;
+    }
+
+    /**
+     * @brief Compute how much space deleting a file would free
+     * @param file_metadata: the file's metadata
+     * @return A number of bytes, which does not include the chunks the file shares with other files
+     */
+    sg_size_t Partition::get_reclaimable_space(const FileMetadata *file_metadata) const {
+        if (deduplication_chunk_size_ == 0)
+            return get_physical_size(file_metadata, file_metadata->stored_size_);
+        std::unordered_map<std::string, unsigned long> num_references;
+        for (const auto& key : file_metadata->stored_chunks_)
+            num_references[key]++;
+        sg_size_t reclaimable_space = 0;
+        for (const auto& [key, count] : num_references) {
+            const auto& chunk = chunks_.at(key);
+            if (chunk.refcount == count)
+                reclaimable_space += chunk.physical_size;
+        }
+        return reclaimable_space;
+    }
+
+    /**
+     * @brief Make the stored content of a file grow or shrink to a new size, creating space if needed
+     * @param file_metadata: the file's metadata
+     * @param new_size: the new size of the file
+     */
+    void Partition::reserve_space(FileMetadata *file_metadata, sg_size_t new_size) {
+        auto space_needed = this->get_space_needed(file_metadata, new_size);
+        if (space_needed > free_space_) {
+            // Keep the file from being evicted to make space for itself
+            file_metadata->increase_file_refcount();
+            try {
+                this->create_space(space_needed - free_space_);
+            } catch (...) {
+                file_metadata->decrease_file_refcount();
+                throw;
+            }
+            file_metadata->decrease_file_refcount();
+        }
+        this->resize_stored_content(file_metadata, new_size);
+        this->start_background_eviction_if_needed();
+    }
+
+    s4u::Host* Partition::get_background_actor_host() const {
+        if (not storage_)
+            return nullptr;
+        auto* host = storage_->get_controller_host();
+        return (host != nullptr) ? host : storage_->get_first_disk()->get_host();
+    }
+
+    void Partition::start_background_eviction_if_needed() {
+        auto used_space = static_cast<double>(size_ - free_space_);
+        if (eviction_actor_ || used_space <= high_watermark_ * static_cast<double>(size_))
+            return;
+        // Partitions that are not managed by a file system, or that have no storage, cannot host the actor
+        std::weak_ptr<Partition> weak_partition = weak_from_this();
+        auto* host = this->get_background_actor_host();
+        if (weak_partition.expired() || host == nullptr)
+            return;
+
+        XBT_DEBUG("Starting the background eviction on partition %s (%llu bytes used)", get_cname(),
+                  size_ - free_space_);
+        // Do not keep the partition alive because its eviction actor still runs
+        eviction_actor_ = host->add_actor(get_name() + "_eviction", [weak_partition]() {
+            while (true) {
+                auto partition = weak_partition.lock();
+                if (not partition)
+                    return;
+                if (not partition->evict_files_in_background()) {
+                    partition->eviction_actor_ = nullptr;
+                    return;
+                }
+            }
+        });
+        eviction_actor_->daemonize();
+    }
+
+    bool Partition::evict_files_in_background() {
+        auto target = static_cast<sg_size_t>(low_watermark_ * static_cast<double>(size_));
+        if (size_ - free_space_ <= target)
+            return false;
+
+        // Evict a whole batch of victims before asking the policy for more. Victims are identified by path and
+        // identifier, as the actor blocks while evicting them, and they may be deleted or moved meanwhile
+        std::vector<std::tuple<std::string, std::string, unsigned long>> victims;
+        for (const auto* victim : eviction_policy_->select_victims(size_ - free_space_ - target))
+            victims.emplace_back(victim->get_dir_path(), victim->get_file_name(), victim->get_id());
+
+        bool evicted_files = false;
+        for (const auto& [dir_path, file_name, id] : victims) {
+            if (size_ - free_space_ <= target)
+                break;
+            auto* metadata = this->get_file_metadata(dir_path, file_name);
+            if (not metadata || metadata->get_id() != id || metadata->is_pinned())
+                continue;
+            this->hold_directory_locks({dir_path});
+            // The file may have been opened, deleted, or moved while the actor held the lock
+            metadata = this->get_file_metadata(dir_path, file_name);
+            if (not metadata || metadata->get_id() != id || metadata->is_pinned())
+                continue;
+            if (not this->needs_write_back(metadata)) {
+                this->delete_file(dir_path, file_name);
+                num_background_evictions_++;
+                evicted_files = true;
+                continue;
+            }
+            // Dirty files are written back one at a time, and a failed write-back stops the eviction
+            metadata->increase_file_refcount();
+            if (not this->write_back_and_evict(metadata))
+                return false;
+            num_background_evictions_++;
+            evicted_files = true;
+        }
+        // Stop when no file of the batch could be evicted, until the used space rises again
+        return evicted_files;
+    }
+
+    /**
+     * @brief Make the partition write dirty files back to a backing file system before evicting them, as a
+     *        burst buffer does with the outputs it holds. A file becomes dirty when it is written, and clean again
+     *        once written back, while files created with FileSystem::create_file() are clean. The write-back of a
+     *        file reads it from the partition's storage and writes it on the backing file system, under the backing
+     *        path followed by the file's path on the partition. Writers that run out of space wait for the
+     *        write-backs of the files evicted for them, which happen one after the other, or concurrently if
+     *        asynchronous. The background eviction actor always writes files back one after the other
+     * @param backing_file_system: the file system to which dirty files are written back
+     * @param backing_path: the directory of the backing file system in which dirty files are written back
+     * @param asynchronous: whether the write-backs of the files evicted at once happen concurrently
+     */
+    void Partition::set_write_back(std::shared_ptr<FileSystem> backing_file_system, const std::string& backing_path,
+                                   bool asynchronous) {
+        if (not eviction_policy_)
+            throw std::invalid_argument("Write-back can only be configured on a partition with an eviction policy");
+        if (not backing_file_system)
+            throw std::invalid_argument("The backing file system of a partition cannot be null");
+        auto backing_partition = backing_file_system->get_partition_for_path_or_null(backing_path);
+        if (not backing_partition)
+            throw std::invalid_argument("The backing path of a partition must be on a partition of the backing "
+                                        "file system");
+        if (backing_partition.get() == this)
+            throw std::invalid_argument("A partition cannot write its files back to itself");
+        backing_file_system_ = std::move(backing_file_system);
+        backing_path_ = PathUtil::simplify_path_string(backing_path);
+        asynchronous_write_back_ = asynchronous;
+    }
+
+    bool Partition::needs_write_back(const FileMetadata *file_metadata) const {
+        return backing_file_system_ && file_metadata->is_dirty();
+    }
+
+    void Partition::write_back(FileMetadata *file_metadata) {
+        auto size = file_metadata->get_current_size();
+        auto path = PathUtil::simplify_path_string(backing_path_ + "/" + file_metadata->get_dir_path() + "/" +
+                                                   file_metadata->get_file_name());
+        XBT_DEBUG("Writing %s/%s (%llu bytes) back to %s", file_metadata->get_dir_path().c_str(),
+                  file_metadata->get_file_name().c_str(), size, path.c_str());
+        // Data written from now on makes the file dirty again
+        file_metadata->dirty_ = false;
+        try {
+            auto physical_size = get_physical_size(file_metadata, size);
+            if (physical_size > 0)
+                this->get_storage_for_file(file_metadata)->submit_read({file_metadata->get_id()}, 0, physical_size);
+            auto backing_file = backing_file_system_->open(path, "w");
+            try {
+                backing_file->write(size);
+            } catch (...) {
+                backing_file->close();
+                throw;
+            }
+            backing_file->close();
+        } catch (...) {
+            file_metadata->dirty_ = true;
+            throw;
+        }
+        num_write_backs_++;
+        num_written_back_bytes_ += size;
+    }
+
+    /**
+     * @brief Write a dirty file back and evict it. The caller pins the file beforehand, so that no other actor
+     *        deletes, moves, or evicts it during the write-back, and the file is unpinned in all cases, including
+     *        when the calling actor is killed
+     * @param file_metadata: the file's metadata
+     * @return true if the file was evicted, or false if the write-back failed or the file was opened or written
+     *         in the meantime
+     */
+    bool Partition::write_back_and_evict(FileMetadata *file_metadata) {
+        try {
+            this->write_back(file_metadata);
+        } catch (const simgrid::Exception& e) {
+            XBT_WARN("Cannot write %s/%s back from partition %s: %s", file_metadata->get_dir_path().c_str(),
+                     file_metadata->get_file_name().c_str(), get_cname(), e.what());
+        } catch (...) {
+            file_metadata->decrease_file_refcount();
+            throw;
+        }
+        file_metadata->decrease_file_refcount();
+        if (file_metadata->is_pinned() || file_metadata->is_dirty())
+            return false;
+        auto dir_path = file_metadata->get_dir_path();
+        auto file_name = file_metadata->get_file_name();
+        this->delete_file(dir_path, file_name);
+        return true;
+    }
+
+    /**
+     * @brief Start an actor that writes a dirty file back and evicts it. The actor takes over the caller's pin on
+     *        the file, which it releases when it exits, even if it is killed before it starts
+     * @param file_metadata: the file's metadata
+     * @param num_evictions: a counter that is incremented if the file is evicted
+     * @return The actor
+     */
+    s4u::ActorPtr Partition::start_write_back_and_evict(FileMetadata *file_metadata,
+                                                        const std::shared_ptr<unsigned long>& num_evictions) {
+        std::weak_ptr<Partition> weak_partition = weak_from_this();
+        auto pinned = std::make_shared<bool>(true);
+        auto actor = this->get_background_actor_host()->add_actor(get_name() + "_write_back",
+                                                                  [weak_partition, file_metadata, num_evictions,
+                                                                   pinned]() {
+            auto partition = weak_partition.lock();
+            if (not partition)
+                return;
+            // From now on, write_back_and_evict() releases the pin
+            *pinned = false;
+            if (partition->write_back_and_evict(file_metadata)) {
+                partition->num_foreground_evictions_++;
+                (*num_evictions)++;
+            }
+        });
+        // The actor has not run yet, and thus cannot have exited
+        actor->on_exit([weak_partition, file_metadata, pinned](bool /*failed*/) {
+            if (*pinned && not weak_partition.expired())
+                file_metadata->decrease_file_refcount();
+        });
+        return actor;
+    }
+
+    /**
+     * @brief Make the stored content of a file grow or shrink to a new size, and update the free space accordingly
+     * @param file_metadata: the file's metadata
+     * @param new_size: the new size of the file
+     */
+    void Partition::resize_stored_content(FileMetadata *file_metadata, sg_size_t new_size) {
+        if (deduplication_chunk_size_ == 0) {
+            free_space_ = free_space_ + get_physical_size(file_metadata, file_metadata->stored_size_) -
+                          get_physical_size(file_metadata, new_size);
+            auto old_size = file_metadata->stored_size_;
+            file_metadata->stored_size_ = new_size;
+            this->new_file_resize_event(file_metadata, old_size);
+            return;
+        }
+
+        // The chunks before the first one whose length changes are full, and thus remain the same
+        auto& stored_chunks = file_metadata->stored_chunks_;
+        auto first_index = std::min(file_metadata->stored_size_, new_size) / deduplication_chunk_size_;
+        for (auto index = first_index; index < stored_chunks.size(); index++) {
+            auto it = chunks_.find(stored_chunks.at(index));
+            if (--it->second.refcount == 0) {
+                free_space_ += it->second.physical_size;
+                chunks_.erase(it);
+            }
+        }
+        stored_chunks.resize(first_index);
+        for (auto index = first_index; index < get_num_chunks(new_size, deduplication_chunk_size_); index++) {
+            auto key = get_chunk_key(file_metadata, index, new_size);
+            auto length = get_chunk_length(index, new_size, deduplication_chunk_size_);
+            auto [it, inserted] = chunks_.try_emplace(
+                key, Chunk{length, to_physical_size(length, file_metadata->compression_ratio_), 0});
+            if (inserted)
+                free_space_ -= it->second.physical_size;
+            it->second.refcount++;
+            stored_chunks.push_back(std::move(key));
+        }
+        auto old_size = file_metadata->stored_size_;
+        file_metadata->stored_size_ = new_size;
+        this->new_file_resize_event(file_metadata, old_size);
+    }
+
+    void Partition::hold_directory_locks(std::vector<std::string> dir_paths) {
+        // Mutations made outside of actors (e.g., to set up the initial content of a partition) are free
+        if (directory_lock_hold_time_ <= 0 || s4u::Actor::is_maestro())
+            return;
+
+        // Acquire the locks in a global order, so that mutations on several directories cannot deadlock
+        std::sort(dir_paths.begin(), dir_paths.end());
+        dir_paths.erase(std::unique(dir_paths.begin(), dir_paths.end()), dir_paths.end());
+        std::vector<s4u::MutexPtr> locks;
+        for (const auto& dir_path : dir_paths) {
+            auto& lock = directory_locks_[dir_path];
+            if (not lock)
+                lock = s4u::Mutex::create();
+            double request_date = s4u::Engine::get_clock();
+            lock->lock();
+            double wait_time = s4u::Engine::get_clock() - request_date;
+            auto& statistics = directory_lock_statistics_[dir_path];
+            statistics.num_mutations++;
+            if (wait_time > 0)
+                statistics.num_waits++;
+            statistics.total_wait_time += wait_time;
+            statistics.max_wait_time = std::max(statistics.max_wait_time, wait_time);
+            locks.push_back(lock);
+        }
+
+        try {
+            s4u::this_actor::sleep_for(directory_lock_hold_time_);
+        } catch (...) {
+            for (const auto& lock : locks)
+                lock->unlock();
+            throw;
+        }
+        for (const auto& lock : locks)
+            lock->unlock();
+    }
+
+    Partition::DirectoryLockStatistics Partition::get_directory_lock_statistics(const std::string &dir_path) const {
+        auto it = directory_lock_statistics_.find(dir_path);
+        return (it == directory_lock_statistics_.end()) ? DirectoryLockStatistics() : it->second;
+    }
+
     /**
      * @brief Retrieve the metadata for a file
      * @param dir_path: the path to the directory in which the file is located
@@ -95,13 +708,15 @@ namespace simgrid::fsmod {
             throw FileAlreadyExistsException(XBT_THROW_POINT, dir_path + "/" + file_name);
         }
 
-        // Check that there is enough space
-        if (free_space_ < size) {
-            this->create_space(size - free_space_);
+        auto metadata = std::make_unique<FileMetadata>(size, this, dir_path, file_name);
+        metadata->compression_ratio_ = compression_ratio_;
+        try {
+            this->reserve_space(metadata.get(), size);
+        } catch (...) {
+            this->new_file_deletion_event(metadata.get());
+            throw;
         }
-
-        content_[dir_path][file_name] = std::make_unique<FileMetadata>(size, this, dir_path, file_name);
-        free_space_ -= size;
+        content_[dir_path][file_name] = std::move(metadata);
     }
 
     /**
@@ -121,7 +736,8 @@ namespace simgrid::fsmod {
         }
 
         this->new_file_deletion_event(metadata_ptr);
-        free_space_ += metadata_ptr->get_current_size();
+        this->resize_stored_content(metadata_ptr, 0);
+        this->get_storage_for_file(metadata_ptr)->on_file_deletion(metadata_ptr->get_id());
         content_.at(dir_path).erase(file_name);
     }
 
@@ -156,15 +772,18 @@ namespace simgrid::fsmod {
             throw FileIsOpenException(XBT_THROW_POINT, "move: " + dst_dir_path + "/" + dst_file_name);
         }
 
-        // Update free space if needed
+        // Update free space if needed, and forget the overwritten file
         if (dst_metadata) {
-            this->increase_free_space(dst_metadata->get_current_size());
+            this->resize_stored_content(dst_metadata, 0);
+            this->new_file_deletion_event(dst_metadata);
+            this->get_storage_for_file(dst_metadata)->on_file_deletion(dst_metadata->get_id());
         }
 
         // Do the move (reusing the original unique ptr, just in case)
         auto uniq_ptr = std::move(content_.at(src_dir_path).at(src_file_name));
         content_.at(src_dir_path).erase(src_file_name);
         this->new_file_deletion_event(src_metadata);
+        uniq_ptr->dir_path_ = dst_dir_path;
         uniq_ptr->file_name_ = dst_file_name;
         uniq_ptr->set_modification_date(s4u::Engine::get_clock());
         content_[dst_dir_path][dst_file_name] = std::move(uniq_ptr);
@@ -196,16 +815,18 @@ namespace simgrid::fsmod {
             throw DirectoryDoesNotExistException(XBT_THROW_POINT, dir_path);
         }
         // Check that no file is open
-        sg_size_t freed_space = 0;
         for (const auto &[filename, metadata]: content_.at(dir_path)) {
             if (metadata->get_file_refcount() != 0) {
                 throw FileIsOpenException(XBT_THROW_POINT, "No content deleted in directory because file " + filename + " is open");
             }
-            freed_space += metadata->get_current_size();
         }
-        // Wipe everything out and update free space!
+        for (const auto &[filename, metadata]: content_.at(dir_path)) {
+            this->new_file_deletion_event(metadata.get());
+            this->resize_stored_content(metadata.get(), 0);
+            this->get_storage_for_file(metadata.get())->on_file_deletion(metadata->get_id());
+        }
+        // Wipe everything out
         content_.erase(dir_path);
-        this->increase_free_space(freed_space);
     }
 
     void Partition::truncate_file(const std::string &dir_path, const std::string &file_name, sg_size_t num_bytes) {
@@ -218,40 +839,276 @@ namespace simgrid::fsmod {
         // Update the real num_bytes to truncate in case it's too large
         num_bytes = std::min<sg_size_t>(num_bytes, metadata->get_current_size());
         auto new_size = metadata->get_current_size() - num_bytes;
+        this->resize_stored_content(metadata, new_size);
         metadata->set_current_size(new_size);
         metadata->set_future_size(new_size);
-        this->increase_free_space(num_bytes);
     }
 
     void Partition::make_file_evictable(const std::string &dir_path, const std::string &file_name,
-                                        bool evictable) const {
+                                        bool evictable) {
         auto metadata = this->get_file_metadata(dir_path, file_name);
         if (not metadata) {
             throw FileNotFoundException(XBT_THROW_POINT, dir_path + "/" + file_name);
         }
+        bool was_pinned = metadata->is_pinned();
         metadata->evictable_ = evictable;
+        if (metadata->is_pinned() != was_pinned)
+            this->new_file_pin_change_event(metadata);
     }
 
+    /**
+     * @brief Make the partition a read-through cache of a directory of an origin file system, as a node-local
+     *        cache in front of a parallel file system. Opening a file that the partition does not hold, but that
+     *        the origin holds under the origin path followed by the file's path on the partition, first fetches the
+     *        file: it is read from the origin and written to the partition, which may evict other files, and is then
+     *        cached like any other (clean) file. Files are only fetched when opened in "r", "r+", or "a" mode, and
+     *        concurrent opens of the same missing file wait for a single fetch. A file that would not fit in the
+     *        partition, even after evicting all the files that can be evicted, is opened on the origin instead
+     * @param origin_file_system: the file system from which missing files are fetched
+     * @param origin_path: the directory of the origin file system from which missing files are fetched
+     */
+    void Partition::set_read_through(std::shared_ptr<FileSystem> origin_file_system, const std::string& origin_path) {
+        if (not origin_file_system)
+            throw std::invalid_argument("The origin file system of a partition cannot be null");
+        auto origin_partition = origin_file_system->get_partition_for_path_or_null(origin_path);
+        if (not origin_partition)
+            throw std::invalid_argument("The origin path of a partition must be on a partition of the origin "
+                                        "file system");
+        if (origin_partition.get() == this)
+            throw std::invalid_argument("A partition cannot fetch its files from itself");
+        origin_file_system_ = std::move(origin_file_system);
+        origin_path_ = PathUtil::simplify_path_string(origin_path);
+    }
 
+    /**
+     * @brief Set the policy that decides which of the files fetched by a read-through partition are cached. A file
+     *        that the policy does not admit is opened on the origin file system instead, which serves it without
+     *        evicting any cached file
+     * @param admission_policy: an admission policy (nullptr to admit all files)
+     */
+    void Partition::set_admission_policy(std::shared_ptr<AdmissionPolicy> admission_policy) {
+        admission_policy_ = std::move(admission_policy);
+        if (admission_policy_)
+            admission_policy_->partition_size_ = size_;
+    }
+
+    /**
+     * @brief Make sure that the partition holds a file that is about to be opened, by fetching it from the origin
+     *        if needed. The file is pinned until the caller unpins it, so that it cannot be evicted before it is
+     *        opened
+     * @param dir_path: the path of the file's directory
+     * @param file_name: the file's name
+     * @param pinned_file: set to the file, which the caller must unpin, or to nullptr if the partition does not
+     *        hold it
+     * @return false if the file should be opened on the origin instead, true otherwise
+     */
+    bool Partition::read_through(const std::string& dir_path, const std::string& file_name,
+                                 FileMetadata*& pinned_file) {
+        pinned_file = nullptr;
+        if (not origin_file_system_)
+            return true;
+        auto path = PathUtil::simplify_path_string(dir_path + "/" + file_name);
+        if (admission_policy_)
+            admission_policy_->on_access(path);
+        if (auto* metadata = this->get_file_metadata(dir_path, file_name)) {
+            num_cache_hits_++;
+            metadata->increase_file_refcount();
+            pinned_file = metadata;
+            return true;
+        }
+
+        // A miss on a file that another actor is fetching waits for that fetch
+        auto it = ongoing_fetches_.find(path);
+        if (it != ongoing_fetches_.end()) {
+            num_cache_misses_++;
+            auto fetch = it->second;
+            fetch->lock();
+            fetch->unlock();
+            if (auto* metadata = this->get_file_metadata(dir_path, file_name)) {
+                metadata->increase_file_refcount();
+                pinned_file = metadata;
+            }
+            return true;
+        }
+        auto origin_path = PathUtil::simplify_path_string(origin_path_ + "/" + path);
+        if (not origin_file_system_->file_exists(origin_path))
+            return true;
+
+        num_cache_misses_++;
+        if (not this->admit(path, origin_file_system_->file_size(origin_path))) {
+            XBT_DEBUG("Serving %s from %s without caching it", path.c_str(), origin_path.c_str());
+            num_rejections_++;
+            return false;
+        }
+        auto fetch = s4u::Mutex::create();
+        fetch->lock();
+        ongoing_fetches_[path] = fetch;
+        try {
+            pinned_file = this->fetch_from_origin(dir_path, file_name, origin_path);
+        } catch (...) {
+            ongoing_fetches_.erase(path);
+            fetch->unlock();
+            throw;
+        }
+        ongoing_fetches_.erase(path);
+        fetch->unlock();
+        return true;
+    }
+
+    bool Partition::admit(const std::string& path, sg_size_t size) {
+        // Files that cannot fit are rejected, as fetching them would fail once the origin has been read
+        auto space_needed = to_physical_size(size, compression_ratio_);
+        std::vector<FileMetadata*> files_to_evict;
+        if (space_needed > free_space_) {
+            auto num_missing_bytes = space_needed - free_space_;
+            if (not eviction_policy_ ||
+                this->select_files_to_evict(num_missing_bytes, files_to_evict, true) < num_missing_bytes)
+                return false;
+        }
+        if (not admission_policy_)
+            return true;
+        // Show the policy the files that caching this one would evict
+        std::vector<const FileMetadata*> victims(files_to_evict.begin(), files_to_evict.end());
+        return admission_policy_->admit(path, size, victims);
+    }
+
+    FileMetadata* Partition::fetch_from_origin(const std::string& dir_path, const std::string& file_name,
+                                               const std::string& origin_path) {
+        auto size = origin_file_system_->file_size(origin_path);
+        XBT_DEBUG("Fetching %s/%s (%llu bytes) from %s", dir_path.c_str(), file_name.c_str(), size,
+                  origin_path.c_str());
+        auto origin_file = origin_file_system_->open(origin_path, "r");
+        try {
+            origin_file->read(size);
+        } catch (...) {
+            origin_file->close();
+            throw;
+        }
+        origin_file->close();
+
+        auto file = file_system_->open(PathUtil::simplify_path_string(name_ + "/" + dir_path + "/" + file_name), "w");
+        try {
+            file->write(size);
+        } catch (...) {
+            file->close();
+            throw;
+        }
+        // Keep the file pinned once closed, until the caller opens it
+        auto* metadata = this->get_file_metadata(dir_path, file_name);
+        metadata->increase_file_refcount();
+        file->close();
+        // The fetched file is the same as the origin's, and thus needs no write-back
+        metadata->dirty_ = false;
+        num_fetches_++;
+        num_fetched_bytes_ += size;
+        return metadata;
+    }
+
+    sg_size_t Partition::select_files_to_evict(sg_size_t num_bytes, std::vector<FileMetadata*>& files_to_evict,
+                                               bool peek) {
+        std::unordered_set<const FileMetadata*> selected_files;
+        sg_size_t space_that_can_be_created = 0;
+        // Peeking leaves the policy as it is, for decisions that evict nothing
+        auto victims = peek ? eviction_policy_->peek_victims(num_bytes) : eviction_policy_->select_victims(num_bytes);
+        for (const auto* victim : victims) {
+            if (space_that_can_be_created >= num_bytes)
+                break;
+            // Never evict a pinned file, or a file that is not (or no longer) on this partition
+            if (victim->is_pinned() || not selected_files.insert(victim).second ||
+                this->get_file_metadata(victim->get_dir_path(), victim->get_file_name()) != victim) {
+                continue;
+            }
+            files_to_evict.push_back(this->get_file_metadata(victim->get_dir_path(), victim->get_file_name()));
+            space_that_can_be_created += this->get_reclaimable_space(victim);
+        }
+        return space_that_can_be_created;
+    }
 
     void Partition::create_space(sg_size_t num_bytes) {
-        throw NotEnoughSpaceException(XBT_THROW_POINT);
+        if (not eviction_policy_)
+            throw NotEnoughSpaceException(XBT_THROW_POINT);
+
+        // Other actors may use the partition while dirty files are written back, hence the retries
+        auto target_free_space = free_space_ + num_bytes;
+        while (free_space_ < target_free_space) {
+            auto num_missing_bytes = target_free_space - free_space_;
+
+            // Only evict files once it is known that they free enough space
+            std::vector<FileMetadata*> files_to_remove_to_create_space;
+            auto space_that_can_be_created =
+                    this->select_files_to_evict(num_missing_bytes, files_to_remove_to_create_space);
+            if (space_that_can_be_created < num_missing_bytes) {
+                throw NotEnoughSpaceException(XBT_THROW_POINT, "Unable to evict files to create enough space");
+            }
+
+            // Evict clean files right away, and pin dirty ones until they are written back
+            std::vector<FileMetadata*> dirty_files;
+            for (auto* victim : files_to_remove_to_create_space) {
+                if (this->needs_write_back(victim)) {
+                    victim->increase_file_refcount();
+                    dirty_files.push_back(victim);
+                    continue;
+                }
+                auto dir_path = victim->get_dir_path();
+                auto file_name = victim->get_file_name();
+                this->delete_file(dir_path, file_name);
+                num_foreground_evictions_++;
+            }
+            if (dirty_files.empty())
+                continue;
+
+            // Only this call's evictions tell whether write-backs make progress, as concurrent writers may use the
+            // space they free
+            auto num_evictions = std::make_shared<unsigned long>(0);
+            if (asynchronous_write_back_ && not weak_from_this().expired()) {
+                std::vector<s4u::ActorPtr> write_back_actors;
+                for (auto* dirty_file : dirty_files)
+                    write_back_actors.push_back(this->start_write_back_and_evict(dirty_file, num_evictions));
+                for (const auto& actor : write_back_actors)
+                    actor->join();
+            } else {
+                for (size_t i = 0; i < dirty_files.size(); i++) {
+                    try {
+                        if (this->write_back_and_evict(dirty_files[i])) {
+                            num_foreground_evictions_++;
+                            (*num_evictions)++;
+                        }
+                    } catch (...) {
+                        // The actor is being killed: unpin the files it has not written back yet
+                        for (size_t j = i + 1; j < dirty_files.size(); j++)
+                            dirty_files[j]->decrease_file_refcount();
+                        throw;
+                    }
+                }
+            }
+            if (*num_evictions == 0) {
+                throw NotEnoughSpaceException(XBT_THROW_POINT, "Unable to write files back to create enough space");
+            }
+        }
     }
 
     void Partition::new_file_creation_event(FileMetadata *file_metadata) {
-        // No-op
+        if (eviction_policy_)
+            eviction_policy_->on_create(file_metadata);
     }
 
     void Partition::new_file_access_event(FileMetadata *file_metadata) {
-        // No-op
+        if (eviction_policy_)
+            eviction_policy_->on_access(file_metadata);
     }
 
     void Partition::new_file_deletion_event(FileMetadata *file_metadata) {
-        // No-op
+        if (eviction_policy_)
+            eviction_policy_->on_delete(file_metadata);
     }
 
+    void Partition::new_file_pin_change_event(FileMetadata *file_metadata) {
+        if (eviction_policy_)
+            eviction_policy_->on_pin_change(file_metadata);
+    }
 
-
-
+    void Partition::new_file_resize_event(FileMetadata * /*file_metadata*/, sg_size_t /*old_size*/) {
+        // Nothing to do by default
+    }
 
 }
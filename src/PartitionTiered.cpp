@@ -0,0 +1,349 @@
+/* Copyright (c) 2024-2026. The FSMOD Team. All rights reserved.          */
+
+/* This program is free software; you can redistribute it and/or modify it
+ * under the terms of the license (GNU LGPL) which comes with this package. */
+
+#include <simgrid/Exception.hpp>
+#include <simgrid/s4u/Actor.hpp>
+#include <simgrid/s4u/Engine.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <tuple>
+#include <vector>
+
+#include "fsmod/PartitionTiered.hpp"
+#include "fsmod/FileSystemException.hpp"
+#include "fsmod/PathUtil.hpp"
+#include "fsmod/Storage.hpp"
+
+XBT_LOG_NEW_DEFAULT_CATEGORY(fsmod_partition_tiered, "File System module: Tiered partition related logs");
+
+namespace simgrid::fsmod {
+
+    /**
+     * @brief Constructor
+     * @param name: partition name
+     * @param file_system: file system that hosts this partition
+     * @param fast_storage: the storage of the fast tier
+     * @param fast_tier_size: the size of the fast tier in bytes
+     * @param capacity_storage: the storage of the capacity tier
+     * @param capacity_tier_size: the size of the capacity tier in bytes
+     */
+    PartitionTiered::PartitionTiered(std::string name, FileSystem *file_system,
+                                     std::shared_ptr<Storage> fast_storage, sg_size_t fast_tier_size,
+                                     std::shared_ptr<Storage> capacity_storage, sg_size_t capacity_tier_size)
+            : Partition(std::move(name), file_system, std::move(fast_storage), fast_tier_size + capacity_tier_size),
+              capacity_storage_(std::move(capacity_storage)),
+              fast_tier_size_(fast_tier_size),
+              capacity_tier_size_(capacity_tier_size) {}
+
+    /**
+     * @brief Retrieve the storage of a tier
+     * @param tier: a tier
+     * @return A storage
+     */
+    std::shared_ptr<Storage> PartitionTiered::get_tier_storage(Tier tier) const {
+        return (tier == Tier::FAST) ? get_storage() : capacity_storage_;
+    }
+
+    /**
+     * @brief Retrieve the size of a tier
+     * @param tier: a tier
+     * @return A number of bytes
+     */
+    sg_size_t PartitionTiered::get_tier_size(Tier tier) const {
+        return (tier == Tier::FAST) ? fast_tier_size_ : capacity_tier_size_;
+    }
+
+    /**
+     * @brief Retrieve the space used by the files stored on a tier, including the ongoing writes to these files.
+     *        A file being migrated is accounted for on its source tier until the migration completes
+     * @param tier: a tier
+     * @return A number of bytes
+     */
+    sg_size_t PartitionTiered::get_tier_used_space(Tier tier) const {
+        return tier_used_space_.at(static_cast<unsigned int>(tier));
+    }
+
+    /**
+     * @brief Retrieve the tier on which a file is stored
+     * @param full_path: the file's absolute path
+     * @return A tier
+     */
+    PartitionTiered::Tier PartitionTiered::get_file_tier(const std::string& full_path) const {
+        return static_cast<Tier>(get_file_metadata_at_path(full_path)->tier_);
+    }
+
+    /**
+     * @brief Retrieve the current heat of a file
+     * @param full_path: the file's absolute path
+     * @return A heat value
+     */
+    double PartitionTiered::get_file_heat(const std::string& full_path) const {
+        return get_heat(get_file_metadata_at_path(full_path));
+    }
+
+    /**
+     * @brief Set the delay after which the heat of a file that is not accessed halves. A short half-life makes
+     *        migrations follow recent accesses, while a long one makes them follow access frequency
+     * @param half_life: a delay in seconds
+     */
+    void PartitionTiered::set_heat_half_life(double half_life) {
+        if (half_life <= 0)
+            throw std::invalid_argument("The heat half-life of a tiered partition must be positive");
+        heat_half_life_ = half_life;
+    }
+
+    /**
+     * @brief Set the heat thresholds that drive migrations. The gap between both thresholds prevents files from
+     *        bouncing between tiers
+     * @param promotion_threshold: the heat from which a file on the capacity tier is promoted to the fast tier
+     * @param demotion_threshold: the heat under which a file on the fast tier is demoted to the capacity tier
+     */
+    void PartitionTiered::set_heat_thresholds(double promotion_threshold, double demotion_threshold) {
+        if (demotion_threshold < 0 || promotion_threshold < demotion_threshold)
+            throw std::invalid_argument("The heat thresholds of a tiered partition must satisfy "
+                                        "0 <= demotion threshold <= promotion threshold");
+        promotion_threshold_ = promotion_threshold;
+        demotion_threshold_ = demotion_threshold;
+    }
+
+    /**
+     * @brief Set the delay between two passes of the migration actor
+     * @param interval: a delay in seconds
+     */
+    void PartitionTiered::set_migration_interval(double interval) {
+        if (interval <= 0)
+            throw std::invalid_argument("The migration interval of a tiered partition must be positive");
+        migration_interval_ = interval;
+    }
+
+    /**
+     * @brief Set the rate at which files are migrated between tiers. Migration traffic competes with foreground
+     *        I/O on both storages, so a lower rate trades slower migrations for less interference
+     * @param rate: a number of bytes per second (0 means as fast as the storages allow)
+     */
+    void PartitionTiered::set_migration_rate(double rate) {
+        if (rate < 0)
+            throw std::invalid_argument("The migration rate of a tiered partition cannot be negative");
+        migration_rate_ = rate;
+    }
+
+    /**
+     * @brief Start the background actor that periodically migrates files between tiers. This happens automatically
+     *        when the partition is mounted, on the controller host of the fast tier's storage, or on the host of its
+     *        first disk if it has no controller
+     * @return The migration actor
+     */
+    s4u::ActorPtr PartitionTiered::start_migrations() {
+        if (migration_actor_)
+            return migration_actor_;
+
+        auto* host = get_storage()->get_controller_host();
+        if (host == nullptr)
+            host = get_storage()->get_first_disk()->get_host();
+        // Do not keep the partition alive because its migration actor still runs
+        std::weak_ptr<PartitionTiered> weak_partition = std::static_pointer_cast<PartitionTiered>(shared_from_this());
+        migration_actor_ = host->add_actor(get_name() + "_migrations", [weak_partition]() {
+            while (true) {
+                double interval;
+                if (auto partition = weak_partition.lock())
+                    interval = partition->migration_interval_;
+                else
+                    return;
+                s4u::this_actor::sleep_for(interval);
+                if (auto partition = weak_partition.lock())
+                    partition->run_migrations();
+                else
+                    return;
+            }
+        });
+        migration_actor_->daemonize();
+        return migration_actor_;
+    }
+
+    /**
+     * @brief Migrate a file to a tier right away, paying for reading it from its current tier and writing it to the
+     *        destination tier. This method must be called from an actor and returns when the migration completes
+     * @param full_path: the file's absolute path
+     * @param tier: the destination tier
+     */
+    void PartitionTiered::migrate_file(const std::string& full_path, Tier tier) {
+        auto* file_metadata = get_file_metadata_at_path(full_path);
+        if (file_metadata->tier_ == static_cast<unsigned int>(tier) ||
+            migrating_files_.find(file_metadata) != migrating_files_.end())
+            return;
+        if (get_tier_used_space(tier) + file_metadata->future_size_ > get_tier_size(tier))
+            throw NotEnoughSpaceException(XBT_THROW_POINT, "Unable to migrate " + full_path);
+        migrate(file_metadata, tier);
+    }
+
+    void PartitionTiered::new_file_creation_event(FileMetadata *file_metadata) {
+        // A moved file keeps its tier
+        if (not file_metadata->tier_assigned_) {
+            auto tier = Tier::FAST;
+            if (get_tier_used_space(Tier::FAST) + file_metadata->future_size_ > fast_tier_size_)
+                tier = Tier::CAPACITY;
+            file_metadata->tier_ = static_cast<unsigned int>(tier);
+            file_metadata->tier_assigned_ = true;
+            file_metadata->heat_date_ = s4u::Engine::get_clock();
+        }
+        if (files_.insert(file_metadata).second)
+            tier_used_space_.at(file_metadata->tier_) += file_metadata->stored_size_;
+    }
+
+    void PartitionTiered::new_file_access_event(FileMetadata *file_metadata) {
+        file_metadata->heat_ = get_heat(file_metadata) + 1.0;
+        file_metadata->heat_date_ = s4u::Engine::get_clock();
+    }
+
+    void PartitionTiered::new_file_deletion_event(FileMetadata *file_metadata) {
+        if (files_.erase(file_metadata) > 0)
+            tier_used_space_.at(file_metadata->tier_) -= file_metadata->stored_size_;
+        // An ongoing migration of this file is abandoned
+        migrating_files_.erase(file_metadata);
+    }
+
+    void PartitionTiered::new_file_resize_event(FileMetadata *file_metadata, sg_size_t old_size) {
+        // Deleted files are emptied after they have left their tier
+        if (files_.find(file_metadata) == files_.end())
+            return;
+        auto& used_space = tier_used_space_.at(file_metadata->tier_);
+        used_space = used_space - old_size + file_metadata->stored_size_;
+    }
+
+    std::shared_ptr<Storage> PartitionTiered::get_storage_for_file(const FileMetadata *file_metadata) const {
+        return get_tier_storage(static_cast<Tier>(file_metadata->tier_));
+    }
+
+    double PartitionTiered::get_heat(const FileMetadata *file_metadata) const {
+        double elapsed = s4u::Engine::get_clock() - file_metadata->heat_date_;
+        return file_metadata->heat_ * std::exp2(-elapsed / heat_half_life_);
+    }
+
+    FileMetadata* PartitionTiered::get_file_metadata_at_path(const std::string& full_path) const {
+        auto simplified_path = PathUtil::simplify_path_string(full_path);
+        if (not PathUtil::is_at_mount_point(simplified_path, get_name()))
+            throw InvalidPathException(XBT_THROW_POINT, "Path is not on partition " + get_name() + " (" + full_path + ")");
+        auto [dir, file_name] = PathUtil::split_path(PathUtil::path_at_mount_point(simplified_path, get_name()));
+        auto* file_metadata = get_file_metadata(dir, file_name);
+        if (not file_metadata)
+            throw FileNotFoundException(XBT_THROW_POINT, full_path);
+        return file_metadata;
+    }
+
+    void PartitionTiered::migrate(FileMetadata *file_metadata, Tier tier) {
+        auto source = get_storage_for_file(file_metadata);
+        auto destination = get_tier_storage(tier);
+        auto size = file_metadata->current_size_;
+        auto file_id = file_metadata->id_;
+        auto dir_path = file_metadata->dir_path_;
+        auto file_name = file_metadata->file_name_;
+        XBT_DEBUG("Migrating %s/%s (%llu bytes) to the %s tier", dir_path.c_str(), file_name.c_str(), size,
+                  (tier == Tier::FAST) ? "fast" : "capacity");
+        migrating_files_.insert(file_metadata);
+
+        // The file may be deleted or moved while the actor is blocked, which abandons the migration. Its metadata
+        // may then have been freed, so the file is looked up again after each blocking call
+        auto is_still_migrating = [this, file_id, &dir_path, &file_name]() {
+            const auto* metadata = get_file_metadata(dir_path, file_name);
+            return metadata != nullptr && metadata->id_ == file_id;
+        };
+
+        double start_date = s4u::Engine::get_clock();
+        // Without rate limit, migrate everything at once. Otherwise, migrate one second worth of data at a time
+        sg_size_t io_size = size;
+        if (migration_rate_ > 0)
+            io_size = std::max<sg_size_t>(1, static_cast<sg_size_t>(migration_rate_));
+
+        sg_size_t num_copied_bytes = 0;
+        try {
+            while (num_copied_bytes < size) {
+                auto num_bytes = std::min(io_size, size - num_copied_bytes);
+                source->submit_read({file_id}, static_cast<sg_offset_t>(num_copied_bytes), num_bytes);
+                if (not is_still_migrating())
+                    return;
+                destination->submit_write({file_id}, static_cast<sg_offset_t>(num_copied_bytes), num_bytes);
+                if (not is_still_migrating())
+                    return;
+                num_copied_bytes += num_bytes;
+                num_migrated_bytes_ += num_bytes;
+                if (migration_rate_ > 0 && num_copied_bytes < size) {
+                    s4u::this_actor::sleep_until(start_date + static_cast<double>(num_copied_bytes) / migration_rate_);
+                    if (not is_still_migrating())
+                        return;
+                }
+            }
+        } catch (...) {
+            if (is_still_migrating())
+                migrating_files_.erase(file_metadata);
+            throw;
+        }
+
+        migrating_files_.erase(file_metadata);
+        tier_used_space_.at(file_metadata->tier_) -= file_metadata->stored_size_;
+        file_metadata->tier_ = static_cast<unsigned int>(tier);
+        tier_used_space_.at(file_metadata->tier_) += file_metadata->stored_size_;
+        // The file has left the storage of its former tier
+        source->on_file_deletion(file_id);
+        if (tier == Tier::FAST)
+            num_promotions_++;
+        else
+            num_demotions_++;
+    }
+
+    void PartitionTiered::run_migrations() {
+        std::vector<std::pair<double, FileMetadata*>> fast_files;
+        std::vector<std::pair<double, FileMetadata*>> capacity_files;
+        for (auto* file_metadata : files_) {
+            if (migrating_files_.find(file_metadata) != migrating_files_.end())
+                continue;
+            if (file_metadata->tier_ == static_cast<unsigned int>(Tier::FAST))
+                fast_files.emplace_back(get_heat(file_metadata), file_metadata);
+            else
+                capacity_files.emplace_back(get_heat(file_metadata), file_metadata);
+        }
+        // Coldest fast-tier files and hottest capacity-tier files first
+        std::sort(fast_files.begin(), fast_files.end());
+        std::sort(capacity_files.begin(), capacity_files.end(), std::greater<>());
+
+        auto fast_used_space = get_tier_used_space(Tier::FAST);
+        auto capacity_used_space = get_tier_used_space(Tier::CAPACITY);
+        std::vector<std::tuple<FileMetadata*, unsigned long, Tier>> migrations;
+        for (const auto& [heat, file_metadata] : fast_files) {
+            // Files grow after their placement, so also demote the coldest files while the fast tier overflows
+            if (heat >= demotion_threshold_ && fast_used_space <= fast_tier_size_)
+                break;
+            auto size = file_metadata->future_size_;
+            if (capacity_used_space + size > capacity_tier_size_)
+                continue;
+            migrations.emplace_back(file_metadata, file_metadata->id_, Tier::CAPACITY);
+            fast_used_space -= size;
+            capacity_used_space += size;
+        }
+        for (const auto& [heat, file_metadata] : capacity_files) {
+            if (heat < promotion_threshold_)
+                break;
+            auto size = file_metadata->future_size_;
+            if (fast_used_space + size > fast_tier_size_)
+                continue;
+            migrations.emplace_back(file_metadata, file_metadata->id_, Tier::FAST);
+            fast_used_space += size;
+            capacity_used_space -= size;
+        }
+
+        for (const auto& [file_metadata, file_id, tier] : migrations) {
+            // The file may have been deleted during a previous migration, and its metadata reused by another file
+            if (files_.find(file_metadata) == files_.end() || file_metadata->id_ != file_id)
+                continue;
+            auto path = file_metadata->dir_path_ + "/" + file_metadata->file_name_;
+            try {
+                migrate(file_metadata, tier);
+            } catch (const simgrid::Exception& e) {
+                XBT_WARN("Cannot migrate %s on partition %s: %s", path.c_str(), get_cname(), e.what());
+            }
+        }
+    }
+
+} // namespace simgrid::fsmod
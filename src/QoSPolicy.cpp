@@ -0,0 +1,90 @@
+/* Copyright (c) 2024-2026. The FSMOD Team. All rights reserved.          */
+
+/* This program is free software; you can redistribute it and/or modify it
+ * under the terms of the license (GNU LGPL) which comes with this package. */
+
+#include "fsmod/QoSPolicy.hpp"
+#include <simgrid/s4u/Engine.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+
+XBT_LOG_NEW_DEFAULT_CATEGORY(fsmod_qos_policy, "File System module: QoS policy related logs");
+
+namespace simgrid::fsmod {
+
+    /**
+     * @brief Create an instance of a QoS policy, which does not throttle I/O and gives it the normal priority class
+     *        until limits and a priority class are set
+     * @return a QoS policy instance
+     */
+    std::shared_ptr<QoSPolicy> QoSPolicy::create() {
+        return std::make_shared<QoSPolicy>();
+    }
+
+    /**
+     * @brief Cap the bandwidth of the requests the policy applies to
+     * @param bandwidth: a number of bytes per second (0 to remove the limit)
+     * @param burst_size: the number of bytes that can be transferred at once after a period of inactivity
+     */
+    void QoSPolicy::set_bandwidth_limit(double bandwidth, sg_size_t burst_size) {
+        if (bandwidth < 0)
+            throw std::invalid_argument("The bandwidth limit of a QoS policy cannot be negative");
+        if (bandwidth > 0 && burst_size == 0)
+            throw std::invalid_argument("The burst size of a QoS policy must be positive");
+        bandwidth_bucket_ = {bandwidth, static_cast<double>(burst_size), static_cast<double>(burst_size),
+                             s4u::Engine::get_clock()};
+    }
+
+    /**
+     * @brief Cap the number of requests per second the policy applies to
+     * @param iops: a number of requests per second (0 to remove the limit)
+     * @param burst_operations: the number of requests that can be made at once after a period of inactivity
+     *        (default: 1)
+     */
+    void QoSPolicy::set_iops_limit(double iops, unsigned long burst_operations) {
+        if (iops < 0)
+            throw std::invalid_argument("The IOPS limit of a QoS policy cannot be negative");
+        if (iops > 0 && burst_operations == 0)
+            throw std::invalid_argument("The number of burst operations of a QoS policy must be positive");
+        iops_bucket_ = {iops, static_cast<double>(burst_operations), static_cast<double>(burst_operations),
+                        s4u::Engine::get_clock()};
+    }
+
+    /**
+     * @brief Retrieve the sharing weight of the I/O activities of a priority class
+     * @param priority_class: a priority class
+     * @return A weight, which is 1 for the normal class
+     */
+    double QoSPolicy::get_priority_weight(PriorityClass priority_class) {
+        switch (priority_class) {
+            case PriorityClass::LOW:
+                return 0.5;
+            case PriorityClass::HIGH:
+                return 2.0;
+            default:
+                return 1.0;
+        }
+    }
+
+    double QoSPolicy::TokenBucket::take(double amount) {
+        if (rate == 0)
+            return 0;
+        double now = s4u::Engine::get_clock();
+        tokens = std::min(capacity, tokens + (now - last_update_date) * rate);
+        last_update_date = now;
+        tokens -= amount;
+        return tokens < 0 ? -tokens / rate : 0;
+    }
+
+    double QoSPolicy::admit(sg_size_t num_bytes) {
+        num_requests_++;
+        double delay = std::max(bandwidth_bucket_.take(static_cast<double>(num_bytes)), iops_bucket_.take(1));
+        if (delay > 0) {
+            XBT_DEBUG("Throttling a request of %llu bytes for %g seconds", num_bytes, delay);
+            num_throttled_requests_++;
+            total_throttling_delay_ += delay;
+        }
+        return delay;
+    }
+}
@@ -0,0 +1,172 @@
+/* Copyright (c) 2024-2026. The FSMOD Team. All rights reserved.          */
+
+/* This program is free software; you can redistribute it and/or modify it
+ * under the terms of the license (GNU LGPL) which comes with this package. */
+
+#include "fsmod/ReplicatedStorage.hpp"
+#include <simgrid/s4u/Actor.hpp>
+#include <simgrid/s4u/Link.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <set>
+
+XBT_LOG_NEW_DEFAULT_CATEGORY(fsmod_replicated_storage, "File System module: Replicated storage related logs");
+
+namespace simgrid::fsmod {
+
+    /**
+     * @brief Create an instance of a replicated storage
+     * @param name: the storage's name
+     * @param disks: the disks that can hold replicas, which must be attached to different hosts
+     * @param replication_factor: the number of replicas of each file
+     * @param replication_mode: how writes reach the replicas (default: ReplicatedStorage::ReplicationMode::PIPELINE)
+     * @return a replicated storage instance
+     */
+    std::shared_ptr<ReplicatedStorage> ReplicatedStorage::create(const std::string& name,
+                                                                 const std::vector<s4u::Disk*>& disks,
+                                                                 unsigned long replication_factor,
+                                                                 ReplicationMode replication_mode) {
+        return std::make_shared<ReplicatedStorage>(name, disks, replication_factor, replication_mode);
+    }
+
+    ReplicatedStorage::ReplicatedStorage(const std::string& name, const std::vector<s4u::Disk*>& disks,
+                                         unsigned long replication_factor, ReplicationMode replication_mode)
+        : Storage(name), replication_factor_(replication_factor), replication_mode_(replication_mode) {
+        if (std::any_of(disks.begin(), disks.end(), [](const auto* disk) { return disk == nullptr; }))
+            throw std::invalid_argument("The disks of a replicated storage cannot be null");
+        std::set<s4u::Host*> hosts;
+        for (const auto* disk : disks)
+            hosts.insert(disk->get_host());
+        if (hosts.size() != disks.size())
+            throw std::invalid_argument("The disks of a replicated storage must be attached to different hosts");
+        if (replication_factor == 0 || replication_factor > disks.size())
+            throw std::invalid_argument("The replication factor of a replicated storage must be between 1 and its "
+                                        "number of disks (" + std::to_string(disks.size()) + ")");
+        set_disks(disks);
+        disk_num_bytes_read_.resize(disks.size(), 0);
+    }
+
+    /**
+     * @brief Retrieve the ratio between the number of bytes written to disks and the number of bytes written by
+     *        clients
+     * @return A write amplification factor (0 if nothing was written)
+     */
+    double ReplicatedStorage::get_write_amplification() const {
+        return (num_bytes_written_ == 0) ? 0.0 : static_cast<double>(num_replica_bytes_written_) /
+                                                 static_cast<double>(num_bytes_written_);
+    }
+
+    /**
+     * @brief Retrieve the number of bytes read from a disk so far, which shows where reads are served
+     * @param disk_index: the index of the disk in the list of disks
+     * @return A number of bytes
+     */
+    sg_size_t ReplicatedStorage::get_disk_num_bytes_read(unsigned long disk_index) const {
+        return disk_num_bytes_read_.at(disk_index);
+    }
+
+    /**
+     * @brief Estimate the time needed to read data from a disk to a host, using the latency of the route between
+     *        the disk's host and that host, and the lowest bandwidth among the disk and the links of that route.
+     *        Contention is not taken into account
+     * @param disk: a disk
+     * @param client_host: the host that reads the data
+     * @param size: a number of bytes
+     * @return A time in seconds
+     */
+    double ReplicatedStorage::estimate_read_cost(s4u::Disk* disk, s4u::Host* client_host, sg_size_t size) const {
+        double latency = 0;
+        double bandwidth = disk->get_read_bandwidth();
+        if (disk->get_host() != client_host) {
+            std::vector<s4u::Link*> links;
+            disk->get_host()->route_to(client_host, links, &latency);
+            for (const auto* link : links)
+                bandwidth = std::min(bandwidth, link->get_bandwidth());
+        }
+        return latency + static_cast<double>(size) / bandwidth;
+    }
+
+    std::vector<unsigned long> ReplicatedStorage::get_file_replicas(unsigned long file_id, s4u::Host* client_host) {
+        if (auto it = replicas_.find(file_id); it != replicas_.end())
+            return it->second;
+
+        // Like HDFS, place the first replica on the writer's host if possible, and the others on the next disks
+        std::vector<unsigned long> replicas;
+        auto disks = get_disks();
+        for (unsigned long i = 0; i < disks.size(); i++) {
+            if (disks.at(i)->get_host() == client_host)
+                replicas.push_back(i);
+        }
+        unsigned long first_replica = (file_id == 0) ? 0 : next_first_replica_;
+        for (unsigned long i = 0; replicas.size() < replication_factor_; i++) {
+            auto disk_index = (first_replica + i) % disks.size();
+            if (std::find(replicas.begin(), replicas.end(), disk_index) == replicas.end())
+                replicas.push_back(disk_index);
+        }
+        // Accesses that do not come from a file are not remembered
+        if (file_id != 0) {
+            next_first_replica_ = (next_first_replica_ + 1) % disks.size();
+            replicas_[file_id] = replicas;
+        }
+        return replicas;
+    }
+
+    s4u::IoPtr ReplicatedStorage::read_async(const IOContext& context, sg_offset_t /*offset*/, sg_size_t size) {
+        auto* client_host = context.get_client_host();
+        auto replicas = get_file_replicas(context.file_id, client_host);
+
+        // Read from the replica with the lowest estimated cost, favoring the first replicas in case of a tie
+        auto best_replica = replicas.front();
+        double best_cost = std::numeric_limits<double>::infinity();
+        for (auto disk_index : replicas) {
+            double cost = estimate_read_cost(get_disk_at(disk_index), client_host, size);
+            if (cost < best_cost) {
+                best_cost = cost;
+                best_replica = disk_index;
+            }
+        }
+        auto* disk = get_disk_at(best_replica);
+        XBT_DEBUG("Reading %llu bytes from %s (estimated cost: %g s)", size, disk->get_cname(), best_cost);
+        disk_num_bytes_read_[best_replica] += size;
+        if (disk->get_host() == client_host)
+            return disk->read_async(size);
+        return s4u::Io::streamto_async(disk->get_host(), disk, client_host, nullptr, size);
+    }
+
+    void ReplicatedStorage::read(const IOContext& context, sg_offset_t offset, sg_size_t size) {
+        wait_for_completion(read_async(context, offset, size));
+    }
+
+    s4u::IoPtr ReplicatedStorage::write_async(const IOContext& context, sg_offset_t /*offset*/, sg_size_t size,
+                                              bool detached) {
+        auto* client_host = context.get_client_host();
+        auto replicas = get_file_replicas(context.file_id, client_host);
+        num_bytes_written_ += size;
+        num_replica_bytes_written_ += size * replicas.size();
+
+        s4u::IoPtr completion_activity = s4u::Io::init()->set_op_type(s4u::Io::OpType::WRITE)->set_size(0);
+        completion_activity->set_name("Replicated Storage Write Completion");
+        // In pipeline mode, each replica receives data from the previous one in the chain
+        auto* source_host = client_host;
+        for (auto disk_index : replicas) {
+            auto* disk = get_disk_at(disk_index);
+            s4u::IoPtr io;
+            if (disk->get_host() == source_host)
+                io = disk->write_async(size);
+            else
+                io = s4u::Io::streamto_async(source_host, nullptr, disk->get_host(), disk, size);
+            io->add_successor(completion_activity);
+            if (replication_mode_ == ReplicationMode::PIPELINE)
+                source_host = disk->get_host();
+        }
+        completion_activity->set_disk(get_disk_at(replicas.front()));
+        if (detached)
+            completion_activity->detach();
+        return completion_activity;
+    }
+
+    void ReplicatedStorage::write(const IOContext& context, sg_offset_t offset, sg_size_t size) {
+        wait_for_completion(write_async(context, offset, size));
+    }
+}
@@ -0,0 +1,176 @@
+/* Copyright (c) 2024-2026. The FSMOD Team. All rights reserved.          */
+
+/* This program is free software; you can redistribute it and/or modify it
+ * under the terms of the license (GNU LGPL) which comes with this package. */
+
+#include "fsmod/SSDStorage.hpp"
+#include <simgrid/Exception.hpp>
+#include <simgrid/s4u/Actor.hpp>
+#include <simgrid/s4u/Engine.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+XBT_LOG_NEW_DEFAULT_CATEGORY(fsmod_ssd_storage, "File System module: SSD storage related logs");
+
+namespace simgrid::fsmod {
+
+    /**
+     * @brief Create an instance of an SSD storage
+     * @param name: the storage's name
+     * @param disk: the storage's disk
+     * @param max_iops: the maximum number of operations per second the drive can serve
+     * @param operation_latency: the time in seconds each operation waits before its data is transferred (default: 0)
+     * @return an SSD storage instance
+     */
+    std::shared_ptr<SSDStorage> SSDStorage::create(const std::string& name, s4u::Disk* disk, double max_iops,
+                                                   double operation_latency) {
+        return std::make_shared<SSDStorage>(name, disk, max_iops, operation_latency);
+    }
+
+    SSDStorage::SSDStorage(const std::string& name, s4u::Disk* disk, double max_iops, double operation_latency)
+        : Storage(name), max_iops_(max_iops), operation_latency_(operation_latency) {
+        if (disk == nullptr)
+            throw std::invalid_argument("The disk of an SSD storage cannot be null");
+        if (max_iops <= 0)
+            throw std::invalid_argument("The maximum number of IOPS of an SSD storage must be positive");
+        if (operation_latency < 0)
+            throw std::invalid_argument("The operation latency of an SSD storage cannot be negative");
+        set_disk(disk);
+    }
+
+    /**
+     * @brief Set the fraction of the drive's capacity that is hidden from the partitions, and that its garbage
+     *        collection can always use as free space
+     * @param over_provisioning: a ratio between 0 and 1 (default: 0.07)
+     */
+    void SSDStorage::set_over_provisioning(double over_provisioning) {
+        if (over_provisioning < 0 || over_provisioning >= 1)
+            throw std::invalid_argument("The over-provisioning ratio of an SSD storage must be in [0, 1)");
+        over_provisioning_ = over_provisioning;
+    }
+
+    /**
+     * @brief Retrieve the current write amplification, i.e., the number of bytes the drive physically writes for
+     *        each byte written to it. It follows the usual greedy garbage-collection approximation
+     *        (1 + s) / (2s), where s is the spare fraction of the drive: the free space of the partitions mounted
+     *        on the storage plus the over-provisioning
+     * @return A number that is at least 1
+     */
+    double SSDStorage::get_write_amplification() const {
+        double spare = (1.0 - get_fill_level()) + over_provisioning_;
+        if (spare <= 0)
+            return 1.0;
+        return std::max(1.0, (1.0 + spare) / (2.0 * spare));
+    }
+
+    /**
+     * @brief Configure the garbage-collection stalls of the drive. When the free space of the partitions mounted on
+     *        the storage falls below a threshold, the drive stalls every time a given number of bytes has been
+     *        physically written, and operations that arrive during a stall wait for it to end
+     * @param free_space_threshold: the fraction of free space below which stalls happen (0 to disable them)
+     * @param period: the number of physically written bytes between two stalls
+     * @param stall_duration: the duration of a stall in seconds
+     */
+    void SSDStorage::set_garbage_collection(double free_space_threshold, sg_size_t period, double stall_duration) {
+        if (free_space_threshold < 0 || free_space_threshold > 1)
+            throw std::invalid_argument("The garbage-collection free space threshold of an SSD storage must be "
+                                        "in [0, 1]");
+        if (free_space_threshold > 0 && period == 0)
+            throw std::invalid_argument("The garbage-collection period of an SSD storage must be positive");
+        if (stall_duration < 0)
+            throw std::invalid_argument("The garbage-collection stall duration of an SSD storage cannot be negative");
+        gc_free_space_threshold_ = free_space_threshold;
+        gc_period_ = period;
+        gc_stall_duration_ = stall_duration;
+        num_bytes_since_gc_ = 0;
+    }
+
+    sg_size_t SSDStorage::get_physical_size(s4u::Io::OpType op_type, sg_size_t size) const {
+        if (op_type == s4u::Io::OpType::READ)
+            return size;
+        return static_cast<sg_size_t>(std::llround(static_cast<double>(size) * get_write_amplification()));
+    }
+
+    s4u::IoPtr SSDStorage::create_io(s4u::Io::OpType op_type, sg_size_t physical_size) {
+        auto* disk = get_first_disk();
+        // Each operation also occupies the drive for 1/max_iops seconds, which is charged as the number of bytes
+        // the drive would have transferred during that time, so that concurrent operations share the IOPS budget
+        double bandwidth = op_type == s4u::Io::OpType::READ ? disk->get_read_bandwidth() : disk->get_write_bandwidth();
+        auto overhead = static_cast<sg_size_t>(std::ceil(bandwidth / max_iops_));
+        XBT_DEBUG("Operation of %llu physical bytes plus %llu bytes of per-operation overhead", physical_size, overhead);
+        return s4u::IoPtr(disk->io_init(physical_size + overhead, op_type));
+    }
+
+    void SSDStorage::account_for_write(sg_size_t size, sg_size_t physical_size) {
+        num_bytes_written_ += size;
+        num_physical_bytes_written_ += physical_size;
+        if (gc_free_space_threshold_ <= 0 || 1.0 - get_fill_level() >= gc_free_space_threshold_)
+            return;
+        num_bytes_since_gc_ += physical_size;
+        if (num_bytes_since_gc_ < gc_period_)
+            return;
+        num_bytes_since_gc_ = 0;
+        double now = s4u::Engine::get_clock();
+        stall_end_date_ = std::max(stall_end_date_, now) + gc_stall_duration_;
+        num_gc_stalls_++;
+        total_stall_time_ += gc_stall_duration_;
+        XBT_DEBUG("Stalling %s for garbage collection until %g", get_cname(), stall_end_date_);
+    }
+
+    void SSDStorage::wait_for_garbage_collection() const {
+        // A stall can be extended while waiting for it to end
+        while (stall_end_date_ > s4u::Engine::get_clock())
+            s4u::this_actor::sleep_until(stall_end_date_);
+    }
+
+    void SSDStorage::perform(s4u::Io::OpType op_type, sg_size_t size) {
+        wait_for_garbage_collection();
+        if (operation_latency_ > 0)
+            s4u::this_actor::sleep_for(operation_latency_);
+        auto physical_size = get_physical_size(op_type, size);
+        create_io(op_type, physical_size)->start()->wait();
+        if (op_type == s4u::Io::OpType::WRITE)
+            account_for_write(size, physical_size);
+    }
+
+    s4u::IoPtr SSDStorage::start(s4u::Io::OpType op_type, sg_size_t size, bool detached) {
+        auto storage = shared_from_this();
+        if (operation_latency_ <= 0 && stall_end_date_ <= s4u::Engine::get_clock()) {
+            // Nothing to wait for, the operation can start right away
+            auto physical_size = get_physical_size(op_type, size);
+            auto io = create_io(op_type, physical_size);
+            if (op_type == s4u::Io::OpType::WRITE)
+                io->on_this_completion_cb([storage, size, physical_size](s4u::Io const&) {
+                    storage->account_for_write(size, physical_size);
+                });
+            if (detached)
+                io->detach();
+            else
+                io->start();
+            return io;
+        }
+
+        // Latencies and stalls are waited for over time, which requires an actor
+        return start_in_background(get_first_disk()->get_host(), op_type, get_name() + "_operation",
+                                   [storage, op_type, size]() { storage->perform(op_type, size); }, detached);
+    }
+
+    s4u::IoPtr SSDStorage::read_async(const IOContext& /*context*/, sg_offset_t /*offset*/, sg_size_t size) {
+        return start(s4u::Io::OpType::READ, size, false);
+    }
+
+    void SSDStorage::read(const IOContext& /*context*/, sg_offset_t /*offset*/, sg_size_t size) {
+        perform(s4u::Io::OpType::READ, size);
+    }
+
+    s4u::IoPtr SSDStorage::write_async(const IOContext& /*context*/, sg_offset_t /*offset*/, sg_size_t size,
+                                       bool detached) {
+        return start(s4u::Io::OpType::WRITE, size, detached);
+    }
+
+    void SSDStorage::write(const IOContext& /*context*/, sg_offset_t /*offset*/, sg_size_t size) {
+        perform(s4u::Io::OpType::WRITE, size);
+    }
+}
@@ -4,10 +4,26 @@
  * under the terms of the license (GNU LGPL) which comes with this package. */
 
 #include "fsmod/OneDiskStorage.hpp"
+#include <simgrid/Exception.hpp>
+#include <simgrid/s4u/ActivitySet.hpp>
 #include <simgrid/s4u/Actor.hpp>
+#include <simgrid/s4u/Engine.hpp>
+#include <simgrid/s4u/Semaphore.hpp>
+
+#include <map>
+#include <tuple>
+
+XBT_LOG_NEW_DEFAULT_CATEGORY(fsmod_storage, "File System module: Storage related logs");
 
 namespace simgrid::fsmod {
 
+    namespace {
+        // The user data of the completion activities of background operations that failed. An activity cannot be
+        // failed directly, so these ones are canceled instead, and carry this marker to tell them from the
+        // activities that are canceled on purpose
+        char failure_marker;
+    } // namespace
+
     /**
      * @brief Retrieve the storage's name
      * @return a name string
@@ -85,4 +101,230 @@ namespace simgrid::fsmod {
         return controller_;
     }
 
-}
\ No newline at end of file
+    /**
+     * @brief Start a controller actor on a host that queues the I/O requests made to the storage, and dispatches
+     *        them in the order decided by an I/O scheduler, with at most a given number of requests in progress at
+     *        any time. This models contention at the storage controller.
+     * @param host: A host
+     * @param scheduler: An I/O scheduler
+     * @param max_concurrent_requests: The maximum number of requests the storage serves at the same time
+     * @return An actor
+     */
+    s4u::ActorPtr Storage::start_controller(s4u::Host* host, std::shared_ptr<IOScheduler> scheduler,
+                                            unsigned long max_concurrent_requests) {
+        if (not scheduler)
+            throw std::invalid_argument("Storage::start_controller(): an I/O scheduler is required");
+        if (max_concurrent_requests == 0)
+            throw std::invalid_argument("Storage::start_controller(): at least one request must be served at a time");
+        io_scheduler_ = std::move(scheduler);
+        max_concurrent_requests_ = max_concurrent_requests;
+        request_arrivals_ = s4u::Semaphore::create(0);
+        auto controller = start_controller(host, [this]() { dispatch_requests(); });
+        // The controller waits for requests forever, which should not prevent the simulation from ending
+        controller->daemonize();
+        return controller;
+    }
+
+    /**
+     * @brief Retrieve the space in use on the partitions mounted on the storage
+     * @return A number of bytes
+     */
+    sg_size_t Storage::get_used_space() const {
+        sg_size_t used_space = 0;
+        for (const auto* partition : partitions_)
+            used_space += partition->get_size() - partition->get_free_space();
+        return used_space;
+    }
+
+    /**
+     * @brief Retrieve the fraction of the space of the partitions mounted on the storage that is in use
+     * @return A number between 0 and 1 (0 if no partition is mounted on the storage)
+     */
+    double Storage::get_fill_level() const {
+        sg_size_t size = 0;
+        for (const auto* partition : partitions_)
+            size += partition->get_size();
+        return size == 0 ? 0.0 : static_cast<double>(get_used_space()) / static_cast<double>(size);
+    }
+
+    /**
+     * @brief Create the activity that completes with an operation performed in the background, which the caller
+     *        can wait for as for any I/O. It is blocked by a gate, that is, a no-op activity that is only started
+     *        (with gate->set_disk()) once the operation is done. If the operation fails, fail_completion() must be
+     *        called instead
+     * @param op_type: the type of the operation
+     * @param name: a name for the completion activity
+     * @return The completion activity and its gate
+     */
+    std::pair<s4u::IoPtr, s4u::IoPtr> Storage::init_completion(s4u::Io::OpType op_type,
+                                                               const std::string& name) const {
+        s4u::IoPtr completion = s4u::Io::init()->set_op_type(op_type)->set_size(0);
+        completion->set_name(name);
+        s4u::IoPtr gate = s4u::Io::init()->set_op_type(op_type)->set_size(0);
+        gate->add_successor(completion);
+        completion->set_disk(get_first_disk());
+        return {completion, gate};
+    }
+
+    /**
+     * @brief Notify the caller waiting for a completion activity that its operation failed. The activity is
+     *        canceled, which wait_for_completion() reports as a StorageFailureException
+     * @param completion: an activity created by init_completion()
+     */
+    void Storage::fail_completion(const s4u::IoPtr& completion) {
+        completion->set_data(&failure_marker);
+        completion->cancel();
+    }
+
+    /**
+     * @brief Wait for an I/O activity, and raise a StorageFailureException if it is the completion of an
+     *        operation that failed in the background, rather than the CancelException raised by the activity.
+     *        Waiting for such an activity directly only raises the CancelException
+     * @param completion: an activity returned by an asynchronous read or write
+     */
+    void Storage::wait_for_completion(const s4u::IoPtr& completion) {
+        try {
+            completion->wait();
+        } catch (const CancelException&) {
+            if (completion->get_data<char>() != &failure_marker)
+                throw;
+            throw StorageFailureException(XBT_THROW_POINT, "I/O operation failed");
+        }
+    }
+
+    /**
+     * @brief Perform an operation with an actor, which is needed when it waits for delays or for several
+     *        activities, and return an activity that completes with it
+     * @param host: the host on which the actor runs
+     * @param op_type: the type of the operation
+     * @param name: a name for the actor
+     * @param work: the operation, which raises an exception if it fails
+     * @param detached: whether the returned activity should be detached
+     * @return The completion activity of the operation
+     */
+    s4u::IoPtr Storage::start_in_background(s4u::Host* host, s4u::Io::OpType op_type, const std::string& name,
+                                            const std::function<void()>& work, bool detached) const {
+        auto [completion, gate] = init_completion(op_type, name + " completion");
+        auto* disk = get_first_disk();
+        host->add_actor(name, [work, disk, completion = completion, gate = gate]() {
+            try {
+                work();
+            } catch (const simgrid::Exception& e) {
+                XBT_DEBUG("Background operation failed: %s", e.what());
+                fail_completion(completion);
+                return;
+            }
+            gate->set_disk(disk);
+        });
+        if (detached)
+            completion->detach();
+        return completion;
+    }
+
+    s4u::IoPtr Storage::submit_read_async(const IOContext& context, sg_offset_t offset, sg_size_t size) {
+        if (io_scheduler_)
+            return enqueue_request(s4u::Io::OpType::READ, context, offset, size);
+        return read_async(context, offset, size);
+    }
+
+    void Storage::submit_read(const IOContext& context, sg_offset_t offset, sg_size_t size) {
+        if (io_scheduler_)
+            wait_for_completion(enqueue_request(s4u::Io::OpType::READ, context, offset, size));
+        else
+            read(context, offset, size);
+    }
+
+    s4u::IoPtr Storage::submit_write_async(const IOContext& context, sg_offset_t offset, sg_size_t size,
+                                           bool detached) {
+        if (not io_scheduler_)
+            return write_async(context, offset, size, detached);
+        auto completion_activity = enqueue_request(s4u::Io::OpType::WRITE, context, offset, size);
+        if (detached)
+            completion_activity->detach();
+        return completion_activity;
+    }
+
+    void Storage::submit_write(const IOContext& context, sg_offset_t offset, sg_size_t size) {
+        if (io_scheduler_)
+            wait_for_completion(enqueue_request(s4u::Io::OpType::WRITE, context, offset, size));
+        else
+            write(context, offset, size);
+    }
+
+    s4u::IoPtr Storage::enqueue_request(s4u::Io::OpType op_type, const IOContext& context, sg_offset_t offset,
+                                        sg_size_t size) {
+        auto request = std::make_shared<IORequest>();
+        request->op_type = op_type;
+        request->file_id = context.file_id;
+        request->offset = offset;
+        request->size = size;
+        request->client = s4u::this_actor::get_pid();
+        request->client_host = context.get_client_host();
+        request->arrival_date = s4u::Engine::get_clock();
+
+        // Create a no-op Activity that completes with the request. This is the one ActivityPtr returned to the
+        // caller. It cannot start before the request is dispatched
+        std::tie(request->completion, request->dispatch_gate) = init_completion(op_type, name_ + " Request Completion");
+        request->dispatch_gate->set_name(name_ + " Request Dispatch");
+
+        io_scheduler_->push(request);
+        request_arrivals_->release();
+        return request->completion;
+    }
+
+    void Storage::dispatch_requests() {
+        s4u::ActivitySet pending_activities;
+        std::map<s4u::Activity*, std::shared_ptr<IORequest>> running_requests;
+        s4u::ActivityPtr next_arrival = request_arrivals_->acquire_async();
+        pending_activities.push(next_arrival);
+
+        while (true) {
+            // Wait for a new request or for the completion of a running one
+            s4u::ActivityPtr activity;
+            bool failed = false;
+            try {
+                activity = pending_activities.wait_any();
+            } catch (const simgrid::Exception& e) {
+                activity = pending_activities.get_failed_activity();
+                XBT_WARN("Activity of %s failed: %s", get_cname(), e.what());
+                failed = true;
+            }
+            if (activity == next_arrival) {
+                // A failed acquisition took no token, so the pending requests remain to be acquired
+                next_arrival = request_arrivals_->acquire_async();
+                pending_activities.push(next_arrival);
+            } else if (auto it = running_requests.find(activity.get()); it != running_requests.end()) {
+                if (failed)
+                    fail_completion(it->second->completion);
+                running_requests.erase(it);
+                num_running_requests_--;
+            }
+
+            // Dispatch as many queued requests as allowed
+            while (num_running_requests_ < max_concurrent_requests_ && not io_scheduler_->empty()) {
+                auto request = io_scheduler_->pop();
+                XBT_DEBUG("Dispatching a %llu-byte request from actor %ld", request->size, request->client);
+                // Data is transferred to/from the client, not the controller
+                IOContext context{request->file_id, request->client_host};
+                s4u::IoPtr io;
+                try {
+                    if (request->op_type == s4u::Io::OpType::READ)
+                        io = read_async(context, request->offset, request->size);
+                    else
+                        io = write_async(context, request->offset, request->size);
+                } catch (const simgrid::Exception& e) {
+                    XBT_WARN("Cannot serve I/O request on %s: %s", get_cname(), e.what());
+                    fail_completion(request->completion);
+                    continue;
+                }
+                io->add_successor(request->completion);
+                // Let the completion activity start once the I/O completes
+                request->dispatch_gate->set_disk(get_first_disk());
+                pending_activities.push(io);
+                running_requests[io.get()] = request;
+                num_running_requests_++;
+            }
+        }
+    }
+
+}
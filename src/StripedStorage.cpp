@@ -0,0 +1,159 @@
+/* Copyright (c) 2024-2026. The FSMOD Team. All rights reserved.          */
+
+/* This program is free software; you can redistribute it and/or modify it
+ * under the terms of the license (GNU LGPL) which comes with this package. */
+
+#include "fsmod/StripedStorage.hpp"
+#include <simgrid/s4u/Actor.hpp>
+
+#include <algorithm>
+#include <map>
+
+XBT_LOG_NEW_DEFAULT_CATEGORY(fsmod_striped_storage, "File System module: Striped storage related logs");
+
+namespace simgrid::fsmod {
+
+    /**
+     * @brief Create an instance of a striped storage
+     * @param name: the storage's name
+     * @param targets: the storages over which files are striped (e.g., remote storages on different hosts)
+     * @param stripe_count: the default number of targets over which a file is striped (default: 1)
+     * @param stripe_size: the default stripe size in bytes (default: 1MiB)
+     * @return a striped storage instance
+     */
+    std::shared_ptr<StripedStorage> StripedStorage::create(const std::string& name,
+                                                           const std::vector<std::shared_ptr<Storage>>& targets,
+                                                           unsigned long stripe_count, sg_size_t stripe_size) {
+        return std::make_shared<StripedStorage>(name, targets, stripe_count, stripe_size);
+    }
+
+    StripedStorage::StripedStorage(const std::string& name, const std::vector<std::shared_ptr<Storage>>& targets,
+                                   unsigned long stripe_count, sg_size_t stripe_size)
+        : Storage(name), targets_(targets), stripe_count_(stripe_count), stripe_size_(stripe_size) {
+        if (targets_.empty())
+            throw std::invalid_argument("A striped storage requires at least one target");
+        if (std::any_of(targets_.begin(), targets_.end(), [](const auto& target) { return not target; }))
+            throw std::invalid_argument("The targets of a striped storage cannot be null");
+        check_layout(stripe_count, stripe_size);
+        target_num_bytes_.resize(targets_.size(), 0);
+
+        std::vector<s4u::Disk*> disks;
+        for (const auto& target : targets_)
+            for (auto* disk : target->get_disks())
+                disks.push_back(disk);
+        set_disks(disks);
+    }
+
+    /**
+     * @brief Set the stripe count and stripe size of the files whose layout is not given at creation time
+     * @param stripe_count: a number of targets
+     * @param stripe_size: a number of bytes
+     */
+    void StripedStorage::set_default_layout(unsigned long stripe_count, sg_size_t stripe_size) {
+        check_layout(stripe_count, stripe_size);
+        stripe_count_ = stripe_count;
+        stripe_size_ = stripe_size;
+    }
+
+    /**
+     * @brief Retrieve the number of bytes read from or written to a target so far, which shows how evenly the load
+     *        is spread over the targets
+     * @param target_index: the index of the target in the list of targets
+     * @return A number of bytes
+     */
+    sg_size_t StripedStorage::get_target_num_bytes(unsigned long target_index) const {
+        return target_num_bytes_.at(target_index);
+    }
+
+    void StripedStorage::check_layout(unsigned long stripe_count, sg_size_t stripe_size) const {
+        if (stripe_count == 0 || stripe_count > targets_.size())
+            throw std::invalid_argument("The stripe count of a striped storage must be between 1 and its number of "
+                                        "targets (" + std::to_string(targets_.size()) + ")");
+        if (stripe_size == 0)
+            throw std::invalid_argument("The stripe size of a striped storage must be positive");
+    }
+
+    void StripedStorage::set_file_layout(unsigned long file_id, unsigned long stripe_count, sg_size_t stripe_size) {
+        check_layout(stripe_count, stripe_size);
+        // Like Lustre's round-robin allocator, successive files start on successive groups of targets
+        layouts_[file_id] = {stripe_count, stripe_size, next_first_target_};
+        next_first_target_ = (next_first_target_ + stripe_count) % targets_.size();
+    }
+
+    StripedStorage::Layout StripedStorage::get_file_layout(unsigned long file_id) {
+        // Accesses that do not come from a file use the default layout
+        if (file_id == 0)
+            return {stripe_count_, stripe_size_, 0};
+        // Files whose layout was not given at creation time get the default layout on their first access
+        if (layouts_.find(file_id) == layouts_.end())
+            set_file_layout(file_id, stripe_count_, stripe_size_);
+        return layouts_.at(file_id);
+    }
+
+    s4u::IoPtr StripedStorage::submit_to_targets(s4u::Io::OpType op_type, const IOContext& context, sg_offset_t offset,
+                                                 sg_size_t size) {
+        auto layout = get_file_layout(context.file_id);
+        // Data is transferred between the client and the targets
+        IOContext target_context{context.file_id, context.get_client_host()};
+
+        // Compute the offset in the target's object of the first byte requested from each target, and the number
+        // of bytes requested from that target. The stripes of a contiguous request are contiguous on each target
+        std::map<unsigned long, std::pair<sg_offset_t, sg_size_t>> target_requests;
+        auto position = static_cast<sg_size_t>(offset);
+        auto end = position + size;
+        while (position < end) {
+            auto stripe = position / layout.stripe_size;
+            auto offset_in_stripe = position % layout.stripe_size;
+            auto num_bytes = std::min(layout.stripe_size - offset_in_stripe, end - position);
+            auto target_index = (layout.first_target + stripe % layout.stripe_count) % targets_.size();
+            auto object_offset = static_cast<sg_offset_t>((stripe / layout.stripe_count) * layout.stripe_size +
+                                                          offset_in_stripe);
+            auto [it, inserted] = target_requests.try_emplace(target_index, object_offset, 0);
+            it->second.second += num_bytes;
+            position += num_bytes;
+        }
+
+        s4u::IoPtr completion_activity = s4u::Io::init()->set_op_type(op_type)->set_size(0);
+        completion_activity->set_name("Striped Storage Completion");
+        // All targets serve their part of the request concurrently
+        for (const auto& [target_index, request] : target_requests) {
+            const auto& target = targets_.at(target_index);
+            XBT_DEBUG("Requesting %llu bytes from target %s", request.second, target->get_cname());
+            s4u::IoPtr io;
+            if (op_type == s4u::Io::OpType::READ)
+                io = target->submit_read_async(target_context, request.first, request.second);
+            else
+                io = target->submit_write_async(target_context, request.first, request.second);
+            io->add_successor(completion_activity);
+            target_num_bytes_[target_index] += request.second;
+        }
+        completion_activity->set_disk(get_first_disk());
+        return completion_activity;
+    }
+
+    s4u::IoPtr StripedStorage::read_async(const IOContext& context, sg_offset_t offset, sg_size_t size) {
+        return submit_to_targets(s4u::Io::OpType::READ, context, offset, size);
+    }
+
+    void StripedStorage::read(const IOContext& context, sg_offset_t offset, sg_size_t size) {
+        wait_for_completion(read_async(context, offset, size));
+    }
+
+    s4u::IoPtr StripedStorage::write_async(const IOContext& context, sg_offset_t offset, sg_size_t size,
+                                           bool detached) {
+        auto completion_activity = submit_to_targets(s4u::Io::OpType::WRITE, context, offset, size);
+        if (detached)
+            completion_activity->detach();
+        return completion_activity;
+    }
+
+    void StripedStorage::write(const IOContext& context, sg_offset_t offset, sg_size_t size) {
+        wait_for_completion(write_async(context, offset, size));
+    }
+
+    void StripedStorage::on_file_deletion(unsigned long file_id) {
+        layouts_.erase(file_id);
+        for (const auto& target : targets_)
+            target->on_file_deletion(file_id);
+    }
+}
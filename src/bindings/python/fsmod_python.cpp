@@ -9,36 +9,72 @@
 #include <pybind11/stl.h>
 #include <pybind11/stl_bind.h>
 
+#include <fsmod/AdmissionPolicy.hpp>
+#include <fsmod/CachedStorage.hpp>
+#include <fsmod/ClientCache.hpp>
+#include <fsmod/EvictionPolicy.hpp>
 #include <fsmod/File.hpp>
 #include <fsmod/FileMetadata.hpp>
 #include <fsmod/FileStat.hpp>
 #include <fsmod/FileSystem.hpp>
 #include <fsmod/FileSystemException.hpp>
+#include <fsmod/IOScheduler.hpp>
+#include <fsmod/MetadataService.hpp>
+#include <fsmod/HDDStorage.hpp>
 #include <fsmod/JBODStorage.hpp>
+#include <fsmod/ObjectStorage.hpp>
 #include <fsmod/OneDiskStorage.hpp>
 #include <fsmod/OneRemoteDiskStorage.hpp>
 #include <fsmod/Partition.hpp>
-#include <fsmod/PartitionFIFOCaching.hpp>
-#include <fsmod/PartitionLRUCaching.hpp>
+#include <fsmod/PartitionTiered.hpp>
 #include <fsmod/PathUtil.hpp>
+#include <fsmod/QoSPolicy.hpp>
+#include <fsmod/ReplicatedStorage.hpp>
+#include <fsmod/SSDStorage.hpp>
 #include <fsmod/Storage.hpp>
+#include <fsmod/StripedStorage.hpp>
 #include <fsmod/version.hpp>
 
 #include <xbt/log.h>
 
 namespace py = pybind11;
+using simgrid::fsmod::AdmissionPolicy;
+using simgrid::fsmod::ARCEvictionPolicy;
+using simgrid::fsmod::CachedStorage;
+using simgrid::fsmod::ClientCache;
+using simgrid::fsmod::EvictionPolicy;
+using simgrid::fsmod::FIFOEvictionPolicy;
+using simgrid::fsmod::GDSFEvictionPolicy;
 using simgrid::fsmod::File;
 using simgrid::fsmod::FileMetadata;
 using simgrid::fsmod::FileStat;
 using simgrid::fsmod::FileSystem;
+using simgrid::fsmod::DeadlineIOScheduler;
+using simgrid::fsmod::FairShareIOScheduler;
+using simgrid::fsmod::FIFOIOScheduler;
+using simgrid::fsmod::HDDStorage;
+using simgrid::fsmod::IOScheduler;
 using simgrid::fsmod::JBODStorage;
+using simgrid::fsmod::LFUEvictionPolicy;
+using simgrid::fsmod::LRUEvictionPolicy;
+using simgrid::fsmod::MaxSizeAdmissionPolicy;
+using simgrid::fsmod::ObjectStorage;
 using simgrid::fsmod::OneDiskStorage;
 using simgrid::fsmod::OneRemoteDiskStorage;
+using simgrid::fsmod::MetadataService;
 using simgrid::fsmod::Partition;
-using simgrid::fsmod::PartitionFIFOCaching;
-using simgrid::fsmod::PartitionLRUCaching;
+using simgrid::fsmod::PartitionTiered;
 using simgrid::fsmod::PathUtil;
+using simgrid::fsmod::QoSPolicy;
+using simgrid::fsmod::ReplicatedStorage;
+using simgrid::fsmod::S3FIFOEvictionPolicy;
+using simgrid::fsmod::SecondHitAdmissionPolicy;
+using simgrid::fsmod::SSDStorage;
+using simgrid::fsmod::ShortestJobFirstIOScheduler;
+using simgrid::fsmod::StripedStorage;
 using simgrid::fsmod::Storage;
+using simgrid::fsmod::TinyLFUAdmissionPolicy;
+using simgrid::fsmod::TwoQEvictionPolicy;
 
 XBT_LOG_NEW_DEFAULT_CATEGORY(python, "python");
 
@@ -51,6 +87,45 @@ std::string get_fsmod_version()
   fsmod_version_get(&major, &minor, &patch);
   return simgrid::xbt::string_printf("%i.%i.%i", major, minor, patch);
 }
+
+// Lets Python classes derive from EvictionPolicy
+class PyEvictionPolicy : public EvictionPolicy {
+public:
+  void on_create(const FileMetadata* file_metadata) override
+  {
+    PYBIND11_OVERRIDE_PURE(void, EvictionPolicy, on_create, file_metadata);
+  }
+  void on_access(const FileMetadata* file_metadata) override
+  {
+    PYBIND11_OVERRIDE_PURE(void, EvictionPolicy, on_access, file_metadata);
+  }
+  void on_delete(const FileMetadata* file_metadata) override
+  {
+    PYBIND11_OVERRIDE_PURE(void, EvictionPolicy, on_delete, file_metadata);
+  }
+  void on_pin_change(const FileMetadata* file_metadata) override
+  {
+    PYBIND11_OVERRIDE(void, EvictionPolicy, on_pin_change, file_metadata);
+  }
+  std::vector<const FileMetadata*> select_victims(sg_size_t num_bytes) override
+  {
+    PYBIND11_OVERRIDE_PURE(std::vector<const FileMetadata*>, EvictionPolicy, select_victims, num_bytes);
+  }
+  std::vector<const FileMetadata*> peek_victims(sg_size_t num_bytes) override
+  {
+    PYBIND11_OVERRIDE(std::vector<const FileMetadata*>, EvictionPolicy, peek_victims, num_bytes);
+  }
+};
+
+// Lets Python classes derive from AdmissionPolicy
+class PyAdmissionPolicy : public AdmissionPolicy {
+public:
+  void on_access(const std::string& path) override { PYBIND11_OVERRIDE(void, AdmissionPolicy, on_access, path); }
+  bool admit(const std::string& path, sg_size_t size, const std::vector<const FileMetadata*>& victims) override
+  {
+    PYBIND11_OVERRIDE_PURE(bool, AdmissionPolicy, admit, path, size, victims);
+  }
+};
 }
 
 PYBIND11_DECLARE_HOLDER_TYPE(T, boost::intrusive_ptr<T>)
@@ -83,6 +158,9 @@ PYBIND11_MODULE(fsmod, m)
                   "The total number of bytes written to the File")
       .def_property_readonly("file_system", &File::get_file_system, "The FileSystem this File belongs to (read-only)")
       .def_property_readonly("tell", &File::tell, "The current position of the File (read-only)")
+      .def_property_readonly("qos_tag", &File::get_qos_tag, "The QoS tag of the File (read-only)")
+      .def("set_qos_tag", &File::set_qos_tag, py::arg("tag"),
+           "Set the tag that selects the QoSPolicy applied to the reads and writes made through the File")
       .def("read_async", py::overload_cast<const std::string&>(&File::read_async), py::arg("num_bytes"),
            "Asynchronously read data from the File")
       .def("read_async", py::overload_cast<sg_size_t>(&File::read_async), py::arg("num_bytes"),
@@ -111,6 +189,197 @@ PYBIND11_MODULE(fsmod, m)
       .def_readwrite("last_modification_date", &FileStat::last_modification_date, "The file's last modification date")
       .def_readwrite("refcount", &FileStat::refcount, "The number of times the file is currently opened");
 
+  /* Class ClientCache */
+  py::class_<ClientCache, std::shared_ptr<ClientCache>>(
+      m, "ClientCache", "A ClientCache represents an NFS-like cache of remote file data on a client host")
+      .def_static("create", &ClientCache::create, py::arg("host"), py::arg("cache_size"),
+                  py::arg("block_size") = 65536, py::arg("cache_disk") = nullptr, "Create a new ClientCache")
+      .def_property_readonly("host", &ClientCache::get_host, "The client host of the ClientCache (read-only)")
+      .def_property_readonly("cache_disk", &ClientCache::get_cache_disk,
+                             "The disk that holds the cached blocks, or None if they are in memory (read-only)")
+      .def_property_readonly("cache_size", &ClientCache::get_cache_size, "The size of the cache in bytes (read-only)")
+      .def_property_readonly("block_size", &ClientCache::get_block_size, "The size of a block in bytes (read-only)")
+      .def_property_readonly("attribute_cache_timeout", &ClientCache::get_attribute_cache_timeout,
+                             "The time during which the attributes of an open file are trusted (read-only)")
+      .def("set_attribute_cache_timeout", &ClientCache::set_attribute_cache_timeout, py::arg("timeout"),
+           "Set the time during which the attributes of an open file are trusted")
+      .def_property_readonly("num_cached_blocks", &ClientCache::get_num_cached_blocks,
+                             "The number of blocks in the cache (read-only)")
+      .def_property_readonly("num_read_hits", &ClientCache::get_num_read_hits,
+                             "The number of read blocks that were found in the cache (read-only)")
+      .def_property_readonly("num_read_misses", &ClientCache::get_num_read_misses,
+                             "The number of read blocks that were not found in the cache (read-only)")
+      .def_property_readonly("num_revalidations", &ClientCache::get_num_revalidations,
+                             "The number of times file attributes were checked with the server (read-only)")
+      .def_property_readonly("num_invalidations", &ClientCache::get_num_invalidations,
+                             "The number of times the cached blocks of a modified file were dropped (read-only)");
+
+  /* Class QoSPolicy */
+  py::class_<QoSPolicy, std::shared_ptr<QoSPolicy>> qos_policy(
+      m, "QoSPolicy", "A QoSPolicy throttles and prioritizes the reads and writes made through files");
+  py::enum_<QoSPolicy::PriorityClass>(qos_policy, "PriorityClass",
+                                      "An enum that defines the priority classes of I/O activities")
+      .value("LOW", QoSPolicy::PriorityClass::LOW, "Half the share of a normal activity")
+      .value("NORMAL", QoSPolicy::PriorityClass::NORMAL, "The default share")
+      .value("HIGH", QoSPolicy::PriorityClass::HIGH, "Twice the share of a normal activity");
+  qos_policy.def_static("create", &QoSPolicy::create, "Create a new QoSPolicy")
+      .def("set_bandwidth_limit", &QoSPolicy::set_bandwidth_limit, py::arg("bandwidth"), py::arg("burst_size"),
+           "Cap the bandwidth of the requests the QoSPolicy applies to (0 to remove the limit)")
+      .def_property_readonly("bandwidth_limit", &QoSPolicy::get_bandwidth_limit,
+                             "The bandwidth limit in bytes per second, or 0 if there is none (read-only)")
+      .def_property_readonly("burst_size", &QoSPolicy::get_burst_size,
+                             "The number of bytes that can be transferred at once (read-only)")
+      .def("set_iops_limit", &QoSPolicy::set_iops_limit, py::arg("iops"), py::arg("burst_operations") = 1,
+           "Cap the number of requests per second the QoSPolicy applies to (0 to remove the limit)")
+      .def_property_readonly("iops_limit", &QoSPolicy::get_iops_limit,
+                             "The number of requests per second, or 0 if there is no limit (read-only)")
+      .def_property_readonly("burst_operations", &QoSPolicy::get_burst_operations,
+                             "The number of requests that can be made at once (read-only)")
+      .def_property_readonly("priority_class", &QoSPolicy::get_priority_class,
+                             "The priority class of the I/O activities (read-only)")
+      .def("set_priority_class", &QoSPolicy::set_priority_class, py::arg("priority_class"),
+           "Set the priority class of the I/O activities")
+      .def_static("get_priority_weight", &QoSPolicy::get_priority_weight, py::arg("priority_class"),
+                  "Get the sharing weight of the I/O activities of a priority class")
+      .def_property_readonly("num_requests", &QoSPolicy::get_num_requests,
+                             "The number of requests the QoSPolicy applied to (read-only)")
+      .def_property_readonly("num_throttled_requests", &QoSPolicy::get_num_throttled_requests,
+                             "The number of requests that had to wait (read-only)")
+      .def_property_readonly("total_throttling_delay", &QoSPolicy::get_total_throttling_delay,
+                             "The total time requests had to wait (read-only)");
+
+  /* Class MetadataService */
+  py::class_<MetadataService, std::shared_ptr<MetadataService>> metadata_service(
+      m, "MetadataService", "A MetadataService represents a metadata server that serves metadata operations");
+  py::enum_<MetadataService::Operation>(metadata_service, "Operation",
+                                        "An enum that defines the metadata operations served by a MetadataService")
+      .value("CREATE", MetadataService::Operation::CREATE, "File creation")
+      .value("OPEN", MetadataService::Operation::OPEN, "Opening of an existing file")
+      .value("UNLINK", MetadataService::Operation::UNLINK, "File deletion")
+      .value("MOVE", MetadataService::Operation::MOVE, "File move")
+      .value("LIST", MetadataService::Operation::LIST, "Directory listing");
+  metadata_service
+      .def_static("create", &MetadataService::create, py::arg("host"), py::arg("max_concurrent_operations") = 1,
+                  "Create a new MetadataService")
+      .def_property_readonly("host", &MetadataService::get_host, "The host of the metadata server (read-only)")
+      .def_property_readonly("max_concurrent_operations", &MetadataService::get_max_concurrent_operations,
+                             "The maximum number of operations served at the same time (read-only)")
+      .def("set_latency", py::overload_cast<double>(&MetadataService::set_latency), py::arg("latency"),
+           "Set the time the server spends on every metadata operation")
+      .def("set_latency", py::overload_cast<MetadataService::Operation, double>(&MetadataService::set_latency),
+           py::arg("operation"), py::arg("latency"), "Set the time the server spends on a metadata operation")
+      .def("get_latency", &MetadataService::get_latency, py::arg("operation"),
+           "Get the time the server spends on a metadata operation")
+      .def("get_num_operations", py::overload_cast<MetadataService::Operation>(&MetadataService::get_num_operations,
+                                                                               py::const_),
+           py::arg("operation"), "Get the number of operations of a given kind served so far")
+      .def("get_num_operations", py::overload_cast<>(&MetadataService::get_num_operations, py::const_),
+           "Get the number of operations served so far")
+      .def_property_readonly("num_running_operations", &MetadataService::get_num_running_operations,
+                             "The number of operations being served (read-only)")
+      .def_property_readonly("num_waiting_operations", &MetadataService::get_num_waiting_operations,
+                             "The number of operations waiting for a service slot (read-only)")
+      .def_property_readonly("total_waiting_time", &MetadataService::get_total_waiting_time,
+                             "The total time operations waited for a service slot (read-only)");
+
+  /* Class FileMetadata */
+  py::class_<FileMetadata, std::unique_ptr<FileMetadata, py::nodelete>>(
+      m, "FileMetadata", "The metadata of a file stored on a Partition, as seen by an EvictionPolicy")
+      .def_property_readonly("id", &FileMetadata::get_id, "The unique identifier of the file (read-only)")
+      .def_property_readonly("dir_path", &FileMetadata::get_dir_path,
+                             "The path of the file's directory in its Partition (read-only)")
+      .def_property_readonly("file_name", &FileMetadata::get_file_name, "The name of the file (read-only)")
+      .def_property_readonly("size", &FileMetadata::get_current_size, "The size of the file in bytes (read-only)")
+      .def_property_readonly("creation_date", &FileMetadata::get_creation_date,
+                             "The date at which the file was created (read-only)")
+      .def_property_readonly("access_date", &FileMetadata::get_access_date,
+                             "The date at which the file was last accessed (read-only)")
+      .def_property_readonly("modification_date", &FileMetadata::get_modification_date,
+                             "The date at which the file was last modified (read-only)")
+      .def_property_readonly("refcount", &FileMetadata::get_file_refcount,
+                             "The number of times the file is open (read-only)")
+      .def_property_readonly("evictable", &FileMetadata::is_evictable, "Whether the file is evictable (read-only)")
+      .def_property_readonly("pinned", &FileMetadata::is_pinned,
+                             "Whether the file is open or not evictable, and thus cannot be evicted (read-only)")
+      .def_property_readonly("reclaimable_space", &FileMetadata::get_reclaimable_space,
+                             "The space that deleting the file would free on its Partition (read-only)")
+      .def_property_readonly("dirty", &FileMetadata::is_dirty,
+                             "Whether the file holds data that was not written back (read-only)");
+
+  /* Classes EvictionPolicy */
+  py::class_<EvictionPolicy, PyEvictionPolicy, std::shared_ptr<EvictionPolicy>>(
+      m, "EvictionPolicy", "An EvictionPolicy decides which files a Partition evicts when it runs out of space")
+      .def(py::init<>())
+      .def_property_readonly("partition_size", &EvictionPolicy::get_partition_size,
+                             "The size of the Partition the policy was mounted with (read-only)")
+      .def("on_create", &EvictionPolicy::on_create, py::arg("file_metadata"),
+           "Notify the policy that a file has been created on, or moved to, the Partition")
+      .def("on_access", &EvictionPolicy::on_access, py::arg("file_metadata"),
+           "Notify the policy that a file has been accessed")
+      .def("on_delete", &EvictionPolicy::on_delete, py::arg("file_metadata"),
+           "Notify the policy that a file has been deleted from, or moved out of, the Partition")
+      .def("on_pin_change", &EvictionPolicy::on_pin_change, py::arg("file_metadata"),
+           "Notify the policy that a file has become pinned or unpinned")
+      .def("select_victims", &EvictionPolicy::select_victims, py::arg("num_bytes"),
+           "Select unpinned files, in eviction order, that free at least a number of bytes")
+      .def("peek_victims", &EvictionPolicy::peek_victims, py::arg("num_bytes"),
+           "Retrieve the files that select_victims would select, without changing the policy's state");
+  py::class_<FIFOEvictionPolicy, EvictionPolicy, std::shared_ptr<FIFOEvictionPolicy>>(
+      m, "FIFOEvictionPolicy", "An EvictionPolicy that evicts files in First-In-First-Out order")
+      .def(py::init<>());
+  py::class_<LRUEvictionPolicy, FIFOEvictionPolicy, std::shared_ptr<LRUEvictionPolicy>>(
+      m, "LRUEvictionPolicy", "An EvictionPolicy that evicts files in Least-Recently-Used order")
+      .def(py::init<>());
+  py::class_<ARCEvictionPolicy, EvictionPolicy, std::shared_ptr<ARCEvictionPolicy>>(
+      m, "ARCEvictionPolicy", "An EvictionPolicy that implements Adaptive Replacement Caching (ARC)")
+      .def(py::init<>())
+      .def_property_readonly("recency_target", &ARCEvictionPolicy::get_recency_target,
+                             "The number of bytes targeted for files seen only once (read-only)");
+  py::class_<TwoQEvictionPolicy, EvictionPolicy, std::shared_ptr<TwoQEvictionPolicy>>(
+      m, "TwoQEvictionPolicy", "An EvictionPolicy that implements the 2Q algorithm")
+      .def(py::init<double, double>(), py::arg("in_fraction") = 0.25, py::arg("out_fraction") = 0.5)
+      .def_property_readonly("in_fraction", &TwoQEvictionPolicy::get_in_fraction,
+                             "The fraction of the Partition targeted by the queue of new files (read-only)")
+      .def_property_readonly("out_fraction", &TwoQEvictionPolicy::get_out_fraction,
+                             "The fraction of the Partition's size remembered by the ghost queue (read-only)");
+  py::class_<LFUEvictionPolicy, EvictionPolicy, std::shared_ptr<LFUEvictionPolicy>>(
+      m, "LFUEvictionPolicy", "An EvictionPolicy that evicts files in Least-Frequently-Used order, with dynamic aging")
+      .def(py::init<>())
+      .def_property_readonly("age", &LFUEvictionPolicy::get_age,
+                             "The age of the cache, i.e., the priority of the latest evicted file (read-only)");
+  py::class_<GDSFEvictionPolicy, LFUEvictionPolicy, std::shared_ptr<GDSFEvictionPolicy>>(
+      m, "GDSFEvictionPolicy", "An EvictionPolicy that implements Greedy-Dual-Size-Frequency (GDSF)")
+      .def(py::init<>());
+  py::class_<S3FIFOEvictionPolicy, EvictionPolicy, std::shared_ptr<S3FIFOEvictionPolicy>>(
+      m, "S3FIFOEvictionPolicy", "An EvictionPolicy that implements S3-FIFO")
+      .def(py::init<double>(), py::arg("small_fraction") = 0.1)
+      .def_property_readonly("small_fraction", &S3FIFOEvictionPolicy::get_small_fraction,
+                             "The fraction of the Partition targeted by the small queue of new files (read-only)");
+
+  /* Classes AdmissionPolicy */
+  py::class_<AdmissionPolicy, PyAdmissionPolicy, std::shared_ptr<AdmissionPolicy>>(
+      m, "AdmissionPolicy", "An AdmissionPolicy decides which files a read-through Partition caches")
+      .def(py::init<>())
+      .def_property_readonly("partition_size", &AdmissionPolicy::get_partition_size,
+                             "The size of the Partition the policy was set on (read-only)")
+      .def("on_access", &AdmissionPolicy::on_access, py::arg("path"),
+           "Notify the policy that a file has been accessed, whether the Partition holds it or not")
+      .def("admit", &AdmissionPolicy::admit, py::arg("path"), py::arg("size"), py::arg("victims"),
+           "Decide whether a file should be cached, given the files that caching it would evict");
+  py::class_<MaxSizeAdmissionPolicy, AdmissionPolicy, std::shared_ptr<MaxSizeAdmissionPolicy>>(
+      m, "MaxSizeAdmissionPolicy", "An AdmissionPolicy that only admits files up to a maximum size")
+      .def(py::init<sg_size_t>(), py::arg("max_size"))
+      .def_property_readonly("max_size", &MaxSizeAdmissionPolicy::get_max_size,
+                             "The size of the largest files the policy admits (read-only)");
+  py::class_<SecondHitAdmissionPolicy, AdmissionPolicy, std::shared_ptr<SecondHitAdmissionPolicy>>(
+      m, "SecondHitAdmissionPolicy", "An AdmissionPolicy that only admits a file on its second miss")
+      .def(py::init<>());
+  py::class_<TinyLFUAdmissionPolicy, AdmissionPolicy, std::shared_ptr<TinyLFUAdmissionPolicy>>(
+      m, "TinyLFUAdmissionPolicy", "An AdmissionPolicy that implements TinyLFU")
+      .def(py::init<size_t>(), py::arg("num_counters") = 4096)
+      .def("get_estimated_frequency", &TinyLFUAdmissionPolicy::get_estimated_frequency, py::arg("path"),
+           "Estimate the number of recent accesses to a file");
+
   /* Class Partition */
   py::class_<Partition, std::shared_ptr<Partition>> partition(
       m, "Partition", "A Partition represents a partition mounted on a FileSystem");
@@ -119,13 +388,159 @@ PYBIND11_MODULE(fsmod, m)
       .def_property_readonly("free_space", &Partition::get_free_space,
                              "The free space available on the Partition (read-only)")
       .def_property_readonly("num_files", &Partition::get_num_files,
-                             "The number of files stored on the Partition (read-only)");
+                             "The number of files stored on the Partition (read-only)")
+      .def_property_readonly("eviction_policy", &Partition::get_eviction_policy,
+                             "The EvictionPolicy of the Partition, if any (read-only)")
+      .def_property_readonly("metadata_service", &Partition::get_metadata_service,
+                             "The MetadataService of the Partition, if any (read-only)")
+      .def("set_metadata_service", &Partition::set_metadata_service, py::arg("metadata_service"),
+           "Set the MetadataService that serves the metadata operations on the Partition")
+      .def_property_readonly("directory_lock_hold_time", &Partition::get_directory_lock_hold_time,
+                             "The time during which a metadata mutation holds the lock of a directory (read-only)")
+      .def("set_directory_lock_hold_time", &Partition::set_directory_lock_hold_time, py::arg("hold_time"),
+           "Set the time during which a metadata mutation holds the lock of the directories it modifies")
+      .def_property_readonly("compression_ratio", &Partition::get_compression_ratio,
+                             "The compression ratio of the files created on the Partition (read-only)")
+      .def_property_readonly("compression_flops_per_byte", &Partition::get_compression_flops_per_byte,
+                             "The number of flops needed to compress a byte of data (read-only)")
+      .def_property_readonly("decompression_flops_per_byte", &Partition::get_decompression_flops_per_byte,
+                             "The number of flops needed to decompress a byte of data (read-only)")
+      .def("set_compression", &Partition::set_compression, py::arg("ratio"),
+           py::arg("compression_flops_per_byte") = 0, py::arg("decompression_flops_per_byte") = 0,
+           "Enable transparent compression on the Partition")
+      .def_property_readonly("deduplication_chunk_size", &Partition::get_deduplication_chunk_size,
+                             "The size of the deduplicated chunks, or 0 if deduplication is disabled (read-only)")
+      .def_property_readonly("hashing_flops_per_byte", &Partition::get_hashing_flops_per_byte,
+                             "The number of flops needed to fingerprint a byte of written data (read-only)")
+      .def_property_readonly("num_unique_chunks", &Partition::get_num_unique_chunks,
+                             "The number of unique chunks stored on the Partition (read-only)")
+      .def_property_readonly("deduplication_ratio", &Partition::get_deduplication_ratio,
+                             "The ratio between the referenced and the stored chunk bytes (read-only)")
+      .def("set_deduplication", &Partition::set_deduplication, py::arg("chunk_size"),
+           py::arg("hashing_flops_per_byte") = 0, "Enable block-level deduplication on an empty Partition")
+      .def_property_readonly("high_watermark", &Partition::get_high_watermark,
+                             "The fraction of the size above which background eviction starts (read-only)")
+      .def_property_readonly("low_watermark", &Partition::get_low_watermark,
+                             "The fraction of the size at which background eviction stops (read-only)")
+      .def("set_eviction_watermarks", &Partition::set_eviction_watermarks, py::arg("high_watermark"),
+           py::arg("low_watermark"), "Set the watermarks that drive the background eviction of files")
+      .def_property_readonly("num_foreground_evictions", &Partition::get_num_foreground_evictions,
+                             "The number of files evicted by writers that ran out of space (read-only)")
+      .def_property_readonly("num_background_evictions", &Partition::get_num_background_evictions,
+                             "The number of files evicted by the background eviction actor (read-only)")
+      .def("set_write_back", &Partition::set_write_back, py::arg("backing_file_system"), py::arg("backing_path"),
+           py::arg("asynchronous") = false, "Make the Partition write dirty files back before evicting them")
+      .def_property_readonly("backing_file_system", &Partition::get_backing_file_system,
+                             "The FileSystem to which dirty files are written back, if any (read-only)")
+      .def_property_readonly("backing_path", &Partition::get_backing_path,
+                             "The directory in which dirty files are written back (read-only)")
+      .def_property_readonly("write_back_asynchronous", &Partition::is_write_back_asynchronous,
+                             "Whether the write-backs of the files evicted at once happen concurrently (read-only)")
+      .def_property_readonly("num_write_backs", &Partition::get_num_write_backs,
+                             "The number of files written back (read-only)")
+      .def_property_readonly("num_written_back_bytes", &Partition::get_num_written_back_bytes,
+                             "The number of bytes written back (read-only)")
+      .def("set_read_through", &Partition::set_read_through, py::arg("origin_file_system"), py::arg("origin_path"),
+           "Make the Partition fetch the files it does not hold from an origin FileSystem when they are opened")
+      .def_property_readonly("origin_file_system", &Partition::get_origin_file_system,
+                             "The FileSystem from which missing files are fetched, if any (read-only)")
+      .def_property_readonly("origin_path", &Partition::get_origin_path,
+                             "The directory from which missing files are fetched (read-only)")
+      .def_property_readonly("num_cache_hits", &Partition::get_num_cache_hits,
+                             "The number of opens of files that the Partition held (read-only)")
+      .def_property_readonly("num_cache_misses", &Partition::get_num_cache_misses,
+                             "The number of opens of files that had to be fetched from the origin (read-only)")
+      .def_property_readonly("num_fetches", &Partition::get_num_fetches,
+                             "The number of files fetched from the origin (read-only)")
+      .def_property_readonly("num_fetched_bytes", &Partition::get_num_fetched_bytes,
+                             "The number of bytes fetched from the origin (read-only)")
+      .def("set_admission_policy", &Partition::set_admission_policy, py::arg("admission_policy"),
+           "Set the AdmissionPolicy that decides which of the files fetched from the origin are cached")
+      .def_property_readonly("admission_policy", &Partition::get_admission_policy,
+                             "The AdmissionPolicy of the Partition, if any (read-only)")
+      .def_property_readonly("num_rejections", &Partition::get_num_rejections,
+                             "The number of files served by the origin without being cached (read-only)");
+  py::class_<Partition::DirectoryLockStatistics>(partition, "DirectoryLockStatistics",
+                                                 "Statistics about the lock of a directory")
+      .def_readonly("num_mutations", &Partition::DirectoryLockStatistics::num_mutations,
+                    "The number of mutations that held the lock")
+      .def_readonly("num_waits", &Partition::DirectoryLockStatistics::num_waits,
+                    "The number of mutations that found the lock held by another mutation")
+      .def_readonly("total_wait_time", &Partition::DirectoryLockStatistics::total_wait_time,
+                    "The total time mutations waited for the lock")
+      .def_readonly("max_wait_time", &Partition::DirectoryLockStatistics::max_wait_time,
+                    "The longest time a mutation waited for the lock");
   py::enum_<Partition::CachingScheme>(partition, "CachingScheme",
                                       "An enum that defines the possible caching schemes for a Partition")
       .value("NONE", Partition::CachingScheme::NONE, "No caching")
       .value("FIFO", Partition::CachingScheme::FIFO, "FIFO caching behavior")
       .value("LRU", Partition::CachingScheme::LRU, "LRU caching behavior");
 
+  /* Class PartitionTiered */
+  py::class_<PartitionTiered, Partition, std::shared_ptr<PartitionTiered>> partition_tiered(
+      m, "PartitionTiered",
+      "A PartitionTiered is a Partition that stores hot files on a fast tier and cold files on a capacity tier");
+  partition_tiered
+      .def("get_tier_storage", &PartitionTiered::get_tier_storage, py::arg("tier"), "Get the Storage of a tier")
+      .def("get_tier_size", &PartitionTiered::get_tier_size, py::arg("tier"), "Get the size of a tier in bytes")
+      .def("get_tier_used_space", &PartitionTiered::get_tier_used_space, py::arg("tier"),
+           "Get the space used by the files stored on a tier in bytes")
+      .def("get_file_tier", &PartitionTiered::get_file_tier, py::arg("full_path"),
+           "Get the tier on which a file is stored")
+      .def("get_file_heat", &PartitionTiered::get_file_heat, py::arg("full_path"), "Get the current heat of a file")
+      .def_property_readonly("heat_half_life", &PartitionTiered::get_heat_half_life,
+                             "The delay after which the heat of a file that is not accessed halves (read-only)")
+      .def("set_heat_half_life", &PartitionTiered::set_heat_half_life, py::arg("half_life"),
+           "Set the delay after which the heat of a file that is not accessed halves")
+      .def_property_readonly("promotion_threshold", &PartitionTiered::get_promotion_threshold,
+                             "The heat from which a file is promoted to the fast tier (read-only)")
+      .def_property_readonly("demotion_threshold", &PartitionTiered::get_demotion_threshold,
+                             "The heat under which a file is demoted to the capacity tier (read-only)")
+      .def("set_heat_thresholds", &PartitionTiered::set_heat_thresholds, py::arg("promotion_threshold"),
+           py::arg("demotion_threshold"), "Set the heat thresholds that drive migrations")
+      .def_property_readonly("migration_interval", &PartitionTiered::get_migration_interval,
+                             "The delay between two passes of the migration actor (read-only)")
+      .def("set_migration_interval", &PartitionTiered::set_migration_interval, py::arg("interval"),
+           "Set the delay between two passes of the migration actor")
+      .def_property_readonly("migration_rate", &PartitionTiered::get_migration_rate,
+                             "The rate at which files are migrated in bytes per second (read-only)")
+      .def("set_migration_rate", &PartitionTiered::set_migration_rate, py::arg("rate"),
+           "Set the rate at which files are migrated in bytes per second (0 for no limit)")
+      .def("migrate_file", &PartitionTiered::migrate_file, py::arg("full_path"), py::arg("tier"),
+           "Migrate a file to a tier and wait for the migration to complete")
+      .def_property_readonly("num_promotions", &PartitionTiered::get_num_promotions,
+                             "The number of files promoted to the fast tier (read-only)")
+      .def_property_readonly("num_demotions", &PartitionTiered::get_num_demotions,
+                             "The number of files demoted to the capacity tier (read-only)")
+      .def_property_readonly("num_migrated_bytes", &PartitionTiered::get_num_migrated_bytes,
+                             "The number of bytes copied by migrations (read-only)");
+  py::enum_<PartitionTiered::Tier>(partition_tiered, "Tier", "An enum that defines the tiers of a PartitionTiered")
+      .value("FAST", PartitionTiered::Tier::FAST, "The tier on which new and hot files are stored")
+      .value("CAPACITY", PartitionTiered::Tier::CAPACITY, "The tier on which cold files are stored");
+
+  /* Classes IOScheduler */
+  py::class_<IOScheduler, std::shared_ptr<IOScheduler>>(
+      m, "IOScheduler", "An IOScheduler decides in which order a Storage controller dispatches queued requests")
+      .def_property_readonly("size", &IOScheduler::size, "The number of queued requests (read-only)");
+  py::class_<FIFOIOScheduler, IOScheduler, std::shared_ptr<FIFOIOScheduler>>(
+      m, "FIFOIOScheduler", "An IOScheduler that dispatches requests in arrival order")
+      .def(py::init<>());
+  py::class_<DeadlineIOScheduler, IOScheduler, std::shared_ptr<DeadlineIOScheduler>>(
+      m, "DeadlineIOScheduler", "An IOScheduler that dispatches the request with the earliest deadline first")
+      .def(py::init<double, double>(), py::arg("read_expiry") = 0.5, py::arg("write_expiry") = 5.0)
+      .def_property_readonly("read_expiry", &DeadlineIOScheduler::get_read_expiry,
+                             "The delay after which a read should have been dispatched (read-only)")
+      .def_property_readonly("write_expiry", &DeadlineIOScheduler::get_write_expiry,
+                             "The delay after which a write should have been dispatched (read-only)");
+  py::class_<FairShareIOScheduler, IOScheduler, std::shared_ptr<FairShareIOScheduler>>(
+      m, "FairShareIOScheduler", "An IOScheduler that serves the client that has been served the fewest bytes first")
+      .def(py::init<>())
+      .def("get_served_bytes", &FairShareIOScheduler::get_served_bytes, py::arg("client"),
+           "Get the number of bytes of the requests of a client (actor PID) that have been dispatched");
+  py::class_<ShortestJobFirstIOScheduler, IOScheduler, std::shared_ptr<ShortestJobFirstIOScheduler>>(
+      m, "ShortestJobFirstIOScheduler", "An IOScheduler that dispatches the smallest request first")
+      .def(py::init<>());
+
   /* Class Storage */
   py::class_<Storage, std::shared_ptr<Storage>> storage(m, "Storage", "A Storage represents a storage abstraction");
   storage.def_property_readonly("name", &Storage::get_name, "The name of the Storage (read-only)")
@@ -136,19 +551,221 @@ PYBIND11_MODULE(fsmod, m)
       .def_property_readonly("num_disks", &Storage::get_num_disks, "The number of disks in the Storage (read-only)")
       .def_property_readonly("first_disk", &Storage::get_first_disk, "The first disk in the Storage (read-only)")
       .def("disk_at", &Storage::get_disk_at, py::arg("position"), "Get the disk at the given position in the Storage")
-      .def("start_controller", &Storage::start_controller, py::call_guard<py::gil_scoped_release>(), py::arg("host"), 
-           py::arg("func"), "Start the controller Actor for the Storage on the given Host");
+      .def("start_controller",
+           py::overload_cast<simgrid::s4u::Host*, const std::function<void()>&>(&Storage::start_controller),
+           py::call_guard<py::gil_scoped_release>(), py::arg("host"), py::arg("func"),
+           "Start the controller Actor for the Storage on the given Host")
+      .def("start_controller",
+           py::overload_cast<simgrid::s4u::Host*, std::shared_ptr<IOScheduler>, unsigned long>(
+               &Storage::start_controller),
+           py::call_guard<py::gil_scoped_release>(), py::arg("host"), py::arg("scheduler"),
+           py::arg("max_concurrent_requests") = 1,
+           "Start a controller Actor on the given Host that dispatches the I/O requests made to the Storage in the "
+           "order decided by the scheduler")
+      .def_property_readonly("io_scheduler", &Storage::get_io_scheduler,
+                             "The I/O scheduler of the Storage's controller, if any (read-only)")
+      .def_property_readonly("max_concurrent_requests", &Storage::get_max_concurrent_requests,
+                             "The maximum number of requests the Storage serves at the same time (read-only)")
+      .def_property_readonly("num_running_requests", &Storage::get_num_running_requests,
+                             "The number of requests the Storage is currently serving (read-only)");
 
   /* Class OneDiskStorage */
   py::class_<OneDiskStorage, Storage, std::shared_ptr<OneDiskStorage>>(
       m, "OneDiskStorage", "A OneDiskStorage represents a storage with a single disk")
       .def_static("create", &OneDiskStorage::create, py::arg("name"), py::arg("disk"), "Create a new OneDiskStorage");
 
+  /* Class ObjectStorage */
+  py::class_<ObjectStorage, Storage, std::shared_ptr<ObjectStorage>>(
+      m, "ObjectStorage", "An ObjectStorage represents a remote object store accessed through latency-bound requests")
+      .def_static("create", &ObjectStorage::create, py::arg("name"), py::arg("disk"), py::arg("request_latency"),
+                  py::arg("max_request_size") = 5368709120, "Create a new ObjectStorage")
+      .def_property_readonly("request_latency", &ObjectStorage::get_request_latency,
+                             "The time each request waits before its data is transferred (read-only)")
+      .def_property_readonly("max_request_size", &ObjectStorage::get_max_request_size,
+                             "The maximum number of bytes a request can transfer (read-only)")
+      .def("set_multipart_upload", &ObjectStorage::set_multipart_upload, py::arg("part_size"),
+           py::arg("parallelism"), "Set the part size and the number of parts uploaded at the same time")
+      .def_property_readonly("part_size", &ObjectStorage::get_part_size,
+                             "The number of bytes of a multipart upload part (read-only)")
+      .def_property_readonly("multipart_parallelism", &ObjectStorage::get_multipart_parallelism,
+                             "The number of parts uploaded at the same time (read-only)")
+      .def("set_ranged_get", &ObjectStorage::set_ranged_get, py::arg("range_size"), py::arg("parallelism"),
+           "Set the range size and the number of ranges downloaded at the same time")
+      .def_property_readonly("range_size", &ObjectStorage::get_range_size,
+                             "The number of bytes of a ranged GET (read-only)")
+      .def_property_readonly("ranged_get_parallelism", &ObjectStorage::get_ranged_get_parallelism,
+                             "The number of ranges downloaded at the same time (read-only)")
+      .def_property_readonly("num_requests", &ObjectStorage::get_num_requests,
+                             "The number of requests sent to the object store (read-only)")
+      .def_property_readonly("num_get_requests", &ObjectStorage::get_num_get_requests,
+                             "The number of GET requests (read-only)")
+      .def_property_readonly("num_put_requests", &ObjectStorage::get_num_put_requests,
+                             "The number of PUT requests, including multipart upload requests (read-only)")
+      .def_property_readonly("num_multipart_uploads", &ObjectStorage::get_num_multipart_uploads,
+                             "The number of multipart uploads (read-only)");
+
   /* Class OneRemoteDiskStorage */
   py::class_<OneRemoteDiskStorage, Storage, std::shared_ptr<OneRemoteDiskStorage>>(
       m, "OneRemoteDiskStorage", "A OneRemoteDiskStorage represents a storage with a single remote disk")
       .def_static("create", &OneRemoteDiskStorage::create, py::arg("name"), py::arg("disk"),
                   "Create a new OneRemoteDiskStorage");
+
+  /* Class CachedStorage */
+  py::class_<CachedStorage, Storage, std::shared_ptr<CachedStorage>> cached_storage(
+      m, "CachedStorage", "A CachedStorage represents a Storage whose blocks are cached on a cache disk");
+  py::enum_<CachedStorage::WritePolicy>(cached_storage, "WritePolicy",
+                                        "An enum that defines how writes are handled by a CachedStorage")
+      .value("WRITE_THROUGH", CachedStorage::WritePolicy::WRITE_THROUGH,
+             "Writes go to both the cache disk and the backing Storage")
+      .value("WRITE_BACK", CachedStorage::WritePolicy::WRITE_BACK,
+             "Writes go to the cache disk, and dirty blocks are written back when evicted or flushed");
+  cached_storage
+      .def_static("create", &CachedStorage::create, py::arg("name"), py::arg("backing_storage"),
+                  py::arg("cache_disk"), py::arg("cache_size"), py::arg("block_size") = 65536,
+                  py::arg("write_policy") = CachedStorage::WritePolicy::WRITE_THROUGH, "Create a new CachedStorage")
+      .def_property_readonly("backing_storage", &CachedStorage::get_backing_storage,
+                             "The Storage whose blocks are cached (read-only)")
+      .def_property_readonly("cache_disk", &CachedStorage::get_cache_disk,
+                             "The disk that stores cached blocks (read-only)")
+      .def_property_readonly("cache_size", &CachedStorage::get_cache_size, "The size of the cache in bytes (read-only)")
+      .def_property_readonly("block_size", &CachedStorage::get_block_size,
+                             "The caching granularity in bytes (read-only)")
+      .def_property_readonly("write_policy", &CachedStorage::get_write_policy, "The write policy (read-only)")
+      .def_property_readonly("num_cached_blocks", &CachedStorage::get_num_cached_blocks,
+                             "The number of blocks in the cache (read-only)")
+      .def_property_readonly("num_dirty_blocks", &CachedStorage::get_num_dirty_blocks,
+                             "The number of cached blocks not yet written to the backing Storage (read-only)")
+      .def_property_readonly("num_read_hits", &CachedStorage::get_num_read_hits,
+                             "The number of blocks read from the cache (read-only)")
+      .def_property_readonly("num_read_misses", &CachedStorage::get_num_read_misses,
+                             "The number of blocks read from the backing Storage (read-only)")
+      .def_property_readonly("read_hit_rate", &CachedStorage::get_read_hit_rate,
+                             "The fraction of the blocks accessed by reads that were found in the cache (read-only)")
+      .def_property_readonly("num_write_hits", &CachedStorage::get_num_write_hits,
+                             "The number of written blocks that were already cached (read-only)")
+      .def_property_readonly("num_evicted_blocks", &CachedStorage::get_num_evicted_blocks,
+                             "The number of blocks evicted from the cache (read-only)")
+      .def_property_readonly("num_flushed_blocks", &CachedStorage::get_num_flushed_blocks,
+                             "The number of dirty blocks written to the backing Storage (read-only)")
+      .def("flush", &CachedStorage::flush, "Write all dirty blocks to the backing Storage")
+      .def_property_readonly("flush_interval", &CachedStorage::get_flush_interval,
+                             "The delay between two background flushes of the dirty blocks (read-only)")
+      .def("set_flush_interval", &CachedStorage::set_flush_interval, py::arg("interval"),
+           "Set the delay between two background flushes of the dirty blocks (0 to disable)");
+
+  /* Class ReplicatedStorage */
+  py::class_<ReplicatedStorage, Storage, std::shared_ptr<ReplicatedStorage>> replicated_storage(
+      m, "ReplicatedStorage", "A ReplicatedStorage represents a storage that replicates files on disks of different hosts");
+  py::enum_<ReplicatedStorage::ReplicationMode>(replicated_storage, "ReplicationMode",
+                                                "An enum that defines how writes reach the replicas of a file")
+      .value("PIPELINE", ReplicatedStorage::ReplicationMode::PIPELINE,
+             "The client sends data to the first replica, which forwards it to the next one, and so on")
+      .value("FAN_OUT", ReplicatedStorage::ReplicationMode::FAN_OUT, "The client sends data to all replicas");
+  replicated_storage
+      .def_static("create", &ReplicatedStorage::create, py::arg("name"), py::arg("disks"),
+                  py::arg("replication_factor"), py::arg("replication_mode") = ReplicatedStorage::ReplicationMode::PIPELINE,
+                  "Create a new ReplicatedStorage")
+      .def_property_readonly("replication_factor", &ReplicatedStorage::get_replication_factor,
+                             "The number of replicas of each file (read-only)")
+      .def_property_readonly("replication_mode", &ReplicatedStorage::get_replication_mode,
+                             "How writes reach the replicas (read-only)")
+      .def_property_readonly("num_bytes_written", &ReplicatedStorage::get_num_bytes_written,
+                             "The number of bytes written by clients (read-only)")
+      .def_property_readonly("num_replica_bytes_written", &ReplicatedStorage::get_num_replica_bytes_written,
+                             "The number of bytes written to disks (read-only)")
+      .def_property_readonly("write_amplification", &ReplicatedStorage::get_write_amplification,
+                             "The ratio between the bytes written to disks and the bytes written by clients (read-only)")
+      .def("get_disk_num_bytes_read", &ReplicatedStorage::get_disk_num_bytes_read, py::arg("disk_index"),
+           "Retrieve the number of bytes read from a disk")
+      .def("estimate_read_cost", &ReplicatedStorage::estimate_read_cost, py::arg("disk"), py::arg("client_host"),
+           py::arg("size"), "Estimate the time needed to read data from a disk to a host");
+
+  /* Class SSDStorage */
+  py::class_<SSDStorage, Storage, std::shared_ptr<SSDStorage>>(
+      m, "SSDStorage", "An SSDStorage represents a solid-state drive with an IOPS cap and garbage collection")
+      .def_static("create", &SSDStorage::create, py::arg("name"), py::arg("disk"), py::arg("max_iops"),
+                  py::arg("operation_latency") = 0, "Create a new SSDStorage")
+      .def_property_readonly("max_iops", &SSDStorage::get_max_iops,
+                             "The maximum number of operations per second the drive can serve (read-only)")
+      .def_property_readonly("operation_latency", &SSDStorage::get_operation_latency,
+                             "The time each operation waits before its data is transferred (read-only)")
+      .def("set_over_provisioning", &SSDStorage::set_over_provisioning, py::arg("over_provisioning"),
+           "Set the fraction of the drive's capacity that is hidden from the partitions")
+      .def_property_readonly("over_provisioning", &SSDStorage::get_over_provisioning,
+                             "The fraction of the drive's capacity that is hidden from the partitions (read-only)")
+      .def_property_readonly("write_amplification", &SSDStorage::get_write_amplification,
+                             "The current number of bytes physically written per byte written (read-only)")
+      .def("set_garbage_collection", &SSDStorage::set_garbage_collection, py::arg("free_space_threshold"),
+           py::arg("period"), py::arg("stall_duration"),
+           "Set the free space threshold below which the drive stalls, every period physically written bytes")
+      .def_property_readonly("gc_free_space_threshold", &SSDStorage::get_gc_free_space_threshold,
+                             "The fraction of free space below which garbage-collection stalls happen (read-only)")
+      .def_property_readonly("gc_period", &SSDStorage::get_gc_period,
+                             "The number of physically written bytes between two stalls (read-only)")
+      .def_property_readonly("gc_stall_duration", &SSDStorage::get_gc_stall_duration,
+                             "The duration of a garbage-collection stall (read-only)")
+      .def_property_readonly("num_bytes_written", &SSDStorage::get_num_bytes_written,
+                             "The number of bytes written to the drive (read-only)")
+      .def_property_readonly("num_physical_bytes_written", &SSDStorage::get_num_physical_bytes_written,
+                             "The number of bytes physically written by the drive (read-only)")
+      .def_property_readonly("num_gc_stalls", &SSDStorage::get_num_gc_stalls,
+                             "The number of garbage-collection stalls (read-only)")
+      .def_property_readonly("total_stall_time", &SSDStorage::get_total_stall_time,
+                             "The total duration of the garbage-collection stalls (read-only)");
+
+  /* Class StripedStorage */
+  py::class_<StripedStorage, Storage, std::shared_ptr<StripedStorage>>(
+      m, "StripedStorage", "A StripedStorage represents a parallel file system storage that stripes files over targets")
+      .def_static("create", &StripedStorage::create, py::arg("name"), py::arg("targets"), py::arg("stripe_count") = 1,
+                  py::arg("stripe_size") = 1048576, "Create a new StripedStorage")
+      .def_property_readonly("targets", &StripedStorage::get_targets,
+                             "The Storages over which files are striped (read-only)")
+      .def_property_readonly("num_targets", &StripedStorage::get_num_targets, "The number of targets (read-only)")
+      .def_property_readonly("stripe_count", &StripedStorage::get_stripe_count,
+                             "The default number of targets over which a file is striped (read-only)")
+      .def_property_readonly("stripe_size", &StripedStorage::get_stripe_size,
+                             "The default stripe size in bytes (read-only)")
+      .def("set_default_layout", &StripedStorage::set_default_layout, py::arg("stripe_count"), py::arg("stripe_size"),
+           "Set the stripe count and stripe size of the files whose layout is not given at creation time")
+      .def("get_target_num_bytes", &StripedStorage::get_target_num_bytes, py::arg("target_index"),
+           "Retrieve the number of bytes read from or written to a target");
+  /* Class HDDStorage */
+  py::class_<HDDStorage, Storage, std::shared_ptr<HDDStorage>>(
+      m, "HDDStorage", "An HDDStorage represents a spinning disk whose head pays seeks between distant operations")
+      .def_static("create", &HDDStorage::create, py::arg("name"), py::arg("disk"), py::arg("capacity"),
+                  "Create a new HDDStorage")
+      .def_property_readonly("capacity", &HDDStorage::get_capacity,
+                             "The number of bytes the drive can hold (read-only)")
+      .def("set_rotation_speed", &HDDStorage::set_rotation_speed, py::arg("rpm"),
+           "Set the number of rotations per minute of the drive")
+      .def_property_readonly("rotation_speed", &HDDStorage::get_rotation_speed,
+                             "The number of rotations per minute of the drive (read-only)")
+      .def("set_seek_times", &HDDStorage::set_seek_times, py::arg("track_to_track_seek_time"),
+           py::arg("full_stroke_seek_time"), "Set the shortest and the longest seek times of the drive")
+      .def_property_readonly("track_to_track_seek_time", &HDDStorage::get_track_to_track_seek_time,
+                             "The shortest seek time of the drive (read-only)")
+      .def_property_readonly("full_stroke_seek_time", &HDDStorage::get_full_stroke_seek_time,
+                             "The longest seek time of the drive (read-only)")
+      .def("get_positioning_time", &HDDStorage::get_positioning_time, py::arg("distance"),
+           "Compute the seek and rotational latency of a head move over a number of bytes")
+      .def("set_file_extent_size", &HDDStorage::set_file_extent_size, py::arg("extent_size"),
+           "Set the size of the contiguous extent reserved for each file. Files beyond the drive's capacity wrap "
+           "around and share the extents of the first ones")
+      .def_property_readonly("file_extent_size", &HDDStorage::get_file_extent_size,
+                             "The size of the contiguous extent reserved for each file (read-only)")
+      .def("set_request_reordering", &HDDStorage::set_request_reordering, py::arg("reordering"),
+           "Set whether queued operations are served in elevator order rather than in arrival order")
+      .def_property_readonly("request_reordering", &HDDStorage::get_request_reordering,
+                             "Whether queued operations are served in elevator order (read-only)")
+      .def_property_readonly("head_position", &HDDStorage::get_head_position,
+                             "The address at which the head currently is (read-only)")
+      .def_property_readonly("num_operations", &HDDStorage::get_num_operations,
+                             "The number of operations served by the drive (read-only)")
+      .def_property_readonly("num_seeks", &HDDStorage::get_num_seeks,
+                             "The number of operations that required a seek (read-only)")
+      .def_property_readonly("total_positioning_time", &HDDStorage::get_total_positioning_time,
+                             "The total seek and rotational latency paid by operations (read-only)");
+
   /* Class JBODStorage */
   py::class_<JBODStorage, Storage, std::shared_ptr<JBODStorage>> jbod(
       m, "JBODStorage", "A JBODStorage represents a storage with multiple disks");
@@ -160,13 +777,68 @@ PYBIND11_MODULE(fsmod, m)
       .value("RAID3", JBODStorage::RAID::RAID3, "RAID level 3 (unsupported)")
       .value("RAID4", JBODStorage::RAID::RAID4, "RAID level 4")
       .value("RAID5", JBODStorage::RAID::RAID5, "RAID level 5")
-      .value("RAID6", JBODStorage::RAID::RAID6, "RAID level 6");
+      .value("RAID6", JBODStorage::RAID::RAID6, "RAID level 6")
+      .value("RAID10", JBODStorage::RAID::RAID10, "RAID level 10")
+      .value("ERASURE_CODING", JBODStorage::RAID::ERASURE_CODING, "k+m Reed-Solomon erasure coding");
+  py::enum_<JBODStorage::MirrorReadPolicy>(jbod, "MirrorReadPolicy",
+                                           "An enum that defines how RAID1 and RAID10 reads choose a mirror")
+      .value("ROUND_ROBIN", JBODStorage::MirrorReadPolicy::ROUND_ROBIN, "Use each mirror in turn")
+      .value("LEAST_OUTSTANDING_BYTES", JBODStorage::MirrorReadPolicy::LEAST_OUTSTANDING_BYTES,
+             "Use the mirror with the fewest bytes left to read or write")
+      .value("EARLIEST_COMPLETION", JBODStorage::MirrorReadPolicy::EARLIEST_COMPLETION,
+             "Use the mirror expected to complete the read first");
   jbod.def_static("create", &JBODStorage::create, py::arg("name"), py::arg("disks"),
-                  py::arg("raid_level") = JBODStorage::RAID::RAID0, "Create a new JBODStorage")
+                  py::arg("raid_level") = JBODStorage::RAID::RAID0, py::arg("stripe_unit_size") = 0,
+                  "Create a new JBODStorage")
+      .def_static("create_erasure_coded", &JBODStorage::create_erasure_coded, py::arg("name"), py::arg("disks"),
+                  py::arg("num_data_fragments"), py::arg("num_parity_fragments"), py::arg("stripe_unit_size") = 0,
+                  "Create a new JBODStorage that uses k+m erasure coding")
       .def_property_readonly("raid_level", &JBODStorage::get_raid_level,
                              "The RAID level of the JBODStorage (read-only)")
       .def("set_raid_level", &JBODStorage::set_raid_level, py::arg("raid_level"),
-           "Set the RAID level of the JBODStorage");
+           "Set the RAID level of the JBODStorage")
+      .def("set_erasure_coding", &JBODStorage::set_erasure_coding, py::arg("num_data_fragments"),
+           py::arg("num_parity_fragments"), "Use k+m erasure coding on the JBODStorage")
+      .def_property_readonly("num_data_disks", &JBODStorage::get_num_data_disks,
+                             "The number of disks that hold data in each stripe (read-only)")
+      .def_property_readonly("num_parity_disks", &JBODStorage::get_num_parity_disks,
+                             "The number of disks that hold parity in each stripe (read-only)")
+      .def_property_readonly("stripe_unit_size", &JBODStorage::get_stripe_unit_size,
+                             "The stripe unit size of the JBODStorage in bytes (read-only)")
+      .def("set_stripe_unit_size", &JBODStorage::set_stripe_unit_size, py::arg("stripe_unit_size"),
+           "Set the stripe unit size of the JBODStorage (0 to spread each request evenly over the disks)")
+      .def_property_readonly("mirror_read_policy", &JBODStorage::get_mirror_read_policy,
+                             "The policy used by RAID1 and RAID10 reads to choose a mirror (read-only)")
+      .def("set_mirror_read_policy", &JBODStorage::set_mirror_read_policy, py::arg("policy"),
+           "Set the policy used by RAID1 and RAID10 reads to choose a mirror")
+      .def_property_readonly("hedged_read_threshold", &JBODStorage::get_hedged_read_threshold,
+                             "The delay after which RAID1 reads are issued to a second mirror (read-only)")
+      .def("set_hedged_read_threshold", &JBODStorage::set_hedged_read_threshold, py::arg("threshold"),
+           "Set the delay after which RAID1 reads are issued to a second mirror (0 to disable hedged reads)")
+      .def_property_readonly("num_hedged_reads", &JBODStorage::get_num_hedged_reads,
+                             "The number of reads that were issued to a second mirror (read-only)")
+      .def("get_outstanding_bytes", &JBODStorage::get_outstanding_bytes, py::arg("disk_idx"),
+           "Get the number of bytes a disk of the JBODStorage has yet to read or write")
+      .def_property_readonly("num_failed_disks", &JBODStorage::get_num_failed_disks,
+                             "The number of disks of the JBODStorage that have failed (read-only)")
+      .def_property_readonly("max_num_failed_disks", &JBODStorage::get_max_num_failed_disks,
+                             "The number of disk failures the JBODStorage tolerates (read-only)")
+      .def("add_spare_disk", &JBODStorage::add_spare_disk, py::arg("disk"),
+           "Add a spare disk on which failed disks of the JBODStorage are rebuilt")
+      .def_property_readonly("spare_disks", &JBODStorage::get_spare_disks,
+                             "The spare disks of the JBODStorage that are not in use yet (read-only)")
+      .def_property_readonly("rebuild_rate", &JBODStorage::get_rebuild_rate,
+                             "The rate at which failed disks are rebuilt in bytes per second (read-only)")
+      .def("set_rebuild_rate", &JBODStorage::set_rebuild_rate, py::arg("rate"),
+           "Set the rate at which failed disks are rebuilt (0 to rebuild as fast as possible)")
+      .def_property_readonly("rebuild_size", &JBODStorage::get_rebuild_size,
+                             "The number of bytes to rebuild per failed disk, by default the number of bytes each "
+                             "disk stores (read-only)")
+      .def("set_rebuild_size", &JBODStorage::set_rebuild_size, py::arg("num_bytes"),
+           "Set the number of bytes to rebuild per failed disk (0 to rebuild the bytes each disk stores)")
+      .def("is_rebuilding", &JBODStorage::is_rebuilding, "Check whether a failed disk is being rebuilt")
+      .def("start_rebuild", &JBODStorage::start_rebuild, py::call_guard<py::gil_scoped_release>(),
+           py::arg("failed_disk"), "Start rebuilding a failed disk of the JBODStorage on a spare disk");
 
            /* class PathUtil */
   py::class_<PathUtil>(m, "PathUtil", "Path management helper functions")
@@ -202,15 +874,73 @@ PYBIND11_MODULE(fsmod, m)
              &FileSystem::mount_partition),
          py::arg("mount_point"), py::arg("storage"), py::arg("size"),
          py::arg("caching_scheme") = Partition::CachingScheme::NONE, "Mount a Partition on the FileSystem")
+    .def("mount_partition",
+         py::overload_cast<const std::string&, std::shared_ptr<Storage>, sg_size_t, std::shared_ptr<EvictionPolicy>>(
+             &FileSystem::mount_partition),
+         py::arg("mount_point"), py::arg("storage"), py::arg("size"), py::arg("eviction_policy"),
+         "Mount a Partition that evicts files with an EvictionPolicy on the FileSystem")
+    .def("mount_partition",
+         py::overload_cast<const std::string&, std::shared_ptr<Storage>, const std::string&,
+                           std::shared_ptr<EvictionPolicy>>(&FileSystem::mount_partition),
+         py::arg("mount_point"), py::arg("storage"), py::arg("size"), py::arg("eviction_policy"),
+         "Mount a Partition that evicts files with an EvictionPolicy on the FileSystem")
+    .def("mount_tiered_partition",
+         py::overload_cast<const std::string&, std::shared_ptr<Storage>, sg_size_t, std::shared_ptr<Storage>,
+                           sg_size_t>(&FileSystem::mount_tiered_partition),
+         py::arg("mount_point"), py::arg("fast_storage"), py::arg("fast_tier_size"), py::arg("capacity_storage"),
+         py::arg("capacity_tier_size"), "Mount a PartitionTiered on the FileSystem")
+    .def("mount_tiered_partition",
+         py::overload_cast<const std::string&, std::shared_ptr<Storage>, const std::string&, std::shared_ptr<Storage>,
+                           const std::string&>(&FileSystem::mount_tiered_partition),
+         py::arg("mount_point"), py::arg("fast_storage"), py::arg("fast_tier_size"), py::arg("capacity_storage"),
+         py::arg("capacity_tier_size"), "Mount a PartitionTiered on the FileSystem")
 
+    .def_property_readonly("metadata_service", &FileSystem::get_metadata_service,
+                           "The MetadataService of the FileSystem, if any (read-only)")
+    .def("set_metadata_service", &FileSystem::set_metadata_service, py::arg("metadata_service"),
+         "Set the MetadataService that serves the metadata operations on the FileSystem")
+    .def_property_readonly("qos_policy", &FileSystem::get_qos_policy,
+                           "The QoSPolicy that applies to the whole FileSystem, if any (read-only)")
+    .def("set_qos_policy", &FileSystem::set_qos_policy, py::arg("qos_policy"),
+         "Set the QoSPolicy that applies to the whole FileSystem")
+    .def("set_actor_qos_policy", &FileSystem::set_actor_qos_policy, py::arg("actor"), py::arg("qos_policy"),
+         "Set the QoSPolicy that applies to an actor")
+    .def("get_actor_qos_policy", &FileSystem::get_actor_qos_policy, py::arg("actor"),
+         "Get the QoSPolicy of an actor, or None if it has none")
+    .def("set_tag_qos_policy", &FileSystem::set_tag_qos_policy, py::arg("tag"), py::arg("qos_policy"),
+         "Set the QoSPolicy that applies to the Files with a QoS tag")
+    .def("get_tag_qos_policy", &FileSystem::get_tag_qos_policy, py::arg("tag"),
+         "Get the QoSPolicy of a QoS tag, or None if it has none")
+    .def("add_client_cache", &FileSystem::add_client_cache, py::arg("client_cache"),
+         "Add a ClientCache that caches the remote data accessed from its host")
+    .def("get_client_cache", &FileSystem::get_client_cache, py::arg("host"),
+         "Get the ClientCache of a host, or None if it has none")
+    .def("get_directory_lock_statistics", &FileSystem::get_directory_lock_statistics, py::arg("full_dir_path"),
+         "Get statistics about the lock of a directory")
     .def("create_file", py::overload_cast<const std::string&, sg_size_t>(&FileSystem::create_file, py::const_),
          py::arg("full_path"), py::arg("size"), "Create a file on the FileSystem")
     .def("create_file", py::overload_cast<const std::string&, const std::string&>(&FileSystem::create_file, py::const_),
          py::arg("full_path"), py::arg("size"), "Create a file on the FileSystem")
+    .def("create_file",
+         py::overload_cast<const std::string&, sg_size_t, unsigned long, sg_size_t>(&FileSystem::create_file,
+                                                                                    py::const_),
+         py::arg("full_path"), py::arg("size"), py::arg("stripe_count"), py::arg("stripe_size"),
+         "Create a file striped over a given number of targets of a StripedStorage")
+    .def("create_file",
+         py::overload_cast<const std::string&, const std::string&, unsigned long, const std::string&>(
+             &FileSystem::create_file, py::const_),
+         py::arg("full_path"), py::arg("size"), py::arg("stripe_count"), py::arg("stripe_size"),
+         "Create a file striped over a given number of targets of a StripedStorage")
     .def("truncate_file", &FileSystem::truncate_file, py::arg("full_path"), py::arg("size"),
          "Truncate a file on the FileSystem")
     .def("make_file_evictable", &FileSystem::make_file_evictable, py::arg("full_path"), py::arg("evictable"),
          "Make a file evictable or not")
+    .def("set_file_compression_ratio", &FileSystem::set_file_compression_ratio, py::arg("full_path"),
+         py::arg("ratio"), "Set the compression ratio of a closed file, which re-stores its content in zero time")
+    .def("set_file_fingerprint", &FileSystem::set_file_fingerprint, py::arg("full_path"), py::arg("fingerprint"),
+         "Set the content fingerprint of a closed file on a deduplicated Partition")
+    .def("set_file_chunk_fingerprints", &FileSystem::set_file_chunk_fingerprints, py::arg("full_path"),
+         py::arg("chunk_fingerprints"), "Set the chunk fingerprints of a closed file on a deduplicated Partition")
     .def("file_exists", &FileSystem::file_exists, py::arg("full_path"), "Check whether a file exists on the FileSystem")
     .def("move_file", &FileSystem::move_file, py::arg("src_full_path"), py::arg("dst_full_path"),
          "Move a file on the FileSystem")
@@ -0,0 +1,182 @@
+/* Copyright (c) 2024-2026. The FSMOD Team. All rights reserved.          */
+
+/* This program is free software; you can redistribute it and/or modify it
+ * under the terms of the license (GNU LGPL) which comes with this package. */
+
+#include <gtest/gtest.h>
+#include <iostream>
+#include <memory>
+
+#include <simgrid/s4u/Actor.hpp>
+#include <simgrid/s4u/Engine.hpp>
+
+#include "fsmod/FileSystem.hpp"
+#include "fsmod/OneDiskStorage.hpp"
+#include "fsmod/AdmissionPolicy.hpp"
+#include "fsmod/EvictionPolicy.hpp"
+#include "fsmod/FileSystemException.hpp"
+
+#include "./test_util.hpp"
+
+namespace sgfs=simgrid::fsmod;
+namespace sg4=simgrid::s4u;
+
+XBT_LOG_NEW_DEFAULT_CATEGORY(admission_policy_test, "Admission Policy Test");
+
+class AdmissionPolicyTest : public ::testing::Test {
+public:
+    std::shared_ptr<sgfs::FileSystem> cache_fs_;
+    std::shared_ptr<sgfs::FileSystem> origin_fs_;
+    std::shared_ptr<sgfs::Partition> cache_;
+    sg4::Host * host_;
+
+    AdmissionPolicyTest() = default;
+
+    void setup_platform() {
+        XBT_INFO("Creating a platform with one host, a 100MBps cache disk, and a 10MBps origin disk...");
+        auto *my_zone = sg4::Engine::get_instance()->get_netzone_root()->add_netzone_full("zone");
+        host_ = my_zone->add_host("my_host", "100Gf");
+        auto* cache_disk = host_->add_disk("cache_disk", "100MBps", "100MBps");
+        auto* origin_disk = host_->add_disk("origin_disk", "10MBps", "10MBps");
+        my_zone->seal();
+
+        XBT_INFO("Creating an origin file system that holds 20MB, 50MB, and 60MB files...");
+        origin_fs_ = sgfs::FileSystem::create("origin_fs");
+        origin_fs_->mount_partition("/pfs/", sgfs::OneDiskStorage::create("origin_storage", origin_disk), "1TB");
+        origin_fs_->create_file("/pfs/data/a.txt", "20MB");
+        origin_fs_->create_file("/pfs/data/b.txt", "50MB");
+        origin_fs_->create_file("/pfs/data/c.txt", "60MB");
+        XBT_INFO("Creating a file system with a 100MB LRU partition that reads through to the origin...");
+        cache_fs_ = sgfs::FileSystem::create("cache_fs");
+        cache_fs_->mount_partition("/cache/", sgfs::OneDiskStorage::create("cache_storage", cache_disk), "100MB",
+                                   std::make_shared<sgfs::LRUEvictionPolicy>());
+        cache_ = cache_fs_->partition_by_name("/cache");
+        cache_->set_read_through(origin_fs_, "/pfs/data/");
+    }
+};
+
+TEST_F(AdmissionPolicyTest, BadArguments)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform();
+        XBT_INFO("Create admission policies with invalid arguments, which should fail");
+        ASSERT_THROW(std::make_shared<sgfs::MaxSizeAdmissionPolicy>(0), std::invalid_argument);
+        ASSERT_THROW(std::make_shared<sgfs::TinyLFUAdmissionPolicy>(0), std::invalid_argument);
+        XBT_INFO("Set a valid admission policy");
+        auto policy = std::make_shared<sgfs::SecondHitAdmissionPolicy>();
+        ASSERT_NO_THROW(cache_->set_admission_policy(policy));
+        ASSERT_EQ(cache_->get_admission_policy(), policy);
+        ASSERT_EQ(policy->get_partition_size(), 100000000);
+    });
+}
+
+TEST_F(AdmissionPolicyTest, MaxSizeAdmission)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform();
+        cache_->set_admission_policy(std::make_shared<sgfs::MaxSizeAdmissionPolicy>(30000000));
+        host_->add_actor("TestActor", [this]() {
+            XBT_INFO("Open a 50MB file, which is not admitted, and is read from the origin in 5s");
+            std::shared_ptr<sgfs::File> file;
+            ASSERT_NO_THROW(file = cache_fs_->open("/cache/b.txt", "r"));
+            ASSERT_DOUBLE_EQ(sg4::Engine::get_clock(), 0.0);
+            ASSERT_NO_THROW(file->read("50MB"));
+            ASSERT_NO_THROW(file->close());
+            ASSERT_NEAR(sg4::Engine::get_clock(), 5.0, 1e-6);
+            ASSERT_FALSE(cache_fs_->file_exists("/cache/b.txt"));
+            ASSERT_EQ(cache_->get_num_cache_misses(), 1);
+            ASSERT_EQ(cache_->get_num_rejections(), 1);
+            ASSERT_EQ(cache_->get_num_fetches(), 0);
+            XBT_INFO("Open a 20MB file, which is admitted, and fetched in 2.2s");
+            ASSERT_NO_THROW(cache_fs_->open("/cache/a.txt", "r")->close());
+            ASSERT_NEAR(sg4::Engine::get_clock(), 7.2, 1e-6);
+            ASSERT_TRUE(cache_fs_->file_exists("/cache/a.txt"));
+            ASSERT_EQ(cache_->get_num_fetches(), 1);
+        });
+        // Run the simulation
+        ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
+    });
+}
+
+TEST_F(AdmissionPolicyTest, SecondHitAdmission)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform();
+        cache_->set_admission_policy(std::make_shared<sgfs::SecondHitAdmissionPolicy>());
+        host_->add_actor("TestActor", [this]() {
+            XBT_INFO("Open a file for the first time, which only remembers it");
+            ASSERT_NO_THROW(cache_fs_->open("/cache/a.txt", "r")->close());
+            ASSERT_DOUBLE_EQ(sg4::Engine::get_clock(), 0.0);
+            ASSERT_FALSE(cache_fs_->file_exists("/cache/a.txt"));
+            ASSERT_EQ(cache_->get_num_rejections(), 1);
+            XBT_INFO("Open it again, which fetches it in 2.2s");
+            ASSERT_NO_THROW(cache_fs_->open("/cache/a.txt", "r")->close());
+            ASSERT_NEAR(sg4::Engine::get_clock(), 2.2, 1e-6);
+            ASSERT_TRUE(cache_fs_->file_exists("/cache/a.txt"));
+            XBT_INFO("Open it a third time, which is a hit");
+            ASSERT_NO_THROW(cache_fs_->open("/cache/a.txt", "r")->close());
+            ASSERT_EQ(cache_->get_num_cache_misses(), 2);
+            ASSERT_EQ(cache_->get_num_cache_hits(), 1);
+            ASSERT_EQ(cache_->get_num_fetches(), 1);
+        });
+        // Run the simulation
+        ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
+    });
+}
+
+TEST_F(AdmissionPolicyTest, TinyLFUAdmission)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform();
+        auto policy = std::make_shared<sgfs::TinyLFUAdmissionPolicy>();
+        cache_->set_admission_policy(policy);
+        host_->add_actor("TestActor", [this, policy]() {
+            XBT_INFO("Open the 20MB file three times, and the 50MB file once, which both fit in the free space");
+            for (int i = 0; i < 3; i++)
+                ASSERT_NO_THROW(cache_fs_->open("/cache/a.txt", "r")->close());
+            ASSERT_NO_THROW(cache_fs_->open("/cache/b.txt", "r")->close());
+            ASSERT_EQ(cache_->get_num_fetches(), 2);
+            ASSERT_EQ(policy->get_estimated_frequency("/a.txt"), 3);
+            XBT_INFO("Open the 60MB file three times, which would evict more frequently used files");
+            for (int i = 0; i < 3; i++)
+                ASSERT_NO_THROW(cache_fs_->open("/cache/c.txt", "r")->close());
+            ASSERT_EQ(cache_->get_num_rejections(), 3);
+            ASSERT_TRUE(cache_fs_->file_exists("/cache/a.txt"));
+            ASSERT_TRUE(cache_fs_->file_exists("/cache/b.txt"));
+            XBT_INFO("Open it a fourth time, which is now the most frequently used file, and evicts both files");
+            ASSERT_NO_THROW(cache_fs_->open("/cache/c.txt", "r")->close());
+            ASSERT_EQ(cache_->get_num_fetches(), 3);
+            ASSERT_TRUE(cache_fs_->file_exists("/cache/c.txt"));
+            ASSERT_FALSE(cache_fs_->file_exists("/cache/a.txt"));
+            ASSERT_FALSE(cache_fs_->file_exists("/cache/b.txt"));
+        });
+        // Run the simulation
+        ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
+    });
+}
+
+TEST_F(AdmissionPolicyTest, FileLargerThanPartition)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform();
+        origin_fs_->create_file("/pfs/data/huge.txt", "150MB");
+        cache_->set_admission_policy(std::make_shared<sgfs::TinyLFUAdmissionPolicy>());
+        host_->add_actor("TestActor", [this]() {
+            XBT_INFO("Open the 20MB file, which is fetched in 2.2s");
+            ASSERT_NO_THROW(cache_fs_->open("/cache/a.txt", "r")->close());
+            ASSERT_NEAR(sg4::Engine::get_clock(), 2.2, 1e-6);
+            XBT_INFO("Open a 150MB file, which cannot fit, and is read from the origin in 15s, evicting nothing");
+            std::shared_ptr<sgfs::File> file;
+            ASSERT_NO_THROW(file = cache_fs_->open("/cache/huge.txt", "r"));
+            ASSERT_NO_THROW(file->read("150MB"));
+            ASSERT_NO_THROW(file->close());
+            ASSERT_NEAR(sg4::Engine::get_clock(), 17.2, 1e-6);
+            ASSERT_EQ(cache_->get_num_rejections(), 1);
+            ASSERT_EQ(cache_->get_num_fetches(), 1);
+            ASSERT_TRUE(cache_fs_->file_exists("/cache/a.txt"));
+            ASSERT_FALSE(cache_fs_->file_exists("/cache/huge.txt"));
+            XBT_INFO("Without an admission policy, the file is not fetched either");
+            cache_->set_admission_policy(nullptr);
+            ASSERT_NO_THROW(cache_fs_->open("/cache/huge.txt", "r")->close());
+            ASSERT_EQ(cache_->get_num_rejections(), 2);
+            ASSERT_EQ(cache_->get_num_fetches(), 1);
+        });
+        // Run the simulation
+        ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
+    });
+}
@@ -0,0 +1,227 @@
+/* Copyright (c) 2024-2026. The FSMOD Team. All rights reserved.          */
+
+/* This program is free software; you can redistribute it and/or modify it
+ * under the terms of the license (GNU LGPL) which comes with this package. */
+
+#include <gtest/gtest.h>
+#include <iostream>
+
+#include <simgrid/s4u/Actor.hpp>
+#include <simgrid/s4u/Engine.hpp>
+
+#include "fsmod/CachedStorage.hpp"
+#include "fsmod/FileSystem.hpp"
+#include "fsmod/OneDiskStorage.hpp"
+#include "fsmod/FileSystemException.hpp"
+
+#include "./test_util.hpp"
+
+namespace sgfs=simgrid::fsmod;
+namespace sg4=simgrid::s4u;
+
+XBT_LOG_NEW_DEFAULT_CATEGORY(cached_storage_test, "Cached Storage Test");
+
+class CachedStorageTest : public ::testing::Test {
+public:
+    std::shared_ptr<sgfs::FileSystem> fs_;
+    std::shared_ptr<sgfs::OneDiskStorage> hdd_storage_;
+    std::shared_ptr<sgfs::CachedStorage> cs_;
+    sg4::Host * host_;
+    sg4::Disk * ssd_;
+
+    CachedStorageTest() = default;
+
+    void setup_platform(sgfs::CachedStorage::WritePolicy write_policy) {
+        XBT_INFO("Creating a platform with one host, one SSD, and one HDD...");
+        auto *my_zone = sg4::Engine::get_instance()->get_netzone_root()->add_netzone_full("zone");
+        host_ = my_zone->add_host("my_host", "100Gf");
+        ssd_ = host_->add_disk("ssd", "10MBps", "10MBps");
+        auto* hdd = host_->add_disk("hdd", "1MBps", "1MBps");
+        my_zone->seal();
+
+        XBT_INFO("Creating a one-disk storage on the HDD, cached by a 4MB cache on the SSD with 1MB blocks...");
+        hdd_storage_ = sgfs::OneDiskStorage::create("hdd_storage", hdd);
+        cs_ = sgfs::CachedStorage::create("cached_storage", hdd_storage_, ssd_, 4000000, 1000000, write_policy);
+        XBT_INFO("Creating a file system...");
+        fs_ = sgfs::FileSystem::create("my_fs");
+        XBT_INFO("Mounting a 100MB partition...");
+        fs_->mount_partition("/dev/a/", cs_, "100MB");
+        XBT_INFO("Create a 10MB file at /dev/a/foo.txt");
+        fs_->create_file("/dev/a/foo.txt", "10MB");
+    }
+};
+
+TEST_F(CachedStorageTest, BadArguments)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform(sgfs::CachedStorage::WritePolicy::WRITE_THROUGH);
+        XBT_INFO("Create cached storages with invalid arguments, which should fail");
+        ASSERT_THROW(sgfs::CachedStorage::create("bad", nullptr, ssd_, 4000000), std::invalid_argument);
+        ASSERT_THROW(sgfs::CachedStorage::create("bad", hdd_storage_, ssd_, 4000000, 0), std::invalid_argument);
+        ASSERT_THROW(sgfs::CachedStorage::create("bad", hdd_storage_, ssd_, 1000, 4096), std::invalid_argument);
+        ASSERT_THROW(cs_->set_flush_interval(-1), std::invalid_argument);
+        ASSERT_EQ(cs_->get_cache_size(), 4000000);
+        ASSERT_EQ(cs_->get_num_disks(), 2);
+        ASSERT_EQ(cs_->get_first_disk(), hdd_storage_->get_first_disk());
+    });
+}
+
+TEST_F(CachedStorageTest, ReadHitsAndMisses)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform(sgfs::CachedStorage::WritePolicy::WRITE_THROUGH);
+        host_->add_actor("TestActor", [this]() {
+            std::shared_ptr<sgfs::File> file;
+            ASSERT_NO_THROW(file = fs_->open("/dev/a/foo.txt", "r"));
+            XBT_INFO("Read 2MB, which misses and is served by the HDD in 2s");
+            ASSERT_NO_THROW(file->read("2MB"));
+            ASSERT_DOUBLE_EQ(sg4::Engine::get_clock(), 2.0);
+            ASSERT_EQ(cs_->get_num_read_misses(), 2);
+            ASSERT_EQ(cs_->get_num_cached_blocks(), 2);
+            XBT_INFO("Read the same 2MB once the cache has been filled, which is served by the SSD in 0.2s");
+            sg4::this_actor::sleep_until(3);
+            ASSERT_NO_THROW(file->seek(0));
+            ASSERT_NO_THROW(file->read("2MB"));
+            ASSERT_DOUBLE_EQ(sg4::Engine::get_clock(), 3.2);
+            ASSERT_EQ(cs_->get_num_read_hits(), 2);
+            ASSERT_DOUBLE_EQ(cs_->get_read_hit_rate(), 0.5);
+            XBT_INFO("Read 3MB more, which evicts the least recently used block");
+            ASSERT_NO_THROW(file->read("3MB"));
+            ASSERT_DOUBLE_EQ(sg4::Engine::get_clock(), 6.2);
+            ASSERT_EQ(cs_->get_num_cached_blocks(), 4);
+            ASSERT_EQ(cs_->get_num_evicted_blocks(), 1);
+            XBT_INFO("Read 5MB from the start, which is larger than the cache and bypasses it");
+            sg4::this_actor::sleep_until(7);
+            ASSERT_NO_THROW(file->seek(0));
+            ASSERT_NO_THROW(file->read("5MB"));
+            ASSERT_DOUBLE_EQ(sg4::Engine::get_clock(), 12.0);
+            ASSERT_EQ(cs_->get_num_read_misses(), 10);
+            ASSERT_EQ(cs_->get_num_evicted_blocks(), 1);
+            ASSERT_NO_THROW(file->close());
+        });
+        // Run the simulation
+        ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
+    });
+}
+
+TEST_F(CachedStorageTest, FilesDoNotShareBlocks)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform(sgfs::CachedStorage::WritePolicy::WRITE_THROUGH);
+        host_->add_actor("TestActor", [this]() {
+            std::shared_ptr<sgfs::File> file;
+            ASSERT_NO_THROW(fs_->create_file("/dev/a/bar.txt", "10MB"));
+            XBT_INFO("Read the first 1MB of two files, which both miss");
+            for (const auto* path : {"/dev/a/foo.txt", "/dev/a/bar.txt"}) {
+                ASSERT_NO_THROW(file = fs_->open(path, "r"));
+                ASSERT_NO_THROW(file->read("1MB"));
+                ASSERT_NO_THROW(file->close());
+            }
+            ASSERT_EQ(cs_->get_num_read_hits(), 0);
+            ASSERT_EQ(cs_->get_num_read_misses(), 2);
+            ASSERT_EQ(cs_->get_num_cached_blocks(), 2);
+        });
+        // Run the simulation
+        ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
+    });
+}
+
+TEST_F(CachedStorageTest, WriteThrough)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform(sgfs::CachedStorage::WritePolicy::WRITE_THROUGH);
+        host_->add_actor("TestActor", [this]() {
+            std::shared_ptr<sgfs::File> file;
+            ASSERT_NO_THROW(fs_->create_file("/dev/a/bar.txt", "0B"));
+            ASSERT_NO_THROW(file = fs_->open("/dev/a/bar.txt", "w"));
+            XBT_INFO("Write 2MB, which completes when the HDD has written it, at 2s");
+            ASSERT_NO_THROW(file->write("2MB"));
+            ASSERT_DOUBLE_EQ(sg4::Engine::get_clock(), 2.0);
+            ASSERT_EQ(cs_->get_num_cached_blocks(), 2);
+            ASSERT_EQ(cs_->get_num_dirty_blocks(), 0);
+            ASSERT_NO_THROW(file->close());
+            XBT_INFO("Read what was written, which hits the cache");
+            ASSERT_NO_THROW(file = fs_->open("/dev/a/bar.txt", "r"));
+            ASSERT_NO_THROW(file->read("2MB"));
+            ASSERT_DOUBLE_EQ(sg4::Engine::get_clock(), 2.2);
+            ASSERT_EQ(cs_->get_num_read_hits(), 2);
+            ASSERT_NO_THROW(file->close());
+        });
+        // Run the simulation
+        ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
+    });
+}
+
+TEST_F(CachedStorageTest, WriteBack)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform(sgfs::CachedStorage::WritePolicy::WRITE_BACK);
+        host_->add_actor("TestActor", [this]() {
+            std::shared_ptr<sgfs::File> file;
+            ASSERT_NO_THROW(fs_->create_file("/dev/a/bar.txt", "0B"));
+            ASSERT_NO_THROW(file = fs_->open("/dev/a/bar.txt", "w"));
+            XBT_INFO("Write 2MB, which completes when the SSD has written it, at 0.2s");
+            ASSERT_NO_THROW(file->write("2MB"));
+            ASSERT_DOUBLE_EQ(sg4::Engine::get_clock(), 0.2);
+            ASSERT_EQ(cs_->get_num_dirty_blocks(), 2);
+            XBT_INFO("Flush the dirty blocks, which the HDD writes in 2s");
+            ASSERT_NO_THROW(cs_->flush());
+            ASSERT_DOUBLE_EQ(sg4::Engine::get_clock(), 2.2);
+            ASSERT_EQ(cs_->get_num_dirty_blocks(), 0);
+            ASSERT_EQ(cs_->get_num_flushed_blocks(), 2);
+            XBT_INFO("Overwrite the first 1MB, which hits the cache and makes the block dirty again");
+            ASSERT_NO_THROW(file->seek(0));
+            ASSERT_NO_THROW(file->write("1MB"));
+            ASSERT_EQ(cs_->get_num_write_hits(), 1);
+            ASSERT_EQ(cs_->get_num_dirty_blocks(), 1);
+            XBT_INFO("Write 4MB more, which evicts both blocks, one of which is written back");
+            ASSERT_NO_THROW(file->seek(2000000));
+            ASSERT_NO_THROW(file->write("4MB"));
+            ASSERT_EQ(cs_->get_num_evicted_blocks(), 2);
+            ASSERT_EQ(cs_->get_num_flushed_blocks(), 3);
+            ASSERT_EQ(cs_->get_num_dirty_blocks(), 4);
+            ASSERT_NO_THROW(file->close());
+        });
+        // Run the simulation
+        ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
+    });
+}
+
+TEST_F(CachedStorageTest, PeriodicFlush)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform(sgfs::CachedStorage::WritePolicy::WRITE_BACK);
+        cs_->set_flush_interval(1);
+        host_->add_actor("TestActor", [this]() {
+            std::shared_ptr<sgfs::File> file;
+            ASSERT_NO_THROW(fs_->create_file("/dev/a/bar.txt", "0B"));
+            ASSERT_NO_THROW(file = fs_->open("/dev/a/bar.txt", "w"));
+            XBT_INFO("Write 2MB, which the flusher writes to the HDD between 1s and 3s");
+            ASSERT_NO_THROW(file->write("2MB"));
+            ASSERT_NO_THROW(file->close());
+            sg4::this_actor::sleep_until(2);
+            ASSERT_EQ(cs_->get_num_dirty_blocks(), 0);
+            ASSERT_EQ(cs_->get_num_flushed_blocks(), 2);
+        });
+        // Run the simulation
+        ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
+    });
+}
+
+TEST_F(CachedStorageTest, DeletedFilesLoseTheirBlocks)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform(sgfs::CachedStorage::WritePolicy::WRITE_BACK);
+        host_->add_actor("TestActor", [this]() {
+            std::shared_ptr<sgfs::File> file;
+            ASSERT_NO_THROW(fs_->create_file("/dev/a/bar.txt", "0B"));
+            XBT_INFO("Write 2MB, which leaves two dirty blocks in the cache");
+            ASSERT_NO_THROW(file = fs_->open("/dev/a/bar.txt", "w"));
+            ASSERT_NO_THROW(file->write("2MB"));
+            ASSERT_NO_THROW(file->close());
+            ASSERT_EQ(cs_->get_num_cached_blocks(), 2);
+            ASSERT_EQ(cs_->get_num_dirty_blocks(), 2);
+            XBT_INFO("Delete the file, which drops its blocks without writing them back");
+            ASSERT_NO_THROW(fs_->unlink_file("/dev/a/bar.txt"));
+            ASSERT_EQ(cs_->get_num_cached_blocks(), 0);
+            ASSERT_EQ(cs_->get_num_dirty_blocks(), 0);
+            ASSERT_NO_THROW(cs_->flush());
+            ASSERT_EQ(cs_->get_num_flushed_blocks(), 0);
+        });
+        // Run the simulation
+        ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
+    });
+}
@@ -273,3 +273,60 @@ TEST_F(CachingTest, LRUExtensive)  {
         ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
     });
 }
+
+TEST_F(CachingTest, LRUOpenFilesKeepTheirPlace)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform();
+        host_->add_actor("TestActor", [this]() {
+            XBT_INFO("Create files of 20MB, 30MB, and 30MB at /dev/lru/a.txt, /dev/lru/b.txt, and /dev/lru/c.txt");
+            ASSERT_NO_THROW(fs_->create_file("/dev/lru/a.txt", "20MB"));
+            ASSERT_NO_THROW(fs_->create_file("/dev/lru/b.txt", "30MB"));
+            ASSERT_NO_THROW(fs_->create_file("/dev/lru/c.txt", "30MB"));
+            XBT_INFO("Access a.txt while it is open, then access b.txt, then close a.txt");
+            std::shared_ptr<sgfs::File> file;
+            ASSERT_NO_THROW(file = fs_->open("/dev/lru/a.txt", "r"));
+            ASSERT_NO_THROW(file->read(10));
+            auto file2 = fs_->open("/dev/lru/b.txt", "r");
+            ASSERT_NO_THROW(file2->read(10));
+            ASSERT_NO_THROW(file2->close());
+            ASSERT_NO_THROW(file->close());
+            XBT_INFO("Create a 60MB file, which evicts c.txt and a.txt, the least recently used files");
+            ASSERT_NO_THROW(fs_->create_file("/dev/lru/d.txt", "60MB"));
+            ASSERT_FALSE(fs_->file_exists("/dev/lru/a.txt"));
+            ASSERT_TRUE(fs_->file_exists("/dev/lru/b.txt"));
+            ASSERT_FALSE(fs_->file_exists("/dev/lru/c.txt"));
+            ASSERT_TRUE(fs_->file_exists("/dev/lru/d.txt"));
+        });
+
+        // Run the simulation
+        ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
+    });
+}
+
+TEST_F(CachingTest, FIFOMovedFiles)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform();
+        host_->add_actor("TestActor", [this]() {
+            XBT_INFO("Create files of 50MB and 40MB, and move the first one to another directory");
+            ASSERT_NO_THROW(fs_->create_file("/dev/fifo/a.txt", "50MB"));
+            ASSERT_NO_THROW(fs_->create_file("/dev/fifo/b.txt", "40MB"));
+            ASSERT_NO_THROW(fs_->move_file("/dev/fifo/a.txt", "/dev/fifo/dir/a.txt"));
+            XBT_INFO("Create two 30MB files, which evict b.txt and then the moved file");
+            ASSERT_NO_THROW(fs_->create_file("/dev/fifo/c.txt", "30MB"));
+            ASSERT_FALSE(fs_->file_exists("/dev/fifo/b.txt"));
+            ASSERT_TRUE(fs_->file_exists("/dev/fifo/dir/a.txt"));
+            ASSERT_NO_THROW(fs_->create_file("/dev/fifo/d.txt", "30MB"));
+            ASSERT_FALSE(fs_->file_exists("/dev/fifo/dir/a.txt"));
+            ASSERT_TRUE(fs_->file_exists("/dev/fifo/c.txt"));
+            XBT_INFO("Move d.txt over c.txt, and create a 90MB file, which evicts the moved file");
+            ASSERT_NO_THROW(fs_->move_file("/dev/fifo/d.txt", "/dev/fifo/c.txt"));
+            ASSERT_NO_THROW(fs_->create_file("/dev/fifo/e.txt", "90MB"));
+            ASSERT_FALSE(fs_->file_exists("/dev/fifo/c.txt"));
+            ASSERT_FALSE(fs_->file_exists("/dev/fifo/d.txt"));
+            ASSERT_TRUE(fs_->file_exists("/dev/fifo/e.txt"));
+        });
+
+        // Run the simulation
+        ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
+    });
+}
@@ -0,0 +1,204 @@
+/* Copyright (c) 2024-2026. The FSMOD Team. All rights reserved.          */
+
+/* This program is free software; you can redistribute it and/or modify it
+ * under the terms of the license (GNU LGPL) which comes with this package. */
+
+#include <gtest/gtest.h>
+#include <iostream>
+
+#include <simgrid/s4u/Actor.hpp>
+#include <simgrid/s4u/Engine.hpp>
+
+#include "fsmod/ClientCache.hpp"
+#include "fsmod/FileSystem.hpp"
+#include "fsmod/OneRemoteDiskStorage.hpp"
+#include "fsmod/FileSystemException.hpp"
+
+#include "./test_util.hpp"
+
+namespace sgfs=simgrid::fsmod;
+namespace sg4=simgrid::s4u;
+
+XBT_LOG_NEW_DEFAULT_CATEGORY(client_cache_test, "Client Cache Test");
+
+class ClientCacheTest : public ::testing::Test {
+public:
+    std::shared_ptr<sgfs::FileSystem> fs_;
+    std::shared_ptr<sgfs::ClientCache> cache_;
+    sg4::Host * client_;
+    sg4::Host * other_client_;
+    sg4::Host * server_;
+    sg4::Disk * client_disk_;
+    sg4::Disk * server_disk_;
+
+    ClientCacheTest() = default;
+
+    void setup_platform(bool use_cache_disk) {
+        XBT_INFO("Creating a platform with two client hosts and one server host with one disk...");
+        auto *my_zone = sg4::Engine::get_instance()->get_netzone_root()->add_netzone_full("zone");
+        client_ = my_zone->add_host("client", "100Gf");
+        client_disk_ = client_->add_disk("ssd", "100MBps", "100MBps");
+        other_client_ = my_zone->add_host("other_client", "100Gf");
+        server_ = my_zone->add_host("server", "100Gf");
+        server_disk_ = server_->add_disk("disk", "10MBps", "10MBps");
+        const auto* link = my_zone->add_link("link", 1e9);
+        my_zone->add_route(client_, server_, {link});
+        my_zone->add_route(other_client_, server_, {link});
+        my_zone->seal();
+
+        XBT_INFO("Creating a file system on a remote storage, with a 4MB client cache with 1MB blocks on the client...");
+        fs_ = sgfs::FileSystem::create("my_fs");
+        fs_->mount_partition("/dev/nfs/", sgfs::OneRemoteDiskStorage::create("nfs", server_disk_), "100MB");
+        cache_ = sgfs::ClientCache::create(client_, 4000000, 1000000, use_cache_disk ? client_disk_ : nullptr);
+        fs_->add_client_cache(cache_);
+        XBT_INFO("Create a 2MB file at /dev/nfs/foo.txt");
+        fs_->create_file("/dev/nfs/foo.txt", "2MB");
+    }
+};
+
+TEST_F(ClientCacheTest, BadArguments)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform(false);
+        XBT_INFO("Create client caches with invalid arguments, which should fail");
+        ASSERT_THROW(sgfs::ClientCache::create(nullptr, 4000000), std::invalid_argument);
+        ASSERT_THROW(sgfs::ClientCache::create(client_, 4000000, 0), std::invalid_argument);
+        ASSERT_THROW(sgfs::ClientCache::create(client_, 1000, 4096), std::invalid_argument);
+        ASSERT_THROW(sgfs::ClientCache::create(client_, 4000000, 1000000, server_disk_), std::invalid_argument);
+        ASSERT_THROW(cache_->set_attribute_cache_timeout(-1), std::invalid_argument);
+        XBT_INFO("A host has at most one client cache per file system");
+        ASSERT_THROW(fs_->add_client_cache(nullptr), std::invalid_argument);
+        ASSERT_THROW(fs_->add_client_cache(sgfs::ClientCache::create(client_, 4000000)), std::invalid_argument);
+        ASSERT_EQ(fs_->get_client_cache(client_), cache_);
+        ASSERT_EQ(fs_->get_client_cache(other_client_), nullptr);
+        ASSERT_EQ(cache_->get_cache_size(), 4000000);
+    });
+}
+
+TEST_F(ClientCacheTest, RereadsHitMemory)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform(false);
+        client_->add_actor("TestActor", [this]() {
+            std::shared_ptr<sgfs::File> file;
+            ASSERT_NO_THROW(file = fs_->open("/dev/nfs/foo.txt", "r"));
+            ASSERT_EQ(cache_->get_num_revalidations(), 1);
+            XBT_INFO("Read 2MB, which misses and is streamed from the server in 0.2s");
+            ASSERT_NO_THROW(file->read("2MB"));
+            ASSERT_NEAR(sg4::Engine::get_clock(), 0.2, 0.001);
+            ASSERT_EQ(cache_->get_num_read_misses(), 2);
+            XBT_INFO("Read the same 2MB again, which is served by the client's memory in zero time");
+            double date = sg4::Engine::get_clock();
+            ASSERT_NO_THROW(file->seek(0));
+            ASSERT_NO_THROW(file->read("2MB"));
+            ASSERT_DOUBLE_EQ(sg4::Engine::get_clock(), date);
+            ASSERT_EQ(cache_->get_num_read_hits(), 2);
+            ASSERT_EQ(cache_->get_num_revalidations(), 1);
+            ASSERT_NO_THROW(file->close());
+        });
+        other_client_->add_actor("OtherActor", [this]() {
+            sg4::this_actor::sleep_until(1);
+            XBT_INFO("Another host has no client cache, and its reads are streamed from the server");
+            std::shared_ptr<sgfs::File> file;
+            ASSERT_NO_THROW(file = fs_->open("/dev/nfs/foo.txt", "r"));
+            ASSERT_NO_THROW(file->read("2MB"));
+            ASSERT_NEAR(sg4::Engine::get_clock(), 1.2, 0.001);
+            ASSERT_EQ(cache_->get_num_read_hits(), 2);
+            ASSERT_NO_THROW(file->close());
+        });
+        // Run the simulation
+        ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
+    });
+}
+
+TEST_F(ClientCacheTest, RereadsHitDisk)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform(true);
+        client_->add_actor("TestActor", [this]() {
+            std::shared_ptr<sgfs::File> file;
+            ASSERT_NO_THROW(file = fs_->open("/dev/nfs/foo.txt", "r"));
+            ASSERT_NO_THROW(file->read("2MB"));
+            XBT_INFO("Read the same 2MB again, which is served by the client's cache disk in 0.02s");
+            sg4::this_actor::sleep_until(1);
+            ASSERT_NO_THROW(file->seek(0));
+            ASSERT_NO_THROW(file->read("2MB"));
+            ASSERT_NEAR(sg4::Engine::get_clock(), 1.02, 1e-6);
+            ASSERT_EQ(cache_->get_num_read_hits(), 2);
+            ASSERT_NO_THROW(file->close());
+        });
+        // Run the simulation
+        ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
+    });
+}
+
+TEST_F(ClientCacheTest, CloseToOpenConsistency)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform(false);
+        client_->add_actor("TestActor", [this]() {
+            std::shared_ptr<sgfs::File> file;
+            XBT_INFO("Write 1MB to a new file, which caches it");
+            ASSERT_NO_THROW(file = fs_->open("/dev/nfs/bar.txt", "w"));
+            ASSERT_NO_THROW(file->write("1MB"));
+            ASSERT_NO_THROW(file->close());
+            XBT_INFO("Reopen and read it, which hits: the client's own writes do not invalidate its cache");
+            ASSERT_NO_THROW(file = fs_->open("/dev/nfs/bar.txt", "r"));
+            ASSERT_NO_THROW(file->read("1MB"));
+            ASSERT_EQ(cache_->get_num_read_hits(), 1);
+            ASSERT_EQ(cache_->get_num_invalidations(), 0);
+            ASSERT_NO_THROW(file->close());
+            XBT_INFO("Reopen and read it once another host has modified it, which invalidates the cached block");
+            sg4::this_actor::sleep_until(2);
+            ASSERT_NO_THROW(file = fs_->open("/dev/nfs/bar.txt", "r"));
+            ASSERT_EQ(cache_->get_num_invalidations(), 1);
+            ASSERT_NO_THROW(file->read("1MB"));
+            ASSERT_NEAR(sg4::Engine::get_clock(), 2.1, 0.001);
+            ASSERT_EQ(cache_->get_num_read_hits(), 1);
+            ASSERT_EQ(cache_->get_num_read_misses(), 1);
+            ASSERT_NO_THROW(file->close());
+        });
+        other_client_->add_actor("OtherActor", [this]() {
+            sg4::this_actor::sleep_until(1);
+            std::shared_ptr<sgfs::File> file;
+            ASSERT_NO_THROW(file = fs_->open("/dev/nfs/bar.txt", "r+"));
+            ASSERT_NO_THROW(file->write("1MB"));
+            ASSERT_NO_THROW(file->close());
+        });
+        // Run the simulation
+        ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
+    });
+}
+
+TEST_F(ClientCacheTest, AttributeCacheTimeout)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform(false);
+        client_->add_actor("TestActor", [this]() {
+            std::shared_ptr<sgfs::File> file;
+            ASSERT_NO_THROW(file = fs_->open("/dev/nfs/foo.txt", "r"));
+            ASSERT_NO_THROW(file->read("1MB"));
+            XBT_INFO("Another host modifies the file at time 1. Reading it again at time 2, while its attributes "
+                     "are still trusted, hits the (stale) cache");
+            sg4::this_actor::sleep_until(2);
+            ASSERT_NO_THROW(file->seek(0));
+            ASSERT_NO_THROW(file->read("1MB"));
+            ASSERT_DOUBLE_EQ(sg4::Engine::get_clock(), 2);
+            ASSERT_EQ(cache_->get_num_read_hits(), 1);
+            XBT_INFO("Reading it again at time 4, after the 3s attribute cache timeout, revalidates the attributes "
+                     "and misses");
+            sg4::this_actor::sleep_until(4);
+            ASSERT_NO_THROW(file->seek(0));
+            ASSERT_NO_THROW(file->read("1MB"));
+            ASSERT_NEAR(sg4::Engine::get_clock(), 4.1, 0.001);
+            ASSERT_EQ(cache_->get_num_revalidations(), 2);
+            ASSERT_EQ(cache_->get_num_invalidations(), 1);
+            ASSERT_EQ(cache_->get_num_read_misses(), 2);
+            ASSERT_NO_THROW(file->close());
+        });
+        other_client_->add_actor("OtherActor", [this]() {
+            sg4::this_actor::sleep_until(1);
+            std::shared_ptr<sgfs::File> file;
+            ASSERT_NO_THROW(file = fs_->open("/dev/nfs/foo.txt", "r+"));
+            ASSERT_NO_THROW(file->write("1MB"));
+            ASSERT_NO_THROW(file->close());
+        });
+        // Run the simulation
+        ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
+    });
+}
@@ -0,0 +1,121 @@
+/* Copyright (c) 2024-2026. The FSMOD Team. All rights reserved.          */
+
+/* This program is free software; you can redistribute it and/or modify it
+ * under the terms of the license (GNU LGPL) which comes with this package. */
+
+#include <gtest/gtest.h>
+#include <iostream>
+
+#include <simgrid/s4u/Actor.hpp>
+#include <simgrid/s4u/Engine.hpp>
+
+#include "fsmod/FileSystem.hpp"
+#include "fsmod/OneDiskStorage.hpp"
+#include "fsmod/FileSystemException.hpp"
+
+#include "./test_util.hpp"
+
+namespace sgfs=simgrid::fsmod;
+namespace sg4=simgrid::s4u;
+
+XBT_LOG_NEW_DEFAULT_CATEGORY(compression_test, "Compression Test");
+
+class CompressionTest : public ::testing::Test {
+public:
+    std::shared_ptr<sgfs::FileSystem> fs_;
+    std::shared_ptr<sgfs::Partition> partition_;
+    sg4::Host * host_;
+    sg4::Disk * disk_;
+
+    CompressionTest() = default;
+
+    void setup_platform() {
+        XBT_INFO("Creating a platform with one 100Gf host and one 100MBps disk...");
+        auto *my_zone = sg4::Engine::get_instance()->get_netzone_root()->add_netzone_full("zone");
+        host_ = my_zone->add_host("my_host", "100Gf");
+        disk_ = host_->add_disk("disk", "100MBps", "100MBps");
+        my_zone->seal();
+
+        XBT_INFO("Creating a one-disk storage on the host's disk...");
+        auto ods = sgfs::OneDiskStorage::create("my_storage", disk_);
+        XBT_INFO("Creating a file system with a 100MB partition...");
+        fs_ = sgfs::FileSystem::create("my_fs");
+        fs_->mount_partition("/dev/a/", ods, "100MB");
+        partition_ = fs_->partition_by_name("/dev/a");
+    }
+};
+
+TEST_F(CompressionTest, BadArguments)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform();
+        XBT_INFO("Configure compression with invalid arguments, which should fail");
+        ASSERT_THROW(partition_->set_compression(0.5), std::invalid_argument);
+        ASSERT_THROW(partition_->set_compression(2, -1), std::invalid_argument);
+        ASSERT_THROW(partition_->set_compression(2, 10, -1), std::invalid_argument);
+        ASSERT_DOUBLE_EQ(partition_->get_compression_ratio(), 1.0);
+        ASSERT_THROW(fs_->set_file_compression_ratio("/dev/a/foo.txt", 2), sgfs::FileNotFoundException);
+        fs_->create_file("/dev/a/foo.txt", "10MB");
+        ASSERT_THROW(fs_->set_file_compression_ratio("/dev/a/foo.txt", 0.5), std::invalid_argument);
+    });
+}
+
+TEST_F(CompressionTest, FreeSpace)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform();
+        XBT_INFO("Create a 10MB file before enabling compression, which uses 10MB");
+        fs_->create_file("/dev/a/foo.txt", "10MB");
+        ASSERT_EQ(partition_->get_free_space(), 90000000);
+        XBT_INFO("Enable a 2:1 compression and create a 10MB file, which uses 5MB");
+        partition_->set_compression(2);
+        fs_->create_file("/dev/a/bar.txt", "10MB");
+        ASSERT_EQ(partition_->get_free_space(), 85000000);
+        ASSERT_EQ(fs_->file_size("/dev/a/bar.txt"), 10000000);
+        XBT_INFO("Compress the first file 4:1, which frees 7.5MB");
+        ASSERT_NO_THROW(fs_->set_file_compression_ratio("/dev/a/foo.txt", 4));
+        ASSERT_EQ(partition_->get_free_space(), 92500000);
+        XBT_INFO("Truncate 6MB from the second file and delete the first one");
+        fs_->truncate_file("/dev/a/bar.txt", 6000000);
+        ASSERT_EQ(partition_->get_free_space(), 95500000);
+        fs_->unlink_file("/dev/a/foo.txt");
+        ASSERT_EQ(partition_->get_free_space(), 98000000);
+        XBT_INFO("A 150MB file fits once compressed");
+        ASSERT_NO_THROW(fs_->create_file("/dev/a/big.txt", "150MB"));
+        ASSERT_EQ(partition_->get_free_space(), 23000000);
+    });
+}
+
+TEST_F(CompressionTest, ReadAndWriteCosts)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform();
+        XBT_INFO("Enable a 2:1 compression that costs 100 flops per byte to compress and 50 to decompress");
+        partition_->set_compression(2, 100, 50);
+        host_->add_actor("TestActor", [this]() {
+            std::shared_ptr<sgfs::File> file;
+            ASSERT_NO_THROW(file = fs_->open("/dev/a/foo.txt", "w"));
+            XBT_INFO("Write 10MB, which computes for 0.01s and writes 5MB in 0.05s");
+            ASSERT_NO_THROW(file->write("10MB"));
+            ASSERT_NEAR(sg4::Engine::get_clock(), 0.06, 1e-6);
+            ASSERT_EQ(partition_->get_free_space(), 95000000);
+            XBT_INFO("Asynchronously write 10MB more, which takes as long");
+            double date = sg4::Engine::get_clock();
+            ASSERT_NO_THROW(file->write_async("10MB")->wait());
+            ASSERT_NEAR(sg4::Engine::get_clock() - date, 0.06, 1e-6);
+            ASSERT_EQ(partition_->get_free_space(), 90000000);
+            ASSERT_THROW(fs_->set_file_compression_ratio("/dev/a/foo.txt", 4), sgfs::FileIsOpenException);
+            ASSERT_NO_THROW(file->close());
+
+            ASSERT_NO_THROW(file = fs_->open("/dev/a/foo.txt", "r"));
+            XBT_INFO("Read 10MB, which reads 5MB in 0.05s and decompresses them in 0.005s");
+            date = sg4::Engine::get_clock();
+            ASSERT_NO_THROW(file->read("10MB"));
+            ASSERT_NEAR(sg4::Engine::get_clock() - date, 0.055, 1e-6);
+            XBT_INFO("Asynchronously read 10MB, which takes as long");
+            date = sg4::Engine::get_clock();
+            ASSERT_NO_THROW(file->read_async("10MB")->wait());
+            ASSERT_NEAR(sg4::Engine::get_clock() - date, 0.055, 1e-6);
+            ASSERT_NO_THROW(file->close());
+        });
+        // Run the simulation
+        ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
+    });
+}
@@ -0,0 +1,143 @@
+/* Copyright (c) 2024-2026. The FSMOD Team. All rights reserved.          */
+
+/* This program is free software; you can redistribute it and/or modify it
+ * under the terms of the license (GNU LGPL) which comes with this package. */
+
+#include <gtest/gtest.h>
+#include <iostream>
+
+#include <simgrid/s4u/Actor.hpp>
+#include <simgrid/s4u/Engine.hpp>
+
+#include "fsmod/FileSystem.hpp"
+#include "fsmod/OneDiskStorage.hpp"
+#include "fsmod/FileSystemException.hpp"
+
+#include "./test_util.hpp"
+
+namespace sgfs=simgrid::fsmod;
+namespace sg4=simgrid::s4u;
+
+XBT_LOG_NEW_DEFAULT_CATEGORY(deduplication_test, "Deduplication Test");
+
+class DeduplicationTest : public ::testing::Test {
+public:
+    std::shared_ptr<sgfs::FileSystem> fs_;
+    std::shared_ptr<sgfs::Partition> partition_;
+    sg4::Host * host_;
+    sg4::Disk * disk_;
+
+    DeduplicationTest() = default;
+
+    void setup_platform() {
+        XBT_INFO("Creating a platform with one 100Gf host and one 100MBps disk...");
+        auto *my_zone = sg4::Engine::get_instance()->get_netzone_root()->add_netzone_full("zone");
+        host_ = my_zone->add_host("my_host", "100Gf");
+        disk_ = host_->add_disk("disk", "100MBps", "100MBps");
+        my_zone->seal();
+
+        XBT_INFO("Creating a one-disk storage on the host's disk...");
+        auto ods = sgfs::OneDiskStorage::create("my_storage", disk_);
+        XBT_INFO("Creating a file system with a 100MB partition...");
+        fs_ = sgfs::FileSystem::create("my_fs");
+        fs_->mount_partition("/dev/a/", ods, "100MB");
+        partition_ = fs_->partition_by_name("/dev/a");
+    }
+};
+
+TEST_F(DeduplicationTest, BadArguments)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform();
+        XBT_INFO("Configure deduplication with invalid arguments, which should fail");
+        ASSERT_THROW(partition_->set_deduplication(0), std::invalid_argument);
+        ASSERT_THROW(partition_->set_deduplication(1000000, -1), std::invalid_argument);
+        ASSERT_EQ(partition_->get_deduplication_chunk_size(), 0);
+        ASSERT_DOUBLE_EQ(partition_->get_deduplication_ratio(), 1.0);
+        XBT_INFO("Deduplication cannot be configured once the partition holds files");
+        fs_->create_file("/dev/a/foo.txt", "1MB");
+        ASSERT_THROW(partition_->set_deduplication(1000000), std::invalid_argument);
+        ASSERT_THROW(fs_->set_file_fingerprint("/dev/a/bar.txt", "bar"), sgfs::FileNotFoundException);
+    });
+}
+
+TEST_F(DeduplicationTest, FreeSpace)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform();
+        XBT_INFO("Deduplicate 1MB chunks");
+        partition_->set_deduplication(1000000);
+        XBT_INFO("Create two 10MB images with the same content, which are stored once");
+        fs_->create_file("/dev/a/a.img", "10MB");
+        ASSERT_EQ(partition_->get_free_space(), 90000000);
+        ASSERT_NO_THROW(fs_->set_file_fingerprint("/dev/a/a.img", "base"));
+        fs_->create_file("/dev/a/b.img", "10MB");
+        ASSERT_NO_THROW(fs_->set_file_fingerprint("/dev/a/b.img", "base"));
+        ASSERT_EQ(partition_->get_free_space(), 90000000);
+        ASSERT_EQ(partition_->get_num_unique_chunks(), 10);
+        ASSERT_DOUBLE_EQ(partition_->get_deduplication_ratio(), 2.0);
+        XBT_INFO("Create a 15MB image that extends them, which stores 5 more chunks");
+        fs_->create_file("/dev/a/c.img", "15MB");
+        ASSERT_NO_THROW(fs_->set_file_fingerprint("/dev/a/c.img", "base"));
+        ASSERT_EQ(partition_->get_free_space(), 85000000);
+        ASSERT_DOUBLE_EQ(partition_->get_deduplication_ratio(), 35.0 / 15.0);
+        XBT_INFO("Create a 2.5MB image, whose last chunk is partial");
+        fs_->create_file("/dev/a/d.img", "2500kB");
+        ASSERT_NO_THROW(fs_->set_file_fingerprint("/dev/a/d.img", "base"));
+        ASSERT_EQ(partition_->get_free_space(), 84500000);
+        XBT_INFO("Deleting or truncating files only frees the chunks that no other file references");
+        ASSERT_NO_THROW(fs_->unlink_file("/dev/a/a.img"));
+        ASSERT_NO_THROW(fs_->unlink_file("/dev/a/b.img"));
+        ASSERT_EQ(partition_->get_free_space(), 84500000);
+        ASSERT_NO_THROW(fs_->unlink_file("/dev/a/c.img"));
+        ASSERT_EQ(partition_->get_free_space(), 97500000);
+        ASSERT_NO_THROW(fs_->truncate_file("/dev/a/d.img", 500000));
+        ASSERT_EQ(partition_->get_free_space(), 98000000);
+        ASSERT_NO_THROW(fs_->unlink_file("/dev/a/d.img"));
+        ASSERT_EQ(partition_->get_free_space(), 100000000);
+        XBT_INFO("Describe the chunks of a 3MB file, two of which are the same");
+        fs_->create_file("/dev/a/e.img", "3MB");
+        ASSERT_NO_THROW(fs_->set_file_chunk_fingerprints("/dev/a/e.img", {"x", "x", "y"}));
+        ASSERT_EQ(partition_->get_free_space(), 98000000);
+        ASSERT_DOUBLE_EQ(partition_->get_deduplication_ratio(), 1.5);
+    });
+}
+
+TEST_F(DeduplicationTest, DuplicateWrites)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform();
+        XBT_INFO("Deduplicate 1MB chunks, hashing 10 flops per byte");
+        partition_->set_deduplication(1000000, 10);
+        fs_->create_file("/dev/a/base.img", "10MB");
+        fs_->set_file_fingerprint("/dev/a/base.img", "base");
+        fs_->create_file("/dev/a/copy.img", "0B");
+        fs_->set_file_fingerprint("/dev/a/copy.img", "base");
+        host_->add_actor("TestActor", [this]() {
+            std::shared_ptr<sgfs::File> file;
+            ASSERT_NO_THROW(file = fs_->open("/dev/a/copy.img", "w"));
+            XBT_INFO("Write a 10MB copy of the image, which only hashes it");
+            ASSERT_NO_THROW(file->write("10MB"));
+            ASSERT_NEAR(sg4::Engine::get_clock(), 0.001, 1e-6);
+            ASSERT_EQ(partition_->get_free_space(), 90000000);
+            XBT_INFO("Write 5MB more, which hashes them and stores 5 new chunks");
+            double date = sg4::Engine::get_clock();
+            ASSERT_NO_THROW(file->write("5MB"));
+            ASSERT_NEAR(sg4::Engine::get_clock() - date, 0.0005 + 0.05, 1e-6);
+            ASSERT_EQ(partition_->get_free_space(), 85000000);
+            ASSERT_NO_THROW(file->close());
+
+            XBT_INFO("Asynchronously write 10MB to another copy and to a file with new content");
+            ASSERT_NO_THROW(file = fs_->open("/dev/a/copy.img", "w"));
+            date = sg4::Engine::get_clock();
+            ASSERT_NO_THROW(file->write_async("10MB")->wait());
+            ASSERT_NEAR(sg4::Engine::get_clock() - date, 0.001, 1e-6);
+            ASSERT_NO_THROW(file->close());
+            ASSERT_NO_THROW(file = fs_->open("/dev/a/new.img", "w"));
+            date = sg4::Engine::get_clock();
+            ASSERT_NO_THROW(file->write_async("10MB")->wait());
+            ASSERT_NEAR(sg4::Engine::get_clock() - date, 0.001 + 0.1, 1e-6);
+            ASSERT_EQ(partition_->get_free_space(), 80000000);
+            ASSERT_NO_THROW(file->close());
+        });
+        // Run the simulation
+        ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
+    });
+}
@@ -0,0 +1,123 @@
+/* Copyright (c) 2024-2026. The FSMOD Team. All rights reserved.          */
+
+/* This program is free software; you can redistribute it and/or modify it
+ * under the terms of the license (GNU LGPL) which comes with this package. */
+
+#include <gtest/gtest.h>
+#include <iostream>
+
+#include <simgrid/s4u/Actor.hpp>
+#include <simgrid/s4u/Engine.hpp>
+
+#include "fsmod/FileSystem.hpp"
+#include "fsmod/OneDiskStorage.hpp"
+#include "fsmod/FileSystemException.hpp"
+
+#include "./test_util.hpp"
+
+namespace sgfs=simgrid::fsmod;
+namespace sg4=simgrid::s4u;
+
+XBT_LOG_NEW_DEFAULT_CATEGORY(directory_lock_test, "Directory Lock Test");
+
+class DirectoryLockTest : public ::testing::Test {
+public:
+    std::shared_ptr<sgfs::FileSystem> fs_;
+    std::shared_ptr<sgfs::Partition> partition_;
+    sg4::Host * host_;
+
+    DirectoryLockTest() = default;
+
+    void setup_platform() {
+        XBT_INFO("Creating a platform with one host and one disk...");
+        auto *my_zone = sg4::Engine::get_instance()->get_netzone_root()->add_netzone_full("zone");
+        host_ = my_zone->add_host("my_host", "100Gf");
+        auto* disk = host_->add_disk("disk", "1MBps", "1MBps");
+        my_zone->seal();
+
+        XBT_INFO("Creating a file system with a 100MB partition on a one-disk storage...");
+        auto ods = sgfs::OneDiskStorage::create("my_storage", disk);
+        fs_ = sgfs::FileSystem::create("my_fs");
+        fs_->mount_partition("/dev/a/", ods, "100MB");
+        XBT_INFO("Make metadata mutations hold directory locks for 0.1s");
+        partition_ = fs_->partition_by_name("/dev/a");
+        partition_->set_directory_lock_hold_time(0.1);
+    }
+};
+
+TEST_F(DirectoryLockTest, BadArguments)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform();
+        ASSERT_THROW(partition_->set_directory_lock_hold_time(-1), std::invalid_argument);
+        XBT_INFO("Create a file outside of an actor, which is free");
+        ASSERT_NO_THROW(fs_->create_file("/dev/a/dir/foo.txt", "1kB"));
+        ASSERT_EQ(fs_->get_directory_lock_statistics("/dev/a/dir").num_mutations, 0);
+        ASSERT_THROW((void)fs_->get_directory_lock_statistics("/dev/b/dir"), sgfs::InvalidPathException);
+    });
+}
+
+TEST_F(DirectoryLockTest, CreatesInSameDirectoryQueue)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform();
+        XBT_INFO("Four actors create a file each in the same directory at the same time");
+        for (int i = 0; i < 4; i++) {
+            host_->add_actor("Creator_" + std::to_string(i), [this, i]() {
+                ASSERT_NO_THROW(fs_->create_file("/dev/a/dir/file_" + std::to_string(i), "1kB"));
+                ASSERT_DOUBLE_EQ(sg4::Engine::get_clock(), 0.1 * (i + 1));
+            });
+        }
+        // Run the simulation
+        ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
+        auto statistics = fs_->get_directory_lock_statistics("/dev/a/dir");
+        ASSERT_EQ(statistics.num_mutations, 4);
+        ASSERT_EQ(statistics.num_waits, 3);
+        ASSERT_DOUBLE_EQ(statistics.total_wait_time, 0.6);
+        ASSERT_DOUBLE_EQ(statistics.max_wait_time, 0.3);
+    });
+}
+
+TEST_F(DirectoryLockTest, CreatesInDifferentDirectoriesProceedInParallel)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform();
+        XBT_INFO("Four actors create a file each in their own directory at the same time");
+        for (int i = 0; i < 4; i++) {
+            host_->add_actor("Creator_" + std::to_string(i), [this, i]() {
+                ASSERT_NO_THROW(fs_->create_file("/dev/a/dir_" + std::to_string(i) + "/file", "1kB"));
+                ASSERT_DOUBLE_EQ(sg4::Engine::get_clock(), 0.1);
+            });
+        }
+        // Run the simulation
+        ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
+        for (int i = 0; i < 4; i++) {
+            auto statistics = fs_->get_directory_lock_statistics("/dev/a/dir_" + std::to_string(i));
+            ASSERT_EQ(statistics.num_mutations, 1);
+            ASSERT_EQ(statistics.num_waits, 0);
+        }
+    });
+}
+
+TEST_F(DirectoryLockTest, MovesLockBothDirectories)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform();
+        ASSERT_NO_THROW(fs_->create_file("/dev/a/src/foo.txt", "1kB"));
+        ASSERT_NO_THROW(fs_->create_file("/dev/a/foo.txt", "1kB"));
+        XBT_INFO("Move a file from one directory to another while other actors mutate both directories");
+        host_->add_actor("Mover", [this]() {
+            ASSERT_NO_THROW(fs_->move_file("/dev/a/src/foo.txt", "/dev/a/dst/foo.txt"));
+            ASSERT_DOUBLE_EQ(sg4::Engine::get_clock(), 0.1);
+        });
+        host_->add_actor("Creator", [this]() {
+            ASSERT_NO_THROW(fs_->create_file("/dev/a/dst/bar.txt", "1kB"));
+            ASSERT_DOUBLE_EQ(sg4::Engine::get_clock(), 0.2);
+        });
+        host_->add_actor("Unlinker", [this]() {
+            ASSERT_NO_THROW(fs_->unlink_file("/dev/a/foo.txt"));
+            ASSERT_DOUBLE_EQ(sg4::Engine::get_clock(), 0.1);
+        });
+        // Run the simulation
+        ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
+        ASSERT_EQ(fs_->get_directory_lock_statistics("/dev/a/src").num_mutations, 1);
+        ASSERT_EQ(fs_->get_directory_lock_statistics("/dev/a/dst").num_waits, 1);
+        ASSERT_EQ(fs_->get_directory_lock_statistics("/dev/a/").num_mutations, 1);
+    });
+}
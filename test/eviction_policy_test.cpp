@@ -0,0 +1,468 @@
+/* Copyright (c) 2024-2026. The FSMOD Team. All rights reserved.          */
+
+/* This program is free software; you can redistribute it and/or modify it
+ * under the terms of the license (GNU LGPL) which comes with this package. */
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <iostream>
+#include <set>
+
+#include <simgrid/s4u/Actor.hpp>
+#include <simgrid/s4u/Engine.hpp>
+
+#include "fsmod/FileSystem.hpp"
+#include "fsmod/OneDiskStorage.hpp"
+#include "fsmod/EvictionPolicy.hpp"
+#include "fsmod/FileSystemException.hpp"
+
+#include "./test_util.hpp"
+
+namespace sgfs=simgrid::fsmod;
+namespace sg4=simgrid::s4u;
+
+XBT_LOG_NEW_DEFAULT_CATEGORY(eviction_policy_test, "Eviction Policy Test");
+
+// A user-defined policy that evicts the largest files first, and counts the events it is notified of
+class LargestFirstEvictionPolicy : public sgfs::EvictionPolicy {
+public:
+    std::set<const sgfs::FileMetadata*> files_;
+    int num_creations_ = 0;
+    int num_accesses_ = 0;
+    int num_deletions_ = 0;
+    int num_pin_changes_ = 0;
+    // Return every file, pinned ones included, to check that the partition never evicts those
+    bool include_pinned_files_ = false;
+
+    void on_create(const sgfs::FileMetadata *file_metadata) override {
+        files_.insert(file_metadata);
+        num_creations_++;
+    }
+    void on_access(const sgfs::FileMetadata *file_metadata) override { num_accesses_++; }
+    void on_delete(const sgfs::FileMetadata *file_metadata) override {
+        files_.erase(file_metadata);
+        num_deletions_++;
+    }
+    void on_pin_change(const sgfs::FileMetadata *file_metadata) override { num_pin_changes_++; }
+
+    std::vector<const sgfs::FileMetadata*> select_victims(sg_size_t num_bytes) override {
+        std::vector<const sgfs::FileMetadata*> victims;
+        for (const auto* file : files_)
+            if (include_pinned_files_ || not file->is_pinned())
+                victims.push_back(file);
+        std::sort(victims.begin(), victims.end(), [](const auto* a, const auto* b) {
+            return a->get_current_size() > b->get_current_size();
+        });
+        return victims;
+    }
+};
+
+class EvictionPolicyTest : public ::testing::Test {
+public:
+    std::shared_ptr<sgfs::FileSystem> fs_;
+    std::shared_ptr<sgfs::OneDiskStorage> ods_;
+    std::shared_ptr<LargestFirstEvictionPolicy> policy_;
+    sg4::Host * host_;
+    sg4::Disk * disk_;
+
+    EvictionPolicyTest() = default;
+
+    void setup_platform() {
+        XBT_INFO("Creating a platform with one host and one disk...");
+        auto *my_zone = sg4::Engine::get_instance()->get_netzone_root()->add_netzone_full("zone");
+        host_ = my_zone->add_host("my_host", "100Gf");
+        disk_ = host_->add_disk("disk", "1kBps", "2kBps");
+        my_zone->seal();
+
+        XBT_INFO("Creating a one-disk storage on the host's disk...");
+        ods_ = sgfs::OneDiskStorage::create("my_storage", disk_);
+        XBT_INFO("Creating a file system...");
+        fs_ = sgfs::FileSystem::create("my_fs");
+        XBT_INFO("Mounting a 100MB partition that evicts the largest files first...");
+        policy_ = std::make_shared<LargestFirstEvictionPolicy>();
+        fs_->mount_partition("/dev/a/", ods_, "100MB", policy_);
+    }
+
+    void access(const std::string& path) {
+        auto file = fs_->open(path, "r");
+        file->read("1kB");
+        file->close();
+    }
+
+    void check_files(const std::string& partition, const std::vector<std::string>& present,
+                     const std::vector<std::string>& evicted) {
+        for (const auto& name : present)
+            ASSERT_TRUE(fs_->file_exists(partition + name)) << name << " should be cached";
+        for (const auto& name : evicted)
+            ASSERT_FALSE(fs_->file_exists(partition + name)) << name << " should have been evicted";
+    }
+};
+
+TEST_F(EvictionPolicyTest, Events)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform();
+        host_->add_actor("TestActor", [this]() {
+            ASSERT_EQ(fs_->get_partition_for_path_or_null("/dev/a/")->get_eviction_policy(), policy_);
+            XBT_INFO("Create a file, which the policy is notified of");
+            ASSERT_NO_THROW(fs_->create_file("/dev/a/foo.txt", "10MB"));
+            ASSERT_EQ(policy_->num_creations_, 1);
+            ASSERT_EQ(policy_->files_.size(), 1);
+            XBT_INFO("Open, read, and close the file, which pins, accesses, and unpins it");
+            int num_accesses = policy_->num_accesses_;
+            int num_pin_changes = policy_->num_pin_changes_;
+            std::shared_ptr<sgfs::File> file;
+            ASSERT_NO_THROW(file = fs_->open("/dev/a/foo.txt", "r"));
+            ASSERT_EQ(policy_->num_pin_changes_, num_pin_changes + 1);
+            ASSERT_TRUE((*policy_->files_.begin())->is_pinned());
+            ASSERT_NO_THROW(file->read("1kB"));
+            ASSERT_GT(policy_->num_accesses_, num_accesses);
+            ASSERT_NO_THROW(file->close());
+            ASSERT_EQ(policy_->num_pin_changes_, num_pin_changes + 2);
+            ASSERT_FALSE((*policy_->files_.begin())->is_pinned());
+            XBT_INFO("Make the file unevictable twice, which pins it once");
+            ASSERT_NO_THROW(fs_->make_file_evictable("/dev/a/foo.txt", false));
+            ASSERT_NO_THROW(fs_->make_file_evictable("/dev/a/foo.txt", false));
+            ASSERT_EQ(policy_->num_pin_changes_, num_pin_changes + 3);
+            XBT_INFO("Delete the file, which the policy is notified of");
+            ASSERT_NO_THROW(fs_->unlink_file("/dev/a/foo.txt"));
+            ASSERT_EQ(policy_->num_deletions_, 1);
+            ASSERT_TRUE(policy_->files_.empty());
+        });
+        // Run the simulation
+        ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
+    });
+}
+
+TEST_F(EvictionPolicyTest, EvictionFollowsThePolicy)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform();
+        host_->add_actor("TestActor", [this]() {
+            XBT_INFO("Create files of 10MB, 50MB, and 30MB");
+            ASSERT_NO_THROW(fs_->create_file("/dev/a/10mb.txt", "10MB"));
+            ASSERT_NO_THROW(fs_->create_file("/dev/a/50mb.txt", "50MB"));
+            ASSERT_NO_THROW(fs_->create_file("/dev/a/30mb.txt", "30MB"));
+            XBT_INFO("Create a 20MB file, which evicts the largest file rather than the oldest one");
+            ASSERT_NO_THROW(fs_->create_file("/dev/a/20mb.txt", "20MB"));
+            ASSERT_TRUE(fs_->file_exists("/dev/a/10mb.txt"));
+            ASSERT_FALSE(fs_->file_exists("/dev/a/50mb.txt"));
+            ASSERT_TRUE(fs_->file_exists("/dev/a/30mb.txt"));
+            ASSERT_TRUE(fs_->file_exists("/dev/a/20mb.txt"));
+            ASSERT_EQ(policy_->num_deletions_, 1);
+            XBT_INFO("Write 50MB to the 10MB file, which evicts the 30MB file, but neither the file itself nor the "
+                     "20MB file");
+            std::shared_ptr<sgfs::File> file;
+            ASSERT_NO_THROW(file = fs_->open("/dev/a/10mb.txt", "a"));
+            ASSERT_NO_THROW(file->write("50MB"));
+            ASSERT_NO_THROW(file->close());
+            ASSERT_TRUE(fs_->file_exists("/dev/a/10mb.txt"));
+            ASSERT_FALSE(fs_->file_exists("/dev/a/30mb.txt"));
+            ASSERT_TRUE(fs_->file_exists("/dev/a/20mb.txt"));
+            ASSERT_EQ(fs_->file_size("/dev/a/10mb.txt"), 60000000);
+            ASSERT_EQ(fs_->get_free_space_at_path("/dev/a/"), 20000000);
+        });
+        // Run the simulation
+        ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
+    });
+}
+
+TEST_F(EvictionPolicyTest, PinnedFilesAreNeverEvicted)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform();
+        policy_->include_pinned_files_ = true;
+        host_->add_actor("TestActor", [this]() {
+            XBT_INFO("Create files of 50MB and 40MB, open the first, and make the second unevictable");
+            ASSERT_NO_THROW(fs_->create_file("/dev/a/50mb.txt", "50MB"));
+            ASSERT_NO_THROW(fs_->create_file("/dev/a/40mb.txt", "40MB"));
+            std::shared_ptr<sgfs::File> file;
+            ASSERT_NO_THROW(file = fs_->open("/dev/a/50mb.txt", "r"));
+            ASSERT_NO_THROW(fs_->make_file_evictable("/dev/a/40mb.txt", false));
+            XBT_INFO("Create a 20MB file, which fails even though the policy selects the pinned files");
+            ASSERT_THROW(fs_->create_file("/dev/a/20mb.txt", "20MB"), sgfs::NotEnoughSpaceException);
+            ASSERT_TRUE(fs_->file_exists("/dev/a/50mb.txt"));
+            ASSERT_TRUE(fs_->file_exists("/dev/a/40mb.txt"));
+            ASSERT_FALSE(fs_->file_exists("/dev/a/20mb.txt"));
+            ASSERT_EQ(fs_->get_free_space_at_path("/dev/a/"), 10000000);
+            XBT_INFO("Close the first file, after which the 20MB file evicts it");
+            ASSERT_NO_THROW(file->close());
+            ASSERT_NO_THROW(fs_->create_file("/dev/a/20mb.txt", "20MB"));
+            ASSERT_FALSE(fs_->file_exists("/dev/a/50mb.txt"));
+            ASSERT_TRUE(fs_->file_exists("/dev/a/40mb.txt"));
+            ASSERT_TRUE(fs_->file_exists("/dev/a/20mb.txt"));
+        });
+        // Run the simulation
+        ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
+    });
+}
+
+TEST_F(EvictionPolicyTest, BuiltInPolicies)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform();
+        XBT_INFO("Mount partitions with explicit FIFO and LRU policies, and one without a policy");
+        fs_->mount_partition("/dev/fifo/", ods_, "100MB", std::make_shared<sgfs::FIFOEvictionPolicy>());
+        fs_->mount_partition("/dev/lru/", ods_, "100MB", std::make_shared<sgfs::LRUEvictionPolicy>());
+        fs_->mount_partition("/dev/none/", ods_, "100MB", std::shared_ptr<sgfs::EvictionPolicy>(nullptr));
+        ASSERT_EQ(fs_->get_partition_for_path_or_null("/dev/none/")->get_eviction_policy(), nullptr);
+        host_->add_actor("TestActor", [this]() {
+            for (const std::string partition : {"/dev/fifo/", "/dev/lru/", "/dev/none/"}) {
+                XBT_INFO("Create files of 20MB and 60MB on %s, then read the first one", partition.c_str());
+                ASSERT_NO_THROW(fs_->create_file(partition + "20mb.txt", "20MB"));
+                ASSERT_NO_THROW(fs_->create_file(partition + "60mb.txt", "60MB"));
+                std::shared_ptr<sgfs::File> file;
+                ASSERT_NO_THROW(file = fs_->open(partition + "20mb.txt", "r"));
+                ASSERT_NO_THROW(file->read("1kB"));
+                ASSERT_NO_THROW(file->close());
+                XBT_INFO("Create a 30MB file on %s", partition.c_str());
+                if (partition == "/dev/none/") {
+                    ASSERT_THROW(fs_->create_file(partition + "30mb.txt", "30MB"), sgfs::NotEnoughSpaceException);
+                    continue;
+                }
+                ASSERT_NO_THROW(fs_->create_file(partition + "30mb.txt", "30MB"));
+                // FIFO evicts the oldest file, LRU the least recently used one
+                ASSERT_EQ(fs_->file_exists(partition + "20mb.txt"), partition == "/dev/lru/");
+                ASSERT_EQ(fs_->file_exists(partition + "60mb.txt"), partition == "/dev/fifo/");
+            }
+        });
+        // Run the simulation
+        ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
+    });
+}
+
+TEST_F(EvictionPolicyTest, AdvancedPoliciesBadArguments)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform();
+        XBT_INFO("Create policies with invalid queue fractions, which should fail");
+        ASSERT_THROW(std::make_shared<sgfs::TwoQEvictionPolicy>(0), std::invalid_argument);
+        ASSERT_THROW(std::make_shared<sgfs::TwoQEvictionPolicy>(1), std::invalid_argument);
+        ASSERT_THROW(std::make_shared<sgfs::TwoQEvictionPolicy>(0.25, 0), std::invalid_argument);
+        ASSERT_THROW(std::make_shared<sgfs::S3FIFOEvictionPolicy>(0), std::invalid_argument);
+        ASSERT_THROW(std::make_shared<sgfs::S3FIFOEvictionPolicy>(1.5), std::invalid_argument);
+        XBT_INFO("A policy learns the size of its partition when mounted");
+        auto policy = std::make_shared<sgfs::ARCEvictionPolicy>();
+        ASSERT_EQ(policy->get_partition_size(), 0);
+        fs_->mount_partition("/dev/arc/", ods_, "100MB", policy);
+        ASSERT_EQ(policy->get_partition_size(), 100000000);
+    });
+}
+
+TEST_F(EvictionPolicyTest, ARC)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform();
+        auto policy = std::make_shared<sgfs::ARCEvictionPolicy>();
+        fs_->mount_partition("/dev/arc/", ods_, "100MB", policy);
+        host_->add_actor("TestActor", [this, policy]() {
+            XBT_INFO("Create two 30MB files and access them again, which makes them frequent");
+            ASSERT_NO_THROW(fs_->create_file("/dev/arc/a.txt", "30MB"));
+            ASSERT_NO_THROW(fs_->create_file("/dev/arc/b.txt", "30MB"));
+            ASSERT_NO_THROW(access("/dev/arc/a.txt"));
+            ASSERT_NO_THROW(access("/dev/arc/b.txt"));
+            XBT_INFO("Scan four 20MB files, which only evicts scanned files");
+            for (const std::string name : {"s1.txt", "s2.txt", "s3.txt", "s4.txt"})
+                ASSERT_NO_THROW(fs_->create_file("/dev/arc/" + name, "20MB"));
+            check_files("/dev/arc/", {"a.txt", "b.txt", "s3.txt", "s4.txt"}, {"s1.txt", "s2.txt"});
+            ASSERT_EQ(policy->get_recency_target(), 0);
+            XBT_INFO("Create the first scanned file again, which grows the target of the recency list");
+            ASSERT_NO_THROW(fs_->create_file("/dev/arc/s1.txt", "20MB"));
+            ASSERT_EQ(policy->get_recency_target(), 20000000);
+            check_files("/dev/arc/", {"a.txt", "b.txt", "s1.txt", "s4.txt"}, {"s2.txt", "s3.txt"});
+        });
+        // Run the simulation
+        ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
+    });
+}
+
+TEST_F(EvictionPolicyTest, PeekingVictimsLeavesThePolicyUnchanged)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform();
+        auto policy = std::make_shared<sgfs::ARCEvictionPolicy>();
+        fs_->mount_partition("/dev/arc/", ods_, "100MB", policy);
+        host_->add_actor("TestActor", [this, policy]() {
+            XBT_INFO("Create two 30MB files, and peek at the victims that would free 30MB");
+            ASSERT_NO_THROW(fs_->create_file("/dev/arc/a.txt", "30MB"));
+            ASSERT_NO_THROW(fs_->create_file("/dev/arc/b.txt", "30MB"));
+            auto victims = policy->peek_victims(30000000);
+            ASSERT_EQ(victims.size(), 1);
+            ASSERT_EQ(victims.at(0)->get_file_name(), "a.txt");
+            XBT_INFO("Delete and create the peeked file again, which is not remembered as evicted");
+            ASSERT_NO_THROW(fs_->unlink_file("/dev/arc/a.txt"));
+            ASSERT_NO_THROW(fs_->create_file("/dev/arc/a.txt", "30MB"));
+            ASSERT_EQ(policy->get_recency_target(), 0);
+        });
+        // Run the simulation
+        ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
+    });
+}
+
+TEST_F(EvictionPolicyTest, TwoQ)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform();
+        fs_->mount_partition("/dev/2q/", ods_, "100MB", std::make_shared<sgfs::TwoQEvictionPolicy>());
+        host_->add_actor("TestActor", [this]() {
+            XBT_INFO("Create four 30MB files, which evicts the first one from the queue of new files");
+            for (const std::string name : {"a.txt", "b.txt", "c.txt", "d.txt"})
+                ASSERT_NO_THROW(fs_->create_file("/dev/2q/" + name, "30MB"));
+            check_files("/dev/2q/", {"b.txt", "c.txt", "d.txt"}, {"a.txt"});
+            XBT_INFO("Create the first file again, which the ghost queue sends to the main queue");
+            ASSERT_NO_THROW(fs_->create_file("/dev/2q/a.txt", "30MB"));
+            check_files("/dev/2q/", {"a.txt", "c.txt", "d.txt"}, {"b.txt"});
+            XBT_INFO("Scan three 20MB files, which never evicts the file of the main queue");
+            for (const std::string name : {"s1.txt", "s2.txt", "s3.txt"})
+                ASSERT_NO_THROW(fs_->create_file("/dev/2q/" + name, "20MB"));
+            check_files("/dev/2q/", {"a.txt", "s1.txt", "s2.txt", "s3.txt"}, {"c.txt", "d.txt"});
+        });
+        // Run the simulation
+        ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
+    });
+}
+
+TEST_F(EvictionPolicyTest, LFU)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform();
+        auto policy = std::make_shared<sgfs::LFUEvictionPolicy>();
+        fs_->mount_partition("/dev/lfu/", ods_, "100MB", policy);
+        host_->add_actor("TestActor", [this, policy]() {
+            XBT_INFO("Create three 30MB files, access the first one 3 more times and the second one once more");
+            for (const std::string name : {"a.txt", "b.txt", "c.txt"})
+                ASSERT_NO_THROW(fs_->create_file("/dev/lfu/" + name, "30MB"));
+            for (int i = 0; i < 3; i++)
+                ASSERT_NO_THROW(access("/dev/lfu/a.txt"));
+            ASSERT_NO_THROW(access("/dev/lfu/b.txt"));
+            XBT_INFO("Create a fourth file, which evicts the least frequently used file and ages the cache");
+            ASSERT_NO_THROW(fs_->create_file("/dev/lfu/d.txt", "30MB"));
+            check_files("/dev/lfu/", {"a.txt", "b.txt", "d.txt"}, {"c.txt"});
+            ASSERT_DOUBLE_EQ(policy->get_age(), 1);
+            XBT_INFO("Create two more files: a file created after the aging ties with the file accessed twice before");
+            ASSERT_NO_THROW(fs_->create_file("/dev/lfu/e.txt", "30MB"));
+            check_files("/dev/lfu/", {"a.txt", "b.txt", "e.txt"}, {"d.txt"});
+            ASSERT_NO_THROW(fs_->create_file("/dev/lfu/f.txt", "30MB"));
+            check_files("/dev/lfu/", {"a.txt", "e.txt", "f.txt"}, {"b.txt"});
+            ASSERT_DOUBLE_EQ(policy->get_age(), 2);
+        });
+        // Run the simulation
+        ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
+    });
+}
+
+TEST_F(EvictionPolicyTest, GDSF)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform();
+        fs_->mount_partition("/dev/gdsf/", ods_, "100MB", std::make_shared<sgfs::GDSFEvictionPolicy>());
+        host_->add_actor("TestActor", [this]() {
+            XBT_INFO("Create a 60MB file and two 10MB files, and access the large file once more");
+            ASSERT_NO_THROW(fs_->create_file("/dev/gdsf/large.txt", "60MB"));
+            ASSERT_NO_THROW(fs_->create_file("/dev/gdsf/small1.txt", "10MB"));
+            ASSERT_NO_THROW(fs_->create_file("/dev/gdsf/small2.txt", "10MB"));
+            ASSERT_NO_THROW(access("/dev/gdsf/large.txt"));
+            XBT_INFO("Create a 30MB file, which evicts the large file even though it is the most frequently used");
+            ASSERT_NO_THROW(fs_->create_file("/dev/gdsf/new.txt", "30MB"));
+            check_files("/dev/gdsf/", {"small1.txt", "small2.txt", "new.txt"}, {"large.txt"});
+        });
+        // Run the simulation
+        ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
+    });
+}
+
+TEST_F(EvictionPolicyTest, S3FIFO)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform();
+        fs_->mount_partition("/dev/s3fifo/", ods_, "100MB", std::make_shared<sgfs::S3FIFOEvictionPolicy>());
+        host_->add_actor("TestActor", [this]() {
+            XBT_INFO("Create three 30MB files, and access the first one once more");
+            ASSERT_NO_THROW(fs_->create_file("/dev/s3fifo/a.txt", "30MB"));
+            ASSERT_NO_THROW(access("/dev/s3fifo/a.txt"));
+            ASSERT_NO_THROW(fs_->create_file("/dev/s3fifo/b.txt", "30MB"));
+            ASSERT_NO_THROW(fs_->create_file("/dev/s3fifo/c.txt", "30MB"));
+            XBT_INFO("Create a fourth file, which moves the accessed file to the main queue and evicts the next one");
+            ASSERT_NO_THROW(fs_->create_file("/dev/s3fifo/d.txt", "30MB"));
+            check_files("/dev/s3fifo/", {"a.txt", "c.txt", "d.txt"}, {"b.txt"});
+            XBT_INFO("Create the evicted file again, which the ghost queue sends to the main queue");
+            ASSERT_NO_THROW(fs_->create_file("/dev/s3fifo/b.txt", "30MB"));
+            check_files("/dev/s3fifo/", {"a.txt", "b.txt", "d.txt"}, {"c.txt"});
+            XBT_INFO("Create a fifth file, which evicts from the small queue, where only that file and d.txt remain");
+            ASSERT_NO_THROW(fs_->create_file("/dev/s3fifo/e.txt", "30MB"));
+            check_files("/dev/s3fifo/", {"a.txt", "b.txt", "e.txt"}, {"d.txt"});
+        });
+        // Run the simulation
+        ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
+    });
+}
+
+TEST_F(EvictionPolicyTest, WatermarksBadArguments)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform();
+        fs_->mount_partition("/dev/none/", ods_, "100MB");
+        auto partition = fs_->get_partition_for_path_or_null("/dev/a/");
+        XBT_INFO("Set invalid watermarks, which should fail");
+        ASSERT_THROW(partition->set_eviction_watermarks(0.5, 0.8), std::invalid_argument);
+        ASSERT_THROW(partition->set_eviction_watermarks(1.1, 0.5), std::invalid_argument);
+        ASSERT_THROW(partition->set_eviction_watermarks(0.8, -0.1), std::invalid_argument);
+        ASSERT_THROW(fs_->get_partition_for_path_or_null("/dev/none/")->set_eviction_watermarks(0.8, 0.5),
+                     std::invalid_argument);
+        XBT_INFO("Set valid watermarks");
+        ASSERT_NO_THROW(partition->set_eviction_watermarks(0.8, 0.5));
+        ASSERT_DOUBLE_EQ(partition->get_high_watermark(), 0.8);
+        ASSERT_DOUBLE_EQ(partition->get_low_watermark(), 0.5);
+    });
+}
+
+TEST_F(EvictionPolicyTest, BackgroundEviction)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform();
+        fs_->mount_partition("/dev/lru/", ods_, "100MB", std::make_shared<sgfs::LRUEvictionPolicy>());
+        auto partition = fs_->get_partition_for_path_or_null("/dev/lru/");
+        partition->set_eviction_watermarks(0.8, 0.5);
+        host_->add_actor("TestActor", [this, partition]() {
+            XBT_INFO("Create three 20MB files, which remain below the high watermark");
+            ASSERT_NO_THROW(fs_->create_file("/dev/lru/a.txt", "20MB"));
+            ASSERT_NO_THROW(fs_->create_file("/dev/lru/b.txt", "20MB"));
+            ASSERT_NO_THROW(fs_->create_file("/dev/lru/c.txt", "20MB"));
+            ASSERT_NO_THROW(sg4::this_actor::sleep_for(1));
+            ASSERT_EQ(partition->get_num_background_evictions(), 0);
+            XBT_INFO("Create a 30MB file, which crosses the high watermark and starts the background eviction");
+            ASSERT_NO_THROW(fs_->create_file("/dev/lru/d.txt", "30MB"));
+            ASSERT_EQ(partition->get_free_space(), 10000000);
+            ASSERT_NO_THROW(sg4::this_actor::sleep_for(1));
+            XBT_INFO("The least recently used files were evicted down to the low watermark");
+            check_files("/dev/lru/", {"c.txt", "d.txt"}, {"a.txt", "b.txt"});
+            ASSERT_EQ(partition->get_free_space(), 50000000);
+            ASSERT_EQ(partition->get_num_background_evictions(), 2);
+            XBT_INFO("Create 30MB and 10MB files, which never wait for an eviction");
+            ASSERT_NO_THROW(fs_->create_file("/dev/lru/e.txt", "30MB"));
+            ASSERT_NO_THROW(fs_->create_file("/dev/lru/f.txt", "10MB"));
+            ASSERT_NO_THROW(sg4::this_actor::sleep_for(1));
+            check_files("/dev/lru/", {"e.txt", "f.txt"}, {"c.txt", "d.txt"});
+            ASSERT_EQ(partition->get_num_background_evictions(), 4);
+            ASSERT_EQ(partition->get_num_foreground_evictions(), 0);
+        });
+        // Run the simulation
+        ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
+    });
+}
+
+TEST_F(EvictionPolicyTest, BackgroundEvictionCost)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform();
+        fs_->mount_partition("/dev/lru/", ods_, "100MB", std::make_shared<sgfs::LRUEvictionPolicy>());
+        auto partition = fs_->get_partition_for_path_or_null("/dev/lru/");
+        partition->set_eviction_watermarks(0.8, 0.5);
+        host_->add_actor("TestActor", [this, partition]() {
+            XBT_INFO("Create three 20MB files, and make each mutation hold the directory lock for 1s");
+            ASSERT_NO_THROW(fs_->create_file("/dev/lru/a.txt", "20MB"));
+            ASSERT_NO_THROW(fs_->create_file("/dev/lru/b.txt", "20MB"));
+            ASSERT_NO_THROW(fs_->create_file("/dev/lru/c.txt", "20MB"));
+            partition->set_directory_lock_hold_time(1);
+            XBT_INFO("Create a 30MB file, which only pays for its own creation");
+            ASSERT_NO_THROW(fs_->create_file("/dev/lru/d.txt", "30MB"));
+            ASSERT_DOUBLE_EQ(sg4::Engine::get_clock(), 1);
+            XBT_INFO("The background eviction deletes one file per second");
+            ASSERT_NO_THROW(sg4::this_actor::sleep_until(1.5));
+            check_files("/dev/lru/", {"a.txt", "b.txt"}, {});
+            ASSERT_NO_THROW(sg4::this_actor::sleep_until(2.5));
+            check_files("/dev/lru/", {"b.txt"}, {"a.txt"});
+            ASSERT_NO_THROW(sg4::this_actor::sleep_until(3.5));
+            check_files("/dev/lru/", {"c.txt", "d.txt"}, {"a.txt", "b.txt"});
+            ASSERT_EQ(partition->get_num_foreground_evictions(), 0);
+        });
+        // Run the simulation
+        ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
+    });
+}
@@ -0,0 +1,276 @@
+/* Copyright (c) 2024-2026. The FSMOD Team. All rights reserved.          */
+
+/* This program is free software; you can redistribute it and/or modify it
+ * under the terms of the license (GNU LGPL) which comes with this package. */
+
+#include <gtest/gtest.h>
+#include <iostream>
+#include <map>
+#include <vector>
+
+#include <simgrid/s4u/Actor.hpp>
+#include <simgrid/s4u/Engine.hpp>
+
+#include "fsmod/FileSystem.hpp"
+#include "fsmod/HDDStorage.hpp"
+#include "fsmod/FileSystemException.hpp"
+
+#include "./test_util.hpp"
+
+namespace sgfs=simgrid::fsmod;
+namespace sg4=simgrid::s4u;
+
+XBT_LOG_NEW_DEFAULT_CATEGORY(hdd_storage_test, "HDD Storage Test");
+
+class HDDStorageTest : public ::testing::Test {
+public:
+    std::shared_ptr<sgfs::FileSystem> fs_;
+    std::shared_ptr<sgfs::HDDStorage> hdd_;
+    sg4::Host * host_;
+    sg4::Host * client_;
+    sg4::Disk * disk_;
+
+    HDDStorageTest() = default;
+
+    void setup_platform() {
+        XBT_INFO("Creating a platform with one host, one client host, and one 100MBps disk...");
+        auto *my_zone = sg4::Engine::get_instance()->get_netzone_root()->add_netzone_full("zone");
+        host_ = my_zone->add_host("my_host", "100Gf");
+        client_ = my_zone->add_host("client", "100Gf");
+        disk_ = host_->add_disk("disk", "100MBps", "100MBps");
+        my_zone->seal();
+
+        XBT_INFO("Creating a 1TB HDD storage with the default 7200rpm and 1ms-15ms seek times...");
+        hdd_ = sgfs::HDDStorage::create("my_hdd", disk_, 1000000000000);
+        XBT_INFO("Creating a file system with a 100GB partition...");
+        fs_ = sgfs::FileSystem::create("my_fs");
+        fs_->mount_partition("/dev/a/", hdd_, "100GB");
+        XBT_INFO("Create two 100MB files at /dev/a/foo.txt and /dev/a/bar.txt");
+        fs_->create_file("/dev/a/foo.txt", "100MB");
+        fs_->create_file("/dev/a/bar.txt", "100MB");
+    }
+
+    void read_at(const std::string& path, sg_offset_t offset, const std::string& num_bytes) {
+        auto file = fs_->open(path, "r");
+        file->seek(offset);
+        file->read(num_bytes);
+        file->close();
+    }
+
+    void run_reordering_scenario(bool reordering);
+};
+
+TEST_F(HDDStorageTest, BadArguments)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform();
+        XBT_INFO("Create HDD storages and configure them with invalid arguments, which should fail");
+        ASSERT_THROW(sgfs::HDDStorage::create("bad", nullptr, 1000000), std::invalid_argument);
+        ASSERT_THROW(sgfs::HDDStorage::create("bad", disk_, 0), std::invalid_argument);
+        ASSERT_THROW(hdd_->set_rotation_speed(0), std::invalid_argument);
+        ASSERT_THROW(hdd_->set_seek_times(-1, 0.01), std::invalid_argument);
+        ASSERT_THROW(hdd_->set_seek_times(0.01, 0.001), std::invalid_argument);
+        ASSERT_THROW(hdd_->set_file_extent_size(0), std::invalid_argument);
+        ASSERT_THROW(hdd_->set_file_extent_size(2000000000000), std::invalid_argument);
+        XBT_INFO("Check positioning times, which include half a rotation (4.17ms at 7200rpm)");
+        ASSERT_DOUBLE_EQ(hdd_->get_positioning_time(0), 0.0);
+        ASSERT_NEAR(hdd_->get_positioning_time(1000000000000), 0.015 + 30.0 / 7200, 1e-9);
+        ASSERT_NEAR(hdd_->get_positioning_time(10000000000), 0.001 + 0.014 * 0.1 + 30.0 / 7200, 1e-9);
+    });
+}
+
+TEST_F(HDDStorageTest, SequentialReads)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform();
+        host_->add_actor("TestActor", [this]() {
+            std::shared_ptr<sgfs::File> file;
+            ASSERT_NO_THROW(file = fs_->open("/dev/a/foo.txt", "r"));
+            XBT_INFO("Read 4 x 1MB sequentially, which never moves the head");
+            for (int i = 0; i < 4; i++)
+                ASSERT_NO_THROW(file->read("1MB"));
+            ASSERT_NEAR(sg4::Engine::get_clock(), 0.04, 1e-6);
+            ASSERT_EQ(hdd_->get_num_operations(), 4);
+            ASSERT_EQ(hdd_->get_num_seeks(), 0);
+            ASSERT_EQ(hdd_->get_head_position(), 4000000);
+            ASSERT_NO_THROW(file->close());
+        });
+        // Run the simulation
+        ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
+    });
+}
+
+TEST_F(HDDStorageTest, RandomSmallReads)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform();
+        host_->add_actor("TestActor", [this]() {
+            XBT_INFO("Read 4kB at offsets 0, 50MB, and 10MB, which moves the head twice");
+            ASSERT_NO_THROW(read_at("/dev/a/foo.txt", 0, "4kB"));
+            ASSERT_NO_THROW(read_at("/dev/a/foo.txt", 50000000, "4kB"));
+            ASSERT_NO_THROW(read_at("/dev/a/foo.txt", 10000000, "4kB"));
+            double expected = 3 * 0.00004 + hdd_->get_positioning_time(50000000 - 4000) +
+                              hdd_->get_positioning_time(40004000);
+            ASSERT_NEAR(sg4::Engine::get_clock(), expected, 1e-6);
+            ASSERT_EQ(hdd_->get_num_seeks(), 2);
+
+            XBT_INFO("Compare 50 sequential and 50 random 4kB reads");
+            std::shared_ptr<sgfs::File> file;
+            ASSERT_NO_THROW(file = fs_->open("/dev/a/foo.txt", "r"));
+            ASSERT_NO_THROW(file->seek(10004000));
+            double date = sg4::Engine::get_clock();
+            for (int i = 0; i < 50; i++)
+                ASSERT_NO_THROW(file->read("4kB"));
+            double sequential_time = sg4::Engine::get_clock() - date;
+            date = sg4::Engine::get_clock();
+            for (int i = 0; i < 50; i++) {
+                ASSERT_NO_THROW(file->seek(static_cast<sg_offset_t>((i * 37) % 100) * 1000000));
+                ASSERT_NO_THROW(file->read("4kB"));
+            }
+            double random_time = sg4::Engine::get_clock() - date;
+            ASSERT_NEAR(sequential_time, 50 * 0.00004, 1e-6);
+            ASSERT_GT(random_time, 100 * sequential_time);
+            ASSERT_NO_THROW(file->close());
+        });
+        // Run the simulation
+        ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
+    });
+}
+
+TEST_F(HDDStorageTest, FilePlacement)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform();
+        host_->add_actor("TestActor", [this]() {
+            XBT_INFO("Read 1MB from two files, which are placed 1GB apart in the order they are first accessed");
+            ASSERT_NO_THROW(read_at("/dev/a/bar.txt", 0, "1MB"));
+            ASSERT_NEAR(sg4::Engine::get_clock(), 0.01, 1e-6);
+            ASSERT_NO_THROW(read_at("/dev/a/foo.txt", 0, "1MB"));
+            ASSERT_NEAR(sg4::Engine::get_clock(), 0.02 + hdd_->get_positioning_time(1000000000 - 1000000), 1e-6);
+            ASSERT_EQ(hdd_->get_head_position(), 1001000000);
+            XBT_INFO("Reading the first file again moves the head back");
+            ASSERT_NO_THROW(read_at("/dev/a/bar.txt", 1000000, "1MB"));
+            ASSERT_EQ(hdd_->get_num_seeks(), 2);
+            ASSERT_EQ(hdd_->get_head_position(), 2000000);
+        });
+        // Run the simulation
+        ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
+    });
+}
+
+void HDDStorageTest::run_reordering_scenario(bool reordering) {
+    this->setup_platform();
+    hdd_->set_request_reordering(reordering);
+    auto finish_dates = std::make_shared<std::map<sg_offset_t, double>>();
+    XBT_INFO("Read 10MB at time 0, during which reads of 4kB at offsets 90MB, 20MB, and 50MB are queued");
+    host_->add_actor("FirstReader", [this]() {
+        ASSERT_NO_THROW(read_at("/dev/a/foo.txt", 0, "10MB"));
+    });
+    std::vector<sg_offset_t> offsets = {90000000, 20000000, 50000000};
+    for (size_t i = 0; i < offsets.size(); i++) {
+        host_->add_actor("Reader_" + std::to_string(i), [this, i, offset = offsets.at(i), finish_dates]() {
+            sg4::this_actor::sleep_until(0.01 * static_cast<double>(i + 1));
+            ASSERT_NO_THROW(read_at("/dev/a/foo.txt", offset, "4kB"));
+            (*finish_dates)[offset] = sg4::Engine::get_clock();
+        });
+    }
+    // Run the simulation
+    ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
+
+    double expected_positioning_time;
+    if (reordering) {
+        XBT_INFO("The head sweeps forward: 20MB, 50MB, then 90MB");
+        ASSERT_LT(finish_dates->at(20000000), finish_dates->at(50000000));
+        ASSERT_LT(finish_dates->at(50000000), finish_dates->at(90000000));
+        expected_positioning_time = hdd_->get_positioning_time(10000000) + hdd_->get_positioning_time(29996000) +
+                                    hdd_->get_positioning_time(39996000);
+    } else {
+        XBT_INFO("The head follows the arrival order: 90MB, 20MB, then 50MB");
+        ASSERT_LT(finish_dates->at(90000000), finish_dates->at(20000000));
+        ASSERT_LT(finish_dates->at(20000000), finish_dates->at(50000000));
+        expected_positioning_time = hdd_->get_positioning_time(80000000) + hdd_->get_positioning_time(70004000) +
+                                    hdd_->get_positioning_time(29996000);
+    }
+    ASSERT_NEAR(hdd_->get_total_positioning_time(), expected_positioning_time, 1e-9);
+}
+
+TEST_F(HDDStorageTest, ArrivalOrder)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->run_reordering_scenario(false);
+    });
+}
+
+TEST_F(HDDStorageTest, ElevatorOrder)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->run_reordering_scenario(true);
+    });
+}
+
+TEST_F(HDDStorageTest, DiskFailure)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform();
+        host_->add_actor("FailureActor", [this]() {
+            sg4::this_actor::sleep_for(0.5);
+            disk_->turn_off();
+            sg4::this_actor::sleep_for(0.1);
+            disk_->turn_on();
+        });
+        host_->add_actor("TestActor", [this]() {
+            std::shared_ptr<sgfs::File> file;
+            ASSERT_NO_THROW(file = fs_->open("/dev/a/foo.txt", "r"));
+            XBT_INFO("Read 100MB, which fails when the disk is turned off at 0.5s");
+            ASSERT_THROW(file->read("100MB"), simgrid::StorageFailureException);
+            ASSERT_NEAR(sg4::Engine::get_clock(), 0.5, 1e-6);
+            ASSERT_EQ(file->tell(), 0);
+            XBT_INFO("Read 1MB once the disk is back, which the head serves as usual");
+            ASSERT_NO_THROW(sg4::this_actor::sleep_for(0.5));
+            ASSERT_NO_THROW(file->read("1MB"));
+            ASSERT_NEAR(sg4::Engine::get_clock(), 1.01, 1e-6);
+            ASSERT_NO_THROW(file->close());
+        });
+        // Run the simulation
+        ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
+    });
+}
+
+TEST_F(HDDStorageTest, HostFailure)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform();
+        client_->add_actor("FailureActor", [this]() {
+            sg4::this_actor::sleep_for(0.5);
+            host_->turn_off();
+            sg4::this_actor::sleep_for(0.1);
+            host_->turn_on();
+        });
+        client_->add_actor("TestActor", [this]() {
+            std::shared_ptr<sgfs::File> file;
+            ASSERT_NO_THROW(file = fs_->open("/dev/a/foo.txt", "r"));
+            XBT_INFO("Read 100MB, which fails when the host of the drive, and thus its head, fails at 0.5s");
+            ASSERT_THROW(file->read("100MB"), simgrid::StorageFailureException);
+            ASSERT_NEAR(sg4::Engine::get_clock(), 0.5, 1e-6);
+            XBT_INFO("Read 1MB once the host is back, which starts a new head");
+            ASSERT_NO_THROW(sg4::this_actor::sleep_for(0.5));
+            ASSERT_NO_THROW(file->read("1MB"));
+            ASSERT_NEAR(sg4::Engine::get_clock(), 1.01, 1e-6);
+            ASSERT_NO_THROW(file->close());
+        });
+        // Run the simulation
+        ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
+    });
+}
+
+TEST_F(HDDStorageTest, ExtentWrapAround)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform();
+        XBT_INFO("Use 500GB extents, so that the 1TB drive only holds two of them");
+        ASSERT_NO_THROW(hdd_->set_file_extent_size(500000000000));
+        ASSERT_NO_THROW(fs_->create_file("/dev/a/baz.txt", "100MB"));
+        host_->add_actor("TestActor", [this]() {
+            XBT_INFO("Read 1MB from three files, the third of which wraps around to the extent of the first one");
+            ASSERT_NO_THROW(read_at("/dev/a/foo.txt", 0, "1MB"));
+            ASSERT_NO_THROW(read_at("/dev/a/bar.txt", 0, "1MB"));
+            ASSERT_EQ(hdd_->get_head_position(), 500001000000);
+            ASSERT_NO_THROW(read_at("/dev/a/baz.txt", 0, "1MB"));
+            ASSERT_EQ(hdd_->get_head_position(), 1000000);
+            ASSERT_EQ(hdd_->get_num_seeks(), 2);
+        });
+        // Run the simulation
+        ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
+    });
+}
@@ -0,0 +1,179 @@
+/* Copyright (c) 2024-2026. The FSMOD Team. All rights reserved.          */
+
+/* This program is free software; you can redistribute it and/or modify it
+ * under the terms of the license (GNU LGPL) which comes with this package. */
+
+#include <gtest/gtest.h>
+#include <iostream>
+
+#include <simgrid/s4u/ActivitySet.hpp>
+#include <simgrid/s4u/Actor.hpp>
+#include <simgrid/s4u/Engine.hpp>
+
+#include "fsmod/FileSystem.hpp"
+#include "fsmod/IOScheduler.hpp"
+#include "fsmod/OneDiskStorage.hpp"
+#include "fsmod/FileSystemException.hpp"
+
+#include "./test_util.hpp"
+
+namespace sgfs=simgrid::fsmod;
+namespace sg4=simgrid::s4u;
+
+XBT_LOG_NEW_DEFAULT_CATEGORY(io_scheduler_test, "I/O Scheduler Test");
+
+class IOSchedulerTest : public ::testing::Test {
+public:
+    std::shared_ptr<sgfs::FileSystem> fs_;
+    std::shared_ptr<sgfs::OneDiskStorage> ods_;
+    sg4::Host * host_;
+    sg4::Disk * disk_;
+
+    IOSchedulerTest() = default;
+
+    void setup_platform() {
+        XBT_INFO("Creating a platform with one host and one disk...");
+        auto *my_zone  = sg4::Engine::get_instance()->get_netzone_root()->add_netzone_full("zone");
+        host_ = my_zone->add_host("my_host", "100Gf");
+        disk_ = host_->add_disk("disk_one", "2MBps", "1MBps");
+        my_zone->seal();
+
+        XBT_INFO("Creating a one-disk storage on the host's disk...");
+        ods_ = sgfs::OneDiskStorage::create("my_storage", disk_);
+        XBT_INFO("Creating a file system...");
+        fs_ = sgfs::FileSystem::create("my_fs");
+        XBT_INFO("Mounting a 100MB partition...");
+        fs_->mount_partition("/dev/a/", ods_, "100MB");
+        XBT_INFO("Create a 10MB file at /dev/a/foo.txt");
+        fs_->create_file("/dev/a/foo.txt", "10MB");
+    }
+
+    void read_4MB_2MB_1MB(const std::vector<double>& expected_completion_dates) {
+        std::shared_ptr<sgfs::File> file;
+        std::vector<sg4::IoPtr> reads;
+        ASSERT_NO_THROW(file = fs_->open("/dev/a/foo.txt", "r"));
+        XBT_INFO("Asynchronously read 4MB, 2MB, then 1MB");
+        for (const auto* size : {"4MB", "2MB", "1MB"})
+            reads.push_back(file->read_async(size));
+        for (size_t i = 0; i < reads.size(); i++) {
+            reads.at(i)->wait();
+            XBT_INFO("Read #%zu complete at %.2fs", i, sg4::Engine::get_clock());
+            ASSERT_DOUBLE_EQ(sg4::Engine::get_clock(), expected_completion_dates.at(i));
+        }
+        ASSERT_EQ(ods_->get_num_running_requests(), 0);
+        ASSERT_NO_THROW(file->close());
+    }
+};
+
+TEST_F(IOSchedulerTest, BadArguments)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform();
+        XBT_INFO("Start a controller without a scheduler, or without allowing any request, which should fail");
+        ASSERT_THROW(ods_->start_controller(host_, std::shared_ptr<sgfs::IOScheduler>()), std::invalid_argument);
+        ASSERT_THROW(ods_->start_controller(host_, std::make_shared<sgfs::FIFOIOScheduler>(), 0),
+                     std::invalid_argument);
+        ASSERT_THROW(std::make_shared<sgfs::DeadlineIOScheduler>(-1, 1), std::invalid_argument);
+        ASSERT_EQ(ods_->get_io_scheduler(), nullptr);
+    });
+}
+
+TEST_F(IOSchedulerTest, FIFO)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform();
+        ods_->start_controller(host_, std::make_shared<sgfs::FIFOIOScheduler>());
+        ASSERT_EQ(ods_->get_max_concurrent_requests(), 1);
+        host_->add_actor("TestActor", [this]() {
+            XBT_INFO("One request at a time, in arrival order: 2s, then 1s, then 0.5s");
+            read_4MB_2MB_1MB({2.0, 3.0, 3.5});
+        });
+        // Run the simulation
+        ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
+    });
+}
+
+TEST_F(IOSchedulerTest, ConcurrencyLimit)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform();
+        ods_->start_controller(host_, std::make_shared<sgfs::FIFOIOScheduler>(), 2);
+        host_->add_actor("TestActor", [this]() {
+            XBT_INFO("The first two requests share the disk. The 2MB read completes at 2s, the 1MB read then "
+                     "shares the disk with the rest of the 4MB read until 3s, and the 4MB read completes at 3.5s");
+            read_4MB_2MB_1MB({3.5, 2.0, 3.0});
+        });
+        // Run the simulation
+        ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
+    });
+}
+
+TEST_F(IOSchedulerTest, ShortestJobFirst)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform();
+        ods_->start_controller(host_, std::make_shared<sgfs::ShortestJobFirstIOScheduler>());
+        host_->add_actor("TestActor", [this]() {
+            XBT_INFO("The 4MB read starts right away, then the 1MB read is dispatched before the 2MB one");
+            read_4MB_2MB_1MB({2.0, 3.5, 2.5});
+        });
+        // Run the simulation
+        ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
+    });
+}
+
+TEST_F(IOSchedulerTest, Deadline)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform();
+        ods_->start_controller(host_, std::make_shared<sgfs::DeadlineIOScheduler>(0.5, 5.0));
+        host_->add_actor("TestActor", [this]() {
+            std::shared_ptr<sgfs::File> file_to_read;
+            std::shared_ptr<sgfs::File> file_to_write;
+            ASSERT_NO_THROW(fs_->create_file("/dev/a/bar.txt", "0B"));
+            ASSERT_NO_THROW(file_to_read = fs_->open("/dev/a/foo.txt", "r"));
+            ASSERT_NO_THROW(file_to_write = fs_->open("/dev/a/bar.txt", "w"));
+            XBT_INFO("Read 2MB, then write 1MB and read 1MB while the disk is busy");
+            auto first_read = file_to_read->read_async("2MB");
+            auto write = file_to_write->write_async("1MB");
+            auto second_read = file_to_read->read_async("1MB");
+            XBT_INFO("The second read expires before the write and is dispatched first, completing at 1.5s");
+            second_read->wait();
+            ASSERT_DOUBLE_EQ(sg4::Engine::get_clock(), 1.5);
+            write->wait();
+            ASSERT_DOUBLE_EQ(sg4::Engine::get_clock(), 2.5);
+            ASSERT_NO_THROW(file_to_read->close());
+            ASSERT_NO_THROW(file_to_write->close());
+        });
+        // Run the simulation
+        ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
+    });
+}
+
+TEST_F(IOSchedulerTest, FairShare)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform();
+        auto scheduler = std::make_shared<sgfs::FairShareIOScheduler>();
+        ods_->start_controller(host_, scheduler);
+        host_->add_actor("GreedyClient", [this, scheduler]() {
+            std::shared_ptr<sgfs::File> file;
+            sg4::ActivitySet reads;
+            ASSERT_NO_THROW(file = fs_->open("/dev/a/foo.txt", "r"));
+            XBT_INFO("Asynchronously read 1MB four times");
+            for (int i = 0; i < 4; i++)
+                reads.push(file->read_async("1MB"));
+            reads.wait_all();
+            XBT_INFO("All reads complete at 2.5s, as one of the other client's reads was served in between");
+            ASSERT_DOUBLE_EQ(sg4::Engine::get_clock(), 2.5);
+            ASSERT_EQ(scheduler->get_served_bytes(sg4::this_actor::get_pid()), 4000000);
+            ASSERT_NO_THROW(file->close());
+        });
+        host_->add_actor("OtherClient", [this]() {
+            std::shared_ptr<sgfs::File> file;
+            sg4::this_actor::sleep_for(0.1);
+            ASSERT_NO_THROW(file = fs_->open("/dev/a/foo.txt", "r"));
+            XBT_INFO("Read 1MB while the greedy client has 3 queued requests");
+            ASSERT_DOUBLE_EQ(file->read("1MB"), 1000000);
+            XBT_INFO("Read complete at 1.5s, right after the greedy client's second read, instead of 2.5s with FIFO");
+            ASSERT_DOUBLE_EQ(sg4::Engine::get_clock(), 1.5);
+            ASSERT_NO_THROW(file->close());
+        });
+        // Run the simulation
+        ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
+    });
+}
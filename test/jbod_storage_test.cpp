@@ -8,6 +8,7 @@
 
 #include <simgrid/s4u/Engine.hpp>
 #include <simgrid/s4u/Actor.hpp>
+#include <simgrid/s4u/ActivitySet.hpp>
 
 #include "fsmod/PathUtil.hpp"
 #include "fsmod/FileSystem.hpp"
@@ -28,6 +29,7 @@ public:
     sg4::Host* fs_client_;
     sg4::Host* fs_server_;
     std::vector<sg4::Disk*> disks_;
+    sg4::Disk* spare_disk_;
 
     JBODStorageTest() = default;
 
@@ -39,6 +41,7 @@ public:
         fs_server_ = my_zone->add_host("fs_server", "200Mf");
         for (int i = 0 ; i < 4 ; i++ )
             disks_.push_back(fs_server_->add_disk("jds_disk" + std::to_string(i), "2MBps", "1MBps"));
+        spare_disk_ = fs_server_->add_disk("jds_spare_disk", "2MBps", "1MBps");
 
         const auto* link = my_zone->add_link("link", 120e6 / 0.97)->set_latency(0);
         my_zone->add_route(fs_client_, fs_server_, {link});
@@ -83,6 +86,10 @@ TEST_F(JBODStorageTest, NotEnoughDisks)  {
         ASSERT_NO_THROW(jds2->set_raid_level(sgfs::JBODStorage::RAID::RAID1));
         XBT_INFO("Try to set RAID level to RAID3 which is not supported but should work");
         ASSERT_NO_THROW(jds2->set_raid_level(sgfs::JBODStorage::RAID::RAID3));
+        XBT_INFO("Try to set RAID level to RAID10 which should fail");
+        ASSERT_THROW(jds2->set_raid_level(sgfs::JBODStorage::RAID::RAID10), std::invalid_argument);
+        XBT_INFO("Try to set RAID level to RAID10 on 3 disks which should also fail");
+        ASSERT_THROW(jds3->set_raid_level(sgfs::JBODStorage::RAID::RAID10), std::invalid_argument);
 
         // Run the simulation
         ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
@@ -401,3 +408,329 @@ TEST_F(JBODStorageTest, ReadWriteRAID6)  {
         ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
     });
 }
+
+TEST_F(JBODStorageTest, ReadWriteStripedRAID5)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform();
+        fs_client_->add_actor("TestActor", [this]() {
+            std::shared_ptr<sgfs::File> file;
+            XBT_INFO("Check that requests are not split into stripe units by default");
+            ASSERT_EQ(jds_->get_stripe_unit_size(), 0);
+            XBT_INFO("Set a 1MB stripe unit (i.e., 3MB of data per stripe)");
+            ASSERT_NO_THROW(jds_->set_stripe_unit_size(1000 * 1000));
+            ASSERT_EQ(jds_->get_stripe_unit_size(), 1000 * 1000);
+            XBT_INFO("Create a 10MB file at /dev/a/foo.txt");
+            ASSERT_NO_THROW(fs_->create_file("/dev/a/foo.txt", "10MB"));
+            XBT_INFO("Open File '/dev/a/foo.txt' in write mode");
+            ASSERT_NO_THROW(file = fs_->open("/dev/a/foo.txt", "w"));
+            XBT_INFO("Write 6MB at /dev/a/foo.txt, i.e., two full stripes with parity on disks #3 and #2");
+            ASSERT_DOUBLE_EQ(file->write("6MB"), 6000000);
+            XBT_INFO("Write complete. Clock is at 2.06s (.05s to transfer, 0.01 to compute parity, 2s to write)");
+            ASSERT_DOUBLE_EQ(sg4::Engine::get_clock(), 2.06);
+            XBT_INFO("Write 1MB at the beginning of /dev/a/foo.txt, which only covers a third of the first stripe");
+            ASSERT_NO_THROW(file->seek(SEEK_SET));
+            ASSERT_DOUBLE_EQ(file->write("1MB"), 1000000);
+            XBT_INFO("Write complete. Clock is at 3.565s (.5s to read old data and parity, 0.005 to compute parity, "
+                     "1s to write)");
+            ASSERT_DOUBLE_EQ(sg4::Engine::get_clock(), 3.565);
+            XBT_INFO("Close the file");
+            ASSERT_NO_THROW(file->close());
+            XBT_INFO("Open File '/dev/a/foo.txt' in read mode");
+            ASSERT_NO_THROW(file = fs_->open("/dev/a/foo.txt", "r"));
+            ASSERT_DOUBLE_EQ(file->read("6MB"), 6000000);
+            XBT_INFO("Read complete. Clock is at 4.615s (1s to read 2MB on disks #0 and #1, .05s to transfer)");
+            ASSERT_DOUBLE_EQ(sg4::Engine::get_clock(), 4.615);
+            XBT_INFO("Close the file");
+            ASSERT_NO_THROW(file->close());
+        });
+        // Run the simulation
+        ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
+    });
+}
+
+TEST_F(JBODStorageTest, ReadWriteRAID10)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform();
+        fs_client_->add_actor("TestActor", [this]() {
+            std::shared_ptr<sgfs::File> file;
+            ASSERT_NO_THROW(jds_->set_raid_level(sgfs::JBODStorage::RAID::RAID10));
+            ASSERT_EQ(jds_->get_num_data_disks(), 2);
+            ASSERT_EQ(jds_->get_num_parity_disks(), 0);
+            XBT_INFO("Create a 10MB file at /dev/a/foo.txt");
+            ASSERT_NO_THROW(fs_->create_file("/dev/a/foo.txt", "10MB"));
+            XBT_INFO("Open File '/dev/a/foo.txt' in write mode");
+            ASSERT_NO_THROW(file = fs_->open("/dev/a/foo.txt", "w"));
+            XBT_INFO("Write 6MB at /dev/a/foo.txt");
+            ASSERT_DOUBLE_EQ(file->write("6MB"), 6000000);
+            XBT_INFO("Write complete. Clock is at 3.05s (.05s to transfer, 3s to write on both disks of each pair)");
+            ASSERT_DOUBLE_EQ(sg4::Engine::get_clock(), 3.05);
+            XBT_INFO("Close the file");
+            ASSERT_NO_THROW(file->close());
+            XBT_INFO("Open File '/dev/a/foo.txt' in read mode");
+            ASSERT_NO_THROW(file = fs_->open("/dev/a/foo.txt", "r"));
+            ASSERT_DOUBLE_EQ(file->read("6MB"), 6000000);
+            XBT_INFO("Read complete. Clock is at 4.6s (1.5s to read from one disk of each pair, .05s to transfer)");
+            ASSERT_DOUBLE_EQ(sg4::Engine::get_clock(), 4.6);
+            XBT_INFO("Close the file");
+            ASSERT_NO_THROW(file->close());
+        });
+        // Run the simulation
+        ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
+    });
+}
+
+TEST_F(JBODStorageTest, ReadWriteErasureCoding)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform();
+        fs_client_->add_actor("TestActor", [this]() {
+            std::shared_ptr<sgfs::File> file;
+            XBT_INFO("Try to use erasure coding without specifying fragments, which should fail");
+            ASSERT_THROW(jds_->set_raid_level(sgfs::JBODStorage::RAID::ERASURE_CODING), std::invalid_argument);
+            XBT_INFO("Try to use 3+2 and 4+0 erasure coding on 4 disks, which should fail");
+            ASSERT_THROW(jds_->set_erasure_coding(3, 2), std::invalid_argument);
+            ASSERT_THROW(jds_->set_erasure_coding(4, 0), std::invalid_argument);
+            XBT_INFO("Use 2+2 erasure coding, which should behave as RAID6");
+            ASSERT_NO_THROW(jds_->set_erasure_coding(2, 2));
+            ASSERT_EQ(jds_->get_raid_level(), sgfs::JBODStorage::RAID::ERASURE_CODING);
+            ASSERT_EQ(jds_->get_num_data_disks(), 2);
+            ASSERT_EQ(jds_->get_num_parity_disks(), 2);
+            XBT_INFO("Create a 10MB file at /dev/a/foo.txt");
+            ASSERT_NO_THROW(fs_->create_file("/dev/a/foo.txt", "10MB"));
+            XBT_INFO("Open File '/dev/a/foo.txt' in write mode");
+            ASSERT_NO_THROW(file = fs_->open("/dev/a/foo.txt", "w"));
+            XBT_INFO("Write 6MB at /dev/a/foo.txt");
+            ASSERT_DOUBLE_EQ(file->write("6MB"), 6000000);
+            XBT_INFO("Write complete. Clock is at 3.08s (.05s to transfer, 0.03 to encode 2 parity fragments, 3s to write)");
+            ASSERT_DOUBLE_EQ(sg4::Engine::get_clock(), 3.08);
+            XBT_INFO("Close the file");
+            ASSERT_NO_THROW(file->close());
+            XBT_INFO("Open File '/dev/a/foo.txt' in read mode");
+            ASSERT_NO_THROW(file = fs_->open("/dev/a/foo.txt", "r"));
+            ASSERT_DOUBLE_EQ(file->read("6MB"), 6000000);
+            XBT_INFO("Read complete. Clock is at 4.63s (1.5s to read the 2 data fragments, .05s to transfer)");
+            ASSERT_DOUBLE_EQ(sg4::Engine::get_clock(), 4.63);
+            XBT_INFO("Close the file");
+            ASSERT_NO_THROW(file->close());
+            XBT_INFO("Create a 3+1 erasure-coded JBOD directly");
+            std::shared_ptr<sgfs::JBODStorage> ec;
+            ASSERT_NO_THROW(ec = sgfs::JBODStorage::create_erasure_coded("my_ec_storage", disks_, 3, 1));
+            ASSERT_EQ(ec->get_num_data_disks(), 3);
+            ASSERT_EQ(ec->get_num_parity_disks(), 1);
+        });
+        // Run the simulation
+        ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
+    });
+}
+
+TEST_F(JBODStorageTest, DegradedRAID5)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform();
+        fs_client_->add_actor("TestActor", [this]() {
+            std::shared_ptr<sgfs::File> file;
+            ASSERT_EQ(jds_->get_max_num_failed_disks(), 1);
+            XBT_INFO("Create a 10MB file at /dev/a/foo.txt");
+            ASSERT_NO_THROW(fs_->create_file("/dev/a/foo.txt", "10MB"));
+            XBT_INFO("Open File '/dev/a/foo.txt' in write mode");
+            ASSERT_NO_THROW(file = fs_->open("/dev/a/foo.txt", "w"));
+            XBT_INFO("Write 6MB at /dev/a/foo.txt, with parity on disk #2");
+            ASSERT_DOUBLE_EQ(file->write("6MB"), 6000000);
+            ASSERT_DOUBLE_EQ(sg4::Engine::get_clock(), 2.06);
+            ASSERT_NO_THROW(file->close());
+            XBT_INFO("Disk #1, which holds the last third of the data, fails");
+            disks_.at(1)->turn_off();
+            ASSERT_EQ(jds_->get_num_failed_disks(), 1);
+            XBT_INFO("Open File '/dev/a/foo.txt' in read mode");
+            ASSERT_NO_THROW(file = fs_->open("/dev/a/foo.txt", "r"));
+            ASSERT_DOUBLE_EQ(file->read("6MB"), 6000000);
+            XBT_INFO("Read complete. Clock is at 3.12s (1s to read 2MB on disks #0, #2, and #3, "
+                     "0.01 to reconstruct the lost data, .05s to transfer)");
+            ASSERT_DOUBLE_EQ(sg4::Engine::get_clock(), 3.12);
+            XBT_INFO("Disk #0 fails too, which RAID5 does not tolerate");
+            disks_.at(0)->turn_off();
+            ASSERT_NO_THROW(file->seek(SEEK_SET));
+            ASSERT_THROW(file->read("6MB"), simgrid::StorageFailureException);
+            XBT_INFO("The failed read did not move the file position");
+            ASSERT_EQ(file->tell(), 0);
+            ASSERT_NO_THROW(file->close());
+            ASSERT_NO_THROW(file = fs_->open("/dev/a/foo.txt", "w"));
+            ASSERT_THROW(file->write("6MB"), simgrid::StorageFailureException);
+            ASSERT_NO_THROW(file->close());
+        });
+        // Run the simulation
+        ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
+    });
+}
+
+TEST_F(JBODStorageTest, FailedWritesLeaveFilesUnchanged)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform();
+        fs_client_->add_actor("TestActor", [this]() {
+            std::shared_ptr<sgfs::File> file;
+            XBT_INFO("Create a 10MB file at /dev/a/foo.txt");
+            ASSERT_NO_THROW(fs_->create_file("/dev/a/foo.txt", "10MB"));
+            auto free_space = fs_->get_free_space_at_path("/dev/a/");
+            XBT_INFO("Disks #0 and #1 fail, which RAID5 does not tolerate");
+            disks_.at(0)->turn_off();
+            disks_.at(1)->turn_off();
+            XBT_INFO("Append 6MB to the file, synchronously and asynchronously, which fails");
+            ASSERT_NO_THROW(file = fs_->open("/dev/a/foo.txt", "a"));
+            ASSERT_THROW(file->write("6MB"), simgrid::StorageFailureException);
+            ASSERT_THROW(file->write_async("6MB")->wait(), simgrid::StorageFailureException);
+            XBT_INFO("The failed writes neither grew the file nor kept the space reserved for them");
+            ASSERT_EQ(fs_->file_size("/dev/a/foo.txt"), 10000000);
+            ASSERT_EQ(fs_->get_free_space_at_path("/dev/a/"), free_space);
+            ASSERT_NO_THROW(file->close());
+        });
+        // Run the simulation
+        ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
+    });
+}
+
+TEST_F(JBODStorageTest, RebuildOnSpareDisk)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform();
+        fs_client_->add_actor("TestActor", [this]() {
+            XBT_INFO("Add a spare disk and rebuild 4MB per failed disk as fast as possible");
+            ASSERT_THROW(jds_->set_rebuild_rate(-1), std::invalid_argument);
+            ASSERT_NO_THROW(jds_->add_spare_disk(spare_disk_));
+            ASSERT_NO_THROW(jds_->set_rebuild_size(4000 * 1000));
+            ASSERT_FALSE(jds_->is_rebuilding());
+            XBT_INFO("Disk #1 fails, which starts its rebuild on the spare disk");
+            disks_.at(1)->turn_off();
+            sg4::this_actor::sleep_for(1);
+            ASSERT_TRUE(jds_->is_rebuilding());
+            ASSERT_TRUE(jds_->get_spare_disks().empty());
+            ASSERT_EQ(jds_->get_num_failed_disks(), 1);
+            XBT_INFO("The rebuild completes at 6.02s (2s to read 4MB on 3 disks, 0.02s to decode, 4s to write)");
+            sg4::this_actor::sleep_until(6.01);
+            ASSERT_TRUE(jds_->is_rebuilding());
+            sg4::this_actor::sleep_until(6.03);
+            ASSERT_FALSE(jds_->is_rebuilding());
+            ASSERT_EQ(jds_->get_num_failed_disks(), 0);
+            ASSERT_EQ(jds_->get_disk_at(1), spare_disk_);
+        });
+        // Run the simulation
+        ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
+    });
+}
+
+TEST_F(JBODStorageTest, RebuildStoredBytesByDefault)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform();
+        fs_client_->add_actor("TestActor", [this]() {
+            XBT_INFO("Add a spare disk without setting the rebuild size");
+            ASSERT_NO_THROW(jds_->add_spare_disk(spare_disk_));
+            ASSERT_EQ(jds_->get_rebuild_size(), 0);
+            XBT_INFO("Create a 12MB file, which stores 4MB on each disk with RAID5");
+            ASSERT_NO_THROW(fs_->create_file("/dev/a/foo.txt", "12MB"));
+            ASSERT_EQ(jds_->get_rebuild_size(), 4000 * 1000);
+            XBT_INFO("Disk #1 fails, whose 4MB are rebuilt by 6.02s");
+            disks_.at(1)->turn_off();
+            sg4::this_actor::sleep_until(6.01);
+            ASSERT_TRUE(jds_->is_rebuilding());
+            sg4::this_actor::sleep_until(6.03);
+            ASSERT_FALSE(jds_->is_rebuilding());
+            ASSERT_EQ(jds_->get_disk_at(1), spare_disk_);
+        });
+        // Run the simulation
+        ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
+    });
+}
+
+TEST_F(JBODStorageTest, LoadAwareRAID1Reads)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform();
+        fs_client_->add_actor("TestActor", [this]() {
+            std::shared_ptr<sgfs::File> file;
+            sg4::ActivitySet pending_reads;
+            ASSERT_NO_THROW(jds_->set_raid_level(sgfs::JBODStorage::RAID::RAID1));
+            ASSERT_EQ(jds_->get_mirror_read_policy(), sgfs::JBODStorage::MirrorReadPolicy::ROUND_ROBIN);
+            ASSERT_NO_THROW(jds_->set_mirror_read_policy(sgfs::JBODStorage::MirrorReadPolicy::LEAST_OUTSTANDING_BYTES));
+            XBT_INFO("Create a 20MB file at /dev/a/foo.txt");
+            ASSERT_NO_THROW(fs_->create_file("/dev/a/foo.txt", "20MB"));
+            ASSERT_NO_THROW(file = fs_->open("/dev/a/foo.txt", "r"));
+            XBT_INFO("Asynchronously read 6MB (on disk #0), then 4 times 2MB (on disks #1, #2, #3, and #1)");
+            pending_reads.push(file->read_async("6MB"));
+            ASSERT_EQ(jds_->get_outstanding_bytes(0), 6000000);
+            for (int i = 0; i < 4; i++)
+                pending_reads.push(file->read_async("2MB"));
+            ASSERT_EQ(jds_->get_outstanding_bytes(1), 4000000);
+            ASSERT_EQ(jds_->get_outstanding_bytes(2), 2000000);
+            ASSERT_EQ(jds_->get_outstanding_bytes(3), 2000000);
+            pending_reads.wait_all();
+            XBT_INFO("Reads complete. Clock is at 3.05s (3s to read 6MB on disk #0, .05s to transfer), while round "
+                     "robin would have sent the last read to disk #0 and completed at 4.05s");
+            ASSERT_DOUBLE_EQ(sg4::Engine::get_clock(), 3.05);
+            for (unsigned long i = 0; i < 4; i++)
+                ASSERT_EQ(jds_->get_outstanding_bytes(i), 0);
+            ASSERT_NO_THROW(file->close());
+        });
+        // Run the simulation
+        ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
+    });
+}
+
+TEST_F(JBODStorageTest, HedgedRAID1Reads)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform();
+        fs_client_->add_actor("TestActor", [this]() {
+            std::shared_ptr<sgfs::File> file;
+            sg4::ActivitySet background_reads;
+            ASSERT_NO_THROW(jds_->set_raid_level(sgfs::JBODStorage::RAID::RAID1));
+            ASSERT_THROW(jds_->set_hedged_read_threshold(-1), std::invalid_argument);
+            ASSERT_NO_THROW(jds_->set_hedged_read_threshold(0.5));
+            XBT_INFO("Create a 10MB file at /dev/a/foo.txt");
+            ASSERT_NO_THROW(fs_->create_file("/dev/a/foo.txt", "10MB"));
+            ASSERT_NO_THROW(file = fs_->open("/dev/a/foo.txt", "r"));
+            XBT_INFO("Overload disk #0 with I/Os the JBOD is not aware of");
+            for (int i = 0; i < 3; i++)
+                background_reads.push(disks_.at(0)->read_async(10 * 1000 * 1000));
+            XBT_INFO("Read 2MB from disk #0, which is hedged on disk #1 after 0.5s");
+            ASSERT_DOUBLE_EQ(file->read("2MB"), 2000000);
+            ASSERT_EQ(jds_->get_num_hedged_reads(), 1);
+            XBT_INFO("Read complete. Clock is at 1.5167s (1s to read 2MB on disk #1 after 0.5s, .0167s to transfer) "
+                     "instead of 4.0167s without hedging");
+            ASSERT_NEAR(sg4::Engine::get_clock(), 1.5 + 2e6 / 120e6, 1e-9);
+            ASSERT_NO_THROW(file->close());
+            background_reads.wait_all();
+        });
+        // Run the simulation
+        ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
+    });
+}
+
+TEST_F(JBODStorageTest, HedgedRAID1ReadsWithFailedDisks)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform();
+        fs_server_->add_actor("FailureActor", [this]() {
+            sg4::this_actor::sleep_for(0.2);
+            disks_.at(0)->turn_off();
+            sg4::this_actor::sleep_for(2);
+            for (int i = 1; i < 4; i++)
+                disks_.at(i)->turn_off();
+        });
+        fs_client_->add_actor("TestActor", [this]() {
+            std::shared_ptr<sgfs::File> file;
+            ASSERT_NO_THROW(jds_->set_raid_level(sgfs::JBODStorage::RAID::RAID1));
+            ASSERT_NO_THROW(jds_->set_hedged_read_threshold(0.5));
+            XBT_INFO("Create a 10MB file at /dev/a/foo.txt");
+            ASSERT_NO_THROW(fs_->create_file("/dev/a/foo.txt", "10MB"));
+            ASSERT_NO_THROW(file = fs_->open("/dev/a/foo.txt", "r"));
+            XBT_INFO("Read 2MB from disk #0, which fails at 0.2s, so that the read is served by disk #1 right away");
+            ASSERT_DOUBLE_EQ(file->read("2MB"), 2000000);
+            ASSERT_EQ(jds_->get_num_hedged_reads(), 1);
+            ASSERT_NEAR(sg4::Engine::get_clock(), 1.2 + 2e6 / 120e6, 1e-9);
+            for (unsigned long i = 0; i < 4; i++)
+                ASSERT_EQ(jds_->get_outstanding_bytes(i), 0);
+            XBT_INFO("Read 2MB, which fails when all the other disks fail at 2.2s, rather than waiting forever");
+            ASSERT_THROW(file->read("2MB"), simgrid::StorageFailureException);
+            ASSERT_NEAR(sg4::Engine::get_clock(), 2.2, 1e-9);
+            ASSERT_EQ(file->tell(), 2000000);
+            for (unsigned long i = 0; i < 4; i++)
+                ASSERT_EQ(jds_->get_outstanding_bytes(i), 0);
+            ASSERT_NO_THROW(file->close());
+        });
+        // Run the simulation
+        ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
+    });
+}
@@ -0,0 +1,166 @@
+/* Copyright (c) 2024-2026. The FSMOD Team. All rights reserved.          */
+
+/* This program is free software; you can redistribute it and/or modify it
+ * under the terms of the license (GNU LGPL) which comes with this package. */
+
+#include <gtest/gtest.h>
+#include <iostream>
+
+#include <simgrid/s4u/Actor.hpp>
+#include <simgrid/s4u/Engine.hpp>
+
+#include "fsmod/FileSystem.hpp"
+#include "fsmod/MetadataService.hpp"
+#include "fsmod/OneDiskStorage.hpp"
+#include "fsmod/FileSystemException.hpp"
+
+#include "./test_util.hpp"
+
+namespace sgfs=simgrid::fsmod;
+namespace sg4=simgrid::s4u;
+
+XBT_LOG_NEW_DEFAULT_CATEGORY(metadata_service_test, "Metadata Service Test");
+
+class MetadataServiceTest : public ::testing::Test {
+public:
+    std::shared_ptr<sgfs::FileSystem> fs_;
+    std::shared_ptr<sgfs::MetadataService> mds_;
+    sg4::Host * client_;
+    sg4::Host * server_;
+
+    MetadataServiceTest() = default;
+
+    void setup_platform(double link_latency, unsigned long max_concurrent_operations) {
+        XBT_INFO("Creating a platform with one client host with one disk, and a metadata server host...");
+        auto *my_zone = sg4::Engine::get_instance()->get_netzone_root()->add_netzone_full("zone");
+        client_ = my_zone->add_host("client", "100Gf");
+        server_ = my_zone->add_host("server", "100Gf");
+        auto* disk = client_->add_disk("disk", "1MBps", "1MBps");
+        auto* link = my_zone->add_link("link", 1e9);
+        link->set_latency(link_latency);
+        my_zone->add_route(client_, server_, {link});
+        my_zone->seal();
+
+        XBT_INFO("Creating a file system with two 100MB partitions on a one-disk storage...");
+        auto ods = sgfs::OneDiskStorage::create("my_storage", disk);
+        fs_ = sgfs::FileSystem::create("my_fs");
+        fs_->mount_partition("/dev/a/", ods, "100MB");
+        fs_->mount_partition("/dev/b/", ods, "100MB");
+        XBT_INFO("Creating a metadata service on the server host...");
+        mds_ = sgfs::MetadataService::create(server_, max_concurrent_operations);
+        fs_->set_metadata_service(mds_);
+    }
+};
+
+TEST_F(MetadataServiceTest, BadArguments)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform(0, 1);
+        XBT_INFO("Create metadata services with invalid arguments, which should fail");
+        ASSERT_THROW(sgfs::MetadataService::create(nullptr), std::invalid_argument);
+        ASSERT_THROW(sgfs::MetadataService::create(server_, 0), std::invalid_argument);
+        ASSERT_THROW(mds_->set_latency(-1), std::invalid_argument);
+        ASSERT_THROW(mds_->set_latency(sgfs::MetadataService::Operation::OPEN, -1), std::invalid_argument);
+        XBT_INFO("Create a file outside of an actor, which is free");
+        ASSERT_NO_THROW(fs_->create_file("/dev/a/foo.txt", "1kB"));
+        ASSERT_EQ(mds_->get_num_operations(), 0);
+    });
+}
+
+TEST_F(MetadataServiceTest, OperationLatencies)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform(0, 1);
+        mds_->set_latency(0.01);
+        mds_->set_latency(sgfs::MetadataService::Operation::CREATE, 0.1);
+        mds_->set_latency(sgfs::MetadataService::Operation::OPEN, 0.05);
+        client_->add_actor("TestActor", [this]() {
+            std::shared_ptr<sgfs::File> file;
+            XBT_INFO("Create a file, which takes 0.1s");
+            ASSERT_NO_THROW(fs_->create_file("/dev/a/dir/foo.txt", "1kB"));
+            ASSERT_DOUBLE_EQ(sg4::Engine::get_clock(), 0.1);
+            XBT_INFO("Open it, which takes 0.05s");
+            ASSERT_NO_THROW(file = fs_->open("/dev/a/dir/foo.txt", "r"));
+            ASSERT_NO_THROW(file->close());
+            ASSERT_DOUBLE_EQ(sg4::Engine::get_clock(), 0.15);
+            XBT_INFO("Open a file that does not exist, which creates it in 0.1s");
+            ASSERT_NO_THROW(file = fs_->open("/dev/a/dir/bar.txt", "w"));
+            ASSERT_NO_THROW(file->close());
+            ASSERT_DOUBLE_EQ(sg4::Engine::get_clock(), 0.25);
+            XBT_INFO("List, move, and unlink files, which take 0.01s each");
+            ASSERT_EQ(fs_->list_files_in_directory("/dev/a/dir").size(), 2);
+            ASSERT_NO_THROW(fs_->move_file("/dev/a/dir/bar.txt", "/dev/a/dir/baz.txt"));
+            ASSERT_NO_THROW(fs_->unlink_file("/dev/a/dir/baz.txt"));
+            ASSERT_DOUBLE_EQ(sg4::Engine::get_clock(), 0.28);
+            ASSERT_EQ(mds_->get_num_operations(sgfs::MetadataService::Operation::CREATE), 2);
+            ASSERT_EQ(mds_->get_num_operations(sgfs::MetadataService::Operation::OPEN), 1);
+            ASSERT_EQ(mds_->get_num_operations(), 6);
+            XBT_INFO("Open a file that does not exist for reading, which fails after 0.05s");
+            ASSERT_THROW(fs_->open("/dev/a/dir/baz.txt", "r"), sgfs::FileNotFoundException);
+            ASSERT_DOUBLE_EQ(sg4::Engine::get_clock(), 0.33);
+        });
+        // Run the simulation
+        ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
+    });
+}
+
+TEST_F(MetadataServiceTest, ConcurrencyCap)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform(0, 2);
+        mds_->set_latency(1.0);
+        XBT_INFO("Four actors create a file each at the same time, on a server that serves two operations at a time");
+        for (int i = 0; i < 4; i++) {
+            client_->add_actor("Creator_" + std::to_string(i), [this, i]() {
+                ASSERT_NO_THROW(fs_->create_file("/dev/a/file_" + std::to_string(i), "1kB"));
+                ASSERT_DOUBLE_EQ(sg4::Engine::get_clock(), (i < 2) ? 1.0 : 2.0);
+            });
+        }
+        client_->add_actor("Observer", [this]() {
+            sg4::this_actor::sleep_for(0.5);
+            ASSERT_EQ(mds_->get_num_running_operations(), 2);
+            ASSERT_EQ(mds_->get_num_waiting_operations(), 2);
+        });
+        // Run the simulation
+        ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
+        ASSERT_EQ(mds_->get_num_operations(), 4);
+        ASSERT_DOUBLE_EQ(mds_->get_total_waiting_time(), 2.0);
+    });
+}
+
+TEST_F(MetadataServiceTest, PartitionMetadataService)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform(0, 1);
+        mds_->set_latency(1.0);
+        XBT_INFO("Give the second partition its own, faster, metadata service");
+        auto other_mds = sgfs::MetadataService::create(server_);
+        other_mds->set_latency(0.5);
+        fs_->partition_by_name("/dev/b")->set_metadata_service(other_mds);
+        client_->add_actor("TestActor", [this, other_mds]() {
+            ASSERT_NO_THROW(fs_->create_file("/dev/a/foo.txt", "1kB"));
+            ASSERT_DOUBLE_EQ(sg4::Engine::get_clock(), 1.0);
+            ASSERT_NO_THROW(fs_->create_file("/dev/b/foo.txt", "1kB"));
+            ASSERT_DOUBLE_EQ(sg4::Engine::get_clock(), 1.5);
+            ASSERT_EQ(mds_->get_num_operations(), 1);
+            ASSERT_EQ(other_mds->get_num_operations(), 1);
+        });
+        // Run the simulation
+        ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
+    });
+}
+
+TEST_F(MetadataServiceTest, NetworkRoundTrip)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform(0.01, 2);
+        mds_->set_latency(0.1);
+        XBT_INFO("An actor on the server host creates a file in 0.1s");
+        server_->add_actor("LocalActor", [this]() {
+            ASSERT_NO_THROW(fs_->create_file("/dev/a/local.txt", "1kB"));
+            ASSERT_DOUBLE_EQ(sg4::Engine::get_clock(), 0.1);
+        });
+        XBT_INFO("An actor on the client host also pays for a round trip over the network");
+        client_->add_actor("RemoteActor", [this]() {
+            ASSERT_NO_THROW(fs_->create_file("/dev/a/remote.txt", "1kB"));
+            ASSERT_GT(sg4::Engine::get_clock(), 0.12);
+        });
+        // Run the simulation
+        ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
+    });
+}
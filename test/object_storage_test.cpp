@@ -0,0 +1,174 @@
+/* Copyright (c) 2024-2026. The FSMOD Team. All rights reserved.          */
+
+/* This program is free software; you can redistribute it and/or modify it
+ * under the terms of the license (GNU LGPL) which comes with this package. */
+
+#include <gtest/gtest.h>
+#include <iostream>
+
+#include <simgrid/s4u/Actor.hpp>
+#include <simgrid/s4u/Engine.hpp>
+
+#include "fsmod/FileSystem.hpp"
+#include "fsmod/ObjectStorage.hpp"
+#include "fsmod/FileSystemException.hpp"
+
+#include "./test_util.hpp"
+
+namespace sgfs=simgrid::fsmod;
+namespace sg4=simgrid::s4u;
+
+XBT_LOG_NEW_DEFAULT_CATEGORY(object_storage_test, "Object Storage Test");
+
+class ObjectStorageTest : public ::testing::Test {
+public:
+    std::shared_ptr<sgfs::FileSystem> fs_;
+    std::shared_ptr<sgfs::ObjectStorage> os_;
+    sg4::Host * client_;
+    sg4::Disk * disk_;
+
+    ObjectStorageTest() = default;
+
+    void setup_platform(sg_size_t max_request_size = 5368709120) {
+        XBT_INFO("Creating a platform with one client host and one server host with one disk...");
+        auto *my_zone = sg4::Engine::get_instance()->get_netzone_root()->add_netzone_full("zone");
+        client_ = my_zone->add_host("client", "100Gf");
+        auto* server = my_zone->add_host("server", "100Gf");
+        disk_ = server->add_disk("disk", "10MBps", "10MBps");
+        const auto* link = my_zone->add_link("link", 1e9);
+        my_zone->add_route(client_, server, {link});
+        my_zone->seal();
+
+        XBT_INFO("Creating an object storage on the server's disk, with a 100ms request latency...");
+        os_ = sgfs::ObjectStorage::create("s3", disk_, 0.1, max_request_size);
+        XBT_INFO("Creating a file system...");
+        fs_ = sgfs::FileSystem::create("my_fs");
+        XBT_INFO("Mounting a 100MB partition...");
+        fs_->mount_partition("/dev/s3/", os_, "100MB");
+    }
+};
+
+TEST_F(ObjectStorageTest, BadArguments)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform(2000000);
+        XBT_INFO("Create object storages with invalid arguments, which should fail");
+        ASSERT_THROW(sgfs::ObjectStorage::create("bad", nullptr, 0.1), std::invalid_argument);
+        ASSERT_THROW(sgfs::ObjectStorage::create("bad", disk_, -1), std::invalid_argument);
+        ASSERT_THROW(sgfs::ObjectStorage::create("bad", disk_, 0.1, 0), std::invalid_argument);
+        XBT_INFO("Parts and ranges cannot be larger than the maximum request size");
+        ASSERT_EQ(os_->get_part_size(), 2000000);
+        ASSERT_EQ(os_->get_range_size(), 2000000);
+        ASSERT_THROW(os_->set_multipart_upload(0, 1), std::invalid_argument);
+        ASSERT_THROW(os_->set_multipart_upload(3000000, 1), std::invalid_argument);
+        ASSERT_THROW(os_->set_multipart_upload(1000000, 0), std::invalid_argument);
+        ASSERT_THROW(os_->set_ranged_get(0, 1), std::invalid_argument);
+        ASSERT_THROW(os_->set_ranged_get(3000000, 1), std::invalid_argument);
+        ASSERT_THROW(os_->set_ranged_get(1000000, 0), std::invalid_argument);
+        ASSERT_NO_THROW(os_->set_multipart_upload(1000000, 4));
+        ASSERT_EQ(os_->get_part_size(), 1000000);
+        ASSERT_EQ(os_->get_multipart_parallelism(), 4);
+    });
+}
+
+TEST_F(ObjectStorageTest, SingleRequests)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform();
+        client_->add_actor("TestActor", [this]() {
+            std::shared_ptr<sgfs::File> file;
+            ASSERT_NO_THROW(file = fs_->open("/dev/s3/foo.txt", "w"));
+            XBT_INFO("Write 1MB, which is a single PUT that waits 0.1s and transfers data in 0.1s");
+            ASSERT_NO_THROW(file->write("1MB"));
+            ASSERT_NEAR(sg4::Engine::get_clock(), 0.2, 1e-6);
+            ASSERT_NO_THROW(file->close());
+            XBT_INFO("Read it back, which is a single GET");
+            ASSERT_NO_THROW(file = fs_->open("/dev/s3/foo.txt", "r"));
+            ASSERT_NO_THROW(file->read("1MB"));
+            ASSERT_NEAR(sg4::Engine::get_clock(), 0.4, 1e-6);
+            ASSERT_NO_THROW(file->close());
+            ASSERT_EQ(os_->get_num_requests(), 2);
+            ASSERT_EQ(os_->get_num_put_requests(), 1);
+            ASSERT_EQ(os_->get_num_get_requests(), 1);
+            ASSERT_EQ(os_->get_num_multipart_uploads(), 0);
+        });
+        // Run the simulation
+        ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
+    });
+}
+
+TEST_F(ObjectStorageTest, MultipartUpload)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform();
+        os_->set_multipart_upload(1000000, 2);
+        client_->add_actor("TestActor", [this]() {
+            std::shared_ptr<sgfs::File> file;
+            ASSERT_NO_THROW(file = fs_->open("/dev/s3/foo.txt", "w"));
+            XBT_INFO("Write 4MB in 1MB parts over 2 connections: initiate (0.1s), two rounds of two parts that "
+                     "share the disk (2 x 0.3s), complete (0.1s)");
+            ASSERT_NO_THROW(file->write("4MB"));
+            ASSERT_NEAR(sg4::Engine::get_clock(), 0.8, 1e-6);
+            ASSERT_NO_THROW(file->close());
+            ASSERT_EQ(os_->get_num_multipart_uploads(), 1);
+            ASSERT_EQ(os_->get_num_put_requests(), 6);
+            XBT_INFO("Write 4MB over a single connection, which pays the latency of each part in turn");
+            os_->set_multipart_upload(1000000, 1);
+            ASSERT_NO_THROW(file = fs_->open("/dev/s3/bar.txt", "w"));
+            ASSERT_NO_THROW(file->write("4MB"));
+            ASSERT_NEAR(sg4::Engine::get_clock(), 1.8, 1e-6);
+            ASSERT_NO_THROW(file->close());
+            ASSERT_EQ(os_->get_num_multipart_uploads(), 2);
+            ASSERT_EQ(os_->get_num_requests(), 12);
+        });
+        // Run the simulation
+        ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
+    });
+}
+
+TEST_F(ObjectStorageTest, RangedGets)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform();
+        os_->set_ranged_get(1000000, 4);
+        ASSERT_NO_THROW(fs_->create_file("/dev/s3/foo.txt", "4MB"));
+        client_->add_actor("TestActor", [this]() {
+            std::shared_ptr<sgfs::File> file;
+            ASSERT_NO_THROW(file = fs_->open("/dev/s3/foo.txt", "r"));
+            XBT_INFO("Read 4MB asynchronously in four 1MB ranges over 4 connections, which pay their latency "
+                     "together (0.1s) and share the disk (0.4s)");
+            sg4::IoPtr io;
+            ASSERT_NO_THROW(io = file->read_async("4MB"));
+            ASSERT_NO_THROW(io->wait());
+            ASSERT_NEAR(sg4::Engine::get_clock(), 0.5, 1e-6);
+            ASSERT_EQ(os_->get_num_get_requests(), 4);
+            XBT_INFO("Read it again over a single connection, which pays the latency of each range in turn");
+            os_->set_ranged_get(1000000, 1);
+            ASSERT_NO_THROW(file->seek(0));
+            ASSERT_NO_THROW(file->read("4MB"));
+            ASSERT_NEAR(sg4::Engine::get_clock(), 1.3, 1e-6);
+            ASSERT_EQ(os_->get_num_get_requests(), 8);
+            ASSERT_NO_THROW(file->close());
+        });
+        // Run the simulation
+        ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
+    });
+}
+
+TEST_F(ObjectStorageTest, MaxRequestSize)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform(2000000);
+        client_->add_actor("TestActor", [this]() {
+            std::shared_ptr<sgfs::File> file;
+            ASSERT_NO_THROW(file = fs_->open("/dev/s3/foo.txt", "w"));
+            XBT_INFO("Write 3MB, which is larger than the maximum request size and goes through a multipart upload");
+            ASSERT_NO_THROW(file->write("3MB"));
+            ASSERT_EQ(os_->get_num_multipart_uploads(), 1);
+            ASSERT_EQ(os_->get_num_put_requests(), 4);
+            ASSERT_NO_THROW(file->close());
+            XBT_INFO("Read it back, which takes two GETs");
+            ASSERT_NO_THROW(file = fs_->open("/dev/s3/foo.txt", "r"));
+            ASSERT_NO_THROW(file->read("3MB"));
+            ASSERT_EQ(os_->get_num_get_requests(), 2);
+            ASSERT_NO_THROW(file->close());
+        });
+        // Run the simulation
+        ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
+    });
+}
@@ -0,0 +1,160 @@
+# Copyright (c) 2025-2026. The FSMod Team. All rights reserved.
+#
+# This program is free software you can redistribute it and/or modify it
+# under the terms of the license (GNU LGPL) which comes with this package.
+
+import math
+import sys
+import multiprocessing
+from simgrid import Engine, this_actor
+from fsmod import (FileSystem, OneDiskStorage, LRUEvictionPolicy, MaxSizeAdmissionPolicy, SecondHitAdmissionPolicy,
+                   TinyLFUAdmissionPolicy)
+
+def setup_platform():
+    e = Engine(sys.argv)
+    e.set_log_control("no_loc")
+    e.set_log_control("root.thresh:critical")
+
+    # Creating a platform with one host, a 100MBps cache disk, and a 10MBps origin disk...
+    zone = e.netzone_root.add_netzone_full("zone")
+    host = zone.add_host("my_host", "100Gf")
+    cache_disk = host.add_disk("cache_disk", "100MBps", "100MBps")
+    origin_disk = host.add_disk("origin_disk", "10MBps", "10MBps")
+    zone.seal()
+
+    # Creating an origin file system that holds 20MB, 50MB, and 60MB files
+    origin_fs = FileSystem.create("origin_fs")
+    origin_fs.mount_partition("/pfs/", OneDiskStorage.create("origin_storage", origin_disk), "1TB")
+    origin_fs.create_file("/pfs/data/a.txt", "20MB")
+    origin_fs.create_file("/pfs/data/b.txt", "50MB")
+    origin_fs.create_file("/pfs/data/c.txt", "60MB")
+    # Creating a file system with a 100MB LRU partition that reads through to the origin
+    cache_fs = FileSystem.create("cache_fs")
+    cache_fs.mount_partition("/cache/", OneDiskStorage.create("cache_storage", cache_disk), "100MB",
+                             LRUEvictionPolicy())
+    cache_fs.partition_by_name("/cache").set_read_through(origin_fs, "/pfs/data/")
+
+    return e, host, cache_fs, origin_fs
+
+def run_test_bad_arguments():
+    e, host, cache_fs, origin_fs = setup_platform()
+    for bad_call in [lambda: MaxSizeAdmissionPolicy(0),
+                     lambda: TinyLFUAdmissionPolicy(0)]:
+        try:
+            bad_call()
+            assert False, "Should have raised an exception"
+        except ValueError:
+            pass
+    cache = cache_fs.partition_by_name("/cache")
+    cache.set_admission_policy(SecondHitAdmissionPolicy())
+    assert cache.admission_policy.partition_size == 100000000
+
+def run_test_max_size_admission():
+    e, host, cache_fs, origin_fs = setup_platform()
+    cache = cache_fs.partition_by_name("/cache")
+    cache.set_admission_policy(MaxSizeAdmissionPolicy(30000000))
+
+    def test_actor():
+        this_actor.info("Open a 50MB file, which is not admitted, and is read from the origin")
+        file = cache_fs.open("/cache/b.txt", "r")
+        file.read("50MB")
+        file.close()
+        assert math.isclose(Engine.clock, 5.0)
+        assert not cache_fs.file_exists("/cache/b.txt")
+        assert cache.num_rejections == 1
+        this_actor.info("Open a 20MB file, which is admitted")
+        cache_fs.open("/cache/a.txt", "r").close()
+        assert math.isclose(Engine.clock, 7.2)
+        assert cache_fs.file_exists("/cache/a.txt")
+
+    host.add_actor("TestActor", test_actor)
+    e.run()
+
+def run_test_second_hit_admission():
+    e, host, cache_fs, origin_fs = setup_platform()
+    cache = cache_fs.partition_by_name("/cache")
+    cache.set_admission_policy(SecondHitAdmissionPolicy())
+
+    def test_actor():
+        this_actor.info("Open a file twice, which only fetches it the second time")
+        cache_fs.open("/cache/a.txt", "r").close()
+        assert not cache_fs.file_exists("/cache/a.txt")
+        cache_fs.open("/cache/a.txt", "r").close()
+        assert math.isclose(Engine.clock, 2.2)
+        assert cache_fs.file_exists("/cache/a.txt")
+        assert cache.num_rejections == 1
+        assert cache.num_fetches == 1
+
+    host.add_actor("TestActor", test_actor)
+    e.run()
+
+def run_test_tiny_lfu_admission():
+    e, host, cache_fs, origin_fs = setup_platform()
+    cache = cache_fs.partition_by_name("/cache")
+    policy = TinyLFUAdmissionPolicy()
+    cache.set_admission_policy(policy)
+
+    def test_actor():
+        this_actor.info("Open the 20MB file three times, and the 50MB file once")
+        for _ in range(3):
+            cache_fs.open("/cache/a.txt", "r").close()
+        cache_fs.open("/cache/b.txt", "r").close()
+        assert policy.get_estimated_frequency("/a.txt") == 3
+        this_actor.info("Open the 60MB file three times, which would evict more frequently used files")
+        for _ in range(3):
+            cache_fs.open("/cache/c.txt", "r").close()
+        assert cache.num_rejections == 3
+        assert cache_fs.file_exists("/cache/a.txt")
+        this_actor.info("Open it a fourth time, which evicts both files")
+        cache_fs.open("/cache/c.txt", "r").close()
+        assert cache_fs.file_exists("/cache/c.txt")
+        assert not cache_fs.file_exists("/cache/a.txt")
+        assert not cache_fs.file_exists("/cache/b.txt")
+
+    host.add_actor("TestActor", test_actor)
+    e.run()
+
+def run_test_file_larger_than_partition():
+    e, host, cache_fs, origin_fs = setup_platform()
+    origin_fs.create_file("/pfs/data/huge.txt", "150MB")
+    cache = cache_fs.partition_by_name("/cache")
+    cache.set_admission_policy(TinyLFUAdmissionPolicy())
+
+    def test_actor():
+        this_actor.info("Open the 20MB file, which is fetched")
+        cache_fs.open("/cache/a.txt", "r").close()
+        this_actor.info("Open a 150MB file, which cannot fit, and is read from the origin in 15s")
+        file = cache_fs.open("/cache/huge.txt", "r")
+        file.read("150MB")
+        file.close()
+        assert math.isclose(Engine.clock, 17.2)
+        assert cache.num_rejections == 1
+        assert cache.num_fetches == 1
+        assert cache_fs.file_exists("/cache/a.txt")
+        assert not cache_fs.file_exists("/cache/huge.txt")
+        this_actor.info("Without an admission policy, the file is not fetched either")
+        cache.set_admission_policy(None)
+        cache_fs.open("/cache/huge.txt", "r").close()
+        assert cache.num_rejections == 2
+
+    host.add_actor("TestActor", test_actor)
+    e.run()
+
+if __name__ == "__main__":
+    tests = [
+        run_test_bad_arguments,
+        run_test_max_size_admission,
+        run_test_second_hit_admission,
+        run_test_tiny_lfu_admission,
+        run_test_file_larger_than_partition,
+    ]
+
+    for test in tests:
+        print(f"\n🔧 Running {test.__name__} ...")
+        p = multiprocessing.Process(target=test)
+        p.start()
+        p.join()
+        if p.exitcode != 0:
+            print(f"❌ {test.__name__} failed with exit code {p.exitcode}")
+        else:
+            print(f"✅ {test.__name__} passed")
@@ -0,0 +1,90 @@
+# Copyright (c) 2025-2026. The FSMod Team. All rights reserved.
+#
+# This program is free software you can redistribute it and/or modify it
+# under the terms of the license (GNU LGPL) which comes with this package.
+
+import math
+import sys
+import multiprocessing
+from simgrid import Engine, this_actor
+from fsmod import FileSystem, OneDiskStorage, CachedStorage
+
+def setup_platform(write_policy):
+    e = Engine(sys.argv)
+    e.set_log_control("no_loc")
+    e.set_log_control("root.thresh:critical")
+
+    # Creating a platform with one host, one SSD, and one HDD...
+    zone = e.netzone_root.add_netzone_full("zone")
+    host = zone.add_host("my_host", "100Gf")
+    ssd = host.add_disk("ssd", "10MBps", "10MBps")
+    hdd = host.add_disk("hdd", "1MBps", "1MBps")
+    zone.seal()
+
+    # Creating a one-disk storage on the HDD, cached by a 4MB cache on the SSD with 1MB blocks
+    hdd_storage = OneDiskStorage.create("hdd_storage", hdd)
+    cs = CachedStorage.create("cached_storage", hdd_storage, ssd, 4000000, 1000000, write_policy)
+    # Creating a file system
+    fs = FileSystem.create("my_fs")
+    # Mounting a 100MB partition
+    fs.mount_partition("/dev/a/", cs, "100MB")
+    fs.create_file("/dev/a/foo.txt", "10MB")
+
+    return e, host, cs, fs
+
+def run_test_read_hits_and_misses():
+    e, host, cs, fs = setup_platform(CachedStorage.WritePolicy.WRITE_THROUGH)
+
+    def test_actor():
+        file = fs.open("/dev/a/foo.txt", "r")
+        this_actor.info("Read 2MB, which misses and is served by the HDD in 2s")
+        file.read("2MB")
+        assert math.isclose(Engine.clock, 2.0)
+        assert cs.num_read_misses == 2
+        this_actor.info("Read the same 2MB once the cache has been filled, which is served by the SSD in 0.2s")
+        this_actor.sleep_until(3)
+        file.seek(0)
+        file.read("2MB")
+        assert math.isclose(Engine.clock, 3.2)
+        assert cs.num_read_hits == 2
+        assert math.isclose(cs.read_hit_rate, 0.5)
+        file.close()
+
+    host.add_actor("TestActor", test_actor)
+    e.run()
+
+def run_test_write_back():
+    e, host, cs, fs = setup_platform(CachedStorage.WritePolicy.WRITE_BACK)
+
+    def test_actor():
+        fs.create_file("/dev/a/bar.txt", "0B")
+        file = fs.open("/dev/a/bar.txt", "w")
+        this_actor.info("Write 2MB, which completes when the SSD has written it, at 0.2s")
+        file.write("2MB")
+        assert math.isclose(Engine.clock, 0.2)
+        assert cs.num_dirty_blocks == 2
+        this_actor.info("Flush the dirty blocks, which the HDD writes in 2s")
+        cs.flush()
+        assert math.isclose(Engine.clock, 2.2)
+        assert cs.num_dirty_blocks == 0
+        assert cs.num_flushed_blocks == 2
+        file.close()
+
+    host.add_actor("TestActor", test_actor)
+    e.run()
+
+if __name__ == "__main__":
+    tests = [
+        run_test_read_hits_and_misses,
+        run_test_write_back,
+    ]
+
+    for test in tests:
+        print(f"\n🔧 Running {test.__name__} ...")
+        p = multiprocessing.Process(target=test)
+        p.start()
+        p.join()
+        if p.exitcode != 0:
+            print(f"❌ {test.__name__} failed with exit code {p.exitcode}")
+        else:
+            print(f"✅ {test.__name__} passed")
@@ -225,6 +225,52 @@ def run_test_LRU_extensive():
     host.add_actor("TestActor", test_actor)
     e.run()
 
+def run_test_LRU_open_files_keep_their_place():
+    e, host, disk, fs = setup_platform()
+    def test_actor():
+        fs.create_file("/dev/lru/a.txt", "20MB")
+        fs.create_file("/dev/lru/b.txt", "30MB")
+        fs.create_file("/dev/lru/c.txt", "30MB")
+        # Access a.txt while it is open, then access b.txt, then close a.txt
+        file = fs.open("/dev/lru/a.txt", "r")
+        file.read(10)
+        file2 = fs.open("/dev/lru/b.txt", "r")
+        file2.read(10)
+        file2.close()
+        file.close()
+        # Creating a 60MB file evicts c.txt and a.txt, the least recently used files
+        fs.create_file("/dev/lru/d.txt", "60MB")
+        assert False == fs.file_exists("/dev/lru/a.txt")
+        assert True == fs.file_exists("/dev/lru/b.txt")
+        assert False == fs.file_exists("/dev/lru/c.txt")
+        assert True == fs.file_exists("/dev/lru/d.txt")
+
+    host.add_actor("TestActor", test_actor)
+    e.run()
+
+def run_test_FIFO_moved_files():
+    e, host, disk, fs = setup_platform()
+    def test_actor():
+        fs.create_file("/dev/fifo/a.txt", "50MB")
+        fs.create_file("/dev/fifo/b.txt", "40MB")
+        fs.move_file("/dev/fifo/a.txt", "/dev/fifo/dir/a.txt")
+        # Creating two 30MB files evicts b.txt and then the moved file
+        fs.create_file("/dev/fifo/c.txt", "30MB")
+        assert False == fs.file_exists("/dev/fifo/b.txt")
+        assert True == fs.file_exists("/dev/fifo/dir/a.txt")
+        fs.create_file("/dev/fifo/d.txt", "30MB")
+        assert False == fs.file_exists("/dev/fifo/dir/a.txt")
+        assert True == fs.file_exists("/dev/fifo/c.txt")
+        # Moving d.txt over c.txt, and creating a 90MB file evicts the moved file
+        fs.move_file("/dev/fifo/d.txt", "/dev/fifo/c.txt")
+        fs.create_file("/dev/fifo/e.txt", "90MB")
+        assert False == fs.file_exists("/dev/fifo/c.txt")
+        assert False == fs.file_exists("/dev/fifo/d.txt")
+        assert True == fs.file_exists("/dev/fifo/e.txt")
+
+    host.add_actor("TestActor", test_actor)
+    e.run()
+
 if __name__ == '__main__':
     tests = [
       run_test_logic_test,
@@ -233,7 +279,9 @@ if __name__ == '__main__':
       run_test_FIFO_do_not_evict_open_files,
       run_test_FIFO_extensive,
       run_test_LRU_basics,
-      run_test_LRU_extensive
+      run_test_LRU_extensive,
+      run_test_LRU_open_files_keep_their_place,
+      run_test_FIFO_moved_files
     ]
 
     for test in tests:
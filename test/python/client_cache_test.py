@@ -0,0 +1,96 @@
+# Copyright (c) 2025-2026. The FSMod Team. All rights reserved.
+#
+# This program is free software you can redistribute it and/or modify it
+# under the terms of the license (GNU LGPL) which comes with this package.
+
+import math
+import sys
+import multiprocessing
+from simgrid import Engine, this_actor
+from fsmod import FileSystem, OneRemoteDiskStorage, ClientCache
+
+def setup_platform(use_cache_disk):
+    e = Engine(sys.argv)
+    e.set_log_control("no_loc")
+    e.set_log_control("root.thresh:critical")
+
+    # Creating a platform with two client hosts and one server host with one disk...
+    zone = e.netzone_root.add_netzone_full("zone")
+    client = zone.add_host("client", "100Gf")
+    client_disk = client.add_disk("ssd", "100MBps", "100MBps")
+    other_client = zone.add_host("other_client", "100Gf")
+    server = zone.add_host("server", "100Gf")
+    server_disk = server.add_disk("disk", "10MBps", "10MBps")
+    link = zone.add_link("link", 1e9)
+    zone.add_route(client, server, [link])
+    zone.add_route(other_client, server, [link])
+    zone.seal()
+
+    # Creating a file system on a remote storage, with a 4MB client cache with 1MB blocks on the client
+    fs = FileSystem.create("my_fs")
+    fs.mount_partition("/dev/nfs/", OneRemoteDiskStorage.create("nfs", server_disk), "100MB")
+    cache = ClientCache.create(client, 4000000, 1000000, client_disk if use_cache_disk else None)
+    fs.add_client_cache(cache)
+    fs.create_file("/dev/nfs/foo.txt", "2MB")
+
+    return e, client, other_client, cache, fs
+
+def run_test_rereads_hit_disk():
+    e, client, other_client, cache, fs = setup_platform(True)
+
+    def reader():
+        file = fs.open("/dev/nfs/foo.txt", "r")
+        file.read("2MB")
+        assert cache.num_read_misses == 2
+        this_actor.info("Read the same 2MB again, which is served by the client's cache disk in 0.02s")
+        this_actor.sleep_until(1)
+        file.seek(0)
+        file.read("2MB")
+        assert math.isclose(Engine.clock, 1.02, abs_tol=1e-6)
+        assert cache.num_read_hits == 2
+        file.close()
+
+    client.add_actor("Reader", reader)
+    e.run()
+
+def run_test_close_to_open_consistency():
+    e, client, other_client, cache, fs = setup_platform(False)
+
+    def reader():
+        file = fs.open("/dev/nfs/foo.txt", "r")
+        file.read("1MB")
+        file.close()
+        this_actor.info("Reopen and read the file once another host has modified it, which misses")
+        this_actor.sleep_until(2)
+        file = fs.open("/dev/nfs/foo.txt", "r")
+        assert cache.num_invalidations == 1
+        file.read("1MB")
+        assert math.isclose(Engine.clock, 2.1, abs_tol=0.001)
+        assert cache.num_read_misses == 2
+        file.close()
+
+    def writer():
+        this_actor.sleep_until(1)
+        file = fs.open("/dev/nfs/foo.txt", "r+")
+        file.write("1MB")
+        file.close()
+
+    client.add_actor("Reader", reader)
+    other_client.add_actor("Writer", writer)
+    e.run()
+
+if __name__ == "__main__":
+    tests = [
+        run_test_rereads_hit_disk,
+        run_test_close_to_open_consistency,
+    ]
+
+    for test in tests:
+        print(f"\n🔧 Running {test.__name__} ...")
+        p = multiprocessing.Process(target=test)
+        p.start()
+        p.join()
+        if p.exitcode != 0:
+            print(f"❌ {test.__name__} failed with exit code {p.exitcode}")
+        else:
+            print(f"✅ {test.__name__} passed")
@@ -0,0 +1,103 @@
+# Copyright (c) 2025-2026. The FSMod Team. All rights reserved.
+#
+# This program is free software you can redistribute it and/or modify it
+# under the terms of the license (GNU LGPL) which comes with this package.
+
+import math
+import sys
+import multiprocessing
+from simgrid import Engine, this_actor
+from fsmod import FileSystem, OneDiskStorage, FileIsOpenException
+
+def setup_platform():
+    e = Engine(sys.argv)
+    e.set_log_control("no_loc")
+    e.set_log_control("root.thresh:critical")
+
+    # Creating a platform with one 100Gf host and one 100MBps disk...
+    zone = e.netzone_root.add_netzone_full("zone")
+    host = zone.add_host("my_host", "100Gf")
+    disk = host.add_disk("disk", "100MBps", "100MBps")
+    zone.seal()
+
+    # Creating a one-disk storage on the host's disk
+    ods = OneDiskStorage.create("my_storage", disk)
+    # Creating a file system
+    fs = FileSystem.create("my_fs")
+    # Mounting a 100MB partition
+    fs.mount_partition("/dev/a/", ods, "100MB")
+
+    return e, host, fs, fs.partition_by_name("/dev/a")
+
+def run_test_bad_arguments():
+    e, host, fs, partition = setup_platform()
+    fs.create_file("/dev/a/foo.txt", "10MB")
+    for bad_call in [lambda: partition.set_compression(0.5),
+                     lambda: partition.set_compression(2, -1),
+                     lambda: partition.set_compression(2, 10, -1),
+                     lambda: fs.set_file_compression_ratio("/dev/a/foo.txt", 0.5)]:
+        try:
+            bad_call()
+            assert False, "Should have raised an exception"
+        except ValueError:
+            pass
+    assert partition.compression_ratio == 1.0
+
+def run_test_free_space():
+    e, host, fs, partition = setup_platform()
+    # A 10MB file created before enabling compression uses 10MB
+    fs.create_file("/dev/a/foo.txt", "10MB")
+    assert partition.free_space == 90000000
+    # A 10MB file created with a 2:1 compression uses 5MB
+    partition.set_compression(2)
+    fs.create_file("/dev/a/bar.txt", "10MB")
+    assert partition.free_space == 85000000
+    assert fs.file_size("/dev/a/bar.txt") == 10000000
+    # Compressing the first file 4:1 frees 7.5MB
+    fs.set_file_compression_ratio("/dev/a/foo.txt", 4)
+    assert partition.free_space == 92500000
+    fs.unlink_file("/dev/a/foo.txt")
+    assert partition.free_space == 95000000
+
+def run_test_read_and_write_costs():
+    e, host, fs, partition = setup_platform()
+    partition.set_compression(2, 100, 50)
+
+    def writer_and_reader():
+        this_actor.info("Write 10MB, which computes for 0.01s and writes 5MB in 0.05s")
+        file = fs.open("/dev/a/foo.txt", "w")
+        file.write("10MB")
+        assert math.isclose(Engine.clock, 0.06, abs_tol=1e-6)
+        assert partition.free_space == 95000000
+        try:
+            fs.set_file_compression_ratio("/dev/a/foo.txt", 4)
+            assert False, "Should have raised an exception"
+        except FileIsOpenException:
+            pass
+        file.close()
+        this_actor.info("Read 10MB, which reads 5MB in 0.05s and decompresses them in 0.005s")
+        file = fs.open("/dev/a/foo.txt", "r")
+        date = Engine.clock
+        file.read("10MB")
+        assert math.isclose(Engine.clock - date, 0.055, abs_tol=1e-6)
+        file.close()
+
+    host.add_actor("WriterAndReader", writer_and_reader)
+    e.run()
+
+if __name__ == "__main__":
+    tests = [
+        run_test_bad_arguments,
+        run_test_free_space,
+        run_test_read_and_write_costs,
+    ]
+
+    for test in tests:
+        print(f"\n🔧 Running {test.__name__} ...")
+        p = multiprocessing.Process(target=test)
+        p.start()
+        p.join()
+        if p.exitcode != 0:
+            print(f"❌ {test.__name__} failed with exit code {p.exitcode}")
+        else:
+            print(f"✅ {test.__name__} passed")
@@ -0,0 +1,104 @@
+# Copyright (c) 2025-2026. The FSMod Team. All rights reserved.
+#
+# This program is free software you can redistribute it and/or modify it
+# under the terms of the license (GNU LGPL) which comes with this package.
+
+import math
+import sys
+import multiprocessing
+from simgrid import Engine, this_actor
+from fsmod import FileSystem, OneDiskStorage
+
+def setup_platform():
+    e = Engine(sys.argv)
+    e.set_log_control("no_loc")
+    e.set_log_control("root.thresh:critical")
+
+    # Creating a platform with one 100Gf host and one 100MBps disk...
+    zone = e.netzone_root.add_netzone_full("zone")
+    host = zone.add_host("my_host", "100Gf")
+    disk = host.add_disk("disk", "100MBps", "100MBps")
+    zone.seal()
+
+    # Creating a one-disk storage on the host's disk
+    ods = OneDiskStorage.create("my_storage", disk)
+    # Creating a file system
+    fs = FileSystem.create("my_fs")
+    # Mounting a 100MB partition
+    fs.mount_partition("/dev/a/", ods, "100MB")
+
+    return e, host, fs, fs.partition_by_name("/dev/a")
+
+def run_test_bad_arguments():
+    e, host, fs, partition = setup_platform()
+    for bad_call in [lambda: partition.set_deduplication(0),
+                     lambda: partition.set_deduplication(1000000, -1)]:
+        try:
+            bad_call()
+            assert False, "Should have raised an exception"
+        except ValueError:
+            pass
+    assert partition.deduplication_chunk_size == 0
+    assert partition.deduplication_ratio == 1.0
+
+def run_test_free_space():
+    e, host, fs, partition = setup_platform()
+    partition.set_deduplication(1000000)
+    # Two 10MB images with the same content are stored once
+    for path in ["/dev/a/a.img", "/dev/a/b.img"]:
+        fs.create_file(path, "10MB")
+        fs.set_file_fingerprint(path, "base")
+    assert partition.free_space == 90000000
+    assert partition.num_unique_chunks == 10
+    assert partition.deduplication_ratio == 2.0
+    # Deleting one of them frees nothing
+    fs.unlink_file("/dev/a/a.img")
+    assert partition.free_space == 90000000
+    fs.unlink_file("/dev/a/b.img")
+    assert partition.free_space == 100000000
+    # A 3MB file with two identical chunks uses 2MB
+    fs.create_file("/dev/a/c.img", "3MB")
+    fs.set_file_chunk_fingerprints("/dev/a/c.img", ["x", "x", "y"])
+    assert partition.free_space == 98000000
+    assert partition.deduplication_ratio == 1.5
+
+def run_test_duplicate_writes():
+    e, host, fs, partition = setup_platform()
+    partition.set_deduplication(1000000, 10)
+    fs.create_file("/dev/a/base.img", "10MB")
+    fs.set_file_fingerprint("/dev/a/base.img", "base")
+    fs.create_file("/dev/a/copy.img", "0B")
+    fs.set_file_fingerprint("/dev/a/copy.img", "base")
+
+    def writer():
+        this_actor.info("Write a 10MB copy of the image, which only hashes it")
+        file = fs.open("/dev/a/copy.img", "w")
+        file.write("10MB")
+        assert math.isclose(Engine.clock, 0.001, abs_tol=1e-6)
+        assert partition.free_space == 90000000
+        this_actor.info("Write 5MB more, which hashes them and stores 5 new chunks")
+        date = Engine.clock
+        file.write("5MB")
+        assert math.isclose(Engine.clock - date, 0.0505, abs_tol=1e-6)
+        assert partition.free_space == 85000000
+        file.close()
+
+    host.add_actor("Writer", writer)
+    e.run()
+
+if __name__ == "__main__":
+    tests = [
+        run_test_bad_arguments,
+        run_test_free_space,
+        run_test_duplicate_writes,
+    ]
+
+    for test in tests:
+        print(f"\n🔧 Running {test.__name__} ...")
+        p = multiprocessing.Process(target=test)
+        p.start()
+        p.join()
+        if p.exitcode != 0:
+            print(f"❌ {test.__name__} failed with exit code {p.exitcode}")
+        else:
+            print(f"✅ {test.__name__} passed")
@@ -0,0 +1,77 @@
+# Copyright (c) 2025-2026. The FSMod Team. All rights reserved.
+#
+# This program is free software you can redistribute it and/or modify it
+# under the terms of the license (GNU LGPL) which comes with this package.
+
+import math
+import sys
+import multiprocessing
+from simgrid import Engine, this_actor
+from fsmod import FileSystem, OneDiskStorage
+
+def setup_platform():
+    e = Engine(sys.argv)
+    e.set_log_control("no_loc")
+    e.set_log_control("root.thresh:critical")
+
+    # Creating a platform with one host and one disk...
+    zone = e.netzone_root.add_netzone_full("zone")
+    host = zone.add_host("my_host", "100Gf")
+    disk = host.add_disk("disk", "1MBps", "1MBps")
+    zone.seal()
+
+    # Creating a file system with a 100MB partition on a one-disk storage
+    ods = OneDiskStorage.create("my_storage", disk)
+    fs = FileSystem.create("my_fs")
+    fs.mount_partition("/dev/a/", ods, "100MB")
+    # Make metadata mutations hold directory locks for 0.1s
+    fs.partition_by_name("/dev/a").set_directory_lock_hold_time(0.1)
+
+    return e, host, fs
+
+def run_test_creates_in_same_directory_queue():
+    e, host, fs = setup_platform()
+
+    def creator(i):
+        fs.create_file(f"/dev/a/dir/file_{i}", "1kB")
+        assert math.isclose(Engine.clock, 0.1 * (i + 1))
+
+    # Four actors create a file each in the same directory at the same time
+    for i in range(4):
+        host.add_actor(f"Creator_{i}", creator, i)
+    e.run()
+    statistics = fs.get_directory_lock_statistics("/dev/a/dir")
+    assert statistics.num_mutations == 4
+    assert statistics.num_waits == 3
+    assert math.isclose(statistics.total_wait_time, 0.6)
+    assert math.isclose(statistics.max_wait_time, 0.3)
+
+def run_test_creates_in_different_directories_proceed_in_parallel():
+    e, host, fs = setup_platform()
+
+    def creator(i):
+        fs.create_file(f"/dev/a/dir_{i}/file", "1kB")
+        assert math.isclose(Engine.clock, 0.1)
+
+    # Four actors create a file each in their own directory at the same time
+    for i in range(4):
+        host.add_actor(f"Creator_{i}", creator, i)
+    e.run()
+    for i in range(4):
+        assert fs.get_directory_lock_statistics(f"/dev/a/dir_{i}").num_waits == 0
+
+if __name__ == "__main__":
+    tests = [
+        run_test_creates_in_same_directory_queue,
+        run_test_creates_in_different_directories_proceed_in_parallel,
+    ]
+
+    for test in tests:
+        print(f"\n🔧 Running {test.__name__} ...")
+        p = multiprocessing.Process(target=test)
+        p.start()
+        p.join()
+        if p.exitcode != 0:
+            print(f"❌ {test.__name__} failed with exit code {p.exitcode}")
+        else:
+            print(f"✅ {test.__name__} passed")
@@ -0,0 +1,294 @@
+# Copyright (c) 2025-2026. The FSMod Team. All rights reserved.
+#
+# This program is free software you can redistribute it and/or modify it
+# under the terms of the license (GNU LGPL) which comes with this package.
+
+import sys
+import multiprocessing
+from simgrid import Engine, this_actor
+from fsmod import (FileSystem, OneDiskStorage, EvictionPolicy, FIFOEvictionPolicy, LRUEvictionPolicy,
+                   ARCEvictionPolicy, TwoQEvictionPolicy, LFUEvictionPolicy, GDSFEvictionPolicy, S3FIFOEvictionPolicy,
+                   NotEnoughSpaceException)
+
+class LargestFirstEvictionPolicy(EvictionPolicy):
+    """A user-defined policy that evicts the largest files first, and counts the events it is notified of"""
+    def __init__(self):
+        EvictionPolicy.__init__(self)
+        self.files = {}
+        self.num_creations = 0
+        self.num_accesses = 0
+        self.num_deletions = 0
+        self.num_pin_changes = 0
+
+    def on_create(self, file_metadata):
+        self.files[file_metadata.id] = file_metadata
+        self.num_creations += 1
+
+    def on_access(self, file_metadata):
+        self.num_accesses += 1
+
+    def on_delete(self, file_metadata):
+        del self.files[file_metadata.id]
+        self.num_deletions += 1
+
+    def on_pin_change(self, file_metadata):
+        self.num_pin_changes += 1
+
+    def select_victims(self, num_bytes):
+        victims = [f for f in self.files.values() if not f.pinned]
+        return sorted(victims, key=lambda f: f.size, reverse=True)
+
+def setup_platform():
+    e = Engine(sys.argv)
+    e.set_log_control("no_loc")
+    e.set_log_control("root.thresh:critical")
+
+    # Creating a platform with one host and one disk...
+    zone = e.netzone_root.add_netzone_full("zone")
+    host = zone.add_host("my_host", "100Gf")
+    disk = host.add_disk("disk", "1kBps", "2kBps")
+    zone.seal()
+
+    # Creating a one-disk storage on the host's disk...
+    ods = OneDiskStorage.create("my_storage", disk)
+    # Creating a file system
+    fs = FileSystem.create("my_fs")
+    # Mounting a 100MB partition that evicts the largest files first (the policy must outlive the simulation)
+    policy = LargestFirstEvictionPolicy()
+    fs.mount_partition("/dev/a/", ods, "100MB", policy)
+
+    return e, host, ods, fs, policy
+
+def access(fs, path):
+    file = fs.open(path, "r")
+    file.read("1kB")
+    file.close()
+
+def check_files(fs, partition, present, evicted):
+    for name in present:
+        assert fs.file_exists(partition + name), f"{name} should be cached"
+    for name in evicted:
+        assert not fs.file_exists(partition + name), f"{name} should have been evicted"
+
+def run_test_events():
+    e, host, ods, fs, policy = setup_platform()
+
+    def test_actor():
+        this_actor.info("Create a file, which the policy is notified of")
+        fs.create_file("/dev/a/foo.txt", "10MB")
+        assert policy.num_creations == 1
+        this_actor.info("Open, read, and close the file, which pins, accesses, and unpins it")
+        num_accesses = policy.num_accesses
+        num_pin_changes = policy.num_pin_changes
+        file = fs.open("/dev/a/foo.txt", "r")
+        assert policy.num_pin_changes == num_pin_changes + 1
+        file.read("1kB")
+        assert policy.num_accesses > num_accesses
+        file.close()
+        assert policy.num_pin_changes == num_pin_changes + 2
+        this_actor.info("Make the file unevictable, which pins it")
+        fs.make_file_evictable("/dev/a/foo.txt", False)
+        assert policy.num_pin_changes == num_pin_changes + 3
+        assert list(policy.files.values())[0].pinned
+        this_actor.info("Delete the file, which the policy is notified of")
+        fs.unlink_file("/dev/a/foo.txt")
+        assert policy.num_deletions == 1
+        assert not policy.files
+
+    host.add_actor("TestActor", test_actor)
+    e.run()
+
+def run_test_eviction_follows_the_policy():
+    e, host, ods, fs, policy = setup_platform()
+
+    def test_actor():
+        this_actor.info("Create files of 10MB, 50MB, and 30MB")
+        fs.create_file("/dev/a/10mb.txt", "10MB")
+        fs.create_file("/dev/a/50mb.txt", "50MB")
+        fs.create_file("/dev/a/30mb.txt", "30MB")
+        this_actor.info("Create a 20MB file, which evicts the largest file rather than the oldest one")
+        fs.create_file("/dev/a/20mb.txt", "20MB")
+        assert fs.file_exists("/dev/a/10mb.txt")
+        assert not fs.file_exists("/dev/a/50mb.txt")
+        assert fs.file_exists("/dev/a/30mb.txt")
+        assert fs.file_exists("/dev/a/20mb.txt")
+        this_actor.info("Open the 30MB file, after which creating an 80MB file fails")
+        file = fs.open("/dev/a/30mb.txt", "r")
+        try:
+            fs.create_file("/dev/a/80mb.txt", "80MB")
+            assert False, "Should have raised a NotEnoughSpaceException"
+        except NotEnoughSpaceException:
+            pass
+        file.close()
+
+    host.add_actor("TestActor", test_actor)
+    e.run()
+
+def run_test_built_in_policies():
+    e, host, ods, fs, policy = setup_platform()
+    fs.mount_partition("/dev/fifo/", ods, "100MB", FIFOEvictionPolicy())
+    fs.mount_partition("/dev/lru/", ods, "100MB", LRUEvictionPolicy())
+
+    def test_actor():
+        for partition in ["/dev/fifo/", "/dev/lru/"]:
+            this_actor.info(f"Create files of 20MB and 60MB on {partition}, then read the first one")
+            fs.create_file(partition + "20mb.txt", "20MB")
+            fs.create_file(partition + "60mb.txt", "60MB")
+            file = fs.open(partition + "20mb.txt", "r")
+            file.read("1kB")
+            file.close()
+            this_actor.info(f"Create a 30MB file on {partition}")
+            fs.create_file(partition + "30mb.txt", "30MB")
+            # FIFO evicts the oldest file, LRU the least recently used one
+            assert fs.file_exists(partition + "20mb.txt") == (partition == "/dev/lru/")
+            assert fs.file_exists(partition + "60mb.txt") == (partition == "/dev/fifo/")
+
+    host.add_actor("TestActor", test_actor)
+    e.run()
+
+def run_test_advanced_policies_bad_arguments():
+    e, host, ods, fs, policy = setup_platform()
+    for bad_call in [lambda: TwoQEvictionPolicy(0),
+                     lambda: TwoQEvictionPolicy(0.25, 0),
+                     lambda: S3FIFOEvictionPolicy(1.5)]:
+        try:
+            bad_call()
+            assert False, "Should have raised an exception"
+        except ValueError:
+            pass
+    arc = ARCEvictionPolicy()
+    assert arc.partition_size == 0
+    fs.mount_partition("/dev/arc/", ods, "100MB", arc)
+    assert arc.partition_size == 100000000
+
+def run_test_ARC():
+    e, host, ods, fs, policy = setup_platform()
+    arc = ARCEvictionPolicy()
+    fs.mount_partition("/dev/arc/", ods, "100MB", arc)
+
+    def test_actor():
+        this_actor.info("Create two 30MB files and access them again, which makes them frequent")
+        fs.create_file("/dev/arc/a.txt", "30MB")
+        fs.create_file("/dev/arc/b.txt", "30MB")
+        access(fs, "/dev/arc/a.txt")
+        access(fs, "/dev/arc/b.txt")
+        this_actor.info("Scan four 20MB files, which only evicts scanned files")
+        for name in ["s1.txt", "s2.txt", "s3.txt", "s4.txt"]:
+            fs.create_file("/dev/arc/" + name, "20MB")
+        check_files(fs, "/dev/arc/", ["a.txt", "b.txt", "s3.txt", "s4.txt"], ["s1.txt", "s2.txt"])
+        this_actor.info("Create the first scanned file again, which grows the target of the recency list")
+        fs.create_file("/dev/arc/s1.txt", "20MB")
+        assert arc.recency_target == 20000000
+        check_files(fs, "/dev/arc/", ["a.txt", "b.txt", "s1.txt", "s4.txt"], ["s2.txt", "s3.txt"])
+
+    host.add_actor("TestActor", test_actor)
+    e.run()
+
+def run_test_LFU_and_GDSF():
+    e, host, ods, fs, policy = setup_platform()
+    lfu = LFUEvictionPolicy()
+    fs.mount_partition("/dev/lfu/", ods, "100MB", lfu)
+    fs.mount_partition("/dev/gdsf/", ods, "100MB", GDSFEvictionPolicy())
+
+    def test_actor():
+        for partition in ["/dev/lfu/", "/dev/gdsf/"]:
+            this_actor.info(f"Create a 60MB file and two 10MB files on {partition}, and access the large file again")
+            fs.create_file(partition + "large.txt", "60MB")
+            fs.create_file(partition + "small1.txt", "10MB")
+            fs.create_file(partition + "small2.txt", "10MB")
+            access(fs, partition + "large.txt")
+            this_actor.info(f"Create a 30MB file on {partition}")
+            fs.create_file(partition + "new.txt", "30MB")
+        # LFU evicts a least frequently used file, GDSF the file with the fewest accesses per byte
+        check_files(fs, "/dev/lfu/", ["large.txt", "small2.txt", "new.txt"], ["small1.txt"])
+        assert lfu.age == 1
+        check_files(fs, "/dev/gdsf/", ["small1.txt", "small2.txt", "new.txt"], ["large.txt"])
+
+    host.add_actor("TestActor", test_actor)
+    e.run()
+
+def run_test_2Q_and_S3FIFO():
+    e, host, ods, fs, policy = setup_platform()
+    fs.mount_partition("/dev/2q/", ods, "100MB", TwoQEvictionPolicy())
+    fs.mount_partition("/dev/s3fifo/", ods, "100MB", S3FIFOEvictionPolicy())
+
+    def test_actor():
+        for partition in ["/dev/2q/", "/dev/s3fifo/"]:
+            this_actor.info(f"Create four 30MB files on {partition}, accessing the first one again")
+            fs.create_file(partition + "a.txt", "30MB")
+            access(fs, partition + "a.txt")
+            for name in ["b.txt", "c.txt", "d.txt"]:
+                fs.create_file(partition + name, "30MB")
+        # 2Q ignores the access and evicts the first file, S3-FIFO moves it to its main queue
+        check_files(fs, "/dev/2q/", ["b.txt", "c.txt", "d.txt"], ["a.txt"])
+        check_files(fs, "/dev/s3fifo/", ["a.txt", "c.txt", "d.txt"], ["b.txt"])
+        this_actor.info("Create the evicted files again, which their ghost queues send to the main queues")
+        fs.create_file("/dev/2q/a.txt", "30MB")
+        fs.create_file("/dev/s3fifo/b.txt", "30MB")
+        check_files(fs, "/dev/2q/", ["a.txt", "c.txt", "d.txt"], ["b.txt"])
+        check_files(fs, "/dev/s3fifo/", ["a.txt", "b.txt", "d.txt"], ["c.txt"])
+
+    host.add_actor("TestActor", test_actor)
+    e.run()
+
+def run_test_watermarks_bad_arguments():
+    e, host, ods, fs, policy = setup_platform()
+    fs.mount_partition("/dev/none/", ods, "100MB")
+    partition = fs.partition_by_name("/dev/a")
+    for bad_call in [lambda: partition.set_eviction_watermarks(0.5, 0.8),
+                     lambda: partition.set_eviction_watermarks(1.1, 0.5),
+                     lambda: partition.set_eviction_watermarks(0.8, -0.1),
+                     lambda: fs.partition_by_name("/dev/none").set_eviction_watermarks(0.8, 0.5)]:
+        try:
+            bad_call()
+            assert False, "Should have raised an exception"
+        except ValueError:
+            pass
+    partition.set_eviction_watermarks(0.8, 0.5)
+    assert partition.high_watermark == 0.8
+    assert partition.low_watermark == 0.5
+
+def run_test_background_eviction():
+    e, host, ods, fs, policy = setup_platform()
+    fs.mount_partition("/dev/lru/", ods, "100MB", LRUEvictionPolicy())
+    partition = fs.partition_by_name("/dev/lru")
+    partition.set_eviction_watermarks(0.8, 0.5)
+
+    def test_actor():
+        this_actor.info("Create three 20MB files and a 30MB file, which crosses the high watermark")
+        for name in ["a.txt", "b.txt", "c.txt"]:
+            fs.create_file("/dev/lru/" + name, "20MB")
+        fs.create_file("/dev/lru/d.txt", "30MB")
+        assert partition.free_space == 10000000
+        this_actor.sleep_for(1)
+        this_actor.info("The least recently used files were evicted down to the low watermark")
+        check_files(fs, "/dev/lru/", ["c.txt", "d.txt"], ["a.txt", "b.txt"])
+        assert partition.free_space == 50000000
+        assert partition.num_background_evictions == 2
+        assert partition.num_foreground_evictions == 0
+
+    host.add_actor("TestActor", test_actor)
+    e.run()
+
+if __name__ == "__main__":
+    tests = [
+        run_test_events,
+        run_test_eviction_follows_the_policy,
+        run_test_built_in_policies,
+        run_test_advanced_policies_bad_arguments,
+        run_test_ARC,
+        run_test_LFU_and_GDSF,
+        run_test_2Q_and_S3FIFO,
+        run_test_watermarks_bad_arguments,
+        run_test_background_eviction,
+    ]
+
+    for test in tests:
+        print(f"\n🔧 Running {test.__name__} ...")
+        p = multiprocessing.Process(target=test)
+        p.start()
+        p.join()
+        if p.exitcode != 0:
+            print(f"❌ {test.__name__} failed with exit code {p.exitcode}")
+        else:
+            print(f"✅ {test.__name__} passed")
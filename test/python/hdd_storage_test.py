@@ -0,0 +1,109 @@
+# Copyright (c) 2025-2026. The FSMod Team. All rights reserved.
+#
+# This program is free software you can redistribute it and/or modify it
+# under the terms of the license (GNU LGPL) which comes with this package.
+
+import math
+import sys
+import multiprocessing
+from simgrid import Engine, this_actor
+from fsmod import FileSystem, HDDStorage
+
+def setup_platform():
+    e = Engine(sys.argv)
+    e.set_log_control("no_loc")
+    e.set_log_control("root.thresh:critical")
+
+    # Creating a platform with one host and one 100MBps disk...
+    zone = e.netzone_root.add_netzone_full("zone")
+    host = zone.add_host("my_host", "100Gf")
+    disk = host.add_disk("disk", "100MBps", "100MBps")
+    zone.seal()
+
+    # Creating a 1TB HDD storage with the default 7200rpm and 1ms-15ms seek times
+    hdd = HDDStorage.create("my_hdd", disk, 1000000000000)
+    # Creating a file system
+    fs = FileSystem.create("my_fs")
+    # Mounting a 100GB partition
+    fs.mount_partition("/dev/a/", hdd, "100GB")
+    fs.create_file("/dev/a/foo.txt", "100MB")
+
+    return e, host, disk, hdd, fs
+
+def read_at(fs, offset, num_bytes):
+    file = fs.open("/dev/a/foo.txt", "r")
+    file.seek(offset)
+    file.read(num_bytes)
+    file.close()
+
+def run_test_bad_arguments():
+    e, host, disk, hdd, fs = setup_platform()
+    for bad_call in [lambda: HDDStorage.create("bad", disk, 0),
+                     lambda: hdd.set_rotation_speed(0),
+                     lambda: hdd.set_seek_times(0.01, 0.001),
+                     lambda: hdd.set_file_extent_size(0)]:
+        try:
+            bad_call()
+            assert False, "Should have raised an exception"
+        except ValueError:
+            pass
+    assert math.isclose(hdd.get_positioning_time(1000000000000), 0.015 + 30.0 / 7200, abs_tol=1e-9)
+
+def run_test_random_small_reads():
+    e, host, disk, hdd, fs = setup_platform()
+
+    def reader():
+        this_actor.info("Read 4kB at offsets 0, 50MB, and 10MB, which moves the head twice")
+        read_at(fs, 0, "4kB")
+        read_at(fs, 50000000, "4kB")
+        read_at(fs, 10000000, "4kB")
+        expected = 3 * 0.00004 + hdd.get_positioning_time(50000000 - 4000) + hdd.get_positioning_time(40004000)
+        assert math.isclose(Engine.clock, expected, abs_tol=1e-6)
+        assert hdd.num_seeks == 2
+
+    host.add_actor("Reader", reader)
+    e.run()
+
+def run_test_elevator_order():
+    e, host, disk, hdd, fs = setup_platform()
+    hdd.set_request_reordering(True)
+    finish_dates = {}
+
+    def first_reader():
+        read_at(fs, 0, "10MB")
+
+    def make_reader(i, offset):
+        def reader():
+            this_actor.sleep_until(0.01 * (i + 1))
+            read_at(fs, offset, "4kB")
+            finish_dates[offset] = Engine.clock
+        return reader
+
+    # Read 10MB at time 0, during which reads of 4kB at offsets 90MB, 20MB, and 50MB are queued
+    host.add_actor("FirstReader", first_reader)
+    for i, offset in enumerate([90000000, 20000000, 50000000]):
+        host.add_actor(f"Reader_{i}", make_reader(i, offset))
+    e.run()
+
+    # The head sweeps forward: 20MB, 50MB, then 90MB
+    assert finish_dates[20000000] < finish_dates[50000000] < finish_dates[90000000]
+    expected = (hdd.get_positioning_time(10000000) + hdd.get_positioning_time(29996000) +
+                hdd.get_positioning_time(39996000))
+    assert math.isclose(hdd.total_positioning_time, expected, abs_tol=1e-9)
+
+if __name__ == "__main__":
+    tests = [
+        run_test_bad_arguments,
+        run_test_random_small_reads,
+        run_test_elevator_order,
+    ]
+
+    for test in tests:
+        print(f"\n🔧 Running {test.__name__} ...")
+        p = multiprocessing.Process(target=test)
+        p.start()
+        p.join()
+        if p.exitcode != 0:
+            print(f"❌ {test.__name__} failed with exit code {p.exitcode}")
+        else:
+            print(f"✅ {test.__name__} passed")
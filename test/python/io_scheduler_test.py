@@ -0,0 +1,91 @@
+# Copyright (c) 2025-2026. The FSMod Team. All rights reserved.
+#
+# This program is free software you can redistribute it and/or modify it
+# under the terms of the license (GNU LGPL) which comes with this package.
+
+import math
+import sys
+import multiprocessing
+from simgrid import Engine, this_actor
+from fsmod import FileSystem, OneDiskStorage, FIFOIOScheduler, ShortestJobFirstIOScheduler
+
+def setup_platform():
+    e = Engine(sys.argv)
+    e.set_log_control("no_loc")
+    e.set_log_control("root.thresh:critical")
+
+    # Creating a platform with one host and one disk...
+    zone = e.netzone_root.add_netzone_full("zone")
+    host = zone.add_host("my_host", "100Gf")
+    disk = host.add_disk("disk", "2MBps", "1MBps")
+    zone.seal()
+
+    # Creating a one-disk storage on the host's disk..."
+    ods = OneDiskStorage.create("my_storage", disk)
+    # Creating a file system
+    fs = FileSystem.create("my_fs")
+    # Mounting a 100MB partition
+    fs.mount_partition("/dev/a/", ods, "100MB")
+    fs.create_file("/dev/a/foo.txt", "10MB")
+
+    return e, host, ods, fs
+
+def read_4MB_2MB_1MB(fs, expected_completion_dates):
+    file = fs.open("/dev/a/foo.txt", "r")
+    this_actor.info("Asynchronously read 4MB, 2MB, then 1MB")
+    reads = [file.read_async(size) for size in ["4MB", "2MB", "1MB"]]
+    for read, expected_date in zip(reads, expected_completion_dates):
+        read.wait()
+        assert math.isclose(Engine.clock, expected_date)
+    file.close()
+
+def run_test_fifo():
+    e, host, ods, fs = setup_platform()
+    ods.start_controller(host, FIFOIOScheduler())
+    assert ods.max_concurrent_requests == 1
+
+    def test_actor():
+        this_actor.info("One request at a time, in arrival order: 2s, then 1s, then 0.5s")
+        read_4MB_2MB_1MB(fs, [2.0, 3.0, 3.5])
+
+    host.add_actor("TestActor", test_actor)
+    e.run()
+
+def run_test_concurrency_limit():
+    e, host, ods, fs = setup_platform()
+    ods.start_controller(host, FIFOIOScheduler(), 2)
+
+    def test_actor():
+        this_actor.info("The first two requests share the disk, the third one starts when the 2MB read completes")
+        read_4MB_2MB_1MB(fs, [3.5, 2.0, 3.0])
+
+    host.add_actor("TestActor", test_actor)
+    e.run()
+
+def run_test_shortest_job_first():
+    e, host, ods, fs = setup_platform()
+    ods.start_controller(host, ShortestJobFirstIOScheduler())
+
+    def test_actor():
+        this_actor.info("The 4MB read starts right away, then the 1MB read is dispatched before the 2MB one")
+        read_4MB_2MB_1MB(fs, [2.0, 3.5, 2.5])
+
+    host.add_actor("TestActor", test_actor)
+    e.run()
+
+if __name__ == "__main__":
+    tests = [
+        run_test_fifo,
+        run_test_concurrency_limit,
+        run_test_shortest_job_first,
+    ]
+
+    for test in tests:
+        print(f"\n🔧 Running {test.__name__} ...")
+        p = multiprocessing.Process(target=test)
+        p.start()
+        p.join()
+        if p.exitcode != 0:
+            print(f"❌ {test.__name__} failed with exit code {p.exitcode}")
+        else:
+            print(f"✅ {test.__name__} passed")
@@ -9,7 +9,7 @@ import os
 import sys
 import tempfile
 
-from simgrid import Engine, this_actor
+from simgrid import Engine, this_actor, ActivitySet, StorageFailureException
 from fsmod import JBODStorage, FileSystem, NotEnoughSpaceException
 
 def capture_cpp_stderr(func, *args, **kwargs):
@@ -321,6 +321,157 @@ def run_test_read_write_raid6():
     client.add_actor("TestActor", actor)
     e.run()
 
+def run_test_read_write_striped_raid5():
+    e, client, server, fs, jds = setup_platform()
+
+    def actor():
+        this_actor.info("Check that requests are not split into stripe units by default")
+        assert jds.stripe_unit_size == 0
+        this_actor.info("Set a 1MB stripe unit (i.e., 3MB of data per stripe)")
+        jds.set_stripe_unit_size(1_000_000)
+        assert jds.stripe_unit_size == 1_000_000
+        this_actor.info("Create a 10MB file at /dev/a/foo.txt")
+        fs.create_file("/dev/a/foo.txt", "10MB")
+        this_actor.info("Opened File '/dev/a/foo.txt' in write mode")
+        file = fs.open("/dev/a/foo.txt", "w")
+        this_actor.info("Write 6MB at '/dev/a/foo.txt', i.e., two full stripes")
+        assert file.write("6MB") == 6_000_000
+        this_actor.info("Write complete. Clock is at 2.06s (.05s to transfer, 0.01 to compute parity, 2s to write)")
+        assert math.isclose(Engine.clock, 2.06)
+        this_actor.info("Write 1MB at the beginning of /dev/a/foo.txt, which only covers a third of the first stripe")
+        file.seek(io.SEEK_SET)
+        assert file.write("1MB") == 1_000_000
+        this_actor.info("Write complete. Clock is at 3.565s (.5s to read old data and parity, 0.005 to compute parity, 1s to write)")
+        assert math.isclose(Engine.clock, 3.565)
+        this_actor.info("Close the file")
+        file.close()
+
+        this_actor.info("Opened File /dev/a/foo.txt in read mode")
+        file = fs.open("/dev/a/foo.txt", "r")
+        assert file.read("6MB") == 6_000_000
+        this_actor.info("Read complete. Clock is at 4.615s (1s to read 2MB on disks #0 and #1, .05s to transfer)")
+        assert math.isclose(Engine.clock, 4.615)
+        this_actor.info("Close the file")
+        file.close()
+
+    client.add_actor("TestActor", actor)
+    e.run()
+
+def run_test_read_write_erasure_coding():
+    e, client, server, fs, jds = setup_platform()
+
+    def actor():
+        this_actor.info("Use 2+2 erasure coding, which should behave as RAID6")
+        jds.set_erasure_coding(2, 2)
+        assert jds.raid_level == JBODStorage.RAID.ERASURE_CODING
+        assert jds.num_data_disks == 2
+        assert jds.num_parity_disks == 2
+        this_actor.info("Create a 10MB file at /dev/a/foo.txt")
+        fs.create_file("/dev/a/foo.txt", "10MB")
+        this_actor.info("Opened File '/dev/a/foo.txt' in write mode")
+        file = fs.open("/dev/a/foo.txt", "w")
+        this_actor.info("Write 6MB at '/dev/a/foo.txt'")
+        assert file.write("6MB") == 6_000_000
+        this_actor.info("Write complete. Clock is at 3.08s (.05s to transfer, 0.03 to encode 2 parity fragments, 3s to write)")
+        assert math.isclose(Engine.clock, 3.08)
+        this_actor.info("Close the file")
+        file.close()
+
+        this_actor.info("Opened File /dev/a/foo.txt in read mode")
+        file = fs.open("/dev/a/foo.txt", "r")
+        assert file.read("6MB") == 6_000_000
+        this_actor.info("Read complete. Clock is at 4.63s (1.5s to read the 2 data fragments, .05s to transfer)")
+        assert math.isclose(Engine.clock, 4.63)
+        this_actor.info("Close the file")
+        file.close()
+
+    client.add_actor("TestActor", actor)
+    e.run()
+
+def run_test_degraded_raid5():
+    e, client, server, fs, jds = setup_platform()
+
+    def actor():
+        assert jds.max_num_failed_disks == 1
+        this_actor.info("Create a 10MB file at /dev/a/foo.txt")
+        fs.create_file("/dev/a/foo.txt", "10MB")
+        file = fs.open("/dev/a/foo.txt", "w")
+        this_actor.info("Write 6MB at '/dev/a/foo.txt', with parity on disk #2")
+        assert file.write("6MB") == 6_000_000
+        assert math.isclose(Engine.clock, 2.06)
+        file.close()
+
+        this_actor.info("Disk #1, which holds the last third of the data, fails")
+        jds.disk_at(1).turn_off()
+        assert jds.num_failed_disks == 1
+        file = fs.open("/dev/a/foo.txt", "r")
+        assert file.read("6MB") == 6_000_000
+        this_actor.info("Read complete. Clock is at 3.12s (1s to read 2MB on disks #0, #2, and #3, "
+                        "0.01 to reconstruct the lost data, .05s to transfer)")
+        assert math.isclose(Engine.clock, 3.12)
+
+        this_actor.info("Disk #0 fails too, which RAID5 does not tolerate")
+        jds.disk_at(0).turn_off()
+        file.seek(0)
+        try:
+            file.read("6MB")
+            assert False, "Expected StorageFailureException was not raised"
+        except StorageFailureException:
+            pass
+        assert file.tell == 0
+        file.close()
+
+    client.add_actor("TestActor", actor)
+    e.run()
+
+def run_test_failed_writes_leave_files_unchanged():
+    e, client, server, fs, jds = setup_platform()
+
+    def actor():
+        this_actor.info("Create a 10MB file at /dev/a/foo.txt")
+        fs.create_file("/dev/a/foo.txt", "10MB")
+        free_space = fs.free_space_at_path("/dev/a/")
+        this_actor.info("Disks #0 and #1 fail, which RAID5 does not tolerate")
+        jds.disk_at(0).turn_off()
+        jds.disk_at(1).turn_off()
+        file = fs.open("/dev/a/foo.txt", "a")
+        try:
+            file.write("6MB")
+            assert False, "Expected StorageFailureException was not raised"
+        except StorageFailureException:
+            pass
+        this_actor.info("The failed write neither grew the file nor kept the space reserved for it")
+        assert fs.file_size("/dev/a/foo.txt") == 10_000_000
+        assert fs.free_space_at_path("/dev/a/") == free_space
+        file.close()
+
+    client.add_actor("TestActor", actor)
+    e.run()
+
+def run_test_load_aware_raid1_reads():
+    e, client, server, fs, jds = setup_platform()
+
+    def actor():
+        jds.set_raid_level(JBODStorage.RAID.RAID1)
+        assert jds.mirror_read_policy == JBODStorage.MirrorReadPolicy.ROUND_ROBIN
+        jds.set_mirror_read_policy(JBODStorage.MirrorReadPolicy.LEAST_OUTSTANDING_BYTES)
+        this_actor.info("Create a 20MB file at /dev/a/foo.txt")
+        fs.create_file("/dev/a/foo.txt", "20MB")
+        file = fs.open("/dev/a/foo.txt", "r")
+        this_actor.info("Asynchronously read 6MB (on disk #0), then 4 times 2MB (on disks #1, #2, #3, and #1)")
+        pending_reads = ActivitySet()
+        pending_reads.push(file.read_async("6MB"))
+        for _ in range(4):
+            pending_reads.push(file.read_async("2MB"))
+        assert jds.get_outstanding_bytes(1) == 4_000_000
+        pending_reads.wait_all()
+        this_actor.info("Reads complete. Clock is at 3.05s (3s to read 6MB on disk #0, .05s to transfer)")
+        assert math.isclose(Engine.clock, 3.05)
+        file.close()
+
+    client.add_actor("TestActor", actor)
+    e.run()
+
 if __name__ == "__main__":
     import multiprocessing
 
@@ -334,6 +485,11 @@ if __name__ == "__main__":
         run_test_read_write_raid1,
         run_test_read_write_raid4,
         run_test_read_write_raid6,
+        run_test_read_write_striped_raid5,
+        run_test_read_write_erasure_coding,
+        run_test_degraded_raid5,
+        run_test_failed_writes_leave_files_unchanged,
+        run_test_load_aware_raid1_reads,
     ]
 
     for test in tests:
@@ -0,0 +1,90 @@
+# Copyright (c) 2025-2026. The FSMod Team. All rights reserved.
+#
+# This program is free software you can redistribute it and/or modify it
+# under the terms of the license (GNU LGPL) which comes with this package.
+
+import math
+import sys
+import multiprocessing
+from simgrid import Engine, this_actor
+from fsmod import FileSystem, OneDiskStorage, MetadataService
+
+def setup_platform(max_concurrent_operations):
+    e = Engine(sys.argv)
+    e.set_log_control("no_loc")
+    e.set_log_control("root.thresh:critical")
+
+    # Creating a platform with one client host with one disk, and a metadata server host...
+    zone = e.netzone_root.add_netzone_full("zone")
+    client = zone.add_host("client", "100Gf")
+    server = zone.add_host("server", "100Gf")
+    disk = client.add_disk("disk", "1MBps", "1MBps")
+    link = zone.add_link("link", 1e9)
+    zone.add_route(client, server, [link])
+    zone.seal()
+
+    # Creating a file system with a 100MB partition on a one-disk storage
+    ods = OneDiskStorage.create("my_storage", disk)
+    fs = FileSystem.create("my_fs")
+    fs.mount_partition("/dev/a/", ods, "100MB")
+    # Creating a metadata service on the server host
+    mds = MetadataService.create(server, max_concurrent_operations)
+    fs.set_metadata_service(mds)
+
+    return e, client, mds, fs
+
+def run_test_operation_latencies():
+    e, client, mds, fs = setup_platform(1)
+    mds.set_latency(0.01)
+    mds.set_latency(MetadataService.Operation.CREATE, 0.1)
+    mds.set_latency(MetadataService.Operation.OPEN, 0.05)
+
+    def test_actor():
+        this_actor.info("Create a file, which takes 0.1s")
+        fs.create_file("/dev/a/dir/foo.txt", "1kB")
+        assert math.isclose(Engine.clock, 0.1)
+        this_actor.info("Open it, which takes 0.05s")
+        file = fs.open("/dev/a/dir/foo.txt", "r")
+        file.close()
+        assert math.isclose(Engine.clock, 0.15)
+        this_actor.info("List, move, and unlink files, which take 0.01s each")
+        assert len(fs.list_files_in_directory("/dev/a/dir")) == 1
+        fs.move_file("/dev/a/dir/foo.txt", "/dev/a/dir/bar.txt")
+        fs.unlink_file("/dev/a/dir/bar.txt")
+        assert math.isclose(Engine.clock, 0.18)
+        assert mds.get_num_operations(MetadataService.Operation.CREATE) == 1
+        assert mds.get_num_operations() == 5
+
+    client.add_actor("TestActor", test_actor)
+    e.run()
+
+def run_test_concurrency_cap():
+    e, client, mds, fs = setup_platform(2)
+    mds.set_latency(1.0)
+
+    def creator(i):
+        fs.create_file(f"/dev/a/file_{i}", "1kB")
+        assert math.isclose(Engine.clock, 1.0 if i < 2 else 2.0)
+
+    # Four actors create a file each at the same time, on a server that serves two operations at a time
+    for i in range(4):
+        client.add_actor(f"Creator_{i}", creator, i)
+    e.run()
+    assert mds.get_num_operations() == 4
+    assert math.isclose(mds.total_waiting_time, 2.0)
+
+if __name__ == "__main__":
+    tests = [
+        run_test_operation_latencies,
+        run_test_concurrency_cap,
+    ]
+
+    for test in tests:
+        print(f"\n🔧 Running {test.__name__} ...")
+        p = multiprocessing.Process(target=test)
+        p.start()
+        p.join()
+        if p.exitcode != 0:
+            print(f"❌ {test.__name__} failed with exit code {p.exitcode}")
+        else:
+            print(f"✅ {test.__name__} passed")
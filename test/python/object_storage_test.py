@@ -0,0 +1,104 @@
+# Copyright (c) 2025-2026. The FSMod Team. All rights reserved.
+#
+# This program is free software you can redistribute it and/or modify it
+# under the terms of the license (GNU LGPL) which comes with this package.
+
+import math
+import sys
+import multiprocessing
+from simgrid import Engine, this_actor
+from fsmod import FileSystem, ObjectStorage
+
+def setup_platform(max_request_size=5368709120):
+    e = Engine(sys.argv)
+    e.set_log_control("no_loc")
+    e.set_log_control("root.thresh:critical")
+
+    # Creating a platform with one client host and one server host with one disk...
+    zone = e.netzone_root.add_netzone_full("zone")
+    client = zone.add_host("client", "100Gf")
+    server = zone.add_host("server", "100Gf")
+    disk = server.add_disk("disk", "10MBps", "10MBps")
+    link = zone.add_link("link", 1e9)
+    zone.add_route(client, server, [link])
+    zone.seal()
+
+    # Creating an object storage on the server's disk, with a 100ms request latency
+    os = ObjectStorage.create("s3", disk, 0.1, max_request_size)
+    # Creating a file system
+    fs = FileSystem.create("my_fs")
+    # Mounting a 100MB partition
+    fs.mount_partition("/dev/s3/", os, "100MB")
+
+    return e, client, disk, os, fs
+
+def run_test_bad_arguments():
+    e, client, disk, os, fs = setup_platform(2000000)
+    # Parts and ranges cannot be larger than the maximum request size
+    assert os.part_size == 2000000
+    assert os.range_size == 2000000
+    for bad_call in [lambda: ObjectStorage.create("bad", disk, -1),
+                     lambda: ObjectStorage.create("bad", disk, 0.1, 0),
+                     lambda: os.set_multipart_upload(3000000, 1),
+                     lambda: os.set_multipart_upload(1000000, 0),
+                     lambda: os.set_ranged_get(3000000, 1),
+                     lambda: os.set_ranged_get(1000000, 0)]:
+        try:
+            bad_call()
+            assert False, "Should have raised an exception"
+        except ValueError:
+            pass
+
+def run_test_multipart_upload():
+    e, client, disk, os, fs = setup_platform()
+    os.set_multipart_upload(1000000, 2)
+
+    def writer():
+        this_actor.info("Write 4MB in 1MB parts over 2 connections")
+        file = fs.open("/dev/s3/foo.txt", "w")
+        file.write("4MB")
+        file.close()
+        assert math.isclose(Engine.clock, 0.8, abs_tol=1e-6)
+        assert os.num_multipart_uploads == 1
+        assert os.num_put_requests == 6
+
+    client.add_actor("Writer", writer)
+    e.run()
+
+def run_test_ranged_gets():
+    e, client, disk, os, fs = setup_platform()
+    os.set_ranged_get(1000000, 4)
+    fs.create_file("/dev/s3/foo.txt", "4MB")
+
+    def reader():
+        this_actor.info("Read 4MB in four 1MB ranges over 4 connections")
+        file = fs.open("/dev/s3/foo.txt", "r")
+        file.read_async("4MB").wait()
+        assert math.isclose(Engine.clock, 0.5, abs_tol=1e-6)
+        assert os.num_get_requests == 4
+        this_actor.info("Read it again over a single connection")
+        os.set_ranged_get(1000000, 1)
+        file.seek(0)
+        file.read("4MB")
+        assert math.isclose(Engine.clock, 1.3, abs_tol=1e-6)
+        file.close()
+
+    client.add_actor("Reader", reader)
+    e.run()
+
+if __name__ == "__main__":
+    tests = [
+        run_test_bad_arguments,
+        run_test_multipart_upload,
+        run_test_ranged_gets,
+    ]
+
+    for test in tests:
+        print(f"\n🔧 Running {test.__name__} ...")
+        p = multiprocessing.Process(target=test)
+        p.start()
+        p.join()
+        if p.exitcode != 0:
+            print(f"❌ {test.__name__} failed with exit code {p.exitcode}")
+        else:
+            print(f"✅ {test.__name__} passed")
@@ -0,0 +1,101 @@
+# Copyright (c) 2025-2026. The FSMod Team. All rights reserved.
+#
+# This program is free software you can redistribute it and/or modify it
+# under the terms of the license (GNU LGPL) which comes with this package.
+
+import math
+import sys
+import multiprocessing
+from simgrid import Engine, this_actor
+from fsmod import FileSystem, OneDiskStorage, QoSPolicy
+
+def setup_platform():
+    e = Engine(sys.argv)
+    e.set_log_control("no_loc")
+    e.set_log_control("root.thresh:critical")
+
+    # Creating a platform with one host and one 100MBps disk...
+    zone = e.netzone_root.add_netzone_full("zone")
+    host = zone.add_host("my_host", "100Gf")
+    disk = host.add_disk("disk", "100MBps", "100MBps")
+    zone.seal()
+
+    # Creating a file system with a 100MB partition
+    fs = FileSystem.create("my_fs")
+    fs.mount_partition("/dev/a/", OneDiskStorage.create("my_storage", disk), "100MB")
+    fs.create_file("/dev/a/foo.txt", "10MB")
+    fs.create_file("/dev/a/bar.txt", "10MB")
+
+    return e, host, fs
+
+def run_test_bandwidth_limit():
+    e, host, fs = setup_platform()
+    # Cap the bandwidth of the file system at 1MBps, with 1MB bursts
+    policy = QoSPolicy.create()
+    policy.set_bandwidth_limit(1e6, 1000000)
+    fs.set_qos_policy(policy)
+
+    def reader():
+        file = fs.open("/dev/a/foo.txt", "r")
+        this_actor.info("Read 1MB, which the burst lets through at disk speed")
+        file.read("1MB")
+        assert math.isclose(Engine.clock, 0.01, abs_tol=1e-6)
+        this_actor.info("Read 1MB more, which waits until the bucket has refilled")
+        file.read("1MB")
+        assert math.isclose(Engine.clock, 1.01, abs_tol=1e-6)
+        assert policy.num_throttled_requests == 1
+        file.close()
+
+    host.add_actor("Reader", reader)
+    e.run()
+
+def run_test_tagged_asynchronous_reads():
+    e, host, fs = setup_platform()
+    # Cap the bandwidth of the files tagged 'job' at 1MBps, with 1MB bursts
+    policy = QoSPolicy.create()
+    policy.set_bandwidth_limit(1e6, 1000000)
+    fs.set_tag_qos_policy("job", policy)
+
+    def reader():
+        file = fs.open("/dev/a/foo.txt", "r")
+        file.set_qos_tag("job")
+        this_actor.info("Asynchronously read 2MB from a tagged file, which starts once 1MB of debt has been paid back")
+        file.read_async("2MB").wait()
+        assert math.isclose(Engine.clock, 1.02, abs_tol=1e-6)
+        file.close()
+
+    host.add_actor("Reader", reader)
+    e.run()
+
+def run_test_priority_classes():
+    e, host, fs = setup_platform()
+
+    def reader(path, expected_date):
+        file = fs.open(path, "r")
+        file.read("10MB")
+        assert math.isclose(Engine.clock, expected_date, abs_tol=1e-3)
+        file.close()
+
+    high_priority_actor = host.add_actor("HighPriorityReader", lambda: reader("/dev/a/foo.txt", 0.15))
+    host.add_actor("NormalPriorityReader", lambda: reader("/dev/a/bar.txt", 0.2))
+    policy = QoSPolicy.create()
+    policy.set_priority_class(QoSPolicy.PriorityClass.HIGH)
+    fs.set_actor_qos_policy(high_priority_actor, policy)
+    e.run()
+
+if __name__ == "__main__":
+    tests = [
+        run_test_bandwidth_limit,
+        run_test_tagged_asynchronous_reads,
+        run_test_priority_classes,
+    ]
+
+    for test in tests:
+        print(f"\n🔧 Running {test.__name__} ...")
+        p = multiprocessing.Process(target=test)
+        p.start()
+        p.join()
+        if p.exitcode != 0:
+            print(f"❌ {test.__name__} failed with exit code {p.exitcode}")
+        else:
+            print(f"✅ {test.__name__} passed")
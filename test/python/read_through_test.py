@@ -0,0 +1,106 @@
+# Copyright (c) 2025-2026. The FSMod Team. All rights reserved.
+#
+# This program is free software you can redistribute it and/or modify it
+# under the terms of the license (GNU LGPL) which comes with this package.
+
+import math
+import sys
+import multiprocessing
+from simgrid import Engine, this_actor
+from fsmod import FileSystem, OneDiskStorage, LRUEvictionPolicy, FileNotFoundException
+
+def setup_platform():
+    e = Engine(sys.argv)
+    e.set_log_control("no_loc")
+    e.set_log_control("root.thresh:critical")
+
+    # Creating a platform with one host, a 100MBps cache disk, and a 10MBps origin disk...
+    zone = e.netzone_root.add_netzone_full("zone")
+    host = zone.add_host("my_host", "100Gf")
+    cache_disk = host.add_disk("cache_disk", "100MBps", "100MBps")
+    origin_disk = host.add_disk("origin_disk", "10MBps", "10MBps")
+    zone.seal()
+
+    # Creating an origin file system that holds 20MB and 50MB files
+    origin_fs = FileSystem.create("origin_fs")
+    origin_fs.mount_partition("/pfs/", OneDiskStorage.create("origin_storage", origin_disk), "1TB")
+    origin_fs.create_file("/pfs/data/a.txt", "20MB")
+    origin_fs.create_file("/pfs/data/b.txt", "50MB")
+    # Creating a file system with a 100MB LRU partition that reads through to the origin
+    cache_fs = FileSystem.create("cache_fs")
+    cache_fs.mount_partition("/cache/", OneDiskStorage.create("cache_storage", cache_disk), "100MB",
+                             LRUEvictionPolicy())
+    cache_fs.partition_by_name("/cache").set_read_through(origin_fs, "/pfs/data/")
+
+    return e, host, cache_fs, origin_fs
+
+def run_test_bad_arguments():
+    e, host, cache_fs, origin_fs = setup_platform()
+    cache = cache_fs.partition_by_name("/cache")
+    for bad_call in [lambda: cache.set_read_through(origin_fs, "/nowhere/"),
+                     lambda: cache.set_read_through(cache_fs, "/cache/data/")]:
+        try:
+            bad_call()
+            assert False, "Should have raised an exception"
+        except ValueError:
+            pass
+    assert cache.origin_path == "/pfs/data"
+
+def run_test_misses_and_hits():
+    e, host, cache_fs, origin_fs = setup_platform()
+    cache = cache_fs.partition_by_name("/cache")
+
+    def test_actor():
+        this_actor.info("Open a missing file, which reads it from the origin and writes it to the cache")
+        file = cache_fs.open("/cache/a.txt", "r")
+        assert math.isclose(Engine.clock, 2.2)
+        file.close()
+        assert cache.num_cache_misses == 1
+        assert cache.num_fetched_bytes == 20000000
+        this_actor.info("Open the file again, which is a hit")
+        cache_fs.open("/cache/a.txt", "r").close()
+        assert math.isclose(Engine.clock, 2.2)
+        assert cache.num_cache_hits == 1
+        this_actor.info("Open a file that the origin does not hold, which fetches nothing")
+        try:
+            cache_fs.open("/cache/c.txt", "r")
+            assert False, "Should have raised an exception"
+        except FileNotFoundException:
+            pass
+        assert cache.num_fetches == 1
+
+    host.add_actor("TestActor", test_actor)
+    e.run()
+
+def run_test_concurrent_misses_coalesce():
+    e, host, cache_fs, origin_fs = setup_platform()
+
+    def reader():
+        file = cache_fs.open("/cache/b.txt", "r")
+        assert math.isclose(Engine.clock, 5.5)
+        file.close()
+
+    # Four actors open the same missing file at the same time
+    for i in range(4):
+        host.add_actor(f"Reader_{i}", reader)
+    e.run()
+    cache = cache_fs.partition_by_name("/cache")
+    assert cache.num_cache_misses == 4
+    assert cache.num_fetches == 1
+
+if __name__ == "__main__":
+    tests = [
+        run_test_bad_arguments,
+        run_test_misses_and_hits,
+        run_test_concurrent_misses_coalesce,
+    ]
+
+    for test in tests:
+        print(f"\n🔧 Running {test.__name__} ...")
+        p = multiprocessing.Process(target=test)
+        p.start()
+        p.join()
+        if p.exitcode != 0:
+            print(f"❌ {test.__name__} failed with exit code {p.exitcode}")
+        else:
+            print(f"✅ {test.__name__} passed")
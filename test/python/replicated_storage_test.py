@@ -0,0 +1,101 @@
+# Copyright (c) 2025-2026. The FSMod Team. All rights reserved.
+#
+# This program is free software you can redistribute it and/or modify it
+# under the terms of the license (GNU LGPL) which comes with this package.
+
+import math
+import sys
+import multiprocessing
+from simgrid import Engine, this_actor
+from fsmod import FileSystem, ReplicatedStorage
+
+def setup_platform(client_bandwidth, first_data_node_bandwidth, replication_factor, replication_mode):
+    e = Engine(sys.argv)
+    e.set_log_control("no_loc")
+    e.set_log_control("root.thresh:critical")
+
+    # Creating a platform with one client host and three data node hosts with one disk each...
+    zone = e.netzone_root.add_netzone_full("zone")
+    client = zone.add_host("client", "100Gf")
+    hosts = [client]
+    nics = [zone.add_link("client_nic", client_bandwidth)]
+    data_nodes = []
+    disks = []
+    for i in range(3):
+        data_node = zone.add_host(f"data_node_{i}", "100Gf")
+        disks.append(data_node.add_disk("disk", "10MBps", "10MBps"))
+        data_nodes.append(data_node)
+        hosts.append(data_node)
+        nics.append(zone.add_link(f"data_node_{i}_nic", first_data_node_bandwidth if i == 0 else 1e9))
+    # Each route goes through the network interfaces of both of its ends
+    for i in range(len(hosts)):
+        for j in range(i + 1, len(hosts)):
+            zone.add_route(hosts[i], hosts[j], [nics[i], nics[j]])
+    zone.seal()
+
+    # Creating a replicated storage over the three disks
+    rs = ReplicatedStorage.create("hdfs", disks, replication_factor, replication_mode)
+    # Creating a file system
+    fs = FileSystem.create("my_fs")
+    # Mounting a 100MB partition
+    fs.mount_partition("/dev/hdfs/", rs, "100MB")
+
+    return e, client, data_nodes, rs, fs
+
+def run_test_nearest_replica_reads():
+    e, client, data_nodes, rs, fs = setup_platform(1e9, 1e5, 2, ReplicatedStorage.ReplicationMode.PIPELINE)
+    fs.create_file("/dev/hdfs/foo.txt", "1MB")
+
+    def remote_reader():
+        this_actor.info("Read a file whose replicas are on the first two data nodes, which reads it from the second one")
+        file = fs.open("/dev/hdfs/foo.txt", "r")
+        assert file.read("1MB") == 1000000
+        file.close()
+        assert math.isclose(Engine.clock, 0.1, rel_tol=0.1)
+        assert rs.get_disk_num_bytes_read(0) == 0
+        assert rs.get_disk_num_bytes_read(1) == 1000000
+
+    def local_reader():
+        this_actor.sleep_until(1)
+        this_actor.info("Read the same file from the first data node, which reads its local replica")
+        file = fs.open("/dev/hdfs/foo.txt", "r")
+        assert file.read("1MB") == 1000000
+        file.close()
+        assert math.isclose(Engine.clock, 1.1)
+        assert rs.get_disk_num_bytes_read(0) == 1000000
+
+    client.add_actor("RemoteReader", remote_reader)
+    data_nodes[0].add_actor("LocalReader", local_reader)
+    e.run()
+
+def run_test_write_amplification():
+    e, client, data_nodes, rs, fs = setup_platform(1e6, 1e9, 3, ReplicatedStorage.ReplicationMode.FAN_OUT)
+
+    def writer():
+        this_actor.info("Write 1MB to three replicas by fan-out, through a 1MBps client link")
+        file = fs.open("/dev/hdfs/foo.txt", "w")
+        file.write("1MB")
+        file.close()
+        assert rs.num_bytes_written == 1000000
+        assert rs.num_replica_bytes_written == 3000000
+        assert math.isclose(rs.write_amplification, 3.0)
+        assert Engine.clock > 2.5
+
+    client.add_actor("Writer", writer)
+    e.run()
+
+if __name__ == "__main__":
+    tests = [
+        run_test_nearest_replica_reads,
+        run_test_write_amplification,
+    ]
+
+    for test in tests:
+        print(f"\n🔧 Running {test.__name__} ...")
+        p = multiprocessing.Process(target=test)
+        p.start()
+        p.join()
+        if p.exitcode != 0:
+            print(f"❌ {test.__name__} failed with exit code {p.exitcode}")
+        else:
+            print(f"✅ {test.__name__} passed")
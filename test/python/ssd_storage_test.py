@@ -0,0 +1,117 @@
+# Copyright (c) 2025-2026. The FSMod Team. All rights reserved.
+#
+# This program is free software you can redistribute it and/or modify it
+# under the terms of the license (GNU LGPL) which comes with this package.
+
+import math
+import sys
+import multiprocessing
+from simgrid import Engine, this_actor
+from fsmod import FileSystem, SSDStorage
+
+def setup_platform():
+    e = Engine(sys.argv)
+    e.set_log_control("no_loc")
+    e.set_log_control("root.thresh:critical")
+
+    # Creating a platform with one host and one 100MBps disk...
+    zone = e.netzone_root.add_netzone_full("zone")
+    host = zone.add_host("my_host", "100Gf")
+    disk = host.add_disk("disk", "100MBps", "100MBps")
+    zone.seal()
+
+    # Creating an SSD storage that serves 1000 IOPS with a 100us operation latency
+    ssd = SSDStorage.create("my_ssd", disk, 1000, 1e-4)
+    # Creating a file system
+    fs = FileSystem.create("my_fs")
+    # Mounting a 100MB partition
+    fs.mount_partition("/dev/a/", ssd, "100MB")
+
+    return e, host, disk, ssd, fs
+
+def run_test_bad_arguments():
+    e, host, disk, ssd, fs = setup_platform()
+    for bad_call in [lambda: SSDStorage.create("bad", disk, 0),
+                     lambda: SSDStorage.create("bad", disk, 1000, -1),
+                     lambda: ssd.set_over_provisioning(1),
+                     lambda: ssd.set_garbage_collection(1.5, 1000000, 0.5),
+                     lambda: ssd.set_garbage_collection(0.2, 0, 0.5)]:
+        try:
+            bad_call()
+            assert False, "Should have raised an exception"
+        except ValueError:
+            pass
+    assert ssd.write_amplification == 1.0
+
+def run_test_small_reads_are_iops_bound():
+    e, host, disk, ssd, fs = setup_platform()
+    fs.create_file("/dev/a/foo.txt", "20MB")
+
+    def reader():
+        this_actor.info("Read 4kB, which takes the latency plus one IOPS slot")
+        file = fs.open("/dev/a/foo.txt", "r")
+        file.read("4kB")
+        assert math.isclose(Engine.clock, 1e-4 + 0.00104, abs_tol=1e-6)
+        this_actor.info("Read 10MB, which is bandwidth bound")
+        date = Engine.clock
+        file.read("10MB")
+        assert math.isclose(Engine.clock - date, 1e-4 + 0.101, abs_tol=1e-6)
+        file.close()
+
+    host.add_actor("Reader", reader)
+    e.run()
+
+def run_test_write_amplification():
+    e, host, disk, ssd, fs = setup_platform()
+    fs.create_file("/dev/a/foo.txt", "90MB")
+
+    def writer():
+        this_actor.info("Write 1MB, which fills the partition to 91% and is amplified 3.625 times")
+        file = fs.open("/dev/a/bar.txt", "w")
+        file.write("1MB")
+        assert math.isclose(Engine.clock, 1e-4 + (3625000 + 100000) / 1e8, abs_tol=1e-6)
+        assert ssd.num_bytes_written == 1000000
+        assert ssd.num_physical_bytes_written == 3625000
+        file.close()
+
+    host.add_actor("Writer", writer)
+    e.run()
+
+def run_test_garbage_collection_stalls():
+    e, host, disk, ssd, fs = setup_platform()
+    ssd.set_garbage_collection(0.2, 1000000, 0.5)
+    fs.create_file("/dev/a/foo.txt", "70MB")
+
+    def writer():
+        this_actor.info("Write 16MB, which leaves 14% of the partition free and triggers a stall")
+        file = fs.open("/dev/a/bar.txt", "w")
+        file.write("16MB")
+        file.close()
+        assert ssd.num_gc_stalls == 1
+        this_actor.info("Read 4kB, which waits for the end of the stall")
+        date = Engine.clock
+        file = fs.open("/dev/a/foo.txt", "r")
+        file.read("4kB")
+        assert math.isclose(Engine.clock - date, 0.5 + 1e-4 + 0.00104, abs_tol=1e-6)
+        file.close()
+
+    host.add_actor("Writer", writer)
+    e.run()
+
+if __name__ == "__main__":
+    tests = [
+        run_test_bad_arguments,
+        run_test_small_reads_are_iops_bound,
+        run_test_write_amplification,
+        run_test_garbage_collection_stalls,
+    ]
+
+    for test in tests:
+        print(f"\n🔧 Running {test.__name__} ...")
+        p = multiprocessing.Process(target=test)
+        p.start()
+        p.join()
+        if p.exitcode != 0:
+            print(f"❌ {test.__name__} failed with exit code {p.exitcode}")
+        else:
+            print(f"✅ {test.__name__} passed")
@@ -0,0 +1,87 @@
+# Copyright (c) 2025-2026. The FSMod Team. All rights reserved.
+#
+# This program is free software you can redistribute it and/or modify it
+# under the terms of the license (GNU LGPL) which comes with this package.
+
+import math
+import sys
+import multiprocessing
+from simgrid import Engine, this_actor
+from fsmod import FileSystem, OneRemoteDiskStorage, StripedStorage
+
+def setup_platform():
+    e = Engine(sys.argv)
+    e.set_log_control("no_loc")
+    e.set_log_control("root.thresh:critical")
+
+    # Creating a platform with one client host and four server hosts with one disk each...
+    zone = e.netzone_root.add_netzone_full("zone")
+    client = zone.add_host("client", "100Gf")
+    osts = []
+    for i in range(4):
+        server = zone.add_host(f"server_{i}", "100Gf")
+        disk = server.add_disk("disk", "1MBps", "1MBps")
+        link = zone.add_link(f"link_{i}", 1e9)
+        zone.add_route(client, server, [link])
+        osts.append(OneRemoteDiskStorage.create(f"ost_{i}", disk))
+    zone.seal()
+
+    # Creating a striped storage over the four remote storages, with 1MB stripes on one target by default
+    ss = StripedStorage.create("pfs", osts, 1, 1000000)
+    # Creating a file system
+    fs = FileSystem.create("my_fs")
+    # Mounting a 100MB partition
+    fs.mount_partition("/dev/pfs/", ss, "100MB")
+
+    return e, client, ss, fs
+
+def run_test_bad_arguments():
+    e, client, ss, fs = setup_platform()
+
+    try:
+        fs.create_file("/dev/pfs/foo.txt", "1MB", 5, "1MB")
+        raise AssertionError("Should have raised ValueError")
+    except ValueError:
+        pass
+    assert not fs.file_exists("/dev/pfs/foo.txt")
+    assert ss.num_targets == 4
+
+def run_test_stripe_count_scales_bandwidth():
+    e, client, ss, fs = setup_platform()
+
+    def test_actor():
+        this_actor.info("Create a 4MB file striped over the four targets, and a 4MB file with the default layout")
+        fs.create_file("/dev/pfs/wide.txt", "4MB", 4, "1MB")
+        fs.create_file("/dev/pfs/narrow.txt", "4MB")
+        this_actor.info("Read the file on one target, which takes 4s")
+        file = fs.open("/dev/pfs/narrow.txt", "r")
+        assert file.read("4MB") == 4000000
+        file.close()
+        assert math.isclose(Engine.clock, 4.0)
+        this_actor.info("Read the file on four targets, which takes 1s")
+        file = fs.open("/dev/pfs/wide.txt", "r")
+        assert file.read("4MB") == 4000000
+        file.close()
+        assert math.isclose(Engine.clock, 5.0)
+        assert ss.get_target_num_bytes(0) == 5000000
+        for i in range(1, 4):
+            assert ss.get_target_num_bytes(i) == 1000000
+
+    client.add_actor("TestActor", test_actor)
+    e.run()
+
+if __name__ == "__main__":
+    tests = [
+        run_test_bad_arguments,
+        run_test_stripe_count_scales_bandwidth,
+    ]
+
+    for test in tests:
+        print(f"\n🔧 Running {test.__name__} ...")
+        p = multiprocessing.Process(target=test)
+        p.start()
+        p.join()
+        if p.exitcode != 0:
+            print(f"❌ {test.__name__} failed with exit code {p.exitcode}")
+        else:
+            print(f"✅ {test.__name__} passed")
@@ -0,0 +1,87 @@
+# Copyright (c) 2025-2026. The FSMod Team. All rights reserved.
+#
+# This program is free software you can redistribute it and/or modify it
+# under the terms of the license (GNU LGPL) which comes with this package.
+
+import math
+import sys
+import multiprocessing
+from simgrid import Engine, this_actor
+from fsmod import FileSystem, OneDiskStorage, PartitionTiered
+
+def setup_platform():
+    e = Engine(sys.argv)
+    e.set_log_control("no_loc")
+    e.set_log_control("root.thresh:critical")
+
+    # Creating a platform with one host, one fast disk, and one slow disk...
+    zone = e.netzone_root.add_netzone_full("zone")
+    host = zone.add_host("my_host", "100Gf")
+    ssd = host.add_disk("ssd", "10MBps", "10MBps")
+    hdd = host.add_disk("hdd", "1MBps", "1MBps")
+    zone.seal()
+
+    # Creating a one-disk storage on each disk
+    fast_storage = OneDiskStorage.create("fast_storage", ssd)
+    capacity_storage = OneDiskStorage.create("capacity_storage", hdd)
+    # Creating a file system
+    fs = FileSystem.create("my_fs")
+    # Mounting a tiered partition with a 10MB fast tier and a 100MB capacity tier
+    partition = fs.mount_tiered_partition("/dev/tiered/", fast_storage, "10MB", capacity_storage, "100MB")
+
+    return e, host, fs, partition
+
+def run_test_placement():
+    e, host, fs, partition = setup_platform()
+
+    def test_actor():
+        this_actor.info("Create two 6MB files: the first one fits on the fast tier, the second one does not")
+        fs.create_file("/dev/tiered/a.txt", "6MB")
+        fs.create_file("/dev/tiered/b.txt", "6MB")
+        assert partition.get_file_tier("/dev/tiered/a.txt") == PartitionTiered.Tier.FAST
+        assert partition.get_file_tier("/dev/tiered/b.txt") == PartitionTiered.Tier.CAPACITY
+        assert partition.free_space == 98000000
+        this_actor.info("Read 1MB from each file, which takes 0.1s on the fast tier and 1s on the capacity tier")
+        file = fs.open("/dev/tiered/a.txt", "r")
+        file.read("1MB")
+        file.close()
+        assert math.isclose(Engine.clock, 0.1)
+        file = fs.open("/dev/tiered/b.txt", "r")
+        file.read("1MB")
+        file.close()
+        assert math.isclose(Engine.clock, 1.1)
+
+    host.add_actor("TestActor", test_actor)
+    e.run()
+
+def run_test_throttled_migration():
+    e, host, fs, partition = setup_platform()
+    fs.create_file("/dev/tiered/small.txt", "2MB")
+    partition.set_migration_rate(500000)
+
+    def test_actor():
+        this_actor.info("Demote the 2MB file at 500kB/s: 4 chunks that take 0.05s + 0.5s each, started every second")
+        partition.migrate_file("/dev/tiered/small.txt", PartitionTiered.Tier.CAPACITY)
+        assert math.isclose(Engine.clock, 3.55)
+        assert partition.get_file_tier("/dev/tiered/small.txt") == PartitionTiered.Tier.CAPACITY
+        assert partition.num_demotions == 1
+        assert partition.num_migrated_bytes == 2000000
+
+    host.add_actor("TestActor", test_actor)
+    e.run()
+
+if __name__ == "__main__":
+    tests = [
+        run_test_placement,
+        run_test_throttled_migration,
+    ]
+
+    for test in tests:
+        print(f"\n🔧 Running {test.__name__} ...")
+        p = multiprocessing.Process(target=test)
+        p.start()
+        p.join()
+        if p.exitcode != 0:
+            print(f"❌ {test.__name__} failed with exit code {p.exitcode}")
+        else:
+            print(f"✅ {test.__name__} passed")
@@ -3,16 +3,34 @@ import sys
 
 # List of script files to run
 scripts = [
+    "admission_policy_test.py",
+    "cached_storage_test.py",
     "caching_test.py",
+    "client_cache_test.py",
+    "compression_test.py",
+    "deduplication_test.py",
+    "directory_lock_test.py",
+    "eviction_policy_test.py",
     "file_system_test.py",
+    "hdd_storage_test.py",
+    "io_scheduler_test.py",
     "jbod_storage_test.py",
+    "metadata_service_test.py",
+    "object_storage_test.py",
     "one_disk_storage_test.py",
     "one_remote_disk_storage_test.py",
     "path_util_test.py",
+    "qos_policy_test.py",
+    "read_through_test.py",
     "register_test.py",
+    "replicated_storage_test.py",
     "seek_test.py",
+    "ssd_storage_test.py",
     "stat_test.py",
-    "truncate_test.py"
+    "striped_storage_test.py",
+    "tiered_partition_test.py",
+    "truncate_test.py",
+    "write_back_test.py"
     ]
                         
 def run_script(script):
@@ -0,0 +1,138 @@
+# Copyright (c) 2025-2026. The FSMod Team. All rights reserved.
+#
+# This program is free software you can redistribute it and/or modify it
+# under the terms of the license (GNU LGPL) which comes with this package.
+
+import math
+import sys
+import multiprocessing
+from simgrid import Engine, this_actor
+from fsmod import FileSystem, OneDiskStorage, LRUEvictionPolicy
+
+def setup_platform():
+    e = Engine(sys.argv)
+    e.set_log_control("no_loc")
+    e.set_log_control("root.thresh:critical")
+
+    # Creating a platform with one host, a 100MBps cache disk, and a 10MBps backing disk...
+    zone = e.netzone_root.add_netzone_full("zone")
+    host = zone.add_host("my_host", "100Gf")
+    cache_disk = host.add_disk("cache_disk", "100MBps", "100MBps")
+    backing_disk = host.add_disk("backing_disk", "10MBps", "10MBps")
+    zone.seal()
+
+    # Creating a file system with a 100MB LRU partition, backed by another file system
+    cache_fs = FileSystem.create("cache_fs")
+    cache_fs.mount_partition("/cache/", OneDiskStorage.create("cache_storage", cache_disk), "100MB",
+                             LRUEvictionPolicy())
+    backing_fs = FileSystem.create("backing_fs")
+    backing_fs.mount_partition("/pfs/", OneDiskStorage.create("backing_storage", backing_disk), "1TB")
+
+    return e, host, cache_fs, backing_fs
+
+def write_file(fs, path, num_bytes):
+    file = fs.open(path, "w")
+    file.write(num_bytes)
+    file.close()
+
+def run_test_bad_arguments():
+    e, host, cache_fs, backing_fs = setup_platform()
+    cache = cache_fs.partition_by_name("/cache")
+    for bad_call in [lambda: backing_fs.partition_by_name("/pfs").set_write_back(cache_fs, "/cache/"),
+                     lambda: cache.set_write_back(backing_fs, "/nowhere/"),
+                     lambda: cache.set_write_back(cache_fs, "/cache/out/")]:
+        try:
+            bad_call()
+            assert False, "Should have raised an exception"
+        except ValueError:
+            pass
+    cache.set_write_back(backing_fs, "/pfs/out/", True)
+    assert cache.backing_path == "/pfs/out"
+    assert cache.write_back_asynchronous
+
+def run_test_only_dirty_files_are_written_back():
+    e, host, cache_fs, backing_fs = setup_platform()
+    cache = cache_fs.partition_by_name("/cache")
+    cache.set_write_back(backing_fs, "/pfs/out/")
+
+    def test_actor():
+        this_actor.info("Create a clean 40MB file, and write a dirty 40MB file, in 0.4s")
+        cache_fs.create_file("/cache/clean.txt", "40MB")
+        write_file(cache_fs, "/cache/dirty.txt", "40MB")
+        this_actor.info("Create a 50MB file, which evicts the clean file right away")
+        cache_fs.create_file("/cache/foo.txt", "50MB")
+        assert math.isclose(Engine.clock, 0.4)
+        assert not backing_fs.file_exists("/pfs/out/clean.txt")
+        this_actor.info("Create a 40MB file, which evicts the dirty file once it is read and written back")
+        cache_fs.create_file("/cache/bar.txt", "40MB")
+        assert math.isclose(Engine.clock, 4.8)
+        assert not cache_fs.file_exists("/cache/dirty.txt")
+        assert backing_fs.file_size("/pfs/out/dirty.txt") == 40000000
+        assert cache.num_write_backs == 1
+        assert cache.num_written_back_bytes == 40000000
+
+    host.add_actor("TestActor", test_actor)
+    e.run()
+
+def run_write_back_scenario(asynchronous):
+    e, host, cache_fs, backing_fs = setup_platform()
+    cache_fs.partition_by_name("/cache").set_write_back(backing_fs, "/pfs/out/", asynchronous)
+    backing_fs.partition_by_name("/pfs").set_directory_lock_hold_time(1)
+
+    def test_actor():
+        this_actor.info("Write two dirty 30MB files in different directories, in 0.6s")
+        write_file(cache_fs, "/cache/a/foo.txt", "30MB")
+        write_file(cache_fs, "/cache/b/foo.txt", "30MB")
+        this_actor.info("Create an 80MB file, which evicts both files once they are written back")
+        cache_fs.create_file("/cache/bar.txt", "80MB")
+        assert math.isclose(Engine.clock, 0.6 + (7.6 if asynchronous else 8.6))
+        assert backing_fs.file_exists("/pfs/out/a/foo.txt")
+        assert backing_fs.file_exists("/pfs/out/b/foo.txt")
+
+    host.add_actor("TestActor", test_actor)
+    e.run()
+
+def run_test_blocking_write_back():
+    run_write_back_scenario(False)
+
+def run_test_asynchronous_write_back():
+    run_write_back_scenario(True)
+
+def run_test_background_write_back():
+    e, host, cache_fs, backing_fs = setup_platform()
+    cache = cache_fs.partition_by_name("/cache")
+    cache.set_write_back(backing_fs, "/pfs/out/")
+    cache.set_eviction_watermarks(0.8, 0.5)
+
+    def test_actor():
+        this_actor.info("Write a dirty 50MB file, and create a 40MB file, which starts the background eviction")
+        write_file(cache_fs, "/cache/dirty.txt", "50MB")
+        cache_fs.create_file("/cache/foo.txt", "40MB")
+        assert math.isclose(Engine.clock, 0.5)
+        this_actor.sleep_until(6.5)
+        assert not cache_fs.file_exists("/cache/dirty.txt")
+        assert backing_fs.file_exists("/pfs/out/dirty.txt")
+        assert cache.num_background_evictions == 1
+        assert cache.num_foreground_evictions == 0
+
+    host.add_actor("TestActor", test_actor)
+    e.run()
+
+if __name__ == "__main__":
+    tests = [
+        run_test_bad_arguments,
+        run_test_only_dirty_files_are_written_back,
+        run_test_blocking_write_back,
+        run_test_asynchronous_write_back,
+        run_test_background_write_back,
+    ]
+
+    for test in tests:
+        print(f"\n🔧 Running {test.__name__} ...")
+        p = multiprocessing.Process(target=test)
+        p.start()
+        p.join()
+        if p.exitcode != 0:
+            print(f"❌ {test.__name__} failed with exit code {p.exitcode}")
+        else:
+            print(f"✅ {test.__name__} passed")
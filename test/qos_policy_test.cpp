@@ -0,0 +1,182 @@
+/* Copyright (c) 2024-2026. The FSMOD Team. All rights reserved.          */
+
+/* This program is free software; you can redistribute it and/or modify it
+ * under the terms of the license (GNU LGPL) which comes with this package. */
+
+#include <gtest/gtest.h>
+#include <iostream>
+
+#include <simgrid/s4u/Actor.hpp>
+#include <simgrid/s4u/Engine.hpp>
+
+#include "fsmod/FileSystem.hpp"
+#include "fsmod/OneDiskStorage.hpp"
+#include "fsmod/QoSPolicy.hpp"
+#include "fsmod/FileSystemException.hpp"
+
+#include "./test_util.hpp"
+
+namespace sgfs=simgrid::fsmod;
+namespace sg4=simgrid::s4u;
+
+XBT_LOG_NEW_DEFAULT_CATEGORY(qos_policy_test, "QoS Policy Test");
+
+class QoSPolicyTest : public ::testing::Test {
+public:
+    std::shared_ptr<sgfs::FileSystem> fs_;
+    sg4::Host * host_;
+
+    QoSPolicyTest() = default;
+
+    void setup_platform() {
+        XBT_INFO("Creating a platform with one host and one 100MBps disk...");
+        auto *my_zone = sg4::Engine::get_instance()->get_netzone_root()->add_netzone_full("zone");
+        host_ = my_zone->add_host("my_host", "100Gf");
+        auto* disk = host_->add_disk("disk", "100MBps", "100MBps");
+        my_zone->seal();
+
+        XBT_INFO("Creating a file system with a 100MB partition...");
+        fs_ = sgfs::FileSystem::create("my_fs");
+        fs_->mount_partition("/dev/a/", sgfs::OneDiskStorage::create("my_storage", disk), "100MB");
+        XBT_INFO("Create two 10MB files at /dev/a/foo.txt and /dev/a/bar.txt");
+        fs_->create_file("/dev/a/foo.txt", "10MB");
+        fs_->create_file("/dev/a/bar.txt", "10MB");
+    }
+};
+
+TEST_F(QoSPolicyTest, BadArguments)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform();
+        XBT_INFO("Set invalid limits, which should fail");
+        auto policy = sgfs::QoSPolicy::create();
+        ASSERT_THROW(policy->set_bandwidth_limit(-1, 1000), std::invalid_argument);
+        ASSERT_THROW(policy->set_bandwidth_limit(1e6, 0), std::invalid_argument);
+        ASSERT_THROW(policy->set_iops_limit(-1), std::invalid_argument);
+        ASSERT_THROW(policy->set_iops_limit(10, 0), std::invalid_argument);
+        ASSERT_THROW(fs_->set_actor_qos_policy(nullptr, policy), std::invalid_argument);
+        ASSERT_THROW(fs_->set_tag_qos_policy("", policy), std::invalid_argument);
+        ASSERT_DOUBLE_EQ(policy->get_bandwidth_limit(), 0);
+        ASSERT_DOUBLE_EQ(sgfs::QoSPolicy::get_priority_weight(sgfs::QoSPolicy::PriorityClass::LOW), 0.5);
+        ASSERT_DOUBLE_EQ(sgfs::QoSPolicy::get_priority_weight(sgfs::QoSPolicy::PriorityClass::NORMAL), 1.0);
+        ASSERT_DOUBLE_EQ(sgfs::QoSPolicy::get_priority_weight(sgfs::QoSPolicy::PriorityClass::HIGH), 2.0);
+        ASSERT_NO_THROW(fs_->set_tag_qos_policy("job", policy));
+        ASSERT_EQ(fs_->get_tag_qos_policy("job"), policy);
+        ASSERT_NO_THROW(fs_->set_tag_qos_policy("job", nullptr));
+        ASSERT_EQ(fs_->get_tag_qos_policy("job"), nullptr);
+    });
+}
+
+TEST_F(QoSPolicyTest, BandwidthLimit)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform();
+        XBT_INFO("Cap the bandwidth of the file system at 1MBps, with 1MB bursts");
+        auto policy = sgfs::QoSPolicy::create();
+        policy->set_bandwidth_limit(1e6, 1000000);
+        fs_->set_qos_policy(policy);
+        host_->add_actor("TestActor", [this, policy]() {
+            std::shared_ptr<sgfs::File> file;
+            ASSERT_NO_THROW(file = fs_->open("/dev/a/foo.txt", "r"));
+            XBT_INFO("Read 1MB, which the burst lets through at disk speed");
+            ASSERT_NO_THROW(file->read("1MB"));
+            ASSERT_NEAR(sg4::Engine::get_clock(), 0.01, 1e-6);
+            XBT_INFO("Read 1MB more, which waits until the bucket has refilled");
+            ASSERT_NO_THROW(file->read("1MB"));
+            ASSERT_NEAR(sg4::Engine::get_clock(), 1.01, 1e-6);
+            ASSERT_EQ(policy->get_num_requests(), 2);
+            ASSERT_EQ(policy->get_num_throttled_requests(), 1);
+            ASSERT_NEAR(policy->get_total_throttling_delay(), 0.99, 1e-6);
+            ASSERT_NO_THROW(file->close());
+        });
+        // Run the simulation
+        ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
+    });
+}
+
+TEST_F(QoSPolicyTest, ActorIopsLimit)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform();
+        auto throttled_actor = host_->add_actor("ThrottledActor", [this]() {
+            std::shared_ptr<sgfs::File> file;
+            ASSERT_NO_THROW(file = fs_->open("/dev/a/foo.txt", "r"));
+            XBT_INFO("Make three small reads, which are spaced by the 10 IOPS limit");
+            for (int i = 0; i < 3; i++)
+                ASSERT_NO_THROW(file->read("1kB"));
+            ASSERT_NEAR(sg4::Engine::get_clock(), 0.2, 1e-3);
+            ASSERT_NO_THROW(file->close());
+        });
+        host_->add_actor("OtherActor", [this]() {
+            std::shared_ptr<sgfs::File> file;
+            ASSERT_NO_THROW(file = fs_->open("/dev/a/bar.txt", "r"));
+            XBT_INFO("Make three small reads, which are not throttled");
+            for (int i = 0; i < 3; i++)
+                ASSERT_NO_THROW(file->read("1kB"));
+            ASSERT_LT(sg4::Engine::get_clock(), 0.001);
+            ASSERT_NO_THROW(file->close());
+        });
+        XBT_INFO("Cap the number of requests of one actor at 10 per second");
+        auto policy = sgfs::QoSPolicy::create();
+        policy->set_iops_limit(10);
+        fs_->set_actor_qos_policy(throttled_actor.get(), policy);
+        ASSERT_EQ(fs_->get_actor_qos_policy(throttled_actor.get()), policy);
+        // Run the simulation
+        ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
+        ASSERT_EQ(policy->get_num_requests(), 3);
+    });
+}
+
+TEST_F(QoSPolicyTest, TaggedAsynchronousReads)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform();
+        XBT_INFO("Cap the bandwidth of the files tagged 'job' at 1MBps, with 1MB bursts");
+        auto policy = sgfs::QoSPolicy::create();
+        policy->set_bandwidth_limit(1e6, 1000000);
+        fs_->set_tag_qos_policy("job", policy);
+        host_->add_actor("TestActor", [this]() {
+            std::shared_ptr<sgfs::File> file;
+            ASSERT_NO_THROW(file = fs_->open("/dev/a/bar.txt", "r"));
+            XBT_INFO("Read 2MB from an untagged file, which is not throttled");
+            ASSERT_NO_THROW(file->read("2MB"));
+            ASSERT_NEAR(sg4::Engine::get_clock(), 0.02, 1e-6);
+            ASSERT_NO_THROW(file->close());
+            ASSERT_NO_THROW(file = fs_->open("/dev/a/foo.txt", "r"));
+            file->set_qos_tag("job");
+            XBT_INFO("Asynchronously read 2MB from a tagged file, which starts once 1MB of debt has been paid back");
+            sg4::IoPtr io;
+            ASSERT_NO_THROW(io = file->read_async("2MB"));
+            ASSERT_DOUBLE_EQ(sg4::Engine::get_clock(), 0.02);
+            ASSERT_NO_THROW(io->wait());
+            ASSERT_NEAR(sg4::Engine::get_clock(), 1.04, 1e-6);
+            ASSERT_EQ(file->tell(), 2000000);
+            ASSERT_NO_THROW(file->close());
+        });
+        // Run the simulation
+        ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
+    });
+}
+
+TEST_F(QoSPolicyTest, PriorityClasses)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform();
+        auto high_priority_actor = host_->add_actor("HighPriorityActor", [this]() {
+            std::shared_ptr<sgfs::File> file;
+            ASSERT_NO_THROW(file = fs_->open("/dev/a/foo.txt", "r"));
+            XBT_INFO("Read 10MB with twice the share of the disk of the other actor");
+            ASSERT_NO_THROW(file->read("10MB"));
+            ASSERT_NEAR(sg4::Engine::get_clock(), 0.15, 1e-3);
+            ASSERT_NO_THROW(file->close());
+        });
+        host_->add_actor("NormalPriorityActor", [this]() {
+            std::shared_ptr<sgfs::File> file;
+            ASSERT_NO_THROW(file = fs_->open("/dev/a/bar.txt", "r"));
+            XBT_INFO("Read 10MB, which gets the whole disk once the other actor is done");
+            ASSERT_NO_THROW(file->read("10MB"));
+            ASSERT_NEAR(sg4::Engine::get_clock(), 0.2, 1e-3);
+            ASSERT_NO_THROW(file->close());
+        });
+        auto policy = sgfs::QoSPolicy::create();
+        policy->set_priority_class(sgfs::QoSPolicy::PriorityClass::HIGH);
+        fs_->set_actor_qos_policy(high_priority_actor.get(), policy);
+        // Run the simulation
+        ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
+    });
+}
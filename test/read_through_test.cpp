@@ -0,0 +1,165 @@
+/* Copyright (c) 2024-2026. The FSMOD Team. All rights reserved.          */
+
+/* This program is free software; you can redistribute it and/or modify it
+ * under the terms of the license (GNU LGPL) which comes with this package. */
+
+#include <gtest/gtest.h>
+#include <iostream>
+#include <memory>
+
+#include <simgrid/s4u/Actor.hpp>
+#include <simgrid/s4u/Engine.hpp>
+
+#include "fsmod/FileSystem.hpp"
+#include "fsmod/OneDiskStorage.hpp"
+#include "fsmod/EvictionPolicy.hpp"
+#include "fsmod/FileSystemException.hpp"
+#include "fsmod/MetadataService.hpp"
+
+#include "./test_util.hpp"
+
+namespace sgfs=simgrid::fsmod;
+namespace sg4=simgrid::s4u;
+
+XBT_LOG_NEW_DEFAULT_CATEGORY(read_through_test, "Read-Through Test");
+
+class ReadThroughTest : public ::testing::Test {
+public:
+    std::shared_ptr<sgfs::FileSystem> cache_fs_;
+    std::shared_ptr<sgfs::FileSystem> origin_fs_;
+    std::shared_ptr<sgfs::Partition> cache_;
+    sg4::Host * host_;
+
+    ReadThroughTest() = default;
+
+    void setup_platform() {
+        XBT_INFO("Creating a platform with one host, a 100MBps cache disk, and a 10MBps origin disk...");
+        auto *my_zone = sg4::Engine::get_instance()->get_netzone_root()->add_netzone_full("zone");
+        host_ = my_zone->add_host("my_host", "100Gf");
+        auto* cache_disk = host_->add_disk("cache_disk", "100MBps", "100MBps");
+        auto* origin_disk = host_->add_disk("origin_disk", "10MBps", "10MBps");
+        my_zone->seal();
+
+        XBT_INFO("Creating an origin file system that holds 20MB and 50MB files...");
+        origin_fs_ = sgfs::FileSystem::create("origin_fs");
+        origin_fs_->mount_partition("/pfs/", sgfs::OneDiskStorage::create("origin_storage", origin_disk), "1TB");
+        origin_fs_->create_file("/pfs/data/a.txt", "20MB");
+        origin_fs_->create_file("/pfs/data/b.txt", "50MB");
+        XBT_INFO("Creating a file system with a 100MB LRU partition that reads through to the origin...");
+        cache_fs_ = sgfs::FileSystem::create("cache_fs");
+        cache_fs_->mount_partition("/cache/", sgfs::OneDiskStorage::create("cache_storage", cache_disk), "100MB",
+                                   std::make_shared<sgfs::LRUEvictionPolicy>());
+        cache_ = cache_fs_->partition_by_name("/cache");
+        cache_->set_read_through(origin_fs_, "/pfs/data/");
+    }
+};
+
+TEST_F(ReadThroughTest, BadArguments)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform();
+        XBT_INFO("Configure read-throughs with invalid arguments, which should fail");
+        ASSERT_THROW(cache_->set_read_through(nullptr, "/pfs/data/"), std::invalid_argument);
+        ASSERT_THROW(cache_->set_read_through(origin_fs_, "/nowhere/"), std::invalid_argument);
+        ASSERT_THROW(cache_->set_read_through(cache_fs_, "/cache/data/"), std::invalid_argument);
+        ASSERT_EQ(cache_->get_origin_file_system(), origin_fs_);
+        ASSERT_EQ(cache_->get_origin_path(), "/pfs/data");
+    });
+}
+
+TEST_F(ReadThroughTest, MissesAndHits)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform();
+        host_->add_actor("TestActor", [this]() {
+            XBT_INFO("Open a missing file, which reads it from the origin in 2s and writes it to the cache in 0.2s");
+            std::shared_ptr<sgfs::File> file;
+            ASSERT_NO_THROW(file = cache_fs_->open("/cache/a.txt", "r"));
+            ASSERT_NEAR(sg4::Engine::get_clock(), 2.2, 1e-6);
+            ASSERT_NO_THROW(file->read("20MB"));
+            ASSERT_NO_THROW(file->close());
+            ASSERT_NEAR(sg4::Engine::get_clock(), 2.4, 1e-6);
+            ASSERT_EQ(cache_->get_num_cache_misses(), 1);
+            ASSERT_EQ(cache_->get_num_fetches(), 1);
+            ASSERT_EQ(cache_->get_num_fetched_bytes(), 20000000);
+            XBT_INFO("Open the file again, which is a hit");
+            ASSERT_NO_THROW(file = cache_fs_->open("/cache/a.txt", "r"));
+            ASSERT_NO_THROW(file->close());
+            ASSERT_NEAR(sg4::Engine::get_clock(), 2.4, 1e-6);
+            ASSERT_EQ(cache_->get_num_cache_hits(), 1);
+            XBT_INFO("Open files that the origin does not hold, or that are overwritten, which fetches nothing");
+            ASSERT_THROW(cache_fs_->open("/cache/c.txt", "r"), sgfs::FileNotFoundException);
+            ASSERT_NO_THROW(file = cache_fs_->open("/cache/b.txt", "w"));
+            ASSERT_NO_THROW(file->close());
+            ASSERT_EQ(cache_fs_->file_size("/cache/b.txt"), 0);
+            ASSERT_EQ(cache_->get_num_cache_misses(), 1);
+            ASSERT_EQ(cache_->get_num_fetches(), 1);
+        });
+        // Run the simulation
+        ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
+    });
+}
+
+TEST_F(ReadThroughTest, FetchedFilesAreCachedAndEvicted)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform();
+        cache_->set_write_back(origin_fs_, "/pfs/data/");
+        host_->add_actor("TestActor", [this]() {
+            XBT_INFO("Fetch both files, and create a 40MB file, which evicts the least recently used one");
+            ASSERT_NO_THROW(cache_fs_->open("/cache/a.txt", "r")->close());
+            ASSERT_NO_THROW(cache_fs_->open("/cache/b.txt", "r")->close());
+            ASSERT_NO_THROW(cache_fs_->create_file("/cache/c.txt", "40MB"));
+            ASSERT_FALSE(cache_fs_->file_exists("/cache/a.txt"));
+            ASSERT_TRUE(cache_fs_->file_exists("/cache/b.txt"));
+            XBT_INFO("Fetched files are clean, and are thus never written back");
+            ASSERT_EQ(cache_->get_num_write_backs(), 0);
+            XBT_INFO("Open the evicted file, which fetches it again");
+            ASSERT_NO_THROW(cache_fs_->open("/cache/a.txt", "r")->close());
+            ASSERT_EQ(cache_->get_num_fetches(), 3);
+        });
+        // Run the simulation
+        ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
+    });
+}
+
+TEST_F(ReadThroughTest, ConcurrentMissesCoalesce)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform();
+        XBT_INFO("Four actors open the same missing file at the same time");
+        for (int i = 0; i < 4; i++) {
+            host_->add_actor("Reader_" + std::to_string(i), [this]() {
+                std::shared_ptr<sgfs::File> file;
+                ASSERT_NO_THROW(file = cache_fs_->open("/cache/b.txt", "r"));
+                XBT_INFO("The file was fetched once, in 5s from the origin and 0.5s to the cache");
+                ASSERT_NEAR(sg4::Engine::get_clock(), 5.5, 1e-6);
+                ASSERT_NO_THROW(file->close());
+            });
+        }
+        // Run the simulation
+        ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
+        ASSERT_EQ(cache_->get_num_cache_misses(), 4);
+        ASSERT_EQ(cache_->get_num_fetches(), 1);
+    });
+}
+
+TEST_F(ReadThroughTest, FetchedFileIsPinnedUntilOpened)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform();
+        auto mds = sgfs::MetadataService::create(host_, 2);
+        mds->set_latency(sgfs::MetadataService::Operation::OPEN, 1);
+        cache_fs_->set_metadata_service(mds);
+        host_->add_actor("TestActor", [this]() {
+            XBT_INFO("Open a missing file, which is fetched in 2.2s, and then opened in 1s");
+            std::shared_ptr<sgfs::File> file;
+            ASSERT_NO_THROW(file = cache_fs_->open("/cache/a.txt", "r"));
+            ASSERT_NEAR(sg4::Engine::get_clock(), 3.2, 1e-6);
+            ASSERT_NO_THROW(file->close());
+        });
+        host_->add_actor("OtherActor", [this]() {
+            XBT_INFO("Create a 90MB file while the fetched file is being opened, which cannot evict it");
+            sg4::this_actor::sleep_until(2.5);
+            ASSERT_THROW(cache_fs_->create_file("/cache/big.txt", "90MB"), sgfs::NotEnoughSpaceException);
+            ASSERT_TRUE(cache_fs_->file_exists("/cache/a.txt"));
+        });
+        // Run the simulation
+        ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
+    });
+}
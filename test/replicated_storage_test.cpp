@@ -0,0 +1,184 @@
+/* Copyright (c) 2024-2026. The FSMOD Team. All rights reserved.          */
+
+/* This program is free software; you can redistribute it and/or modify it
+ * under the terms of the license (GNU LGPL) which comes with this package. */
+
+#include <gtest/gtest.h>
+#include <iostream>
+
+#include <simgrid/s4u/Actor.hpp>
+#include <simgrid/s4u/Engine.hpp>
+
+#include "fsmod/FileSystem.hpp"
+#include "fsmod/ReplicatedStorage.hpp"
+#include "fsmod/FileSystemException.hpp"
+
+#include "./test_util.hpp"
+
+namespace sgfs=simgrid::fsmod;
+namespace sg4=simgrid::s4u;
+
+XBT_LOG_NEW_DEFAULT_CATEGORY(replicated_storage_test, "Replicated Storage Test");
+
+class ReplicatedStorageTest : public ::testing::Test {
+public:
+    std::shared_ptr<sgfs::FileSystem> fs_;
+    std::shared_ptr<sgfs::ReplicatedStorage> rs_;
+    sg4::Host * client_;
+    std::vector<sg4::Host*> data_nodes_;
+    std::vector<sg4::Disk*> disks_;
+
+    ReplicatedStorageTest() = default;
+
+    void setup_platform(double client_bandwidth, double first_data_node_bandwidth, unsigned long replication_factor,
+                        sgfs::ReplicatedStorage::ReplicationMode replication_mode) {
+        XBT_INFO("Creating a platform with one client host and three data node hosts with one disk each...");
+        auto *my_zone = sg4::Engine::get_instance()->get_netzone_root()->add_netzone_full("zone");
+        client_ = my_zone->add_host("client", "100Gf");
+        std::vector<sg4::Host*> hosts = {client_};
+        std::vector<const sg4::Link*> nics = {my_zone->add_link("client_nic", client_bandwidth)};
+        for (int i = 0; i < 3; i++) {
+            auto* data_node = my_zone->add_host("data_node_" + std::to_string(i), "100Gf");
+            disks_.push_back(data_node->add_disk("disk", "10MBps", "10MBps"));
+            data_nodes_.push_back(data_node);
+            hosts.push_back(data_node);
+            nics.push_back(my_zone->add_link("data_node_" + std::to_string(i) + "_nic",
+                                             (i == 0) ? first_data_node_bandwidth : 1e9));
+        }
+        XBT_INFO("Each route goes through the network interfaces of both of its ends");
+        for (size_t i = 0; i < hosts.size(); i++)
+            for (size_t j = i + 1; j < hosts.size(); j++)
+                my_zone->add_route(hosts.at(i), hosts.at(j), {nics.at(i), nics.at(j)});
+        my_zone->seal();
+
+        XBT_INFO("Creating a replicated storage over the three disks...");
+        rs_ = sgfs::ReplicatedStorage::create("hdfs", disks_, replication_factor, replication_mode);
+        XBT_INFO("Creating a file system...");
+        fs_ = sgfs::FileSystem::create("my_fs");
+        XBT_INFO("Mounting a 100MB partition...");
+        fs_->mount_partition("/dev/hdfs/", rs_, "100MB");
+    }
+};
+
+TEST_F(ReplicatedStorageTest, BadArguments)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform(1e9, 1e9, 3, sgfs::ReplicatedStorage::ReplicationMode::PIPELINE);
+        XBT_INFO("Create replicated storages with invalid arguments, which should fail");
+        ASSERT_THROW(sgfs::ReplicatedStorage::create("bad", {disks_.at(0), nullptr}, 1), std::invalid_argument);
+        ASSERT_THROW(sgfs::ReplicatedStorage::create("bad", {disks_.at(0), disks_.at(0)}, 1), std::invalid_argument);
+        ASSERT_THROW(sgfs::ReplicatedStorage::create("bad", disks_, 0), std::invalid_argument);
+        ASSERT_THROW(sgfs::ReplicatedStorage::create("bad", disks_, 4), std::invalid_argument);
+        ASSERT_EQ(rs_->get_replication_factor(), 3);
+        ASSERT_EQ(rs_->get_num_disks(), 3);
+    });
+}
+
+TEST_F(ReplicatedStorageTest, NearestReplicaReads)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform(1e9, 1e5, 2, sgfs::ReplicatedStorage::ReplicationMode::PIPELINE);
+        ASSERT_NO_THROW(fs_->create_file("/dev/hdfs/foo.txt", "1MB"));
+        XBT_INFO("The first data node is behind a slow link");
+        ASSERT_GT(rs_->estimate_read_cost(disks_.at(0), client_, 1000000),
+                  rs_->estimate_read_cost(disks_.at(1), client_, 1000000));
+        client_->add_actor("RemoteReader", [this]() {
+            std::shared_ptr<sgfs::File> file;
+            XBT_INFO("Read a file whose replicas are on the first two data nodes from the client, which reads it "
+                     "from the second data node in 0.1s");
+            ASSERT_NO_THROW(file = fs_->open("/dev/hdfs/foo.txt", "r"));
+            ASSERT_EQ(file->read("1MB"), 1000000);
+            ASSERT_NO_THROW(file->close());
+            ASSERT_NEAR(sg4::Engine::get_clock(), 0.1, 0.01);
+            ASSERT_EQ(rs_->get_disk_num_bytes_read(0), 0);
+            ASSERT_EQ(rs_->get_disk_num_bytes_read(1), 1000000);
+        });
+        data_nodes_.at(0)->add_actor("LocalReader", [this]() {
+            std::shared_ptr<sgfs::File> file;
+            sg4::this_actor::sleep_until(1);
+            XBT_INFO("Read the same file from the first data node, which reads its local replica in 0.1s");
+            ASSERT_NO_THROW(file = fs_->open("/dev/hdfs/foo.txt", "r"));
+            ASSERT_EQ(file->read("1MB"), 1000000);
+            ASSERT_NO_THROW(file->close());
+            ASSERT_DOUBLE_EQ(sg4::Engine::get_clock(), 1.1);
+            ASSERT_EQ(rs_->get_disk_num_bytes_read(0), 1000000);
+        });
+        // Run the simulation
+        ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
+    });
+}
+
+TEST_F(ReplicatedStorageTest, LocalFirstReplica)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform(1e9, 1e9, 1, sgfs::ReplicatedStorage::ReplicationMode::PIPELINE);
+        data_nodes_.at(2)->add_actor("LocalWriter", [this]() {
+            std::shared_ptr<sgfs::File> file;
+            XBT_INFO("Write a file from the last data node, which places its only replica on its local disk");
+            ASSERT_NO_THROW(file = fs_->open("/dev/hdfs/foo.txt", "w"));
+            ASSERT_NO_THROW(file->write("1MB"));
+            ASSERT_NO_THROW(file->close());
+            ASSERT_DOUBLE_EQ(sg4::Engine::get_clock(), 0.1);
+        });
+        client_->add_actor("RemoteReader", [this]() {
+            std::shared_ptr<sgfs::File> file;
+            sg4::this_actor::sleep_until(1);
+            ASSERT_NO_THROW(file = fs_->open("/dev/hdfs/foo.txt", "r"));
+            ASSERT_EQ(file->read("1MB"), 1000000);
+            ASSERT_NO_THROW(file->close());
+            ASSERT_EQ(rs_->get_disk_num_bytes_read(2), 1000000);
+        });
+        // Run the simulation
+        ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
+    });
+}
+
+TEST_F(ReplicatedStorageTest, WriteAmplification)  {
+    for (auto mode : {sgfs::ReplicatedStorage::ReplicationMode::PIPELINE,
+                      sgfs::ReplicatedStorage::ReplicationMode::FAN_OUT}) {
+        DO_TEST_WITH_FORK([this, mode]() {
+            XBT_INFO("The client is behind a 1MBps link");
+            this->setup_platform(1e6, 1e9, 3, mode);
+            client_->add_actor("Writer", [this, mode]() {
+                std::shared_ptr<sgfs::File> file;
+                XBT_INFO("Write 1MB to three replicas");
+                ASSERT_NO_THROW(file = fs_->open("/dev/hdfs/foo.txt", "w"));
+                ASSERT_NO_THROW(file->write("1MB"));
+                ASSERT_NO_THROW(file->close());
+                ASSERT_EQ(rs_->get_num_bytes_written(), 1000000);
+                ASSERT_EQ(rs_->get_num_replica_bytes_written(), 3000000);
+                ASSERT_DOUBLE_EQ(rs_->get_write_amplification(), 3.0);
+                if (mode == sgfs::ReplicatedStorage::ReplicationMode::PIPELINE) {
+                    XBT_INFO("In a pipeline, the client sends the data once and the write takes about 1s");
+                    ASSERT_LT(sg4::Engine::get_clock(), 1.5);
+                } else {
+                    XBT_INFO("In a fan-out, the client sends the data three times and the write takes about 3s");
+                    ASSERT_GT(sg4::Engine::get_clock(), 2.5);
+                }
+            });
+            // Run the simulation
+            ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
+        });
+    }
+}
+
+TEST_F(ReplicatedStorageTest, DeletedFilesLoseTheirReplicas)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform(1e9, 1e9, 2, sgfs::ReplicatedStorage::ReplicationMode::PIPELINE);
+        client_->add_actor("TestActor", [this]() {
+            std::shared_ptr<sgfs::File> file;
+            XBT_INFO("Write a file and two files in a directory, which places their replicas");
+            ASSERT_NO_THROW(fs_->create_directory("/dev/hdfs/dir"));
+            for (const auto& path : {"/dev/hdfs/foo.txt", "/dev/hdfs/dir/a.txt", "/dev/hdfs/dir/b.txt"}) {
+                ASSERT_NO_THROW(file = fs_->open(path, "w"));
+                ASSERT_NO_THROW(file->write("1MB"));
+                ASSERT_NO_THROW(file->close());
+            }
+            ASSERT_EQ(rs_->get_num_placed_files(), 3);
+            XBT_INFO("Delete the file, and then the directory, which forgets all the placements");
+            ASSERT_NO_THROW(fs_->unlink_file("/dev/hdfs/foo.txt"));
+            ASSERT_EQ(rs_->get_num_placed_files(), 2);
+            ASSERT_NO_THROW(fs_->unlink_directory("/dev/hdfs/dir"));
+            ASSERT_EQ(rs_->get_num_placed_files(), 0);
+        });
+        // Run the simulation
+        ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
+    });
+}
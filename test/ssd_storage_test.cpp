@@ -0,0 +1,156 @@
+/* Copyright (c) 2024-2026. The FSMOD Team. All rights reserved.          */
+
+/* This program is free software; you can redistribute it and/or modify it
+ * under the terms of the license (GNU LGPL) which comes with this package. */
+
+#include <gtest/gtest.h>
+#include <iostream>
+
+#include <simgrid/s4u/Actor.hpp>
+#include <simgrid/s4u/Engine.hpp>
+
+#include "fsmod/FileSystem.hpp"
+#include "fsmod/SSDStorage.hpp"
+#include "fsmod/FileSystemException.hpp"
+
+#include "./test_util.hpp"
+
+namespace sgfs=simgrid::fsmod;
+namespace sg4=simgrid::s4u;
+
+XBT_LOG_NEW_DEFAULT_CATEGORY(ssd_storage_test, "SSD Storage Test");
+
+class SSDStorageTest : public ::testing::Test {
+public:
+    std::shared_ptr<sgfs::FileSystem> fs_;
+    std::shared_ptr<sgfs::SSDStorage> ssd_;
+    sg4::Host * host_;
+    sg4::Disk * disk_;
+
+    SSDStorageTest() = default;
+
+    void setup_platform() {
+        XBT_INFO("Creating a platform with one host and one 100MBps disk...");
+        auto *my_zone = sg4::Engine::get_instance()->get_netzone_root()->add_netzone_full("zone");
+        host_ = my_zone->add_host("my_host", "100Gf");
+        disk_ = host_->add_disk("disk", "100MBps", "100MBps");
+        my_zone->seal();
+
+        XBT_INFO("Creating an SSD storage that serves 1000 IOPS with a 100us operation latency...");
+        ssd_ = sgfs::SSDStorage::create("my_ssd", disk_, 1000, 1e-4);
+        XBT_INFO("Creating a file system with a 100MB partition...");
+        fs_ = sgfs::FileSystem::create("my_fs");
+        fs_->mount_partition("/dev/a/", ssd_, "100MB");
+    }
+};
+
+TEST_F(SSDStorageTest, BadArguments)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform();
+        XBT_INFO("Create SSD storages and configure them with invalid arguments, which should fail");
+        ASSERT_THROW(sgfs::SSDStorage::create("bad", nullptr, 1000), std::invalid_argument);
+        ASSERT_THROW(sgfs::SSDStorage::create("bad", disk_, 0), std::invalid_argument);
+        ASSERT_THROW(sgfs::SSDStorage::create("bad", disk_, 1000, -1), std::invalid_argument);
+        ASSERT_THROW(ssd_->set_over_provisioning(-0.1), std::invalid_argument);
+        ASSERT_THROW(ssd_->set_over_provisioning(1), std::invalid_argument);
+        ASSERT_THROW(ssd_->set_garbage_collection(1.5, 1000000, 0.5), std::invalid_argument);
+        ASSERT_THROW(ssd_->set_garbage_collection(0.2, 0, 0.5), std::invalid_argument);
+        ASSERT_THROW(ssd_->set_garbage_collection(0.2, 1000000, -1), std::invalid_argument);
+        XBT_INFO("An empty drive does not amplify writes");
+        ASSERT_DOUBLE_EQ(ssd_->get_write_amplification(), 1.0);
+        ASSERT_DOUBLE_EQ(ssd_->get_over_provisioning(), 0.07);
+    });
+}
+
+TEST_F(SSDStorageTest, SmallReadsAreIopsBound)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform();
+        fs_->create_file("/dev/a/foo.txt", "20MB");
+        host_->add_actor("TestActor", [this]() {
+            std::shared_ptr<sgfs::File> file;
+            ASSERT_NO_THROW(file = fs_->open("/dev/a/foo.txt", "r"));
+            XBT_INFO("Read 4kB, which takes the latency plus one IOPS slot, i.e., much more than 4kB at 100MBps");
+            ASSERT_NO_THROW(file->read("4kB"));
+            ASSERT_NEAR(sg4::Engine::get_clock(), 1e-4 + 0.00104, 1e-6);
+            XBT_INFO("Read 10MB, which is bandwidth bound");
+            double date = sg4::Engine::get_clock();
+            ASSERT_NO_THROW(file->read("10MB"));
+            ASSERT_NEAR(sg4::Engine::get_clock() - date, 1e-4 + 0.101, 1e-6);
+            ASSERT_NO_THROW(file->close());
+        });
+        // Run the simulation
+        ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
+    });
+}
+
+TEST_F(SSDStorageTest, ConcurrentSmallReads)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform();
+        fs_->create_file("/dev/a/foo.txt", "1MB");
+        XBT_INFO("Ten actors read 4kB at the same time, which the drive serves at no more than 1000 IOPS");
+        for (int i = 0; i < 10; i++) {
+            host_->add_actor("Reader_" + std::to_string(i), [this]() {
+                std::shared_ptr<sgfs::File> file;
+                ASSERT_NO_THROW(file = fs_->open("/dev/a/foo.txt", "r"));
+                ASSERT_NO_THROW(file->read("4kB"));
+                ASSERT_NEAR(sg4::Engine::get_clock(), 1e-4 + 0.0104, 1e-6);
+                ASSERT_NO_THROW(file->close());
+            });
+        }
+        // Run the simulation
+        ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
+    });
+}
+
+TEST_F(SSDStorageTest, WriteAmplification)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform();
+        XBT_INFO("Fill 90MB of the 100MB partition");
+        fs_->create_file("/dev/a/foo.txt", "90MB");
+        ASSERT_NEAR(ssd_->get_write_amplification(), 1.17 / 0.34, 1e-9);
+        host_->add_actor("TestActor", [this]() {
+            std::shared_ptr<sgfs::File> file;
+            ASSERT_NO_THROW(file = fs_->open("/dev/a/bar.txt", "w"));
+            XBT_INFO("Write 1MB, which fills the partition to 91%% and is amplified 3.625 times");
+            ASSERT_NO_THROW(file->write("1MB"));
+            ASSERT_NEAR(sg4::Engine::get_clock(), 1e-4 + (3625000 + 100000) / 1e8, 1e-6);
+            ASSERT_EQ(ssd_->get_num_bytes_written(), 1000000);
+            ASSERT_EQ(ssd_->get_num_physical_bytes_written(), 3625000);
+            ASSERT_NO_THROW(file->close());
+            XBT_INFO("Free the space, which removes the amplification");
+            ASSERT_NO_THROW(fs_->unlink_file("/dev/a/foo.txt"));
+            ASSERT_DOUBLE_EQ(ssd_->get_write_amplification(), 1.0);
+        });
+        // Run the simulation
+        ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
+    });
+}
+
+TEST_F(SSDStorageTest, GarbageCollectionStalls)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform();
+        XBT_INFO("Stall for 0.5s every 1MB physically written when less than 20%% of the partition is free");
+        ssd_->set_garbage_collection(0.2, 1000000, 0.5);
+        fs_->create_file("/dev/a/foo.txt", "70MB");
+        host_->add_actor("TestActor", [this]() {
+            std::shared_ptr<sgfs::File> file;
+            ASSERT_NO_THROW(file = fs_->open("/dev/a/bar.txt", "w"));
+            XBT_INFO("Write 1MB while 29%% of the partition is free, which does not stall");
+            ASSERT_NO_THROW(file->write("1MB"));
+            ASSERT_EQ(ssd_->get_num_gc_stalls(), 0);
+            XBT_INFO("Asynchronously write 15MB, which leaves 14%% of the partition free and triggers a stall");
+            ASSERT_NO_THROW(file->write_async("15MB")->wait());
+            ASSERT_EQ(ssd_->get_num_gc_stalls(), 1);
+            ASSERT_DOUBLE_EQ(ssd_->get_total_stall_time(), 0.5);
+            ASSERT_NO_THROW(file->close());
+            XBT_INFO("Read 4kB, which waits for the end of the stall");
+            double date = sg4::Engine::get_clock();
+            ASSERT_NO_THROW(file = fs_->open("/dev/a/foo.txt", "r"));
+            ASSERT_NO_THROW(file->read("4kB"));
+            ASSERT_NEAR(sg4::Engine::get_clock() - date, 0.5 + 1e-4 + 0.00104, 1e-6);
+            ASSERT_NO_THROW(file->close());
+        });
+        // Run the simulation
+        ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
+    });
+}
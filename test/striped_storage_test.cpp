@@ -0,0 +1,176 @@
+/* Copyright (c) 2024-2026. The FSMOD Team. All rights reserved.          */
+
+/* This program is free software; you can redistribute it and/or modify it
+ * under the terms of the license (GNU LGPL) which comes with this package. */
+
+#include <gtest/gtest.h>
+#include <iostream>
+
+#include <simgrid/s4u/Actor.hpp>
+#include <simgrid/s4u/Engine.hpp>
+
+#include "fsmod/FileSystem.hpp"
+#include "fsmod/OneRemoteDiskStorage.hpp"
+#include "fsmod/StripedStorage.hpp"
+#include "fsmod/FileSystemException.hpp"
+
+#include "./test_util.hpp"
+
+namespace sgfs=simgrid::fsmod;
+namespace sg4=simgrid::s4u;
+
+XBT_LOG_NEW_DEFAULT_CATEGORY(striped_storage_test, "Striped Storage Test");
+
+class StripedStorageTest : public ::testing::Test {
+public:
+    std::shared_ptr<sgfs::FileSystem> fs_;
+    std::shared_ptr<sgfs::StripedStorage> ss_;
+    std::vector<std::shared_ptr<sgfs::Storage>> osts_;
+    sg4::Host * client_;
+
+    StripedStorageTest() = default;
+
+    void setup_platform() {
+        XBT_INFO("Creating a platform with one client host and four server hosts with one disk each...");
+        auto *my_zone = sg4::Engine::get_instance()->get_netzone_root()->add_netzone_full("zone");
+        client_ = my_zone->add_host("client", "100Gf");
+        for (int i = 0; i < 4; i++) {
+            auto* server = my_zone->add_host("server_" + std::to_string(i), "100Gf");
+            auto* disk = server->add_disk("disk", "1MBps", "1MBps");
+            const auto* link = my_zone->add_link("link_" + std::to_string(i), 1e9);
+            my_zone->add_route(client_, server, {link});
+            osts_.push_back(sgfs::OneRemoteDiskStorage::create("ost_" + std::to_string(i), disk));
+        }
+        my_zone->seal();
+
+        XBT_INFO("Creating a striped storage over the four remote storages, with 1MB stripes on one target by default");
+        ss_ = sgfs::StripedStorage::create("pfs", osts_, 1, 1000000);
+        XBT_INFO("Creating a file system...");
+        fs_ = sgfs::FileSystem::create("my_fs");
+        XBT_INFO("Mounting a 100MB partition...");
+        fs_->mount_partition("/dev/pfs/", ss_, "100MB");
+    }
+};
+
+TEST_F(StripedStorageTest, BadArguments)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform();
+        XBT_INFO("Create striped storages with invalid arguments, which should fail");
+        ASSERT_THROW(sgfs::StripedStorage::create("bad", {}), std::invalid_argument);
+        ASSERT_THROW(sgfs::StripedStorage::create("bad", {osts_.at(0), nullptr}), std::invalid_argument);
+        ASSERT_THROW(sgfs::StripedStorage::create("bad", osts_, 0), std::invalid_argument);
+        ASSERT_THROW(sgfs::StripedStorage::create("bad", osts_, 5), std::invalid_argument);
+        ASSERT_THROW(sgfs::StripedStorage::create("bad", osts_, 2, 0), std::invalid_argument);
+        ASSERT_THROW(ss_->set_default_layout(5, 1000000), std::invalid_argument);
+        ASSERT_EQ(ss_->get_num_targets(), 4);
+        ASSERT_EQ(ss_->get_num_disks(), 4);
+        XBT_INFO("Create files with invalid layouts, which should fail and not create the files");
+        ASSERT_THROW(fs_->create_file("/dev/pfs/foo.txt", "1MB", 5, "1MB"), std::invalid_argument);
+        ASSERT_FALSE(fs_->file_exists("/dev/pfs/foo.txt"));
+        ASSERT_NO_THROW(fs_->mount_partition("/dev/ost/", osts_.at(0), "100MB"));
+        ASSERT_THROW(fs_->create_file("/dev/ost/foo.txt", "1MB", 1, "1MB"), std::invalid_argument);
+        ASSERT_FALSE(fs_->file_exists("/dev/ost/foo.txt"));
+    });
+}
+
+TEST_F(StripedStorageTest, StripeCountScalesBandwidth)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform();
+        client_->add_actor("TestActor", [this]() {
+            std::shared_ptr<sgfs::File> file;
+            XBT_INFO("Create a 4MB file striped over the four targets, and a 4MB file with the default layout");
+            ASSERT_NO_THROW(fs_->create_file("/dev/pfs/wide.txt", "4MB", 4, "1MB"));
+            ASSERT_NO_THROW(fs_->create_file("/dev/pfs/narrow.txt", "4MB"));
+            XBT_INFO("Read the file on one target, which takes 4s");
+            ASSERT_NO_THROW(file = fs_->open("/dev/pfs/narrow.txt", "r"));
+            ASSERT_EQ(file->read("4MB"), 4000000);
+            ASSERT_NO_THROW(file->close());
+            ASSERT_DOUBLE_EQ(sg4::Engine::get_clock(), 4.0);
+            XBT_INFO("Read the file on four targets, which takes 1s");
+            ASSERT_NO_THROW(file = fs_->open("/dev/pfs/wide.txt", "r"));
+            ASSERT_EQ(file->read("4MB"), 4000000);
+            ASSERT_NO_THROW(file->close());
+            ASSERT_DOUBLE_EQ(sg4::Engine::get_clock(), 5.0);
+            ASSERT_EQ(ss_->get_target_num_bytes(0), 5000000);
+            for (unsigned long i = 1; i < 4; i++)
+                ASSERT_EQ(ss_->get_target_num_bytes(i), 1000000);
+        });
+        // Run the simulation
+        ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
+    });
+}
+
+TEST_F(StripedStorageTest, CollidingStripes)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform();
+        XBT_INFO("Create three 2MB files striped over two targets, which are allocated in round-robin fashion: "
+                 "the first and third files share their targets");
+        for (const auto* path : {"/dev/pfs/a.txt", "/dev/pfs/b.txt", "/dev/pfs/c.txt"})
+            ASSERT_NO_THROW(fs_->create_file(path, "2MB", 2, "1MB"));
+        auto read_file = [this](const std::string& path, double start_date, double end_date) {
+            sg4::this_actor::sleep_until(start_date);
+            std::shared_ptr<sgfs::File> file;
+            ASSERT_NO_THROW(file = fs_->open(path, "r"));
+            ASSERT_EQ(file->read("2MB"), 2000000);
+            ASSERT_NO_THROW(file->close());
+            ASSERT_DOUBLE_EQ(sg4::Engine::get_clock(), end_date);
+        };
+        XBT_INFO("Reading the first two files concurrently takes 1s");
+        client_->add_actor("ReaderA", [read_file]() { read_file("/dev/pfs/a.txt", 0, 1.0); });
+        client_->add_actor("ReaderB", [read_file]() { read_file("/dev/pfs/b.txt", 0, 1.0); });
+        XBT_INFO("Reading the first and third files concurrently takes 2s, as they compete for the same targets");
+        client_->add_actor("ReaderA2", [read_file]() { read_file("/dev/pfs/a.txt", 2, 4.0); });
+        client_->add_actor("ReaderC", [read_file]() { read_file("/dev/pfs/c.txt", 2, 4.0); });
+        // Run the simulation
+        ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
+        for (unsigned long i = 0; i < 4; i++)
+            ASSERT_EQ(ss_->get_target_num_bytes(i), (i < 2) ? 3000000 : 1000000);
+    });
+}
+
+TEST_F(StripedStorageTest, WritesAndUnalignedReads)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform();
+        client_->add_actor("TestActor", [this]() {
+            std::shared_ptr<sgfs::File> file;
+            ASSERT_NO_THROW(fs_->create_file("/dev/pfs/foo.txt", "0B", 2, "1MB"));
+            XBT_INFO("Write 4MB to a file striped over two targets, which takes 2s");
+            ASSERT_NO_THROW(file = fs_->open("/dev/pfs/foo.txt", "w"));
+            ASSERT_NO_THROW(file->write("4MB"));
+            ASSERT_NO_THROW(file->close());
+            ASSERT_DOUBLE_EQ(sg4::Engine::get_clock(), 2.0);
+            ASSERT_EQ(fs_->file_size("/dev/pfs/foo.txt"), 4000000);
+            XBT_INFO("Read 1MB across a stripe boundary, which reads 0.5MB from each target in 0.5s");
+            ASSERT_NO_THROW(file = fs_->open("/dev/pfs/foo.txt", "r"));
+            ASSERT_NO_THROW(file->seek(500000));
+            ASSERT_EQ(file->read("1MB"), 1000000);
+            ASSERT_NO_THROW(file->close());
+            ASSERT_DOUBLE_EQ(sg4::Engine::get_clock(), 2.5);
+            ASSERT_EQ(ss_->get_target_num_bytes(0), 2500000);
+            ASSERT_EQ(ss_->get_target_num_bytes(1), 2500000);
+        });
+        // Run the simulation
+        ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
+    });
+}
+
+TEST_F(StripedStorageTest, DeletedFilesLoseTheirLayout)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform();
+        client_->add_actor("TestActor", [this]() {
+            XBT_INFO("Create a file and a directory with two files, each striped over two targets");
+            ASSERT_NO_THROW(fs_->create_file("/dev/pfs/foo.txt", "1MB", 2, "1MB"));
+            ASSERT_NO_THROW(fs_->create_directory("/dev/pfs/dir"));
+            ASSERT_NO_THROW(fs_->create_file("/dev/pfs/dir/a.txt", "1MB", 2, "1MB"));
+            ASSERT_NO_THROW(fs_->create_file("/dev/pfs/dir/b.txt", "1MB", 2, "1MB"));
+            ASSERT_EQ(ss_->get_num_file_layouts(), 3);
+            XBT_INFO("Delete the file, and then the directory, which forgets all the layouts");
+            ASSERT_NO_THROW(fs_->unlink_file("/dev/pfs/foo.txt"));
+            ASSERT_EQ(ss_->get_num_file_layouts(), 2);
+            ASSERT_NO_THROW(fs_->unlink_directory("/dev/pfs/dir"));
+            ASSERT_EQ(ss_->get_num_file_layouts(), 0);
+        });
+        // Run the simulation
+        ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
+    });
+}
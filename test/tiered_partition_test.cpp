@@ -0,0 +1,195 @@
+/* Copyright (c) 2024-2026. The FSMOD Team. All rights reserved.          */
+
+/* This program is free software; you can redistribute it and/or modify it
+ * under the terms of the license (GNU LGPL) which comes with this package. */
+
+#include <gtest/gtest.h>
+#include <iostream>
+
+#include <simgrid/s4u/Actor.hpp>
+#include <simgrid/s4u/Engine.hpp>
+
+#include "fsmod/FileSystem.hpp"
+#include "fsmod/OneDiskStorage.hpp"
+#include "fsmod/PartitionTiered.hpp"
+#include "fsmod/FileSystemException.hpp"
+
+#include "./test_util.hpp"
+
+namespace sgfs=simgrid::fsmod;
+namespace sg4=simgrid::s4u;
+
+XBT_LOG_NEW_DEFAULT_CATEGORY(tiered_partition_test, "Tiered Partition Test");
+
+class TieredPartitionTest : public ::testing::Test {
+public:
+    std::shared_ptr<sgfs::FileSystem> fs_;
+    std::shared_ptr<sgfs::PartitionTiered> partition_;
+    sg4::Host * host_;
+
+    TieredPartitionTest() = default;
+
+    void setup_platform() {
+        XBT_INFO("Creating a platform with one host, one fast disk, and one slow disk...");
+        auto *my_zone = sg4::Engine::get_instance()->get_netzone_root()->add_netzone_full("zone");
+        host_ = my_zone->add_host("my_host", "100Gf");
+        auto* ssd = host_->add_disk("ssd", "10MBps", "10MBps");
+        auto* hdd = host_->add_disk("hdd", "1MBps", "1MBps");
+        my_zone->seal();
+
+        XBT_INFO("Creating a one-disk storage on each disk...");
+        auto fast_storage = sgfs::OneDiskStorage::create("fast_storage", ssd);
+        auto capacity_storage = sgfs::OneDiskStorage::create("capacity_storage", hdd);
+        XBT_INFO("Creating a file system...");
+        fs_ = sgfs::FileSystem::create("my_fs");
+        XBT_INFO("Mounting a tiered partition with a 10MB fast tier and a 100MB capacity tier...");
+        partition_ = fs_->mount_tiered_partition("/dev/tiered/", fast_storage, "10MB", capacity_storage, "100MB");
+    }
+};
+
+TEST_F(TieredPartitionTest, BadArguments)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform();
+        auto ods = sgfs::OneDiskStorage::create("other_storage", host_->get_disks().at(0));
+        XBT_INFO("Mount tiered partitions at invalid mount points, which should fail");
+        ASSERT_THROW(fs_->mount_tiered_partition("", ods, "1MB", ods, "1MB"), std::invalid_argument);
+        ASSERT_THROW(fs_->mount_tiered_partition("/dev/tiered/sub", ods, "1MB", ods, "1MB"), std::invalid_argument);
+        XBT_INFO("Set invalid migration parameters, which should fail");
+        ASSERT_THROW(partition_->set_heat_half_life(0), std::invalid_argument);
+        ASSERT_THROW(partition_->set_heat_thresholds(1, 2), std::invalid_argument);
+        ASSERT_THROW(partition_->set_heat_thresholds(1, -1), std::invalid_argument);
+        ASSERT_THROW(partition_->set_migration_interval(-1), std::invalid_argument);
+        ASSERT_THROW(partition_->set_migration_rate(-1), std::invalid_argument);
+        XBT_INFO("Query files that do not exist or are not on the partition, which should fail");
+        ASSERT_THROW((void)partition_->get_file_tier("/dev/tiered/foo.txt"), sgfs::FileNotFoundException);
+        ASSERT_THROW((void)partition_->get_file_heat("/dev/other/foo.txt"), sgfs::InvalidPathException);
+    });
+}
+
+TEST_F(TieredPartitionTest, Placement)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform();
+        host_->add_actor("TestActor", [this]() {
+            std::shared_ptr<sgfs::File> file;
+            XBT_INFO("Create two 6MB files: the first one fits on the fast tier, the second one does not");
+            ASSERT_NO_THROW(fs_->create_file("/dev/tiered/a.txt", "6MB"));
+            ASSERT_NO_THROW(fs_->create_file("/dev/tiered/b.txt", "6MB"));
+            ASSERT_EQ(partition_->get_file_tier("/dev/tiered/a.txt"), sgfs::PartitionTiered::Tier::FAST);
+            ASSERT_EQ(partition_->get_file_tier("/dev/tiered/b.txt"), sgfs::PartitionTiered::Tier::CAPACITY);
+            ASSERT_EQ(partition_->get_tier_used_space(sgfs::PartitionTiered::Tier::FAST), 6000000);
+            ASSERT_EQ(partition_->get_tier_used_space(sgfs::PartitionTiered::Tier::CAPACITY), 6000000);
+            ASSERT_EQ(partition_->get_free_space(), 98000000);
+            XBT_INFO("Read 1MB from each file, which takes 0.1s on the fast tier and 1s on the capacity tier");
+            ASSERT_NO_THROW(file = fs_->open("/dev/tiered/a.txt", "r"));
+            ASSERT_NO_THROW(file->read("1MB"));
+            ASSERT_NO_THROW(file->close());
+            ASSERT_DOUBLE_EQ(sg4::Engine::get_clock(), 0.1);
+            ASSERT_NO_THROW(file = fs_->open("/dev/tiered/b.txt", "r"));
+            ASSERT_NO_THROW(file->read("1MB"));
+            ASSERT_NO_THROW(file->close());
+            ASSERT_DOUBLE_EQ(sg4::Engine::get_clock(), 1.1);
+            XBT_INFO("Move the second file, which stays on the capacity tier");
+            ASSERT_NO_THROW(fs_->move_file("/dev/tiered/b.txt", "/dev/tiered/c.txt"));
+            ASSERT_EQ(partition_->get_file_tier("/dev/tiered/c.txt"), sgfs::PartitionTiered::Tier::CAPACITY);
+            XBT_INFO("Delete the first file, which frees the fast tier");
+            ASSERT_NO_THROW(fs_->unlink_file("/dev/tiered/a.txt"));
+            ASSERT_EQ(partition_->get_tier_used_space(sgfs::PartitionTiered::Tier::FAST), 0);
+        });
+        // Run the simulation
+        ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
+    });
+}
+
+TEST_F(TieredPartitionTest, HotColdMigration)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform();
+        partition_->set_heat_half_life(2);
+        partition_->set_heat_thresholds(1, 0.5);
+        partition_->set_migration_interval(5);
+        XBT_INFO("Create a 4MB file on the fast tier, and an 8MB file that only fits on the capacity tier");
+        ASSERT_NO_THROW(fs_->create_file("/dev/tiered/cold.txt", "4MB"));
+        ASSERT_NO_THROW(fs_->create_file("/dev/tiered/hot.txt", "8MB"));
+        host_->add_actor("TestActor", [this]() {
+            std::shared_ptr<sgfs::File> file;
+            XBT_INFO("Read the 8MB file 1MB at a time, four times");
+            ASSERT_NO_THROW(file = fs_->open("/dev/tiered/hot.txt", "r"));
+            for (int i = 0; i < 4; i++)
+                ASSERT_NO_THROW(file->read("1MB"));
+            ASSERT_NO_THROW(file->close());
+            ASSERT_DOUBLE_EQ(sg4::Engine::get_clock(), 4.0);
+            ASSERT_EQ(partition_->get_file_tier("/dev/tiered/cold.txt"), sgfs::PartitionTiered::Tier::FAST);
+            ASSERT_EQ(partition_->get_file_tier("/dev/tiered/hot.txt"), sgfs::PartitionTiered::Tier::CAPACITY);
+
+            XBT_INFO("At 5s, the 4MB file has cooled down and is demoted, which takes 0.4s + 4s");
+            sg4::this_actor::sleep_until(7);
+            ASSERT_EQ(partition_->get_file_tier("/dev/tiered/cold.txt"), sgfs::PartitionTiered::Tier::FAST);
+            XBT_INFO("Then the 8MB file is promoted, which takes 8s + 0.8s");
+            sg4::this_actor::sleep_until(20);
+            ASSERT_EQ(partition_->get_file_tier("/dev/tiered/cold.txt"), sgfs::PartitionTiered::Tier::CAPACITY);
+            ASSERT_EQ(partition_->get_file_tier("/dev/tiered/hot.txt"), sgfs::PartitionTiered::Tier::FAST);
+            ASSERT_EQ(partition_->get_num_demotions(), 1);
+            ASSERT_EQ(partition_->get_num_promotions(), 1);
+            ASSERT_EQ(partition_->get_num_migrated_bytes(), 12000000);
+
+            XBT_INFO("Reading 1MB from the 8MB file now takes 0.1s");
+            ASSERT_NO_THROW(file = fs_->open("/dev/tiered/hot.txt", "r"));
+            ASSERT_NO_THROW(file->read("1MB"));
+            ASSERT_NO_THROW(file->close());
+            ASSERT_DOUBLE_EQ(sg4::Engine::get_clock(), 20.1);
+        });
+        // Run the simulation
+        ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
+    });
+}
+
+TEST_F(TieredPartitionTest, ThrottledMigration)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform();
+        ASSERT_NO_THROW(fs_->create_file("/dev/tiered/small.txt", "2MB"));
+        ASSERT_NO_THROW(fs_->create_file("/dev/tiered/large.txt", "20MB"));
+        partition_->set_migration_rate(500000);
+        host_->add_actor("TestActor", [this]() {
+            XBT_INFO("Migrating the 20MB file to the fast tier should fail");
+            ASSERT_THROW(partition_->migrate_file("/dev/tiered/large.txt", sgfs::PartitionTiered::Tier::FAST),
+                         sgfs::NotEnoughSpaceException);
+            XBT_INFO("Migrating the 2MB file to its current tier does nothing");
+            ASSERT_NO_THROW(partition_->migrate_file("/dev/tiered/small.txt", sgfs::PartitionTiered::Tier::FAST));
+            ASSERT_DOUBLE_EQ(sg4::Engine::get_clock(), 0.0);
+            XBT_INFO("Demote the 2MB file at 500kB/s: 4 chunks that take 0.05s + 0.5s each, started every second");
+            ASSERT_NO_THROW(partition_->migrate_file("/dev/tiered/small.txt",
+                                                     sgfs::PartitionTiered::Tier::CAPACITY));
+            ASSERT_DOUBLE_EQ(sg4::Engine::get_clock(), 3.55);
+            ASSERT_EQ(partition_->get_file_tier("/dev/tiered/small.txt"), sgfs::PartitionTiered::Tier::CAPACITY);
+            ASSERT_EQ(partition_->get_num_demotions(), 1);
+            ASSERT_EQ(partition_->get_num_migrated_bytes(), 2000000);
+        });
+        // Run the simulation
+        ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
+    });
+}
+
+TEST_F(TieredPartitionTest, DeletionDuringMigration)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform();
+        ASSERT_NO_THROW(fs_->create_file("/dev/tiered/small.txt", "2MB"));
+        partition_->set_migration_rate(500000);
+        host_->add_actor("DeletionActor", [this]() {
+            sg4::this_actor::sleep_for(1.2);
+            XBT_INFO("Replace the file being migrated by a new one at the same path");
+            ASSERT_NO_THROW(fs_->unlink_file("/dev/tiered/small.txt"));
+            ASSERT_NO_THROW(fs_->create_file("/dev/tiered/small.txt", "1MB"));
+        });
+        host_->add_actor("TestActor", [this]() {
+            XBT_INFO("Demote the 2MB file at 500kB/s, which is abandoned after the second chunk is written");
+            ASSERT_NO_THROW(partition_->migrate_file("/dev/tiered/small.txt",
+                                                     sgfs::PartitionTiered::Tier::CAPACITY));
+            ASSERT_DOUBLE_EQ(sg4::Engine::get_clock(), 1.55);
+            ASSERT_EQ(partition_->get_num_demotions(), 0);
+            ASSERT_EQ(partition_->get_num_migrated_bytes(), 500000);
+            XBT_INFO("The new file stays on the fast tier");
+            ASSERT_EQ(partition_->get_file_tier("/dev/tiered/small.txt"), sgfs::PartitionTiered::Tier::FAST);
+        });
+        // Run the simulation
+        ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
+    });
+}
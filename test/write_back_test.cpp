@@ -0,0 +1,201 @@
+/* Copyright (c) 2024-2026. The FSMOD Team. All rights reserved.          */
+
+/* This program is free software; you can redistribute it and/or modify it
+ * under the terms of the license (GNU LGPL) which comes with this package. */
+
+#include <gtest/gtest.h>
+#include <iostream>
+
+#include <simgrid/s4u/Actor.hpp>
+#include <simgrid/s4u/Engine.hpp>
+
+#include "fsmod/FileSystem.hpp"
+#include "fsmod/OneDiskStorage.hpp"
+#include "fsmod/EvictionPolicy.hpp"
+#include "fsmod/FileSystemException.hpp"
+
+#include "./test_util.hpp"
+
+namespace sgfs=simgrid::fsmod;
+namespace sg4=simgrid::s4u;
+
+XBT_LOG_NEW_DEFAULT_CATEGORY(write_back_test, "Write-Back Test");
+
+class WriteBackTest : public ::testing::Test {
+public:
+    std::shared_ptr<sgfs::FileSystem> cache_fs_;
+    std::shared_ptr<sgfs::FileSystem> backing_fs_;
+    std::shared_ptr<sgfs::Partition> cache_;
+    std::shared_ptr<sgfs::Partition> backing_;
+    sg4::Host * host_;
+
+    WriteBackTest() = default;
+
+    void setup_platform() {
+        XBT_INFO("Creating a platform with one host, a 100MBps cache disk, and a 10MBps backing disk...");
+        auto *my_zone = sg4::Engine::get_instance()->get_netzone_root()->add_netzone_full("zone");
+        host_ = my_zone->add_host("my_host", "100Gf");
+        auto* cache_disk = host_->add_disk("cache_disk", "100MBps", "100MBps");
+        auto* backing_disk = host_->add_disk("backing_disk", "10MBps", "10MBps");
+        my_zone->seal();
+
+        XBT_INFO("Creating a file system with a 100MB LRU partition, backed by another file system...");
+        cache_fs_ = sgfs::FileSystem::create("cache_fs");
+        cache_fs_->mount_partition("/cache/", sgfs::OneDiskStorage::create("cache_storage", cache_disk), "100MB",
+                                   std::make_shared<sgfs::LRUEvictionPolicy>());
+        cache_ = cache_fs_->partition_by_name("/cache");
+        backing_fs_ = sgfs::FileSystem::create("backing_fs");
+        backing_fs_->mount_partition("/pfs/", sgfs::OneDiskStorage::create("backing_storage", backing_disk), "1TB");
+        backing_ = backing_fs_->partition_by_name("/pfs");
+    }
+
+    void write_file(const std::string& path, const std::string& num_bytes) {
+        auto file = cache_fs_->open(path, "w");
+        file->write(num_bytes);
+        file->close();
+    }
+
+    void run_write_back_scenario(bool asynchronous);
+};
+
+TEST_F(WriteBackTest, BadArguments)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform();
+        XBT_INFO("Configure write-backs with invalid arguments, which should fail");
+        ASSERT_THROW(backing_->set_write_back(cache_fs_, "/cache/"), std::invalid_argument);
+        ASSERT_THROW(cache_->set_write_back(nullptr, "/pfs/"), std::invalid_argument);
+        ASSERT_THROW(cache_->set_write_back(backing_fs_, "/nowhere/"), std::invalid_argument);
+        ASSERT_THROW(cache_->set_write_back(cache_fs_, "/cache/out/"), std::invalid_argument);
+        XBT_INFO("Configure a valid write-back");
+        ASSERT_NO_THROW(cache_->set_write_back(backing_fs_, "/pfs/out/", true));
+        ASSERT_EQ(cache_->get_backing_file_system(), backing_fs_);
+        ASSERT_EQ(cache_->get_backing_path(), "/pfs/out");
+        ASSERT_TRUE(cache_->is_write_back_asynchronous());
+    });
+}
+
+TEST_F(WriteBackTest, OnlyDirtyFilesAreWrittenBack)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform();
+        cache_->set_write_back(backing_fs_, "/pfs/out/");
+        host_->add_actor("TestActor", [this]() {
+            XBT_INFO("Create a clean 40MB file, and write a dirty 40MB file, in 0.4s");
+            ASSERT_NO_THROW(cache_fs_->create_file("/cache/clean.txt", "40MB"));
+            ASSERT_NO_THROW(write_file("/cache/dirty.txt", "40MB"));
+            ASSERT_DOUBLE_EQ(sg4::Engine::get_clock(), 0.4);
+            XBT_INFO("Create a 50MB file, which evicts the clean file right away");
+            ASSERT_NO_THROW(cache_fs_->create_file("/cache/foo.txt", "50MB"));
+            ASSERT_DOUBLE_EQ(sg4::Engine::get_clock(), 0.4);
+            ASSERT_FALSE(cache_fs_->file_exists("/cache/clean.txt"));
+            ASSERT_FALSE(backing_fs_->file_exists("/pfs/out/clean.txt"));
+            XBT_INFO("Create a 40MB file, which evicts the dirty file once it is read in 0.4s and written back in 4s");
+            ASSERT_NO_THROW(cache_fs_->create_file("/cache/bar.txt", "40MB"));
+            ASSERT_NEAR(sg4::Engine::get_clock(), 4.8, 1e-6);
+            ASSERT_FALSE(cache_fs_->file_exists("/cache/dirty.txt"));
+            ASSERT_TRUE(backing_fs_->file_exists("/pfs/out/dirty.txt"));
+            ASSERT_EQ(backing_fs_->file_size("/pfs/out/dirty.txt"), 40000000);
+            ASSERT_EQ(cache_->get_num_write_backs(), 1);
+            ASSERT_EQ(cache_->get_num_written_back_bytes(), 40000000);
+            ASSERT_EQ(cache_->get_num_foreground_evictions(), 2);
+        });
+        // Run the simulation
+        ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
+    });
+}
+
+void WriteBackTest::run_write_back_scenario(bool asynchronous) {
+    this->setup_platform();
+    cache_->set_write_back(backing_fs_, "/pfs/out/", asynchronous);
+    backing_->set_directory_lock_hold_time(1);
+    host_->add_actor("TestActor", [this, asynchronous]() {
+        XBT_INFO("Write two dirty 30MB files in different directories, in 0.6s");
+        ASSERT_NO_THROW(write_file("/cache/a/foo.txt", "30MB"));
+        ASSERT_NO_THROW(write_file("/cache/b/foo.txt", "30MB"));
+        ASSERT_DOUBLE_EQ(sg4::Engine::get_clock(), 0.6);
+        XBT_INFO("Create an 80MB file, which evicts both files once they are written back");
+        ASSERT_NO_THROW(cache_fs_->create_file("/cache/bar.txt", "80MB"));
+        if (asynchronous) {
+            XBT_INFO("Both files were read in 0.6s, created in 1s, and written in 6s at the same time");
+            ASSERT_NEAR(sg4::Engine::get_clock(), 0.6 + 7.6, 1e-6);
+        } else {
+            XBT_INFO("Each file was read in 0.3s, created in 1s, and written in 3s, one after the other");
+            ASSERT_NEAR(sg4::Engine::get_clock(), 0.6 + 8.6, 1e-6);
+        }
+        ASSERT_TRUE(backing_fs_->file_exists("/pfs/out/a/foo.txt"));
+        ASSERT_TRUE(backing_fs_->file_exists("/pfs/out/b/foo.txt"));
+        ASSERT_FALSE(cache_fs_->file_exists("/cache/a/foo.txt"));
+        ASSERT_FALSE(cache_fs_->file_exists("/cache/b/foo.txt"));
+        ASSERT_EQ(cache_->get_num_write_backs(), 2);
+        ASSERT_EQ(cache_->get_num_foreground_evictions(), 2);
+    });
+    // Run the simulation
+    ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
+}
+
+TEST_F(WriteBackTest, BlockingWriteBack)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->run_write_back_scenario(false);
+    });
+}
+
+TEST_F(WriteBackTest, AsynchronousWriteBack)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->run_write_back_scenario(true);
+    });
+}
+
+TEST_F(WriteBackTest, BackgroundWriteBack)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform();
+        cache_->set_write_back(backing_fs_, "/pfs/out/");
+        cache_->set_eviction_watermarks(0.8, 0.5);
+        host_->add_actor("TestActor", [this]() {
+            XBT_INFO("Write a dirty 50MB file in 0.5s, and create a 40MB file, which starts the background eviction");
+            ASSERT_NO_THROW(write_file("/cache/dirty.txt", "50MB"));
+            ASSERT_NO_THROW(cache_fs_->create_file("/cache/foo.txt", "40MB"));
+            ASSERT_DOUBLE_EQ(sg4::Engine::get_clock(), 0.5);
+            XBT_INFO("The dirty file is still cached while it is written back");
+            ASSERT_NO_THROW(sg4::this_actor::sleep_until(5));
+            ASSERT_TRUE(cache_fs_->file_exists("/cache/dirty.txt"));
+            XBT_INFO("The dirty file was evicted once read in 0.5s and written back in 5s");
+            ASSERT_NO_THROW(sg4::this_actor::sleep_until(6.5));
+            ASSERT_FALSE(cache_fs_->file_exists("/cache/dirty.txt"));
+            ASSERT_TRUE(backing_fs_->file_exists("/pfs/out/dirty.txt"));
+            ASSERT_TRUE(cache_fs_->file_exists("/cache/foo.txt"));
+            ASSERT_EQ(cache_->get_num_background_evictions(), 1);
+            ASSERT_EQ(cache_->get_num_foreground_evictions(), 0);
+        });
+        // Run the simulation
+        ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
+    });
+}
+
+TEST_F(WriteBackTest, KilledWriteBack)  {
+    DO_TEST_WITH_FORK([this]() {
+        this->setup_platform();
+        cache_->set_write_back(backing_fs_, "/pfs/out/", true);
+        host_->add_actor("TestActor", [this]() {
+            XBT_INFO("Write a dirty 60MB file in 0.6s");
+            ASSERT_NO_THROW(write_file("/cache/dirty.txt", "60MB"));
+            XBT_INFO("Kill the write-back of the dirty file while it is read");
+            host_->add_actor("Killer", []() {
+                sg4::this_actor::sleep_until(1);
+                for (const auto& actor : sg4::Engine::get_instance()->get_all_actors())
+                    if (actor->get_name() == "/cache_write_back")
+                        actor->kill();
+            });
+            XBT_INFO("Create an 80MB file, which fails as the dirty file was not evicted");
+            ASSERT_THROW(cache_fs_->create_file("/cache/foo.txt", "80MB"), sgfs::NotEnoughSpaceException);
+            ASSERT_DOUBLE_EQ(sg4::Engine::get_clock(), 1);
+            ASSERT_TRUE(cache_fs_->file_exists("/cache/dirty.txt"));
+            XBT_INFO("Try again, which succeeds once the dirty file, which is unpinned, is read in 0.6s and written back "
+                     "in 6s");
+            ASSERT_NO_THROW(cache_fs_->create_file("/cache/foo.txt", "80MB"));
+            ASSERT_NEAR(sg4::Engine::get_clock(), 7.6, 1e-6);
+            ASSERT_FALSE(cache_fs_->file_exists("/cache/dirty.txt"));
+            ASSERT_EQ(cache_->get_num_write_backs(), 1);
+        });
+        // Run the simulation
+        ASSERT_NO_THROW(sg4::Engine::get_instance()->run());
+    });
+}